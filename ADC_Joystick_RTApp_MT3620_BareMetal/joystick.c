@@ -3,6 +3,8 @@
 
 #include <stddef.h>
 
+#include "lib/NVIC.h"
+
 #include "joystick.h"
 
 #define JOYSTICK_HANDLE_MAX 4
@@ -10,6 +12,24 @@
 #define JOYSTICK_DEADZONE_MAX 2950
 #define JOYSTICK_DEADZONE_MIN 820
 
+//Filtered values carry this many fractional bits, and each new conversion moves them
+//1/(2^JOYSTICK_FILTER_SHIFT) of the way, so noise is averaged over about 8 conversions
+#define JOYSTICK_FILTER_FRACT 4
+#define JOYSTICK_FILTER_SHIFT 3
+//Scale factors are in Q16
+#define JOYSTICK_SCALE_SHIFT  16
+#define JOYSTICK_INDEX_NONE   UINT32_MAX
+
+typedef struct {
+    //Position of the channel in the ADC data
+    uint32_t index;
+    //Low pass filtered value, with JOYSTICK_FILTER_FRACT fractional bits
+    int32_t  filtered;
+    //Percent per raw unit each side of the center, in Q16
+    int32_t  scaleHigh;
+    int32_t  scaleLow;
+} Joystick_Axis;
+
 struct Joystick {
     ADC_Data* data;
     uint32_t  numChannels;
@@ -23,6 +43,14 @@ struct Joystick {
     int32_t   yMin;
     uint8_t   yDir;
     uint8_t   xDir;
+
+    bool                  primed;
+    Joystick_Axis         x;
+    Joystick_Axis         y;
+
+    Joystick_MoveCallback moveCallback;
+    int32_t               threshold;
+    Joystick_XY           reported;
 };
 
 static Joystick Joystick_Handles[JOYSTICK_HANDLE_MAX] = {0};
@@ -41,10 +69,13 @@ Joystick *Joystick_Open(ADC_Data *data, uint32_t numChannels, uint16_t channelX,
         return NULL;
     }
 
+    *handle = (Joystick){0};
     handle->data = data;
     handle->numChannels = numChannels;
     handle->channelX = channelX;
     handle->channelY = channelY;
+    handle->x.index = JOYSTICK_INDEX_NONE;
+    handle->y.index = JOYSTICK_INDEX_NONE;
 
     return handle;
 }
@@ -54,22 +85,148 @@ void Joystick_Close(Joystick *handle)
     handle->data = NULL;
 }
 
-Joystick_XY Joystick_GetRawXY(const Joystick *handle)
+//Finds the channel in the ADC data the first time, or if it has moved since
+static bool Joystick__FindChannel(Joystick_Axis *axis, const ADC_Data *data,
+                                  uint32_t count, uint16_t channel)
 {
-    Joystick_XY joystick_data = { 0 };
+    if ((axis->index < count) && (data[axis->index].channel == channel)) {
+        return true;
+    }
 
-    for (int i = 0; i < handle->numChannels; i++) {
-        if (handle->data[i].channel == handle->channelX) {
-            joystick_data.x = handle->data[i].value;
-        }
-        else if (handle->data[i].channel == handle->channelY) {
-            joystick_data.y = handle->data[i].value;
+    for (uint32_t i = 0; i < count; i++) {
+        if (data[i].channel == channel) {
+            axis->index = i;
+            return true;
         }
     }
+    return false;
+}
+
+static void Joystick__Filter(Joystick_Axis *axis, uint32_t value, bool prime)
+{
+    int32_t sample = ((int32_t)value << JOYSTICK_FILTER_FRACT);
+    if (prime) {
+        axis->filtered = sample;
+    } else {
+        axis->filtered += ((sample - axis->filtered) >> JOYSTICK_FILTER_SHIFT);
+    }
+}
+
+static int32_t Joystick__Scale(const Joystick_Axis *axis, int32_t raw, int32_t center)
+{
+    int32_t offset = (raw - center);
+    int32_t scale  = (offset >= 0 ? axis->scaleHigh : axis->scaleLow);
+    int32_t pos    = (int32_t)(((int64_t)offset * scale) >> JOYSTICK_SCALE_SHIFT);
+
+    //Clip joystick values if they exceeed 100/-100 due to inaccuracy
+    if (pos > 100) {
+        pos = 100;
+    } else if (pos < -100) {
+        pos = -100;
+    }
+    return pos;
+}
+
+static int32_t Joystick__Reciprocal(int32_t range)
+{
+    return (range == 0 ? 0 : ((100 << JOYSTICK_SCALE_SHIFT) / range));
+}
+
+//Works out the scale factors each side of the center from the calibration so far. The
+//side towards the maximum is scaled by its range and the other side by the minimum's.
+static void Joystick__UpdateScale(Joystick *handle)
+{
+    if (handle->xDir == 1) {
+        handle->x.scaleHigh = Joystick__Reciprocal(handle->xMax - handle->centerPosX);
+        handle->x.scaleLow  = Joystick__Reciprocal(handle->centerPosX - handle->xMin);
+    } else {
+        handle->x.scaleHigh = Joystick__Reciprocal(handle->centerPosX - handle->xMin);
+        handle->x.scaleLow  = Joystick__Reciprocal(handle->xMax - handle->centerPosX);
+    }
+
+    if (handle->yDir == 1) {
+        handle->y.scaleHigh = Joystick__Reciprocal(handle->yMax - handle->centerPosY);
+        handle->y.scaleLow  = Joystick__Reciprocal(handle->centerPosY - handle->yMin);
+    } else {
+        handle->y.scaleHigh = Joystick__Reciprocal(handle->centerPosY - handle->yMin);
+        handle->y.scaleLow  = Joystick__Reciprocal(handle->yMax - handle->centerPosY);
+    }
+}
+
+static Joystick_XY Joystick__Position(const Joystick *handle, Joystick_XY raw)
+{
+    Joystick_XY pos;
+    pos.x = Joystick__Scale(&handle->x, raw.x, handle->centerPosX);
+    pos.y = Joystick__Scale(&handle->y, raw.y, handle->centerPosY);
+    return pos;
+}
+
+static int32_t Joystick__Abs(int32_t value)
+{
+    return (value < 0 ? -value : value);
+}
+
+void Joystick_Update(Joystick *handle, int32_t count)
+{
+    if (!handle || !handle->data || (count <= 0)) {
+        return;
+    }
+
+    //Channels swap around during calibration, so are looked up by their current roles
+    if (!Joystick__FindChannel(&handle->x, handle->data, count, handle->channelX)
+        || !Joystick__FindChannel(&handle->y, handle->data, count, handle->channelY)) {
+        return;
+    }
+
+    Joystick__Filter(&handle->x, handle->data[handle->x.index].value, !handle->primed);
+    Joystick__Filter(&handle->y, handle->data[handle->y.index].value, !handle->primed);
+    handle->primed = true;
+
+    if (!handle->moveCallback) {
+        return;
+    }
+
+    Joystick_XY raw = {
+        .x = (handle->x.filtered >> JOYSTICK_FILTER_FRACT),
+        .y = (handle->y.filtered >> JOYSTICK_FILTER_FRACT),
+    };
+    Joystick_XY pos = Joystick__Position(handle, raw);
+
+    if ((Joystick__Abs(pos.x - handle->reported.x) > handle->threshold)
+        || (Joystick__Abs(pos.y - handle->reported.y) > handle->threshold)) {
+        handle->reported = pos;
+        handle->moveCallback(handle, pos);
+    }
+}
+
+void Joystick_SetMoveCallback(Joystick *handle, int32_t threshold, Joystick_MoveCallback callback)
+{
+    if (!handle) {
+        return;
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    handle->threshold    = threshold;
+    handle->moveCallback = callback;
+    //The first update after this always reports, wherever the joystick is
+    handle->reported.x   = INT32_MIN / 2;
+    handle->reported.y   = INT32_MIN / 2;
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+Joystick_XY Joystick_GetRawXY(const Joystick *handle)
+{
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    Joystick_XY joystick_data = {
+        .x = (handle->x.filtered >> JOYSTICK_FILTER_FRACT),
+        .y = (handle->y.filtered >> JOYSTICK_FILTER_FRACT),
+    };
+    NVIC_RestoreIRQs(prevBasePri);
+
     return joystick_data;
 }
 
-int32_t Joystick_Calibrate(Joystick *handle, uint8_t direction)
+static int32_t Joystick__Calibrate(Joystick *handle, uint8_t direction)
 {
     switch (direction) {
     case JOYSTICK_CENTER:
@@ -89,10 +246,19 @@ int32_t Joystick_Calibrate(Joystick *handle, uint8_t direction)
             handle->yMax = value.y;
         }
         else if (value.x >= JOYSTICK_DEADZONE_MAX || value.x <= JOYSTICK_DEADZONE_MIN) {
+            uint32_t prevBasePri = NVIC_BlockIRQs();
             uint16_t channelY_buff = handle->channelY;
             handle->channelY = handle->channelX;
             handle->channelX = channelY_buff;
+            Joystick_Axis axis_buff = handle->y;
+            handle->y = handle->x;
+            handle->x = axis_buff;
+            NVIC_RestoreIRQs(prevBasePri);
             handle->yMax = value.x;
+            //The center was measured with the channels the other way round
+            int32_t centerPos_buff = handle->centerPosY;
+            handle->centerPosY = handle->centerPosX;
+            handle->centerPosX = centerPos_buff;
         }
 
         if (handle->yMax >= JOYSTICK_DEADZONE_MAX) {
@@ -140,37 +306,16 @@ int32_t Joystick_Calibrate(Joystick *handle, uint8_t direction)
     }
 }
 
-Joystick_XY Joystick_GetXY(const Joystick *handle)
+int32_t Joystick_Calibrate(Joystick *handle, uint8_t direction)
 {
-    Joystick_XY raw = Joystick_GetRawXY(handle);
-    Joystick_XY pos;
-
-    pos.x = ((raw.x - handle->centerPosX) * 100);
-    if (raw.x >= handle->centerPosX && handle->xDir == 1) {
-        pos.x /= (int32_t)(handle->xMax - handle->centerPosX);
-    } else {
-        pos.x /= (int32_t)(handle->centerPosX - handle->xMin);
-    }
-
-    pos.y = ((raw.y - handle->centerPosY) * 100);
-    if (raw.y >= handle->centerPosY && handle->yDir == 1) {
-        pos.y /= (int32_t)(handle->yMax - handle->centerPosY);
-    } else {
-        pos.y /= (int32_t)(handle->centerPosY - handle->yMin);
-    }
-
-    //Clip joystick values if they exceeed 100/-100 due to inaccuracy
-    if (pos.y > 100) {
-        pos.y = 100;
-    } else if (pos.y < -100) {
-        pos.y = -100;
-    }
-    if (pos.x > 100) {
-        pos.x = 100;
-    }
-    else if (pos.x < -100) {
-        pos.x = -100;
+    int32_t status = Joystick__Calibrate(handle, direction);
+    if (status == ERROR_NONE) {
+        Joystick__UpdateScale(handle);
     }
+    return status;
+}
 
-    return pos;
+Joystick_XY Joystick_GetXY(const Joystick *handle)
+{
+    return Joystick__Position(handle, Joystick_GetRawXY(handle));
 }
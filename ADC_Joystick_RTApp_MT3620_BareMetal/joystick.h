@@ -41,6 +41,10 @@ typedef struct {
 	int32_t y;
 } Joystick_XY;
 
+/// <summary>Called from Joystick_Update, so in interrupt context, when the calibrated position
+/// has moved beyond the hysteresis threshold from the last position reported.</summary>
+typedef void (*Joystick_MoveCallback)(Joystick *handle, Joystick_XY position);
+
 /// <summary>
 /// <para>This function opens and initializes a Joystick struct then returns a pointer to it.</para>
 /// </summary>
@@ -58,7 +62,26 @@ Joystick *Joystick_Open(ADC_Data *data, uint32_t numChannels, uint16_t channelX,
 void Joystick_Close(Joystick *handle);
 
 /// <summary>
-/// <para>This function returns the uncalibrated values of the joystick's V_x and V_y.</para>
+/// <para>This function takes a new set of ADC conversions and applies a low pass filter to
+/// the joystick's V_x and V_y, to be called from the ADC callback. The channels' positions
+/// in the data are found on the first call and only checked after that. If a move callback
+/// is set, it's called once the calibrated position moves far enough.</para>
+/// </summary>
+/// <param name="handle">The memory address of the joystick to update.</param>
+/// <param name="count">The number of ADC_Data entries which have been filled.</param>
+void Joystick_Update(Joystick *handle, int32_t count);
+
+/// <summary>
+/// <para>This function sets a callback for when the calibrated position moves, so the
+/// joystick needn't be polled. It should be set once calibration is finished.</para>
+/// </summary>
+/// <param name="handle">The memory address of the joystick.</param>
+/// <param name="threshold">The change in percent on either axis needed to call back again.</param>
+/// <param name="callback">The callback, or NULL to stop calling back.</param>
+void Joystick_SetMoveCallback(Joystick *handle, int32_t threshold, Joystick_MoveCallback callback);
+
+/// <summary>
+/// <para>This function returns the uncalibrated, filtered values of the joystick's V_x and V_y.</para>
 /// </summary>
 /// <param name="handle">The memory address of the joystick to return raw data for.</param>
 /// <returns>The raw joystick V_x and V_y values.</returns>
@@ -75,7 +98,8 @@ int32_t Joystick_Calibrate(Joystick *handle, uint8_t direction);
 
 /// <summary>
 /// <para>This function returns calibrated values for V_x and V_y as a positive/negative percentage
-/// relative to the center position and min/max values.</para>
+/// relative to the center position and min/max values, using scale factors worked out
+/// at calibration so no division is needed.</para>
 /// </summary>
 /// <param name="handle">The memory address of the joystick to get data for.</param>
 /// <returns>The calibrated V_x and V_y values.</returns>
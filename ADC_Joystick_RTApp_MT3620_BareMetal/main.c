@@ -10,23 +10,23 @@
 #include "lib/VectorTable.h"
 #include "lib/NVIC.h"
 #include "lib/GPIO.h"
-#include "lib/GPT.h"
 #include "lib/UART.h"
 #include "lib/Print.h"
 #include "lib/ADC.h"
 
 #include "joystick.h"
+#include "EventQueue.h"
+#include "Input.h"
+#include "Placement.h"
 
 
 static UART *debug = NULL;
-static GPT  *buttonTimeout = NULL;
 
 // ADC global variables
 #define ADC_DATA_SIZE 4
 #define ADC_CHANNELS 2
-static __attribute__((section(".sysram"))) uint32_t rawData[ADC_DATA_SIZE];
+static SYSRAM_DATA uint32_t rawData[ADC_DATA_SIZE];
 static ADC_Data data[ADC_DATA_SIZE];
-static int32_t adcStatus;
 
 // Joystick variables
 #define JOYSTICK_CHANNEL_X 0
@@ -40,9 +40,18 @@ static int32_t     joystickStatus = ERROR;
 int32_t stateFsm = 0;
 #define DATA_PHASE 5
 
+// Once calibrated, the position is printed whenever it moves by more than this
+// many percent.
+#define JOYSTICK_HYSTERESIS 5
+
+// Each move is passed to the main loop with the position it moved to, and
+// each button press in the order they happened.
+EVENT_QUEUE_DEFINE(joystickEvents, Joystick_XY, 4);
+EVENT_QUEUE_DEFINE(buttonEvents, Input_Event, 4);
+
 static void AdcCallback(int32_t status)
 {
-    adcStatus = status;
+    Joystick_Update(joystick, status);
 }
 
 static inline void joystickErrCheck(void)
@@ -58,98 +67,51 @@ static inline void joystickErrCheck(void)
 }
 
 static const uint32_t buttonAGpio = 12;
-static const int buttonPressCheckPeriodMs = 10;
-static void HandleButtonTimerIrq(GPT *);
-static void HandleButtonTimerIrqDeferred();
-
-typedef struct CallbackNode {
-    bool enqueued;
-    struct CallbackNode* next;
-    void (*cb)(void);
-} CallbackNode;
+static void HandleButtonDeferred(void *payload);
 
-static void EnqueueCallback(CallbackNode *node);
-
-static void HandleButtonTimerIrq(GPT *handle)
+static void HandleButtonDeferred(void *payload)
 {
-    (void)handle;
-    static CallbackNode cbn = { .enqueued = false,
-                                .cb       = HandleButtonTimerIrqDeferred };
-    EnqueueCallback(&cbn);
-}
-
-static void HandleButtonTimerIrqDeferred()
-{
-    // Assume initial state is high, i.e. button not pressed.
-    static bool prevState = true;
-    bool newState;
-    GPIO_Read(buttonAGpio, &newState);
-
-    if (newState != prevState) {
-        bool pressed = !newState;
-        if (pressed) {
-            switch (stateFsm) {
-                case JOYSTICK_CENTER:
-                    joystickStatus = Joystick_Calibrate(joystick, JOYSTICK_CENTER);
-                    joystickErrCheck();
-                    break;
-                case JOYSTICK_Y_MAX:
-                    joystickStatus = Joystick_Calibrate(joystick, JOYSTICK_Y_MAX);
-                    joystickErrCheck();
-                    break;
-                case JOYSTICK_Y_MIN:
-                    joystickStatus = Joystick_Calibrate(joystick, JOYSTICK_Y_MIN);
-                    joystickErrCheck();
-                    break;
-                case JOYSTICK_X_MAX:
-                    joystickStatus = Joystick_Calibrate(joystick, JOYSTICK_X_MAX);
-                    joystickErrCheck();
-                    break;
-                case JOYSTICK_X_MIN:
-                    joystickStatus = Joystick_Calibrate(joystick, JOYSTICK_X_MIN);
-                    joystickErrCheck();
-                    break;
-                case DATA_PHASE:
-                    joystickValue = Joystick_GetXY(joystick);
-                    UART_Printf(debug, "Joystick V_x = %li%% Joystick V_y = %li%%\r\n", joystickValue.x, joystickValue.y);
-                    break;
-            }
+    const Input_Event *event = payload;
+    if (event->pressed) {
+        switch (stateFsm) {
+            case JOYSTICK_CENTER:
+                joystickStatus = Joystick_Calibrate(joystick, JOYSTICK_CENTER);
+                joystickErrCheck();
+                break;
+            case JOYSTICK_Y_MAX:
+                joystickStatus = Joystick_Calibrate(joystick, JOYSTICK_Y_MAX);
+                joystickErrCheck();
+                break;
+            case JOYSTICK_Y_MIN:
+                joystickStatus = Joystick_Calibrate(joystick, JOYSTICK_Y_MIN);
+                joystickErrCheck();
+                break;
+            case JOYSTICK_X_MAX:
+                joystickStatus = Joystick_Calibrate(joystick, JOYSTICK_X_MAX);
+                joystickErrCheck();
+                break;
+            case JOYSTICK_X_MIN:
+                joystickStatus = Joystick_Calibrate(joystick, JOYSTICK_X_MIN);
+                joystickErrCheck();
+                break;
+            case DATA_PHASE:
+                joystickValue = Joystick_GetXY(joystick);
+                UART_Printf(debug, "Joystick V_x = %li%% Joystick V_y = %li%%\r\n", joystickValue.x, joystickValue.y);
+                break;
         }
-        prevState = newState;
-        adcStatus = 0;
     }
 }
 
-static CallbackNode* volatile callbacks = NULL;
-
-static void EnqueueCallback(CallbackNode* node)
+static void HandleJoystickMove(Joystick *handle, Joystick_XY position)
 {
-    uint32_t prevBasePri = NVIC_BlockIRQs();
-    if (!node->enqueued) {
-        CallbackNode* prevHead = callbacks;
-        node->enqueued = true;
-        callbacks = node;
-        node->next = prevHead;
-    }
-    NVIC_RestoreIRQs(prevBasePri);
+    (void)handle;
+    EventQueue_Post(&joystickEvents, &position);
 }
 
-static void InvokeCallbacks(void)
+static void HandleJoystickMoveDeferred(void *payload)
 {
-    CallbackNode* node;
-    do {
-        uint32_t prevBasePri = NVIC_BlockIRQs();
-        node = callbacks;
-        if (node) {
-            node->enqueued = false;
-            callbacks = node->next;
-        }
-        NVIC_RestoreIRQs(prevBasePri);
-
-        if (node) {
-            (*node->cb)();
-        }
-    } while (node);
+    Joystick_XY *position = payload;
+    UART_Printf(debug, "Joystick moved: V_x = %li%% V_y = %li%%\r\n", position->x, position->y);
 }
 
 static void JoystickCal(int32_t state)
@@ -183,7 +145,7 @@ static void JoystickCal(int32_t state)
     }
     while (joystickStatus != ERROR_NONE) {
         __asm__("wfi");
-        InvokeCallbacks();
+        EventQueue_Dispatch();
     }
     joystickStatus = ERROR;
 }
@@ -198,6 +160,9 @@ _Noreturn void RTCoreMain(void)
     UART_Print(debug, "ADC_RTApp_MT3620_BareMetal\r\n");
     UART_Print(debug, "App built on: " __DATE__ ", " __TIME__ "\r\n");
 
+    EventQueue_Init(&joystickEvents, 0, HandleJoystickMoveDeferred);
+    EventQueue_Init(&buttonEvents, 1, HandleButtonDeferred);
+
     // Initialise ADC driver and joystick
     AdcContext* handle = ADC_Open(MT3620_UNIT_ADC0);
     joystick = Joystick_Open(data, ADC_CHANNELS, JOYSTICK_CHANNEL_X, JOYSTICK_CHANNEL_Y);
@@ -208,17 +173,8 @@ _Noreturn void RTCoreMain(void)
     // Start ADC to run periodically
     ADC_ReadPeriodicAsync(handle, &AdcCallback, ADC_DATA_SIZE, data, rawData, 0x3, 1000, 2500);
 
-    GPIO_ConfigurePinForInput(buttonAGpio);
-
-    // Setup GPT1 to poll joystick data on button press
-    if (!(buttonTimeout = GPT_Open(MT3620_UNIT_GPT1, 1000, GPT_MODE_REPEAT))) {
-        UART_Print(debug, "ERROR: Opening timer\r\n");
-    }
-    int32_t error;
-
-    if ((error = GPT_StartTimeout(buttonTimeout, buttonPressCheckPeriodMs,
-                                  GPT_UNITS_MILLISEC, &HandleButtonTimerIrq)) != ERROR_NONE) {
-        UART_Printf(debug, "ERROR: Starting timer (%ld)\r\n", error);
+    if (!Input_Open(buttonAGpio, INPUT_EDGE_PRESS, &buttonEvents)) {
+        UART_Print(debug, "ERROR: Configuring button interrupt\r\n");
     }
 
     // Calibrate the joystick
@@ -241,11 +197,12 @@ _Noreturn void RTCoreMain(void)
     JoystickCal(stateFsm);
 
     UART_Print(debug,
-        "The joystick is now calibrated, you can now see joystick data by pressing the A button.\r\n");
+        "The joystick is now calibrated, moving it or pressing the A button prints its position.\r\n");
     stateFsm = DATA_PHASE;
+    Joystick_SetMoveCallback(joystick, JOYSTICK_HYSTERESIS, HandleJoystickMove);
 
     for (;;) {
         __asm__("wfi");
-        InvokeCallbacks();
+        EventQueue_Dispatch();
     }
 }
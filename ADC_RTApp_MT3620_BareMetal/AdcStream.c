@@ -0,0 +1,197 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "AdcStream.h"
+#include "lib/NVIC.h"
+#include "Placement.h"
+#include <stddef.h>
+
+// This is the maximum number of streams which can be opened at once.
+#define ADC_STREAM_MAX 1
+
+// Marks channels which aren't part of the stream.
+#define ADC_STREAM_SLOT_NONE 0xFF
+
+struct AdcStream {
+    uint16_t  *buffer;
+    void     (*request)(void);
+    unsigned   channels;
+    uintptr_t  blockFrames;
+    unsigned   blocks;
+    unsigned   decimation;
+
+    // Where each channel goes within a frame, looked up once when opened, and
+    // the channel whose conversion ends each scan.
+    uint8_t    slot[ADC_STREAM_CHANNELS_MAX];
+    unsigned   lastChannel;
+
+    // The interrupt fills the block after the filled ones while the
+    // application holds those from head. The application only changes these
+    // with IRQs blocked.
+    unsigned           head;
+    volatile unsigned  filled;
+    uintptr_t          frame;
+
+    // Running sums of the scans averaged into the next frame.
+    unsigned   scans;
+    uint32_t   sum[ADC_STREAM_CHANNELS_MAX];
+
+    AdcStream_Stats stats;
+};
+
+AdcStream *AdcStream_Open(
+    uint32_t channelMask, uintptr_t blockFrames, unsigned blocks, unsigned decimation,
+    uint16_t *buffer, void (*request)(void))
+{
+    if ((channelMask == 0) || (channelMask >> ADC_STREAM_CHANNELS_MAX)
+        || (blockFrames == 0) || (blocks < 2) || (decimation == 0) || !buffer) {
+        return NULL;
+    }
+
+    static AdcStream Handles[ADC_STREAM_MAX] = {0};
+    AdcStream *stream = NULL;
+    unsigned h;
+    for (h = 0; h < ADC_STREAM_MAX; h++) {
+        if (!Handles[h].buffer) {
+            stream = &Handles[h];
+            break;
+        }
+    }
+    if (!stream) {
+        return NULL;
+    }
+
+    *stream = (AdcStream){0};
+
+    unsigned c;
+    for (c = 0; c < ADC_STREAM_CHANNELS_MAX; c++) {
+        if (channelMask & (1U << c)) {
+            stream->slot[c] = stream->channels++;
+            stream->lastChannel = c;
+        } else {
+            stream->slot[c] = ADC_STREAM_SLOT_NONE;
+        }
+    }
+
+    stream->request     = request;
+    stream->blockFrames = blockFrames;
+    stream->blocks      = blocks;
+    stream->decimation  = decimation;
+    stream->buffer      = buffer;
+    return stream;
+}
+
+void AdcStream_Close(AdcStream *stream)
+{
+    if (!stream) {
+        return;
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    stream->buffer = NULL;
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+TCM_CODE bool AdcStream_Input(AdcStream *stream, const ADC_Data *data, int32_t count)
+{
+    if (!stream || !stream->buffer || (!data && (count > 0))) {
+        return false;
+    }
+
+    uintptr_t blockFrames = stream->blockFrames;
+    unsigned  channels    = stream->channels;
+    bool      ready       = false;
+
+    int32_t i;
+    for (i = 0; i < count; i++) {
+        uint32_t channel = data[i].channel;
+        if ((channel >= ADC_STREAM_CHANNELS_MAX)
+            || (stream->slot[channel] == ADC_STREAM_SLOT_NONE)) {
+            continue;
+        }
+        stream->sum[stream->slot[channel]] += data[i].value;
+
+        // Only finish a frame once each channel has been scanned decimation
+        // times.
+        if ((channel != stream->lastChannel)
+            || (++stream->scans < stream->decimation)) {
+            continue;
+        }
+        stream->scans = 0;
+
+        if (stream->filled >= stream->blocks) {
+            // The application still holds every block, drop the frame.
+            __builtin_memset(stream->sum, 0x00, sizeof(stream->sum));
+            stream->stats.overruns++;
+            continue;
+        }
+
+        unsigned tail = ((stream->head + stream->filled) % stream->blocks);
+        uint16_t *dst = &stream->buffer[(tail * channels * blockFrames) + stream->frame];
+        unsigned c;
+        for (c = 0; c < channels; c++) {
+            dst[c * blockFrames] = (uint16_t)(stream->sum[c] / stream->decimation);
+            stream->sum[c] = 0;
+        }
+
+        if (++stream->frame >= blockFrames) {
+            stream->frame = 0;
+            stream->filled++;
+            stream->stats.blocks++;
+            ready = true;
+        }
+    }
+
+    if (ready && stream->request) {
+        stream->request();
+    }
+    return true;
+}
+
+const uint16_t *AdcStream_Acquire(AdcStream *stream)
+{
+    if (!stream || !stream->buffer || (stream->filled == 0)) {
+        return NULL;
+    }
+    return &stream->buffer[stream->head * stream->channels * stream->blockFrames];
+}
+
+void AdcStream_Release(AdcStream *stream)
+{
+    if (!stream) {
+        return;
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (stream->filled > 0) {
+        stream->head = ((stream->head + 1) % stream->blocks);
+        stream->filled--;
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+unsigned AdcStream_GetChannels(const AdcStream *stream)
+{
+    return (stream ? stream->channels : 0);
+}
+
+uintptr_t AdcStream_GetBlockFrames(const AdcStream *stream)
+{
+    return (stream ? stream->blockFrames : 0);
+}
+
+void AdcStream_GetStats(AdcStream *stream, AdcStream_Stats *stats, bool reset)
+{
+    if (!stream) {
+        return;
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (stats) {
+        *stats = stream->stats;
+    }
+    if (reset) {
+        stream->stats = (AdcStream_Stats){0};
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
@@ -0,0 +1,64 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef ADC_STREAM_H_
+#define ADC_STREAM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lib/ADC.h"
+
+// Collects continuous periodic ADC conversions into a ring of blocks, so the
+// application handles them a block at a time rather than a sample at a time.
+// The ADC callback passes each batch of conversions to AdcStream_Input, which
+// sorts them by channel into the block being filled, calling request as each
+// block completes. The application then takes whole blocks by pointer, e.g.
+// to forward them with a single write, and hands them back when done.
+//
+// Blocks are planar, holding blockFrames samples of the first enabled channel,
+// then of the next and so on, so each channel can be handed on or filtered as
+// a contiguous run. Consecutive frames may be averaged together to lower the
+// output rate, which also reduces noise. Frames arriving while every block is
+// still held are dropped and counted as overruns.
+
+// This is the number of channels on the ADC.
+#define ADC_STREAM_CHANNELS_MAX 8
+
+typedef struct AdcStream AdcStream;
+
+typedef struct {
+    uint32_t blocks;    // Blocks filled.
+    uint32_t overruns;  // Frames dropped for want of a free block.
+} AdcStream_Stats;
+
+// Size in bytes of the buffer needed by AdcStream_Open.
+#define ADC_STREAM_BUFFER_SIZE(channels, blockFrames, blocks) \
+    ((channels) * (blockFrames) * (blocks) * sizeof(uint16_t))
+
+// channelMask is the same as passed to ADC_ReadPeriodicAsync, and each frame
+// of the stream is the average of decimation frames from the ADC. buffer holds
+// ADC_STREAM_BUFFER_SIZE bytes, and blocks must be at least 2. request is
+// called in interrupt context as each block is filled, and may be NULL if the
+// stream is polled.
+AdcStream *AdcStream_Open(
+    uint32_t channelMask, uintptr_t blockFrames, unsigned blocks, unsigned decimation,
+    uint16_t *buffer, void (*request)(void));
+void AdcStream_Close(AdcStream *stream);
+
+// Sorts count conversions from data into the stream, to be called from the ADC
+// callback with the count it was given.
+bool AdcStream_Input(AdcStream *stream, const ADC_Data *data, int32_t count);
+
+// Returns the oldest filled block, or NULL if none is ready. It stays valid
+// until AdcStream_Release hands it back to the stream.
+const uint16_t *AdcStream_Acquire(AdcStream *stream);
+void            AdcStream_Release(AdcStream *stream);
+
+// Number of channels in each frame, and of frames in each block.
+unsigned  AdcStream_GetChannels(const AdcStream *stream);
+uintptr_t AdcStream_GetBlockFrames(const AdcStream *stream);
+
+void AdcStream_GetStats(AdcStream *stream, AdcStream_Stats *stats, bool reset);
+
+#endif // #ifndef ADC_STREAM_H_
@@ -0,0 +1,151 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "AdcTiming.h"
+#include "lib/NVIC.h"
+#include "Log.h"
+#include <stddef.h>
+
+// This is the maximum number of callbacks which can be timed at once.
+#define ADC_TIMING_MAX 1
+
+struct AdcTiming {
+    GPT      *clock;
+    uint32_t  expected;
+    unsigned  binShift;
+    // Start of the first bin, which may be before zero.
+    int64_t   binStart;
+
+    bool      started;
+    uint32_t  last;
+
+    AdcTiming_Stats stats;
+};
+
+static void AdcTiming__Reset(AdcTiming *timing)
+{
+    timing->stats = (AdcTiming_Stats){
+        .min      = UINT32_MAX,
+        .expected = timing->expected,
+        .binWidth = (1U << timing->binShift),
+    };
+}
+
+AdcTiming *AdcTiming_Open(GPT *clock, uint32_t expected, unsigned binShift)
+{
+    if (!clock || (expected == 0) || (binShift >= 31)) {
+        return NULL;
+    }
+
+    static AdcTiming Handles[ADC_TIMING_MAX] = {0};
+    AdcTiming *timing = NULL;
+    unsigned h;
+    for (h = 0; h < ADC_TIMING_MAX; h++) {
+        if (!Handles[h].clock) {
+            timing = &Handles[h];
+            break;
+        }
+    }
+    if (!timing) {
+        return NULL;
+    }
+
+    timing->expected = expected;
+    timing->binShift = binShift;
+    timing->binStart = ((int64_t)expected - ((int64_t)(ADC_TIMING_BINS / 2) << binShift));
+    timing->started  = false;
+    AdcTiming__Reset(timing);
+    timing->clock    = clock;
+    return timing;
+}
+
+void AdcTiming_Close(AdcTiming *timing)
+{
+    if (!timing) {
+        return;
+    }
+    timing->clock = NULL;
+}
+
+void AdcTiming_Stamp(AdcTiming *timing)
+{
+    if (!timing || !timing->clock) {
+        return;
+    }
+
+    uint32_t now = GPT_GetCount(timing->clock);
+    if (!timing->started) {
+        timing->last    = now;
+        timing->started = true;
+        return;
+    }
+
+    // Unsigned subtraction copes with the count wrapping.
+    uint32_t interval = (now - timing->last);
+    timing->last = now;
+
+    AdcTiming_Stats *stats = &timing->stats;
+    stats->count++;
+    stats->total += interval;
+    if (interval < stats->min) {
+        stats->min = interval;
+    }
+    if (interval > stats->max) {
+        stats->max = interval;
+    }
+
+    // Only a late callback needs dividing out into the periods it missed.
+    uint32_t expected = timing->expected;
+    if (interval >= (expected + (expected / 2))) {
+        stats->missed += (((interval + (expected / 2)) / expected) - 1);
+    }
+
+    int64_t offset = ((int64_t)interval - timing->binStart);
+    unsigned bin = 0;
+    if (offset > 0) {
+        int64_t index = (offset >> timing->binShift);
+        bin = (index >= ADC_TIMING_BINS ? (ADC_TIMING_BINS - 1) : (unsigned)index);
+    }
+    stats->histogram[bin]++;
+}
+
+void AdcTiming_GetStats(AdcTiming *timing, AdcTiming_Stats *stats, bool reset)
+{
+    if (!timing) {
+        return;
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (stats) {
+        *stats = timing->stats;
+    }
+    if (reset) {
+        AdcTiming__Reset(timing);
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+void AdcTiming_Print(const AdcTiming_Stats *stats)
+{
+    if (!stats || (stats->count == 0)) {
+        Log_Print("No ADC callbacks timed yet\r\n");
+        return;
+    }
+
+    Log_Printf("ADC callback interval: min %lu, mean %lu, max %lu ticks, %lu missed\r\n",
+        stats->min, (uint32_t)(stats->total / stats->count), stats->max, stats->missed);
+
+    // Bin edges are printed relative to the expected interval.
+    int32_t width = (int32_t)stats->binWidth;
+    unsigned i;
+    for (i = 0; i < ADC_TIMING_BINS; i++) {
+        int32_t start = ((int32_t)(i - (ADC_TIMING_BINS / 2)) * width);
+        if (i == 0) {
+            Log_Printf("        < %+ld: %lu\r\n", (start + width), stats->histogram[i]);
+        } else if (i == (ADC_TIMING_BINS - 1)) {
+            Log_Printf("       >= %+ld: %lu\r\n", start, stats->histogram[i]);
+        } else {
+            Log_Printf("%+ld to %+ld: %lu\r\n", start, (start + width), stats->histogram[i]);
+        }
+    }
+}
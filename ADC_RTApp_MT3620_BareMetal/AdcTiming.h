@@ -0,0 +1,53 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef ADC_TIMING_H_
+#define ADC_TIMING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lib/GPT.h"
+
+// Measures how regularly the ADC callback runs, by stamping each call with the
+// count of a free running timer. The intervals between calls are kept as a
+// histogram around the expected interval, along with their extremes and how
+// many expected calls never happened, so the jitter of sampling under load can
+// be checked against a control loop's timing budget.
+//
+// Stamping only reads the timer and updates a few counters, so it can be done
+// at the start of every callback.
+
+// This is the number of histogram bins.
+#define ADC_TIMING_BINS 16
+
+typedef struct AdcTiming AdcTiming;
+
+// Laid out without padding so it can be sent as it is.
+typedef struct {
+    uint32_t count;    // Intervals measured.
+    uint32_t min, max; // Shortest and longest intervals, in clock ticks.
+    uint32_t missed;   // Expected calls which didn't happen.
+    uint64_t total;    // Sum of all intervals, for the mean.
+
+    // Bin i counts intervals of at least
+    // (expected + ((i - (ADC_TIMING_BINS / 2)) * binWidth)) ticks but less than
+    // binWidth more, the first and last bins including everything further out.
+    uint32_t expected;
+    uint32_t binWidth;
+    uint32_t histogram[ADC_TIMING_BINS];
+} AdcTiming_Stats;
+
+// clock must be free running with a 32-bit count, and expected is the
+// interval between callbacks in its ticks. Bins are (1 << binShift) ticks wide.
+AdcTiming *AdcTiming_Open(GPT *clock, uint32_t expected, unsigned binShift);
+void       AdcTiming_Close(AdcTiming *timing);
+
+// Records a callback, to be called first thing in it.
+void AdcTiming_Stamp(AdcTiming *timing);
+
+void AdcTiming_GetStats(AdcTiming *timing, AdcTiming_Stats *stats, bool reset);
+// Logs the statistics, through the Log module.
+void AdcTiming_Print(const AdcTiming_Stats *stats);
+
+#endif // #ifndef ADC_TIMING_H_
@@ -12,95 +12,245 @@
 #include "lib/GPIO.h"
 #include "lib/GPT.h"
 #include "lib/UART.h"
-#include "lib/Print.h"
 #include "lib/ADC.h"
 
+#include "AdcStream.h"
+#include "AdcTiming.h"
+#include "EventQueue.h"
+#include "Input.h"
+#include "Log.h"
+#include "Placement.h"
+#ifdef ADC_SOCKET
+#include "Socket.h"
+#endif
+
 static UART *debug = NULL;
-static GPT  *buttonTimeout = NULL;
 
 // ADC global variables
 #define ADC_MAX_VAL 0xFFF
-#define ADC_DATA_SIZE 8
-static __attribute__((section(".sysram"))) uint32_t rawData[ADC_DATA_SIZE];
+#define ADC_CHANNEL_MASK 0xF
+#define ADC_CHANNELS 4
+// The channels are scanned every 100us, which is the driver's period argument,
+// and the DMA FIFO holds 16 scans so the callback runs at about 600Hz.
+#define ADC_PERIOD 100
+#define ADC_DATA_SIZE (ADC_CHANNELS * 16)
+static SYSRAM_DATA uint32_t rawData[ADC_DATA_SIZE];
 static ADC_Data data[ADC_DATA_SIZE];
-static int32_t adcStatus;
 
-static void callback(int32_t status)
+// Every 10 scans are averaged into a frame, and blocks of 128 frames are
+// handed to the main loop, leaving it about a second to forward each one.
+#define ADC_DECIMATION   10
+#define ADC_BLOCK_FRAMES 128
+#define ADC_BLOCKS       8
+static uint16_t adcBuffer[ADC_CHANNELS * ADC_BLOCK_FRAMES * ADC_BLOCKS];
+static AdcStream *adcStream = NULL;
+
+// Mean of each channel over the last block.
+static uint32_t adcMean[ADC_CHANNELS] = {0};
+
+// Callbacks are timed in microseconds against a free running GPT3, and are
+// expected once per FIFO's worth of scans.
+#define ADC_CALLBACK_INTERVAL ((ADC_DATA_SIZE / ADC_CHANNELS) * ADC_PERIOD)
+#define ADC_TIMING_BIN_SHIFT  4
+static GPT       *adcClock  = NULL;
+static AdcTiming *adcTiming = NULL;
+
+#ifdef ADC_SOCKET
+// Each block is sent as one message, a header followed by the block as it is.
+// Sending the HLApp's "timing" command gets a message with the same header,
+// but no frames, followed by AdcTiming_Stats.
+typedef enum {
+    ADC_MSG_BLOCK  = 0,
+    ADC_MSG_TIMING = 1,
+} AdcMsgType;
+
+typedef struct __attribute__((__packed__)) {
+    uint32_t sequence;
+    uint8_t  channelMask;
+    uint8_t  type;
+    uint16_t frames;
+} AdcBlockHeader;
+
+// A block and its header must fit in one message.
+#if ((ADC_CHANNELS * ADC_BLOCK_FRAMES * 2) + 8) > SOCKET_MAX_PAYLOAD_LEN
+#error "ADC blocks are too big to send over the socket"
+#endif
+
+static Socket *socket = NULL;
+static uint32_t socketDropped = 0;
+
+static const Component_Id A7ID =
 {
-    adcStatus = status;
-}
+    .seg_0   = 0x25025d2c,
+    .seg_1   = 0x66da,
+    .seg_2   = 0x4448,
+    .seg_3_4 = {0xba, 0xe1, 0xac, 0x26, 0xfc, 0xdd, 0x36, 0x27}
+};
+#endif
 
-static const uint32_t buttonAGpio = 12;
-static const int buttonPressCheckPeriodMs = 10;
-static void HandleButtonTimerIrq(GPT *);
-static void HandleButtonTimerIrqDeferred(void);
+// One pending event covers everything a repeat would have, as each of these
+// handlers deals with all there is to do.
+EVENT_QUEUE_DEFINE_SIGNAL(blockEvents, 1);
+#ifdef ADC_SOCKET
+EVENT_QUEUE_DEFINE_SIGNAL(socketEvents, 1);
+#endif
 
-typedef struct CallbackNode {
-    bool enqueued;
-    struct CallbackNode* next;
-    void (*cb)(void);
-} CallbackNode;
+// Button presses are handled in the order they happened.
+EVENT_QUEUE_DEFINE(buttonEvents, Input_Event, 4);
 
-static void EnqueueCallback(CallbackNode* node);
+static void HandleBlockReady(void);
+static void HandleBlockReadyDeferred(void *payload);
 
-static void HandleButtonTimerIrq(GPT *handle)
+static TCM_CODE void callback(int32_t status)
 {
-    (void)handle;
-    static CallbackNode cbn = { .enqueued = false,.cb = HandleButtonTimerIrqDeferred };
-    EnqueueCallback(&cbn);
+    AdcTiming_Stamp(adcTiming);
+    AdcStream_Input(adcStream, data, status);
 }
 
-static void HandleButtonTimerIrqDeferred(void)
+static const uint32_t buttonAGpio = 12;
+static void HandleButtonDeferred(void *payload);
+
+static void HandleBlockReady(void)
 {
-    // Assume initial state is high, i.e. button not pressed.
-    static bool prevState = true;
-    bool newState;
-    GPIO_Read(buttonAGpio, &newState);
-
-    if (newState != prevState) {
-        bool pressed = !newState;
-        if (pressed) {
-            for (int i = 0; i < adcStatus; i++) {
-                uint32_t mV = (data[i].value * 2500) / ADC_MAX_VAL;
-                UART_Printf(debug, "Channel: %lu", data[i].channel);
-                UART_Printf(debug, ", Data: %lu.%03lu\r\n", (mV / 1000), (mV % 1000));
+    EventQueue_Post(&blockEvents, NULL);
+}
+
+static void HandleBlockReadyDeferred(void *payload)
+{
+    (void)payload;
+
+    static uint32_t sequence = 0;
+
+    const uint16_t *block;
+    while ((block = AdcStream_Acquire(adcStream))) {
+#ifdef ADC_SOCKET
+        if (socket) {
+            AdcBlockHeader header = {
+                .sequence    = sequence,
+                .channelMask = ADC_CHANNEL_MASK,
+                .type        = ADC_MSG_BLOCK,
+                .frames      = ADC_BLOCK_FRAMES,
+            };
+            const Socket_IOVec iov[] = {
+                { .data = &header, .size = sizeof(header) },
+                { .data = block,   .size = (ADC_CHANNELS * ADC_BLOCK_FRAMES * sizeof(uint16_t)) },
+            };
+            // Don't wait for space, the HLApp sees the gap in sequence numbers.
+            if (Socket_WriteV(socket, &A7ID, iov, 2) != ERROR_NONE) {
+                socketDropped++;
+            }
+        }
+#endif
+
+        unsigned c;
+        for (c = 0; c < ADC_CHANNELS; c++) {
+            const uint16_t *samples = &block[c * ADC_BLOCK_FRAMES];
+            uint32_t sum = 0;
+            unsigned i;
+            for (i = 0; i < ADC_BLOCK_FRAMES; i++) {
+                sum += samples[i];
             }
+            adcMean[c] = (sum / ADC_BLOCK_FRAMES);
         }
-        prevState = newState;
-        adcStatus = 0;
+
+        AdcStream_Release(adcStream);
+        sequence++;
     }
 }
 
-static CallbackNode* volatile callbacks = NULL;
-
-static void EnqueueCallback(CallbackNode* node)
+#ifdef ADC_SOCKET
+static void HandleSocketMsgDeferred(void *payload)
 {
-    uint32_t prevBasePri = NVIC_BlockIRQs();
-    if (!node->enqueued) {
-        CallbackNode* prevHead = callbacks;
-        node->enqueued = true;
-        callbacks = node;
-        node->next = prevHead;
+    (void)payload;
+
+    if (Socket_NegotiationPending(socket)) {
+        // NB: this is blocking.
+        if (Socket_Negotiate(socket) != ERROR_NONE) {
+            Log_Print("ERROR: renegotiating socket connection\r\n");
+        }
+    }
+
+    static const char timingCmd[] = "timing";
+
+    // A batch at a time until the ring is empty, as one notification may
+    // cover more messages than fit in a batch.
+    bool timing = false;
+    for (;;) {
+        Socket_Msg msgs[4];
+        uint32_t count = 4;
+        int32_t error = Socket_ReadBatch(socket, msgs, &count);
+        if (error != ERROR_NONE) {
+            // A bad block can't be stepped over, so it's dropped along with
+            // everything after it.
+            if (error != ERROR_SOCKET_EMPTY) {
+                Socket_ReadDiscard(socket);
+            }
+            break;
+        }
+
+        uint32_t i;
+        for (i = 0; i < count; i++) {
+            // Commands are short enough to copy out in case they wrap in the
+            // ring, anything else is discarded.
+            char cmd[sizeof(timingCmd)] = {0};
+            const Socket_Buffer *buffer = &msgs[i].buffer;
+            if ((buffer->size[0] + buffer->size[1]) > sizeof(cmd)) {
+                continue;
+            }
+            __builtin_memcpy(cmd, buffer->seg[0], buffer->size[0]);
+            __builtin_memcpy(&cmd[buffer->size[0]], buffer->seg[1], buffer->size[1]);
+            if (__builtin_memcmp(cmd, timingCmd, (sizeof(timingCmd) - 1)) == 0) {
+                timing = true;
+            }
+        }
+        Socket_ReadRelease(socket);
+    }
+
+    if (timing) {
+        AdcTiming_Stats stats;
+        AdcTiming_GetStats(adcTiming, &stats, false);
+
+        AdcBlockHeader header = {
+            .channelMask = ADC_CHANNEL_MASK,
+            .type        = ADC_MSG_TIMING,
+        };
+        const Socket_IOVec iov[] = {
+            { .data = &header, .size = sizeof(header) },
+            { .data = &stats,  .size = sizeof(stats)  },
+        };
+        if (Socket_WriteV(socket, &A7ID, iov, 2) != ERROR_NONE) {
+            Log_Print("ERROR: sending ADC timing\r\n");
+        }
     }
-    NVIC_RestoreIRQs(prevBasePri);
 }
 
-static void InvokeCallbacks(void)
+static void HandleSocketMsg(Socket *handle)
 {
-    CallbackNode* node;
-    do {
-        uint32_t prevBasePri = NVIC_BlockIRQs();
-        node = callbacks;
-        if (node) {
-            node->enqueued = false;
-            callbacks = node->next;
-        }
-        NVIC_RestoreIRQs(prevBasePri);
+    (void)handle;
+    EventQueue_Post(&socketEvents, NULL);
+}
+#endif
 
-        if (node) {
-            (*node->cb)();
+static void HandleButtonDeferred(void *payload)
+{
+    const Input_Event *event = payload;
+    if (event->pressed) {
+        for (int i = 0; i < ADC_CHANNELS; i++) {
+            uint32_t mV = (adcMean[i] * 2500) / ADC_MAX_VAL;
+            Log_Printf("Channel: %d, Data: %lu.%03lu\r\n", i, (mV / 1000), (mV % 1000));
         }
-    } while (node);
+
+        AdcStream_Stats stats;
+        AdcStream_GetStats(adcStream, &stats, false);
+        Log_Printf("Blocks: %lu, overruns: %lu\r\n", stats.blocks, stats.overruns);
+
+        AdcTiming_Stats timing;
+        AdcTiming_GetStats(adcTiming, &timing, false);
+        AdcTiming_Print(&timing);
+#ifdef ADC_SOCKET
+        Log_Printf("Blocks not sent: %lu\r\n", socketDropped);
+#endif
+    }
 }
 
 _Noreturn void RTCoreMain(void)
@@ -109,34 +259,51 @@ _Noreturn void RTCoreMain(void)
     CPUFreq_Set(26000000);
 
     debug = UART_Open(MT3620_UNIT_UART_DEBUG, 115200, UART_PARITY_NONE, 1, NULL);
-    UART_Print(debug, "--------------------------------\r\n");
-    UART_Print(debug, "ADC_RTApp_MT3620_BareMetal\r\n");
-    UART_Print(debug, "App built on: " __DATE__ ", " __TIME__ "\r\n");
-    UART_Print(debug, "Press A to print ADC pin states.\r\n");
+    Log_Init(debug);
+    Log_Print("--------------------------------\r\n");
+    Log_Print("ADC_RTApp_MT3620_BareMetal\r\n");
+    Log_Print("App built on: " __DATE__ ", " __TIME__ "\r\n");
 
-    //Initialise ADC driver, and then configure it to use channel 0
-    AdcContext *handle = ADC_Open(MT3620_UNIT_ADC0);
-    if (ADC_ReadPeriodicAsync(handle, &callback, ADC_DATA_SIZE, data, rawData,
-        0xF, 1000, 2500) != ERROR_NONE) {
-        UART_Print(debug, "Error: Failed to initialise ADC.\r\n");
+    // Blocks are forwarded before commands are answered or presses handled.
+    EventQueue_Init(&blockEvents, 0, HandleBlockReadyDeferred);
+#ifdef ADC_SOCKET
+    EventQueue_Init(&socketEvents, 1, HandleSocketMsgDeferred);
+#endif
+    EventQueue_Init(&buttonEvents, 2, HandleButtonDeferred);
+    Log_Print("Press A to print ADC pin states.\r\n");
+
+#ifdef ADC_SOCKET
+    // NB: this blocks until the HLApp connects.
+    socket = Socket_Open(HandleSocketMsg);
+    if (!socket) {
+        Log_Print("ERROR: socket initialisation failed\r\n");
+    }
+#endif
+
+    adcClock = GPT_Open(MT3620_UNIT_GPT3, 1000000, GPT_MODE_NONE);
+    if (!adcClock || (GPT_Start_Freerun(adcClock) != ERROR_NONE)) {
+        Log_Print("ERROR: Starting ADC timing clock\r\n");
     }
+    adcTiming = AdcTiming_Open(adcClock, ADC_CALLBACK_INTERVAL, ADC_TIMING_BIN_SHIFT);
 
-    GPIO_ConfigurePinForInput(buttonAGpio);
+    adcStream = AdcStream_Open(ADC_CHANNEL_MASK, ADC_BLOCK_FRAMES, ADC_BLOCKS,
+        ADC_DECIMATION, adcBuffer, HandleBlockReady);
 
-    // Setup GPT1 to poll for button press
-    if (!(buttonTimeout = GPT_Open(MT3620_UNIT_GPT1, 1000, GPT_MODE_REPEAT))) {
-        UART_Print(debug, "ERROR: Opening timer\r\n");
+    //Initialise ADC driver, and then configure it to scan channels 0 to 3
+    AdcContext *handle = ADC_Open(MT3620_UNIT_ADC0);
+    if (ADC_ReadPeriodicAsync(handle, &callback, ADC_DATA_SIZE, data, rawData,
+        ADC_CHANNEL_MASK, ADC_PERIOD, 2500) != ERROR_NONE) {
+        Log_Print("Error: Failed to initialise ADC.\r\n");
     }
-    int32_t error;
 
-    if ((error = GPT_StartTimeout(buttonTimeout, buttonPressCheckPeriodMs,
-                                  GPT_UNITS_MILLISEC, &HandleButtonTimerIrq)) != ERROR_NONE) {
-        UART_Printf(debug, "ERROR: Starting timer (%ld)\r\n", error);
+    if (!Input_Open(buttonAGpio, INPUT_EDGE_PRESS, &buttonEvents)) {
+        Log_Print("ERROR: Configuring button interrupt\r\n");
     }
 
     for (;;) {
         __asm__("wfi");
-        InvokeCallbacks();
+        EventQueue_Dispatch();
+        Log_Drain();
     }
 
 }
@@ -0,0 +1,379 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef DSP_H_
+#define DSP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Fixed point signal processing for the M4 cores, shared by the samples which
+// filter audio or ADC streams. Samples are Q15 in int16_t or Q31 in int32_t,
+// with multichannel data interleaved by frame, and every function may process
+// in place.
+//
+// Everything is inline, so stage, tap and channel counts passed as constants
+// are folded into the caller's loops. The DSP_*_DEFINE macros wrap this up as
+// functions specialised on those counts, e.g.
+//
+//     DSP_BIQUAD_Q15_DEFINE(HighPass, 2, 2)
+//
+// defines HighPass() running a two stage cascade over stereo frames.
+//
+// Inner loops use the M4's DSP extension (SMLAD, QADD16, SSAT) to work on two
+// Q15 samples per instruction, falling back to plain C elsewhere so the same
+// code can be checked on a host.
+
+// Converts a constant in [-1, 1) to Q15 or Q31, saturating at 1.
+#define DSP_Q15(x) ((int16_t)DSP__FIXED(x, 15, 0x7FFF))
+#define DSP_Q31(x) ((int32_t)DSP__FIXED(x, 31, 0x7FFFFFFF))
+
+#define DSP__FIXED(x, bits, max) \
+    (((x) * (double)(1ULL << (bits))) >= (max) ? (int64_t)(max) \
+        : (int64_t)(((x) * (double)(1ULL << (bits))) + ((x) < 0 ? -0.5 : 0.5)))
+#define DSP__PACK2(lo, hi) \
+    ((uint32_t)(uint16_t)(lo) | ((uint32_t)(uint16_t)(hi) << 16))
+
+#define DSP__INLINE static inline __attribute__((always_inline))
+
+
+// Primitives
+
+// Two Q15 multiplies accumulated at once: acc + (x.lo * y.lo) + (x.hi * y.hi).
+DSP__INLINE int32_t DSP_SMLAD(uint32_t x, uint32_t y, int32_t acc)
+{
+#if defined(__ARM_FEATURE_DSP)
+    int32_t r;
+    __asm__ ("smlad %0, %1, %2, %3" : "=r" (r) : "r" (x), "r" (y), "r" (acc));
+    return r;
+#else
+    int32_t lo = ((int32_t)(int16_t)x * (int16_t)y);
+    int32_t hi = ((int32_t)(int16_t)(x >> 16) * (int16_t)(y >> 16));
+    return (int32_t)((uint32_t)acc + (uint32_t)lo + (uint32_t)hi);
+#endif
+}
+
+DSP__INLINE int16_t DSP_SatQ15(int32_t x)
+{
+#if defined(__ARM_FEATURE_DSP)
+    int32_t r;
+    __asm__ ("ssat %0, #16, %1" : "=r" (r) : "r" (x));
+    return (int16_t)r;
+#else
+    return (int16_t)(x > INT16_MAX ? INT16_MAX : (x < INT16_MIN ? INT16_MIN : x));
+#endif
+}
+
+DSP__INLINE int32_t DSP_SatQ31(int64_t x)
+{
+    return (int32_t)(x > INT32_MAX ? INT32_MAX : (x < INT32_MIN ? INT32_MIN : x));
+}
+
+// Saturating add of two pairs of Q15 samples.
+DSP__INLINE uint32_t DSP_QADD16(uint32_t x, uint32_t y)
+{
+#if defined(__ARM_FEATURE_DSP)
+    uint32_t r;
+    __asm__ ("qadd16 %0, %1, %2" : "=r" (r) : "r" (x), "r" (y));
+    return r;
+#else
+    int16_t lo = DSP_SatQ15((int16_t)x + (int16_t)y);
+    int16_t hi = DSP_SatQ15((int16_t)(x >> 16) + (int16_t)(y >> 16));
+    return DSP__PACK2(lo, hi);
+#endif
+}
+
+// Loads and stores a pair of samples, which needn't be word aligned.
+DSP__INLINE uint32_t DSP_Load2(const int16_t *p)
+{
+    uint32_t v;
+    __builtin_memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+DSP__INLINE void DSP_Store2(int16_t *p, uint32_t v)
+{
+    __builtin_memcpy(p, &v, sizeof(v));
+}
+
+// Q15 dot product of count samples, which must sum to less than 2 in magnitude
+// for the result to be saturated rather than wrapped.
+DSP__INLINE int16_t DSP_DotQ15(const int16_t *a, const int16_t *b, unsigned count)
+{
+    int32_t acc = (1 << 14);
+    unsigned i;
+    for (i = 0; (i + 2) <= count; i += 2) {
+        acc = DSP_SMLAD(DSP_Load2(&a[i]), DSP_Load2(&b[i]), acc);
+    }
+    if (count & 1) {
+        acc += (a[count - 1] * b[count - 1]);
+    }
+    return DSP_SatQ15(acc >> 15);
+}
+
+
+// Biquad IIR cascades, in direct form I.
+
+// Q15 stage with coefficients in Q14, so they can reach +/-2, and a0 of 1.
+typedef struct {
+    uint32_t b12; // b1 and b2, paired with the last two inputs.
+    uint32_t a12; // -a1 and -a2, paired with the last two outputs.
+    int16_t  b0;
+} DSP_BiquadQ15;
+
+#define DSP_BIQUAD_Q15(B0, B1, B2, A1, A2) { \
+    .b12 = DSP__PACK2(DSP__FIXED(B1, 14, 0x7FFF), DSP__FIXED(B2, 14, 0x7FFF)), \
+    .a12 = DSP__PACK2(DSP__FIXED(-(A1), 14, 0x7FFF), DSP__FIXED(-(A2), 14, 0x7FFF)), \
+    .b0  = (int16_t)DSP__FIXED(B0, 14, 0x7FFF) }
+
+// Zero initialise for silence.
+typedef struct {
+    uint32_t x12;
+    uint32_t y12;
+} DSP_BiquadQ15State;
+
+// state holds stages entries for each channel.
+DSP__INLINE void DSP_BiquadQ15_Process(
+    const DSP_BiquadQ15 *coeffs, DSP_BiquadQ15State *state, unsigned stages, unsigned channels,
+    const int16_t *in, int16_t *out, uintptr_t frames)
+{
+    for (; frames > 0; frames--) {
+        unsigned c;
+        for (c = 0; c < channels; c++) {
+            DSP_BiquadQ15State *st = &state[c * stages];
+            int32_t x = *in++;
+
+            unsigned s;
+            for (s = 0; s < stages; s++, st++) {
+                const DSP_BiquadQ15 *k = &coeffs[s];
+                int32_t acc = ((1 << 13) + (k->b0 * x));
+                acc = DSP_SMLAD(k->b12, st->x12, acc);
+                acc = DSP_SMLAD(k->a12, st->y12, acc);
+                int32_t y = DSP_SatQ15(acc >> 14);
+
+                // Shift the newest sample into the low half of each pair.
+                st->x12 = ((st->x12 << 16) | (uint16_t)x);
+                st->y12 = ((st->y12 << 16) | (uint16_t)y);
+                x = y;
+            }
+            *out++ = (int16_t)x;
+        }
+    }
+}
+
+#define DSP_BIQUAD_Q15_DEFINE(name, STAGES, CHANNELS) \
+    static inline void name( \
+        const DSP_BiquadQ15 coeffs[STAGES], DSP_BiquadQ15State state[(STAGES) * (CHANNELS)], \
+        const int16_t *in, int16_t *out, uintptr_t frames) \
+    { \
+        DSP_BiquadQ15_Process(coeffs, state, STAGES, CHANNELS, in, out, frames); \
+    }
+
+// Q31 stage with coefficients in Q30, for filters whose poles are too close to
+// the unit circle for Q15, e.g. low cutoffs at high sample rates.
+typedef struct {
+    int32_t b0, b1, b2;
+    int32_t a1, a2; // Negated.
+} DSP_BiquadQ31;
+
+#define DSP_BIQUAD_Q31(B0, B1, B2, A1, A2) { \
+    .b0 = (int32_t)DSP__FIXED(B0, 30, 0x7FFFFFFF), \
+    .b1 = (int32_t)DSP__FIXED(B1, 30, 0x7FFFFFFF), \
+    .b2 = (int32_t)DSP__FIXED(B2, 30, 0x7FFFFFFF), \
+    .a1 = (int32_t)DSP__FIXED(-(A1), 30, 0x7FFFFFFF), \
+    .a2 = (int32_t)DSP__FIXED(-(A2), 30, 0x7FFFFFFF) }
+
+typedef struct {
+    int32_t x1, x2;
+    int32_t y1, y2;
+} DSP_BiquadQ31State;
+
+DSP__INLINE void DSP_BiquadQ31_Process(
+    const DSP_BiquadQ31 *coeffs, DSP_BiquadQ31State *state, unsigned stages, unsigned channels,
+    const int32_t *in, int32_t *out, uintptr_t frames)
+{
+    for (; frames > 0; frames--) {
+        unsigned c;
+        for (c = 0; c < channels; c++) {
+            DSP_BiquadQ31State *st = &state[c * stages];
+            int32_t x = *in++;
+
+            unsigned s;
+            for (s = 0; s < stages; s++, st++) {
+                const DSP_BiquadQ31 *k = &coeffs[s];
+                // These compile to SMLAL.
+                int64_t acc = (1LL << 29);
+                acc += ((int64_t)k->b0 * x);
+                acc += ((int64_t)k->b1 * st->x1);
+                acc += ((int64_t)k->b2 * st->x2);
+                acc += ((int64_t)k->a1 * st->y1);
+                acc += ((int64_t)k->a2 * st->y2);
+                int32_t y = DSP_SatQ31(acc >> 30);
+
+                st->x2 = st->x1;
+                st->x1 = x;
+                st->y2 = st->y1;
+                st->y1 = y;
+                x = y;
+            }
+            *out++ = x;
+        }
+    }
+}
+
+#define DSP_BIQUAD_Q31_DEFINE(name, STAGES, CHANNELS) \
+    static inline void name( \
+        const DSP_BiquadQ31 coeffs[STAGES], DSP_BiquadQ31State state[(STAGES) * (CHANNELS)], \
+        const int32_t *in, int32_t *out, uintptr_t frames) \
+    { \
+        DSP_BiquadQ31_Process(coeffs, state, STAGES, CHANNELS, in, out, frames); \
+    }
+
+
+// FIR filters and decimators, with Q15 coefficients whose magnitudes sum to
+// less than 2.
+//
+// Each channel's delay line holds every input twice, taps apart, newest first,
+// so the last taps inputs are always contiguous and the filter is a single
+// dot product with no wrapping.
+
+DSP__INLINE void DSP_FIRQ15_Push(
+    int16_t *delay, unsigned taps, unsigned channels, unsigned pos, const int16_t *in)
+{
+    unsigned c;
+    for (c = 0; c < channels; c++) {
+        int16_t *line = &delay[c * 2 * taps];
+        line[pos] = line[pos + taps] = in[c];
+    }
+}
+
+// delay holds (2 * taps) samples for each channel, and pos the newest input.
+DSP__INLINE void DSP_FIRQ15_Process(
+    const int16_t *coeffs, unsigned taps, unsigned channels, int16_t *delay, unsigned *pos,
+    const int16_t *in, int16_t *out, uintptr_t frames)
+{
+    unsigned p = *pos;
+    for (; frames > 0; frames--) {
+        p = ((p == 0 ? taps : p) - 1);
+        DSP_FIRQ15_Push(delay, taps, channels, p, in);
+        in += channels;
+
+        unsigned c;
+        for (c = 0; c < channels; c++) {
+            *out++ = DSP_DotQ15(coeffs, &delay[(c * 2 * taps) + p], taps);
+        }
+    }
+    *pos = p;
+}
+
+// As DSP_FIRQ15_Process, only computing every factor'th output. Returns the
+// number of frames written to out, phase counting inputs since the last.
+DSP__INLINE uintptr_t DSP_FIRQ15_Decimate(
+    const int16_t *coeffs, unsigned taps, unsigned factor, unsigned channels,
+    int16_t *delay, unsigned *pos, unsigned *phase,
+    const int16_t *in, int16_t *out, uintptr_t frames)
+{
+    unsigned p  = *pos;
+    unsigned ph = *phase;
+    uintptr_t produced = 0;
+    for (; frames > 0; frames--) {
+        p = ((p == 0 ? taps : p) - 1);
+        DSP_FIRQ15_Push(delay, taps, channels, p, in);
+        in += channels;
+
+        if (++ph < factor) {
+            continue;
+        }
+        ph = 0;
+
+        unsigned c;
+        for (c = 0; c < channels; c++) {
+            *out++ = DSP_DotQ15(coeffs, &delay[(c * 2 * taps) + p], taps);
+        }
+        produced++;
+    }
+    *pos   = p;
+    *phase = ph;
+    return produced;
+}
+
+// Defines name##_State, to be zero initialised, and name().
+#define DSP_FIR_Q15_DEFINE(name, TAPS, CHANNELS) \
+    typedef struct { \
+        unsigned pos; \
+        int16_t  delay[(CHANNELS) * 2 * (TAPS)]; \
+    } name##_State; \
+    static inline void name(name##_State *state, const int16_t coeffs[TAPS], \
+        const int16_t *in, int16_t *out, uintptr_t frames) \
+    { \
+        DSP_FIRQ15_Process(coeffs, TAPS, CHANNELS, state->delay, &state->pos, in, out, frames); \
+    }
+
+#define DSP_DECIMATOR_Q15_DEFINE(name, TAPS, FACTOR, CHANNELS) \
+    typedef struct { \
+        unsigned pos; \
+        unsigned phase; \
+        int16_t  delay[(CHANNELS) * 2 * (TAPS)]; \
+    } name##_State; \
+    static inline uintptr_t name(name##_State *state, const int16_t coeffs[TAPS], \
+        const int16_t *in, int16_t *out, uintptr_t frames) \
+    { \
+        return DSP_FIRQ15_Decimate(coeffs, TAPS, FACTOR, CHANNELS, \
+            state->delay, &state->pos, &state->phase, in, out, frames); \
+    }
+
+
+// Gain and mixing, with a Q15 gain per channel.
+
+DSP__INLINE uint32_t DSP__Scale2(uint32_t x, int16_t g0, int16_t g1)
+{
+    int32_t lo = (((int16_t)x * g0) >> 15);
+    int32_t hi = (((int16_t)(x >> 16) * g1) >> 15);
+    return DSP__PACK2(DSP_SatQ15(lo), DSP_SatQ15(hi));
+}
+
+// Scales data in place. Mono and stereo frames are handled a pair of samples
+// at a time.
+DSP__INLINE void DSP_GainQ15(
+    int16_t *data, uintptr_t frames, unsigned channels, const int16_t *gains)
+{
+    uintptr_t count = (frames * channels);
+    uintptr_t i;
+    if (channels <= 2) {
+        int16_t g0 = gains[0], g1 = gains[channels - 1];
+        for (i = 0; (i + 2) <= count; i += 2) {
+            DSP_Store2(&data[i], DSP__Scale2(DSP_Load2(&data[i]), g0, g1));
+        }
+        if (count & 1) {
+            data[count - 1] = DSP_SatQ15((data[count - 1] * g0) >> 15);
+        }
+    } else {
+        for (i = 0; i < count; i++) {
+            data[i] = DSP_SatQ15((data[i] * gains[i % channels]) >> 15);
+        }
+    }
+}
+
+// Adds src scaled by gains to dst, saturating.
+DSP__INLINE void DSP_MixQ15(
+    int16_t *dst, const int16_t *src, uintptr_t frames, unsigned channels, const int16_t *gains)
+{
+    uintptr_t count = (frames * channels);
+    uintptr_t i;
+    if (channels <= 2) {
+        int16_t g0 = gains[0], g1 = gains[channels - 1];
+        for (i = 0; (i + 2) <= count; i += 2) {
+            uint32_t scaled = DSP__Scale2(DSP_Load2(&src[i]), g0, g1);
+            DSP_Store2(&dst[i], DSP_QADD16(DSP_Load2(&dst[i]), scaled));
+        }
+        if (count & 1) {
+            dst[count - 1] = DSP_SatQ15(dst[count - 1] + ((src[count - 1] * g0) >> 15));
+        }
+    } else {
+        for (i = 0; i < count; i++) {
+            dst[i] = DSP_SatQ15(dst[i] + ((src[i] * gains[i % channels]) >> 15));
+        }
+    }
+}
+
+#endif // #ifndef DSP_H_
@@ -12,6 +12,7 @@
 #include "lib/UART.h"
 #include "lib/Print.h"
 
+#include "Governor.h"
 
 #define NUM_BUTTONS  2
 #define COUNT_CYCLE 10
@@ -37,6 +38,10 @@ static void buttonPress(unsigned pin)
         return;
     }
 
+    // Printing and reconfiguring the pin are the only work, done at full
+    // speed from the interrupt.
+    Governor_Begin();
+
     ButtonContext *ctxt = &(context[pin - 12]);
     UART_Printf(
         debug, "EINT %lu triggered (%lu)\r\n",
@@ -62,6 +67,8 @@ static void buttonPress(unsigned pin)
 
         ctxt->cnt = 0;
     }
+
+    Governor_End();
 }
 
 
@@ -80,12 +87,20 @@ void gpio_g3_irq1(void)
 _Noreturn void RTCoreMain(void)
 {
     VectorTableInit();
-    CPUFreq_Set(197600000);
+    // The core idles at 26 MHz between presses, and is raised to 197.6 MHz
+    // while one is handled.
+    bool governed = Governor_Init(26000000, 197600000);
+    if (!governed) {
+        CPUFreq_Set(197600000);
+    }
 
     debug = UART_Open(MT3620_UNIT_UART_DEBUG, 115200, UART_PARITY_NONE, 1, NULL);
     UART_Print(debug, "--------------------------------\r\n");
     UART_Print(debug, "EINT_RTApp_MT3620_BareMetal\r\n");
     UART_Print(debug, "App built on: " __DATE__ " " __TIME__ "\r\n");
+    if (!governed) {
+        UART_Print(debug, "ERROR: Failed to set up the clock governor\r\n");
+    }
 
     UART_Print(
         debug,
@@ -104,7 +119,13 @@ _Noreturn void RTCoreMain(void)
         }
     }
 
+    // Everything is handled in the interrupts, so the clock is dropped with
+    // them masked, or one arriving in between would leave it raised while
+    // the core sleeps.
     for (;;) {
-        __asm__("wfi");
+        __asm__ volatile ("cpsid i" ::: "memory");
+        Governor_Idle();
+        __asm__ volatile ("wfi");
+        __asm__ volatile ("cpsie i" ::: "memory");
     }
 }
@@ -0,0 +1,179 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stddef.h>
+
+#include "EventQueue.h"
+
+// Orders the event's contents against the index which publishes it. A single
+// core only needs the compiler kept in order, but dmb costs little.
+#define EVENT_QUEUE_BARRIER() __asm__ volatile ("dmb" ::: "memory")
+
+#define DEMCR       (*(volatile uint32_t *)0xE000EDFC)
+#define DWT_CTRL    (*(volatile uint32_t *)0xE0001000)
+#define DWT_CYCCNT  (*(volatile uint32_t *)0xE0001004)
+
+#define DEMCR_TRCENA        (1U << 24)
+#define DWT_CTRL_CYCCNTENA  (1U << 0)
+
+// Registered queues, most urgent first.
+static EventQueue *queues = NULL;
+
+bool EventQueue_Init(EventQueue *queue, unsigned priority, EventQueue_Handler handler)
+{
+    if ((queue == NULL) || (handler == NULL)
+        || ((queue->mask & (queue->mask + 1)) != 0)
+        || (queue->size > EVENT_QUEUE_PAYLOAD_MAX)
+        || ((queue->size > 0) && (queue->events == NULL))) {
+        return false;
+    }
+
+    EventQueue **link;
+    for (link = &queues; *link != NULL; link = &(*link)->next) {
+        if (*link == queue) {
+            return false;
+        }
+    }
+
+    queue->head      = 0;
+    queue->tail      = 0;
+    queue->overflows = 0;
+    queue->handler   = handler;
+    queue->priority  = priority;
+
+    EventQueue_StatsGet(queue, NULL, true);
+
+    DEMCR    |= DEMCR_TRCENA;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+
+    // Behind every queue of the same or a more urgent priority.
+    for (link = &queues; (*link != NULL) && ((*link)->priority <= priority); link = &(*link)->next);
+    queue->next = *link;
+    *link = queue;
+
+    return true;
+}
+
+bool EventQueue_Post(EventQueue *queue, const void *payload)
+{
+    uint32_t head = queue->head;
+    if ((head - queue->tail) > queue->mask) {
+        queue->overflows++;
+        return false;
+    }
+
+    if (queue->posted) {
+        queue->posted[head & queue->mask] = DWT_CYCCNT;
+    }
+
+    if (queue->size > 0) {
+        uint8_t *event = &queue->events[(head & queue->mask) * queue->stride];
+        if (payload) {
+            __builtin_memcpy(event, payload, queue->size);
+        } else {
+            __builtin_memset(event, 0, queue->size);
+        }
+    }
+
+    EVENT_QUEUE_BARRIER();
+    queue->head = (head + 1);
+    return true;
+}
+
+bool EventQueue_Dispatch(void)
+{
+    bool handled = false;
+
+    EventQueue *queue = queues;
+    while (queue != NULL) {
+        uint32_t tail = queue->tail;
+        if (tail == queue->head) {
+            queue = queue->next;
+            continue;
+        }
+        EVENT_QUEUE_BARRIER();
+
+        // The event is copied out and its slot freed before it's handled, so
+        // the producer can post again while the handler runs. A single slot
+        // signal queue would otherwise drop a post made during its handler,
+        // and the work it asks for would wait for the next.
+        uint32_t event[EVENT_QUEUE_PAYLOAD_MAX / 4];
+        void *payload = NULL;
+        if (queue->size > 0) {
+            __builtin_memcpy(event, &queue->events[(tail & queue->mask) * queue->stride], queue->size);
+            payload = event;
+        }
+        uint32_t posted = (queue->posted ? queue->posted[tail & queue->mask] : 0);
+
+        EVENT_QUEUE_BARRIER();
+        queue->tail = (tail + 1);
+
+        uint32_t start = DWT_CYCCNT;
+        queue->handler(payload);
+        uint32_t end = DWT_CYCCNT;
+
+        queue->handled++;
+        if ((end - start) > queue->run_max) {
+            queue->run_max = (end - start);
+        }
+        if (queue->posted) {
+            uint32_t latency = (end - posted);
+            if (latency > queue->latency_max) {
+                queue->latency_max = latency;
+            }
+            if ((queue->deadline > 0) && (latency > queue->deadline)) {
+                queue->missed++;
+            }
+        }
+
+        handled = true;
+
+        // Something more urgent may have arrived meanwhile.
+        queue = queues;
+    }
+
+    return handled;
+}
+
+bool EventQueue_Pending(void)
+{
+    EventQueue *queue;
+    for (queue = queues; queue != NULL; queue = queue->next) {
+        if (queue->tail != queue->head) {
+            return true;
+        }
+    }
+    return false;
+}
+
+EventQueue *EventQueue_Next(const EventQueue *queue)
+{
+    return (queue ? queue->next : queues);
+}
+
+void EventQueue_SetDeadline(EventQueue *queue, uint32_t cycles)
+{
+    queue->deadline = cycles;
+}
+
+void EventQueue_StatsGet(EventQueue *queue, EventQueue_Stats *stats, bool reset)
+{
+    // The overflow count belongs to the producer, so is never cleared here.
+    uint32_t overflows = queue->overflows;
+
+    if (stats) {
+        stats->handled     = queue->handled;
+        stats->overflows   = (overflows - queue->overflows_reset);
+        stats->missed      = queue->missed;
+        stats->latency_max = queue->latency_max;
+        stats->run_max     = queue->run_max;
+    }
+
+    if (reset) {
+        queue->handled         = 0;
+        queue->missed          = 0;
+        queue->overflows_reset = overflows;
+        queue->latency_max     = 0;
+        queue->run_max         = 0;
+    }
+}
@@ -0,0 +1,142 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef EVENT_QUEUE_H_
+#define EVENT_QUEUE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Passes events from interrupt handlers to the main loop, where the work they
+// defer is done.
+//
+// Each queue is a ring of fixed size events with one producer, normally a
+// single interrupt, and the main loop as its only consumer. The producer only
+// ever writes the head index and the consumer only the tail, each publishing
+// its index after the event it covers, so neither side needs to block
+// interrupts. Events are kept in the order they were posted, and may carry a
+// payload of whatever type the queue was defined for. When a queue is full the
+// event is dropped and counted, rather than an earlier one being overwritten.
+//
+// Queues are registered with a priority, numbered like NVIC priorities so that
+// lower is more urgent. EventQueue_Dispatch() always takes the next event from
+// the most urgent queue with one waiting, so a burst of slow events can't hold
+// back an urgent one for longer than one handler takes.
+//
+// A queue and its storage are defined together, e.g.
+//
+//     EVENT_QUEUE_DEFINE(buttonEvents, uint32_t, 4);
+//
+// or with EVENT_QUEUE_DEFINE_SIGNAL for events which carry nothing, then
+// registered with EventQueue_Init() before its producer is started.
+//
+// Each event is timestamped with the DWT cycle counter as it's posted, so every
+// queue keeps count of how long its events waited and how long its handler
+// ran. A queue may also be given a deadline, the longest from an event being
+// posted to its handler returning, and counts each event which misses it.
+
+typedef struct EventQueue EventQueue;
+
+// Called from EventQueue_Dispatch() with a copy of the event's payload, which
+// stays valid until it returns. The event's slot is freed before the handler is
+// called, so the producer may post again meanwhile, and a post to a single slot
+// queue from within its handler's run is dispatched once more after it.
+typedef void (*EventQueue_Handler)(void *payload);
+
+struct EventQueue {
+    const char *label;
+    uint8_t    *events;
+    uint32_t   *posted;
+    uint32_t    size;
+    uint32_t    stride;
+    uint32_t    mask;
+
+    volatile uint32_t head;      // Written only by the producer.
+    volatile uint32_t tail;      // Written only by the consumer.
+    volatile uint32_t overflows; // Written only by the producer.
+
+    EventQueue_Handler handler;
+    unsigned           priority;
+    EventQueue        *next;
+
+    // Written only by the consumer, and all in cycles.
+    uint32_t deadline;
+    uint32_t handled;
+    uint32_t missed;
+    uint32_t overflows_reset;
+    uint32_t latency_max;
+    uint32_t run_max;
+};
+
+typedef struct {
+    uint32_t handled;
+    uint32_t overflows;
+    uint32_t missed;
+    uint32_t latency_max;
+    uint32_t run_max;
+} EventQueue_Stats;
+
+// Events are stored padded to a word, and count must be a power of two. Payloads
+// are copied onto the stack to be handled, so are limited in size.
+#define EVENT_QUEUE_PAYLOAD_MAX 32
+
+#define EVENT_QUEUE_STRIDE(type) ((sizeof(type) + 3) & ~3U)
+
+#define EVENT_QUEUE_DEFINE(name, type, count) \
+    static uint32_t name##_events[((count) * EVENT_QUEUE_STRIDE(type)) / 4]; \
+    static uint32_t name##_posted[(count)]; \
+    static EventQueue name = { \
+        .label  = #name,                     \
+        .events = (uint8_t *)name##_events,  \
+        .posted = name##_posted,             \
+        .size   = sizeof(type),              \
+        .stride = EVENT_QUEUE_STRIDE(type),  \
+        .mask   = ((count) - 1),             \
+    }
+
+// Each event of these queues is only counted, and handlers are passed NULL.
+#define EVENT_QUEUE_DEFINE_SIGNAL(name, count) \
+    static uint32_t name##_posted[(count)]; \
+    static EventQueue name = { \
+        .label  = #name,         \
+        .posted = name##_posted, \
+        .mask   = ((count) - 1), \
+    }
+
+// Registers a queue defined with EVENT_QUEUE_DEFINE to be dispatched, from the
+// main loop before interrupts which post to it are enabled. Returns false if
+// the queue wasn't defined properly, its payload is larger than
+// EVENT_QUEUE_PAYLOAD_MAX, or it's already registered.
+bool EventQueue_Init(EventQueue *queue, unsigned priority, EventQueue_Handler handler);
+
+// Copies the payload into the queue, to be called only from the queue's own
+// producer. payload may be NULL for queues whose events carry nothing, or to
+// leave the event zeroed. Returns false if the queue is full.
+bool EventQueue_Post(EventQueue *queue, const void *payload);
+
+// Handles every event waiting, most urgent first, until all the queues are
+// empty. Returns whether any events were handled.
+bool EventQueue_Dispatch(void);
+
+// Returns whether any registered queue has an event waiting.
+bool EventQueue_Pending(void);
+
+// Returns the registered queue after queue, or the most urgent if queue is
+// NULL, so that every queue can be visited in turn.
+EventQueue *EventQueue_Next(const EventQueue *queue);
+
+// Sets the deadline of each of the queue's events in CPU cycles, or 0 for none.
+// Only to be called from the main loop.
+void EventQueue_SetDeadline(EventQueue *queue, uint32_t cycles);
+
+// Copies the queue's statistics since they were last reset into stats, if it
+// isn't NULL. Only to be called from the main loop.
+void EventQueue_StatsGet(EventQueue *queue, EventQueue_Stats *stats, bool reset);
+
+// Returns the number of events dropped because the queue was full.
+static inline uint32_t EventQueue_Overflows(const EventQueue *queue)
+{
+    return queue->overflows;
+}
+
+#endif // #ifndef EVENT_QUEUE_H_
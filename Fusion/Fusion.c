@@ -0,0 +1,176 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "Fusion.h"
+#include "Placement.h"
+#include <stddef.h>
+
+#define FUSION_ONE (1 << 30)
+#define FUSION_PI  3.14159265f
+
+static bool Fusion__ScaleOf(float k, Fusion_Scale *scale)
+{
+    scale->mul   = 0;
+    scale->shift = 0;
+    if (k == 0.0f) {
+        return true;
+    }
+    if (!(k > 0.0f) || (k >= 2147483648.0f)) {
+        return false;
+    }
+
+    // Double k up to [2^30, 2^31), counting how far it went.
+    unsigned shift = 0;
+    while ((k < 1073741824.0f) && (shift < 62)) {
+        k *= 2.0f;
+        shift++;
+    }
+    scale->mul   = (int32_t)k;
+    scale->shift = shift;
+    return true;
+}
+
+// Rounds, as most of what's scaled is so small that a shift alone would turn
+// every negative error into -1 and every positive one into 0, and the integral
+// would wander off in one direction.
+static inline int64_t Fusion__Apply64(int32_t x, const Fusion_Scale *scale)
+{
+    int64_t half = ((scale->shift != 0) ? ((int64_t)1 << (scale->shift - 1)) : 0);
+    return ((((int64_t)x * scale->mul) + half) >> scale->shift);
+}
+
+static inline int32_t Fusion__Apply(int32_t x, const Fusion_Scale *scale)
+{
+    return (int32_t)Fusion__Apply64(x, scale);
+}
+
+static inline int32_t Fusion__MulQ30(int32_t a, int32_t b)
+{
+    return (int32_t)(((int64_t)a * b) >> 30);
+}
+
+static uint32_t Fusion__Sqrt(uint32_t x)
+{
+    uint32_t root = 0;
+    uint32_t bit  = (1U << 30);
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (x >= (root + bit)) {
+            x   -= (root + bit);
+            root = ((root >> 1) + bit);
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+bool Fusion_Init(Fusion *fusion, float rate, float gyroScale, float kp, float ki)
+{
+    if (!fusion || !(rate > 0.0f) || !(gyroScale > 0.0f)) {
+        return false;
+    }
+
+    // Everything is applied as half of the angle turned in one sample.
+    float halfPeriod = (0.5f / rate);
+    if (!Fusion__ScaleOf(((gyroScale * FUSION_PI) / 180.0f) * halfPeriod * FUSION_ONE, &fusion->gyro)
+        || !Fusion__ScaleOf(kp * halfPeriod, &fusion->kp)
+        || !Fusion__ScaleOf(ki * (1.0f / rate) * halfPeriod * (1 << FUSION_BIAS_FRACTION), &fusion->ki)) {
+        return false;
+    }
+
+    Fusion_Reset(fusion);
+    return true;
+}
+
+void Fusion_Reset(Fusion *fusion)
+{
+    if (!fusion) {
+        return;
+    }
+
+    fusion->q[0] = FUSION_ONE;
+    fusion->q[1] = 0;
+    fusion->q[2] = 0;
+    fusion->q[3] = 0;
+    fusion->bias[0] = 0;
+    fusion->bias[1] = 0;
+    fusion->bias[2] = 0;
+}
+
+TCM_CODE void Fusion_Update(Fusion *fusion, const int16_t g[3], const int16_t xl[3])
+{
+    int32_t q0 = fusion->q[0], q1 = fusion->q[1], q2 = fusion->q[2], q3 = fusion->q[3];
+
+    int32_t h[3];
+    unsigned i;
+    for (i = 0; i < 3; i++) {
+        h[i] = Fusion__Apply(g[i], &fusion->gyro);
+    }
+
+    // Correct towards gravity, unless the accelerometer reads nothing at all,
+    // such as in free fall. Each square fits an int, but their sum may not.
+    uint32_t norm = Fusion__Sqrt((uint32_t)(xl[0] * xl[0])
+        + (uint32_t)(xl[1] * xl[1]) + (uint32_t)(xl[2] * xl[2]));
+    if (norm != 0) {
+        // Measured direction of gravity in Q15.
+        int32_t a[3];
+        for (i = 0; i < 3; i++) {
+            a[i] = (((int32_t)xl[i] * (1 << 15)) / (int32_t)norm);
+        }
+
+        // Gravity as the orientation has it, in Q30.
+        int32_t v[3];
+        v[0] = (int32_t)((((int64_t)q1 * q3) - ((int64_t)q0 * q2)) >> 29);
+        v[1] = (int32_t)((((int64_t)q0 * q1) + ((int64_t)q2 * q3)) >> 29);
+        v[2] = (int32_t)((((int64_t)q0 * q0) - ((int64_t)q1 * q1)
+            - ((int64_t)q2 * q2) + ((int64_t)q3 * q3)) >> 30);
+
+        // The error is the turn between the two, their cross product in Q30.
+        int32_t e[3];
+        e[0] = (int32_t)((((int64_t)a[1] * v[2]) - ((int64_t)a[2] * v[1])) >> 15);
+        e[1] = (int32_t)((((int64_t)a[2] * v[0]) - ((int64_t)a[0] * v[2])) >> 15);
+        e[2] = (int32_t)((((int64_t)a[0] * v[1]) - ((int64_t)a[1] * v[0])) >> 15);
+
+        for (i = 0; i < 3; i++) {
+            fusion->bias[i] += Fusion__Apply64(e[i], &fusion->ki);
+            h[i] += Fusion__Apply(e[i], &fusion->kp);
+        }
+    }
+    for (i = 0; i < 3; i++) {
+        h[i] += (int32_t)(fusion->bias[i] >> FUSION_BIAS_FRACTION);
+    }
+
+    // q += q * (0, h), where h is half the turn this sample.
+    int32_t n0 = q0 + (int32_t)(((-(int64_t)q1 * h[0]) - ((int64_t)q2 * h[1]) - ((int64_t)q3 * h[2])) >> 30);
+    int32_t n1 = q1 + (int32_t)((( (int64_t)q0 * h[0]) + ((int64_t)q2 * h[2]) - ((int64_t)q3 * h[1])) >> 30);
+    int32_t n2 = q2 + (int32_t)((( (int64_t)q0 * h[1]) - ((int64_t)q1 * h[2]) + ((int64_t)q3 * h[0])) >> 30);
+    int32_t n3 = q3 + (int32_t)((( (int64_t)q0 * h[2]) + ((int64_t)q1 * h[1]) - ((int64_t)q2 * h[0])) >> 30);
+
+    // The length is within rounding of 1, so 1 / |q| is close enough to
+    // (3 - |q|^2) / 2.
+    int32_t length = (int32_t)((((int64_t)n0 * n0) + ((int64_t)n1 * n1)
+        + ((int64_t)n2 * n2) + ((int64_t)n3 * n3)) >> 30);
+    int32_t correct = (FUSION_ONE + ((FUSION_ONE - length) / 2));
+
+    fusion->q[0] = Fusion__MulQ30(n0, correct);
+    fusion->q[1] = Fusion__MulQ30(n1, correct);
+    fusion->q[2] = Fusion__MulQ30(n2, correct);
+    fusion->q[3] = Fusion__MulQ30(n3, correct);
+}
+
+void Fusion_GetQuaternion(const Fusion *fusion, int16_t q[4])
+{
+    if (!fusion || !q) {
+        return;
+    }
+
+    unsigned i;
+    for (i = 0; i < 4; i++) {
+        int32_t v = ((fusion->q[i] + (1 << 15)) >> 16);
+        q[i] = (int16_t)(v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v));
+    }
+}
@@ -0,0 +1,81 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef FUSION_H_
+#define FUSION_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Estimates orientation from a gyroscope and accelerometer, in fixed point,
+// with a Mahony complementary filter.
+//
+// Each sample turns the orientation by the angular rate, corrected towards
+// the direction of gravity the accelerometer measures by a proportional and
+// an integral gain, the integral learning the gyroscope's bias. Only gravity
+// is measured, so roll and pitch are corrected while yaw is left to drift as
+// the gyroscope does.
+//
+// The orientation is a unit quaternion in Q30 and every step is integer
+// arithmetic: 32 by 32 bit multiplies into 64 bits, which are one SMULL or
+// SMLAL each on the M4, three divides to find the direction of gravity, and
+// no square root on the quaternion, which is renormalised each step by a
+// first order correction, as it only ever strays from unit length by rounding.
+// Samples are taken as the LSM6DS3 outputs them, gyroscope then
+// accelerometer, straight from a FIFO read with no conversion to units first.
+//
+//     static Fusion fusion;
+//
+//     Fusion_Init(&fusion, 1666.0f, FUSION_G_DPS_PER_LSB_500, 1.0f, 0.01f);
+//     Fusion_Update(&fusion, &frame[0], &frame[3]);
+//     Fusion_GetQuaternion(&fusion, q);
+
+// Gyroscope sensitivity of the LSM6DS3 at each full scale, from its datasheet.
+#define FUSION_G_DPS_PER_LSB_125  0.004375f
+#define FUSION_G_DPS_PER_LSB_250  0.00875f
+#define FUSION_G_DPS_PER_LSB_500  0.0175f
+#define FUSION_G_DPS_PER_LSB_1000 0.035f
+#define FUSION_G_DPS_PER_LSB_2000 0.07f
+
+#define FUSION_BIAS_FRACTION 24
+
+// Multiplies by (mul / 2^shift), so a constant keeps 31 bits of precision
+// however small it is.
+typedef struct {
+    int32_t  mul;
+    unsigned shift;
+} Fusion_Scale;
+
+typedef struct {
+    // Orientation as w, x, y, z in Q30, from the sensor's frame to the world's.
+    int32_t q[4];
+    // The integral term, as a half angle turned each sample in Q30 with
+    // FUSION_BIAS_FRACTION more bits, as it learns by far less than one Q30
+    // step a sample.
+    int64_t bias[3];
+
+    // Turn each raw gyroscope count, and each Q30 unit of error, makes in
+    // half an angle per sample in Q30.
+    Fusion_Scale gyro;
+    Fusion_Scale kp;
+    Fusion_Scale ki;
+} Fusion;
+
+// Sets up a filter for samples at rate Hz, with the gyroscope's sensitivity
+// in degrees per second per count, and kp and ki the gains of the correction
+// in radians per second per unit of error, and per second for ki. The
+// orientation starts level, with the integral cleared. Returns false if any of
+// the parameters are out of range.
+bool Fusion_Init(Fusion *fusion, float rate, float gyroScale, float kp, float ki);
+
+// Levels the orientation and clears the integral, keeping the parameters.
+void Fusion_Reset(Fusion *fusion);
+
+// Takes one sample, g and xl being the gyroscope's and accelerometer's three
+// axes as read from the device.
+void Fusion_Update(Fusion *fusion, const int16_t g[3], const int16_t xl[3]);
+
+// Reads the orientation as w, x, y, z in Q14, so 16384 is 1.
+void Fusion_GetQuaternion(const Fusion *fusion, int16_t q[4]);
+
+#endif // #ifndef FUSION_H_
@@ -0,0 +1,159 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "GPIOGroup.h"
+#include <stddef.h>
+
+// Register words of a GPIO block, as laid out in the MT3620 datasheet. The
+// GPIO driver only exposes pins one at a time, so they're defined here.
+#define GPIO_BLOCK_DIN        (0x04 / 4)
+#define GPIO_BLOCK_DOUT_SET   (0x14 / 4)
+#define GPIO_BLOCK_DOUT_RESET (0x18 / 4)
+
+typedef struct {
+    uint32_t  firstPin;
+    uint32_t  count;
+    uintptr_t base;
+} GPIOGroup_Block;
+
+static const GPIOGroup_Block GPIOGroup__Blocks[] = {
+    { 0, 4, 0x38010000}, // PWM0
+    { 4, 4, 0x38020000}, // PWM1
+    { 8, 4, 0x38030000}, // PWM2
+    {12, 4, 0x38040000}, // GRP3
+    {16, 4, 0x38050000}, // GRP4
+    {20, 4, 0x38060000}, // GRP5
+    {26, 5, 0x38070000}, // ISU0
+    {31, 5, 0x38080000}, // ISU1
+    {36, 5, 0x38090000}, // ISU2
+    {41, 8, 0x38000000}, // ADC
+    {56, 5, 0x380D0000}, // I2S0
+    {61, 5, 0x380E0000}, // I2S1
+    {66, 5, 0x380A0000}, // ISU3
+    {71, 5, 0x380B0000}, // ISU4
+};
+
+#define GPIO_GROUP_BLOCKS (sizeof(GPIOGroup__Blocks) / sizeof(GPIOGroup__Blocks[0]))
+
+static const GPIOGroup_Block *GPIOGroup__Block(uint32_t pin)
+{
+    unsigned b;
+    for (b = 0; b < GPIO_GROUP_BLOCKS; b++) {
+        const GPIOGroup_Block *block = &GPIOGroup__Blocks[b];
+        if ((pin >= block->firstPin) && (pin < (block->firstPin + block->count))) {
+            return block;
+        }
+    }
+    return NULL;
+}
+
+// Finds the block every pin of the group is in, and records the group's
+// bits, before anything is configured.
+static int32_t GPIOGroup__Check(GPIOGroup *group)
+{
+    if (!group || !group->pins || (group->count == 0)
+        || (group->count > GPIO_GROUP_PINS_MAX)) {
+        return ERROR_PARAMETER;
+    }
+
+    const GPIOGroup_Block *block = GPIOGroup__Block(group->pins[0]);
+    if (!block) {
+        return ERROR_PARAMETER;
+    }
+
+    unsigned i;
+    for (i = 1; i < group->count; i++) {
+        if (GPIOGroup__Block(group->pins[i]) != block) {
+            return ERROR_PARAMETER;
+        }
+    }
+
+    group->block    = (volatile uint32_t *)block->base;
+    group->firstPin = block->firstPin;
+    group->mask     = ((1U << group->count) - 1);
+    return ERROR_NONE;
+}
+
+// Block register bits for the bits of a group value.
+static uint32_t GPIOGroup__ToBlock(const GPIOGroup *group, uint32_t value)
+{
+    uint32_t bits = 0;
+    unsigned i;
+    for (i = 0; i < group->count; i++) {
+        if (value & (1U << i)) {
+            bits |= (1U << (group->pins[i] - group->firstPin));
+        }
+    }
+    return bits;
+}
+
+int32_t GPIOGroup_ConfigureForOutput(GPIOGroup *group, uint32_t value)
+{
+    int32_t status = GPIOGroup__Check(group);
+    if (status != ERROR_NONE) {
+        return status;
+    }
+
+    unsigned i;
+    for (i = 0; i < group->count; i++) {
+        if ((status = GPIO_ConfigurePinForOutput(group->pins[i])) != ERROR_NONE) {
+            group->mask = 0;
+            return status;
+        }
+    }
+    return GPIOGroup_Write(group, value);
+}
+
+int32_t GPIOGroup_ConfigureForInput(GPIOGroup *group)
+{
+    int32_t status = GPIOGroup__Check(group);
+    if (status != ERROR_NONE) {
+        return status;
+    }
+
+    unsigned i;
+    for (i = 0; i < group->count; i++) {
+        if ((status = GPIO_ConfigurePinForInput(group->pins[i])) != ERROR_NONE) {
+            group->mask = 0;
+            return status;
+        }
+    }
+    return ERROR_NONE;
+}
+
+int32_t GPIOGroup_WriteMasked(GPIOGroup *group, uint32_t mask, uint32_t value)
+{
+    if (!group || (group->mask == 0)) {
+        return ERROR_HANDLE;
+    }
+
+    mask &= group->mask;
+    uint32_t set   = GPIOGroup__ToBlock(group, value & mask);
+    uint32_t reset = GPIOGroup__ToBlock(group, ~value & mask);
+
+    // Writing zero to either register leaves the block's outputs as they are.
+    group->block[GPIO_BLOCK_DOUT_SET]   = set;
+    group->block[GPIO_BLOCK_DOUT_RESET] = reset;
+    return ERROR_NONE;
+}
+
+int32_t GPIOGroup_Read(const GPIOGroup *group, uint32_t *value)
+{
+    if (!group || (group->mask == 0)) {
+        return ERROR_HANDLE;
+    }
+    if (!value) {
+        return ERROR_PARAMETER;
+    }
+
+    uint32_t din = group->block[GPIO_BLOCK_DIN];
+
+    uint32_t bits = 0;
+    unsigned i;
+    for (i = 0; i < group->count; i++) {
+        bits |= (((din >> (group->pins[i] - group->firstPin)) & 1) << i);
+    }
+
+    *value = bits;
+    return ERROR_NONE;
+}
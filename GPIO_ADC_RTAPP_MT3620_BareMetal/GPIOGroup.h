@@ -0,0 +1,65 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef GPIO_GROUP_H_
+#define GPIO_GROUP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lib/GPIO.h"
+
+// Reads and writes a group of GPIOs in the same GPIO block as one value, bit
+// n being the nth pin of the group, such as a parallel bus or the rows of an
+// LED matrix.
+//
+// A group is described once, by the pins it's made of, and then written a
+// whole value or a masked part of one at a time. A write is a single store to
+// each of the block's output set and reset registers, so the pins going high
+// all change together, as do the pins going low, and a read is a single load
+// of the block's input register.
+//
+//     GPIO_GROUP_DEFINE(leds, GPIO_LED_0, GPIO_LED_1, GPIO_LED_2);
+//
+//     GPIOGroup_ConfigureForOutput(&leds, 0);
+//     GPIOGroup_Write(&leds, value);
+//
+// Pins can be given in any order, but must all be in the same block, for
+// example GPIO 0-3 or the ADC block's GPIO 41-48, otherwise configuring the
+// group fails with ERROR_PARAMETER.
+
+#define GPIO_GROUP_PINS_MAX 8
+
+typedef struct {
+    const uint32_t *pins;
+    unsigned        count;
+
+    // Set when the group is configured, the registers of the group's block,
+    // the block's first pin and every bit of the group.
+    volatile uint32_t *block;
+    uint32_t           firstPin;
+    uint32_t           mask;
+} GPIOGroup;
+
+#define GPIO_GROUP_DEFINE(name, ...) \
+    static const uint32_t name##__pins[] = { __VA_ARGS__ }; \
+    static GPIOGroup name = { \
+        .pins = name##__pins, \
+        .count = (sizeof(name##__pins) / sizeof(name##__pins[0])) }
+
+// Configures every pin of the group, driving outputs to their bits of value.
+int32_t GPIOGroup_ConfigureForOutput(GPIOGroup *group, uint32_t value);
+int32_t GPIOGroup_ConfigureForInput(GPIOGroup *group);
+
+// Drives the pins of the group selected by mask to their bits of value,
+// leaving the rest as they are.
+int32_t GPIOGroup_WriteMasked(GPIOGroup *group, uint32_t mask, uint32_t value);
+
+static inline int32_t GPIOGroup_Write(GPIOGroup *group, uint32_t value)
+{
+    return GPIOGroup_WriteMasked(group, UINT32_MAX, value);
+}
+
+int32_t GPIOGroup_Read(const GPIOGroup *group, uint32_t *value);
+
+#endif // #ifndef GPIO_GROUP_H_
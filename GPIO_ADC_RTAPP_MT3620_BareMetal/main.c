@@ -10,10 +10,14 @@
 #include "lib/VectorTable.h"
 #include "lib/NVIC.h"
 #include "lib/GPIO.h"
-#include "lib/GPT.h"
 #include "lib/UART.h"
 #include "lib/Print.h"
 
+#include "EventQueue.h"
+#include "Input.h"
+
+#include "GPIOGroup.h"
+
 static UART* debug = NULL;
 
 #define GPIO_PLAY_R 45
@@ -29,32 +33,37 @@ static UART* debug = NULL;
 #define GPIO_IN_1 66
 #define GPIO_IN_2 44
 
+// The LEDs are driven low to light them, so one is lit at a time by clearing
+// its bit.
 #define NUM_LEDS 4
-static bool LED[NUM_LEDS] = {false, true, true, true};
+GPIO_GROUP_DEFINE(leds, GPIO_PLAY_R, GPIO_PLAY_G, GPIO_PLAY_B, GPIO_WIFI_R);
 static uint32_t activeLED = 0;
 
-static const uint32_t buttonAGpio = 12;
-static const int buttonPressCheckPeriodMs = 10;
-static void HandleButtonTimerIrq(GPT *);
-static void HandleButtonTimerIrqDeferred(void);
+// The counter's outputs are looped back to its inputs, bit for bit. Its pins
+// are each in a different GPIO block, to check the blocks work, so they're
+// driven and read one at a time rather than as a group.
+static const uint32_t countOut[] = {GPIO_OUT_0, GPIO_OUT_1, GPIO_OUT_2};
+static const uint32_t countIn[]  = {GPIO_IN_0,  GPIO_IN_1,  GPIO_IN_2};
+#define COUNT_BITS (sizeof(countOut) / sizeof(countOut[0]))
 
-static GPT *buttonTimeout = NULL;
+static const uint32_t buttonAGpio = 12;
+static void HandleButtonDeferred(void *payload);
 
 static void updateCountingGPIOs()
 {
     static uint8_t count = 0;
 
-    GPIO_Write(GPIO_OUT_0, (count >> 0) & 1);
-    GPIO_Write(GPIO_OUT_1, (count >> 1) & 1);
-    GPIO_Write(GPIO_OUT_2, (count >> 2) & 1);
-
-    bool inBits[3];
-
-    GPIO_Read(GPIO_IN_0, &inBits[0]);
-    GPIO_Read(GPIO_IN_1, &inBits[1]);
-    GPIO_Read(GPIO_IN_2, &inBits[2]);
+    unsigned i;
+    for (i = 0; i < COUNT_BITS; i++) {
+        GPIO_Write(countOut[i], (count >> i) & 1);
+    }
 
-    uint8_t countRead = inBits[0] + (inBits[1] << 1) + (inBits[2] << 2);
+    uint8_t countRead = 0;
+    for (i = 0; i < COUNT_BITS; i++) {
+        bool level = false;
+        GPIO_Read(countIn[i], &level);
+        countRead |= (level << i);
+    }
 
     UART_Printf(debug, "count: %u, countRead: %u\r\n", count, countRead);
 
@@ -63,81 +72,24 @@ static void updateCountingGPIOs()
 
 static void updateLEDs()
 {
-    GPIO_Write(GPIO_PLAY_R, LED[0]);
-    GPIO_Write(GPIO_PLAY_G, LED[1]);
-    GPIO_Write(GPIO_PLAY_B, LED[2]);
-    GPIO_Write(GPIO_WIFI_R, LED[3]);
+    GPIOGroup_Write(&leds, ~(1U << activeLED));
 }
 
-typedef struct CallbackNode {
-    bool enqueued;
-    struct CallbackNode* next;
-    void (*cb)(void);
-} CallbackNode;
-
-static void EnqueueCallback(CallbackNode* node);
-
-static void HandleButtonTimerIrq(GPT *handle)
-{
-    (void)handle;
-    static CallbackNode cbn = { .enqueued = false,.cb = HandleButtonTimerIrqDeferred };
-    EnqueueCallback(&cbn);
-}
+// Button presses are handled in the main loop, in the order they happened.
+EVENT_QUEUE_DEFINE(buttonEvents, Input_Event, 4);
 
-static void HandleButtonTimerIrqDeferred(void)
+static void HandleButtonDeferred(void *payload)
 {
-    // Assume initial state is high, i.e. button not pressed.
-    static bool prevState = true;
-    bool newState;
-    GPIO_Read(buttonAGpio, &newState);
-
-    if (newState != prevState) {
-        bool pressed = !newState;
-        if (pressed) {
-            LED[activeLED] = true;
-            activeLED++;
-            if (activeLED >= NUM_LEDS) {
-                activeLED = 0;
-            }
-            LED[activeLED] = false;
-
-            updateLEDs();
-            updateCountingGPIOs();
+    const Input_Event *event = payload;
+    if (event->pressed) {
+        activeLED++;
+        if (activeLED >= NUM_LEDS) {
+            activeLED = 0;
         }
-        prevState = newState;
-    }
-}
-
-static CallbackNode* volatile callbacks = NULL;
 
-static void EnqueueCallback(CallbackNode* node)
-{
-    uint32_t prevBasePri = NVIC_BlockIRQs();
-    if (!node->enqueued) {
-        CallbackNode* prevHead = callbacks;
-        node->enqueued = true;
-        callbacks = node;
-        node->next = prevHead;
+        updateLEDs();
+        updateCountingGPIOs();
     }
-    NVIC_RestoreIRQs(prevBasePri);
-}
-
-static void InvokeCallbacks(void)
-{
-    CallbackNode* node;
-    do {
-        uint32_t prevBasePri = NVIC_BlockIRQs();
-        node = callbacks;
-        if (node) {
-            node->enqueued = false;
-            callbacks = node->next;
-        }
-        NVIC_RestoreIRQs(prevBasePri);
-
-        if (node) {
-            (*node->cb)();
-        }
-    } while (node);
 }
 
 _Noreturn void RTCoreMain(void)
@@ -149,37 +101,27 @@ _Noreturn void RTCoreMain(void)
     UART_Print(debug, "--------------------------------\r\n");
     UART_Print(debug, "GPIO_ADC_RTApp_MT3620_BareMetal\r\n");
     UART_Print(debug, "App built on: " __DATE__ ", " __TIME__ "\r\n");
-    UART_Print(debug, "Press A to cycle LED state (cycles R-G-B(Play LED)-R(Wifi LED))\r\n");
 
-    GPIO_ConfigurePinForInput(buttonAGpio);
-    GPIO_ConfigurePinForInput(GPIO_IN_0);
-    GPIO_ConfigurePinForInput(GPIO_IN_1);
-    GPIO_ConfigurePinForInput(GPIO_IN_2);
-
-    GPIO_ConfigurePinForOutput(GPIO_PLAY_R);
-    GPIO_ConfigurePinForOutput(GPIO_PLAY_G);
-    GPIO_ConfigurePinForOutput(GPIO_PLAY_B);
-    GPIO_ConfigurePinForOutput(GPIO_WIFI_R);
-    GPIO_ConfigurePinForOutput(GPIO_OUT_0);
-    GPIO_ConfigurePinForOutput(GPIO_OUT_1);
-    GPIO_ConfigurePinForOutput(GPIO_OUT_2);
+    EventQueue_Init(&buttonEvents, 0, HandleButtonDeferred);
+    UART_Print(debug, "Press A to cycle LED state (cycles R-G-B(Play LED)-R(Wifi LED))\r\n");
 
-    updateLEDs();
+    for (unsigned i = 0; i < COUNT_BITS; i++) {
+        GPIO_ConfigurePinForInput(countIn[i]);
+        GPIO_ConfigurePinForOutput(countOut[i]);
+    }
 
-    // Setup GPT1 to poll for button press
-    if (!(buttonTimeout = GPT_Open(MT3620_UNIT_GPT1, 1000, GPT_MODE_REPEAT))) {
-        UART_Print(debug, "ERROR: Opening timer\r\n");
+    // The LEDs are all in the ADC block, so they're lit and cleared together.
+    if (GPIOGroup_ConfigureForOutput(&leds, ~(1U << activeLED)) != ERROR_NONE) {
+        UART_Print(debug, "ERROR: Configuring LED GPIOs\r\n");
     }
-    int32_t error;
 
-    if ((error = GPT_StartTimeout(buttonTimeout, buttonPressCheckPeriodMs,
-                                  GPT_UNITS_MILLISEC, &HandleButtonTimerIrq)) != ERROR_NONE) {
-        UART_Printf(debug, "ERROR: Starting timer (%ld)\r\n", error);
+    if (!Input_Open(buttonAGpio, INPUT_EDGE_PRESS, &buttonEvents)) {
+        UART_Print(debug, "ERROR: Configuring button interrupt\r\n");
     }
 
     for (;;) {
         __asm__("wfi");
-        InvokeCallbacks();
+        EventQueue_Dispatch();
     }
 
 }
@@ -14,6 +14,9 @@
 #include "lib/Print.h"
 #include "lib/GPT.h"
 
+#include "EventQueue.h"
+#include "Input.h"
+
 
 #define NUM_BUTTONS 2
 
@@ -44,15 +47,6 @@ typedef enum {
 
 static GPT_AppMode appMode = APP_MODE_FREERUN;
 
-// Callbacks
-typedef struct CallbackNode {
-    bool enqueued;
-    struct CallbackNode *next;
-    void (*cb)(void);
-} CallbackNode;
-
-static void EnqueueCallback(CallbackNode *node);
-
 static void printTimerState(void)
 {
     UART_Print(debug, "-----------------------------\r\n");
@@ -318,7 +312,7 @@ static void buttonB(void)
 
     case APP_MODE_INTERRUPT:
         // Extra demo mode for doing accurate timing of GPT1&3 (interrupt timers)
-        // using logic analyser (GPT0 is same ad 1 and is being used for buttons)
+        // using logic analyser (GPT0 is the same as 1)
         if (oldAppMode != appMode) {
             UART_Print(debug, "-----------------------------\r\n");
             UART_Print(debug, "INFO: Interrupt timer timing mode. \r\n");
@@ -357,68 +351,32 @@ static void buttonB(void)
 }
 
 typedef struct ButtonState {
-    bool         prevState;
-    CallbackNode cbn;
+    void       (*cb)(void);
     uint32_t     gpioPin;
 } ButtonState;
 
 static ButtonState buttons[NUM_BUTTONS] = {
-    {.prevState = true,
-     .cbn = {.enqueued = false, .cb = buttonA},
+    {.cb        = buttonA,
      .gpioPin   = 12},
-    {.prevState = true,
-     .cbn = {.enqueued = false, .cb = buttonB},
+    {.cb        = buttonB,
      .gpioPin   = 13}
 };
 
-static void handleButtonCallback(GPT *handle)
-{
-    (void)(handle);
-    // Assume initial state is high, i.e. button not pressed.
-    bool newState, pressed;
-
-    for (unsigned i = 0; i < NUM_BUTTONS; i++) {
-        GPIO_Read(buttons[i].gpioPin, &newState);
-        if (newState != buttons[i].prevState) {
-            pressed = !newState;
-            if (pressed) {
-                EnqueueCallback(&buttons[i].cbn);
-            }
-        }
-        buttons[i].prevState = newState;
-    }
-}
-
-static CallbackNode *volatile callbacks = NULL;
+// Presses are handled in the order they happened.
+EVENT_QUEUE_DEFINE(buttonEvents, Input_Event, 4);
 
-static void EnqueueCallback(CallbackNode *node)
+static void handleButtonDeferred(void *payload)
 {
-    uint32_t prevBasePri = NVIC_BlockIRQs();
-    if (!node->enqueued) {
-        CallbackNode *prevHead = callbacks;
-        node->enqueued = true;
-        callbacks = node;
-        node->next = prevHead;
+    const Input_Event *event = payload;
+    if (!event->pressed) {
+        return;
     }
-    NVIC_RestoreIRQs(prevBasePri);
-}
-
-static void InvokeCallbacks(void)
-{
-    CallbackNode *node;
-    do {
-        uint32_t prevBasePri = NVIC_BlockIRQs();
-        node = callbacks;
-        if (node) {
-            node->enqueued = false;
-            callbacks = node->next;
-        }
-        NVIC_RestoreIRQs(prevBasePri);
 
-        if (node) {
-            (*node->cb)();
+    for (unsigned i = 0; i < NUM_BUTTONS; i++) {
+        if (buttons[i].gpioPin == event->pin) {
+            buttons[i].cb();
         }
-    } while (node);
+    }
 }
 
 
@@ -432,6 +390,8 @@ _Noreturn void RTCoreMain(void)
     UART_Print(debug, "GPT_RTApp_MT3620_BareMetal\r\n");
     UART_Print(debug, "App built on: " __DATE__ " " __TIME__ "\r\n");
 
+    EventQueue_Init(&buttonEvents, 0, handleButtonDeferred);
+
     // Initialise timers and supported speeds
     for (unsigned i = 0; i < MT3620_UNIT_GPT_COUNT; i++) {
         timer[i] = GPT_Open(MT3620_UNIT_GPT0 + i, testSpeeds[i].speeds[1], GPT_MODE_NONE);
@@ -448,27 +408,21 @@ _Noreturn void RTCoreMain(void)
         "For timer timing. Sets all timers (except GPT0) off in freerun mode\r\n"
         "    Press A to start timers, subsequent presses will print timer counts.\r\n"
         "    Press B to cycle through speeds (LOW->MED_LOW->MED_HIGH->HIGH) and modes\r\n"
-        "NB: GPT0 is used to monitor button presses\r\n"
+        "NB: Buttons use external interrupts, so GPT0 is left alone\r\n"
         "NB: Only GPT3 supports speeds other than LOW/HIGH; anything not \r\n"
         "    HIGH will be LOW for timer->id != GPT3\r\n");
 
-    GPIO_ConfigurePinForInput(buttons[0].gpioPin);
-    GPIO_ConfigurePinForInput(buttons[1].gpioPin);
     GPIO_ConfigurePinForOutput(gpioOut[0]);
     GPIO_ConfigurePinForOutput(gpioOut[1]);
 
-    int32_t error;
-    if ((error = GPT_SetMode(timer[0], GPT_MODE_REPEAT)) != ERROR_NONE) {
-        UART_Printf(debug, "ERROR: GPT_SetMode failed %ld\r\n", error);
-    }
-    if ((error = GPT_StartTimeout(
-        timer[0], 100, GPT_UNITS_MILLISEC,
-        handleButtonCallback)) != ERROR_NONE) {
-        UART_Printf(debug, "ERROR: GPT_StartTimeout failed %ld\r\n", error);
+    for (unsigned i = 0; i < NUM_BUTTONS; i++) {
+        if (!Input_Open(buttons[i].gpioPin, INPUT_EDGE_PRESS, &buttonEvents)) {
+            UART_Printf(debug, "ERROR: Configuring button %u interrupt\r\n", i);
+        }
     }
 
     for (;;) {
         __asm__("wfi");
-        InvokeCallbacks();
+        EventQueue_Dispatch();
     }
 }
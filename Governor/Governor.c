@@ -0,0 +1,112 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stddef.h>
+
+#include "Governor.h"
+#include "lib/CPUFreq.h"
+#include "lib/NVIC.h"
+
+static unsigned           Governor__IdleFreq  = 0;
+static unsigned           Governor__BurstFreq = 0;
+static unsigned           Governor__Depth     = 0;
+static bool               Governor__Raised    = false;
+static Governor_Listener *Governor__Listeners = NULL;
+static Governor_Stats     Governor__Stats     = { 0 };
+
+// Only called with interrupts blocked.
+static void Governor__Set(unsigned freq)
+{
+    if (!CPUFreq_Set(freq)) {
+        return;
+    }
+
+    Governor_Listener *listener;
+    for (listener = Governor__Listeners; listener != NULL; listener = listener->next) {
+        listener->handler(freq);
+    }
+}
+
+bool Governor_Init(unsigned idleFreq, unsigned burstFreq)
+{
+    if ((idleFreq == 0) || (burstFreq < idleFreq)) {
+        return false;
+    }
+
+    bool success = false;
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    unsigned prevFreq = CPUFreq_Get();
+    if (CPUFreq_Set(burstFreq) && CPUFreq_Set(idleFreq)) {
+        Governor__IdleFreq  = idleFreq;
+        Governor__BurstFreq = burstFreq;
+        Governor__Raised    = false;
+        success = true;
+    } else {
+        CPUFreq_Set(prevFreq);
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+
+    return success;
+}
+
+void Governor_AddListener(Governor_Listener *listener)
+{
+    if (!listener || !listener->handler) {
+        return;
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    listener->next      = Governor__Listeners;
+    Governor__Listeners = listener;
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+void Governor_Begin(void)
+{
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    Governor__Stats.bursts++;
+    Governor__Depth++;
+    if (!Governor__Raised && (Governor__BurstFreq != 0)) {
+        Governor__Raised = true;
+        Governor__Stats.raises++;
+        if (Governor__BurstFreq != Governor__IdleFreq) {
+            Governor__Set(Governor__BurstFreq);
+        }
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+void Governor_End(void)
+{
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (Governor__Depth > 0) {
+        Governor__Depth--;
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+void Governor_Idle(void)
+{
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (Governor__Raised && (Governor__Depth == 0)) {
+        Governor__Raised = false;
+        if (Governor__BurstFreq != Governor__IdleFreq) {
+            Governor__Set(Governor__IdleFreq);
+        }
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+void Governor_GetStats(Governor_Stats *stats, bool reset)
+{
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (stats) {
+        *stats = Governor__Stats;
+    }
+    if (reset) {
+        Governor__Stats.bursts = 0;
+        Governor__Stats.raises = 0;
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
@@ -0,0 +1,75 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef GOVERNOR_H_
+#define GOVERNOR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Runs the core at a low clock while it's idle, and raises it only for bursts
+// of work which are worth running quickly, such as rendering a block of audio
+// or checking what was read from an SD card.
+//
+// Work is marked as a burst by Governor_Begin() and Governor_End(), which may
+// be nested and called from interrupts as well as the main loop. The first
+// Governor_Begin() raises the clock there and then. The last Governor_End()
+// doesn't drop it again, Governor_Idle() does, which the main loop calls just
+// before it sleeps, so bursts handled back to back only raise the clock once.
+// The loop should only sleep once it has checked, with interrupts masked,
+// that nothing was posted meanwhile, as Scheduler_Run() does when given
+// Governor_Idle() by Scheduler_SetIdle():
+//
+//     Governor_Init(26000000, 197600000);
+//
+//     static void HandleAudioRequestDeferred(void *payload)
+//     {
+//         Governor_Begin();
+//         AudioStream_Fill(audio);
+//         Governor_End();
+//     }
+//
+//     Scheduler_SetIdle(Governor_Idle);
+//     Scheduler_Run();
+//
+// Only the core's clock is changed. The drivers clock the GPTs, ISUs, I2S and
+// ADC from sources of their own, which is why the samples configure them the
+// same whether they run at 26 MHz or 197.6 MHz, so no divider has to change
+// with it. What does change is the rate of the DWT cycle counter, which the
+// event queues time their events with. Code which converts cycles to time can
+// be told of each change with a listener, as Scheduler_ClockChanged() keeps
+// the scheduler's deadlines in microseconds. Times measured across a change,
+// and any reported in cycles, mix the two rates, so profiling is best done
+// against a GPT with PROFILE_INIT(gpt), or with the clock held up for it.
+
+typedef void (*Governor_Handler)(unsigned freq);
+
+typedef struct Governor_Listener Governor_Listener;
+
+struct Governor_Listener {
+    Governor_Handler   handler;
+    Governor_Listener *next;
+};
+
+typedef struct {
+    uint32_t bursts;  // Calls of Governor_Begin().
+    uint32_t raises;  // Times the clock was raised for them.
+} Governor_Stats;
+
+// Sets the clock to idleFreq. Returns false, leaving the clock as it was, if
+// either frequency can't be set or burstFreq is lower than idleFreq.
+bool Governor_Init(unsigned idleFreq, unsigned burstFreq);
+
+// Calls the listener's handler, with interrupts blocked, each time the clock
+// is changed from then on. The listener must stay valid for good.
+void Governor_AddListener(Governor_Listener *listener);
+
+void Governor_Begin(void);
+void Governor_End(void);
+
+// Drops the clock back to idleFreq unless a burst is still running.
+void Governor_Idle(void);
+
+void Governor_GetStats(Governor_Stats *stats, bool reset);
+
+#endif // #ifndef GOVERNOR_H_
@@ -2,6 +2,7 @@
    Licensed under the MIT License. */
 
 #include "SSD1306.h"
+#include "Placement.h"
 
 typedef union __attribute__((__packed__)) {
     struct __attribute__((__packed__)) {
@@ -12,26 +13,71 @@ typedef union __attribute__((__packed__)) {
     uint8_t mask;
 } Ssd1306_I2CHeader;
 
-typedef struct __attribute__((__packed__)) {
-    Ssd1306_I2CHeader header;
-    uint8_t           data;
-} Ssd1306_Packet;
+// The controller takes a single control byte with the continuation bit clear
+// followed by a stream of command or data bytes, so a write is sent as one
+// header and the caller's bytes. Anything over a few bytes has to be in SYSRAM
+// for the I2C driver, so data is staged through a small SYSRAM buffer in chunks;
+// the column and page pointers carry on from one transaction to the next.
+#define SSD1306_MAX_CHUNK_WRITE 128
+static SYSRAM_DATA uint8_t Ssd1306_Packet[1 + SSD1306_MAX_CHUNK_WRITE];
 
-#define SSD1306_MAX_DATA_WRITE 1024
 static bool Ssd1306_Write(I2CMaster *driver, bool isData, const void *data, uintptr_t size)
 {
-    static __attribute__((section(".sysram"))) Ssd1306_Packet cmd[SSD1306_MAX_DATA_WRITE];
-    if (size > SSD1306_MAX_DATA_WRITE) {
+    if (!isData && (size > SSD1306_MAX_CHUNK_WRITE)) {
         return false;
     }
 
-    uintptr_t i;
-    for (i = 0; i < size; i++) {
-        cmd[i].header = (Ssd1306_I2CHeader){ .isData = isData, .cont = (i < (size - 1)) };
-        cmd[i].data   = ((uint8_t *)data)[i];
+    Ssd1306_Packet[0] = ((Ssd1306_I2CHeader){ .isData = isData, .cont = false }).mask;
+
+    const uint8_t *src = data;
+    while (size > 0) {
+        uintptr_t chunk = (size > SSD1306_MAX_CHUNK_WRITE ? SSD1306_MAX_CHUNK_WRITE : size);
+        __builtin_memcpy(&Ssd1306_Packet[1], src, chunk);
+        if (I2CMaster_WriteSync(driver, SSD1306_ADDRESS, Ssd1306_Packet, (1 + chunk)) != ERROR_NONE) {
+            return false;
+        }
+        src  += chunk;
+        size -= chunk;
+    }
+
+    return true;
+}
+
+// Sends pages bytes from each of columns columns, stride bytes apart, so part of
+// a column ordered buffer can be sent as one data stream.
+static bool Ssd1306_WriteColumns(
+    I2CMaster *driver, const uint8_t *src, uintptr_t columns, uintptr_t pages, uintptr_t stride)
+{
+    if (stride == pages) {
+        return Ssd1306_Write(driver, true, src, (columns * pages));
     }
 
-    return (I2CMaster_WriteSync(driver, SSD1306_ADDRESS, cmd, (size * sizeof(cmd[0]))) == ERROR_NONE);
+    Ssd1306_Packet[0] = ((Ssd1306_I2CHeader){ .isData = true, .cont = false }).mask;
+
+    uintptr_t fill = 0;
+    uintptr_t c;
+    for (c = 0; c < columns; c++, src += stride) {
+        uintptr_t p;
+        for (p = 0; p < pages; ) {
+            uintptr_t chunk = (SSD1306_MAX_CHUNK_WRITE - fill);
+            if (chunk > (pages - p)) {
+                chunk = (pages - p);
+            }
+            __builtin_memcpy(&Ssd1306_Packet[1 + fill], &src[p], chunk);
+            fill += chunk;
+            p    += chunk;
+
+            if (fill == SSD1306_MAX_CHUNK_WRITE) {
+                if (I2CMaster_WriteSync(driver, SSD1306_ADDRESS, Ssd1306_Packet, (1 + fill)) != ERROR_NONE) {
+                    return false;
+                }
+                fill = 0;
+            }
+        }
+    }
+
+    return ((fill == 0)
+        || (I2CMaster_WriteSync(driver, SSD1306_ADDRESS, Ssd1306_Packet, (1 + fill)) == ERROR_NONE));
 }
 
 //Static functions for hardware configuration
@@ -107,24 +153,150 @@ static bool SSD1306_SetVComDetect(I2CMaster *driver, uint8_t value)
 }
 //End of hardware configuration functions
 
-//Sets the start and end column address for the data that is being sent
-static bool SSD1306_SetColumnAddress(I2CMaster *driver, uint8_t columnStart, uint8_t columnEnd)
+//Sets the column and page range for the data that is being sent, the address
+//wraps to the next column at the end of each column's pages
+static bool SSD1306_SetWindow(
+    I2CMaster *driver, uint8_t columnStart, uint8_t columnEnd, uint8_t pageStart, uint8_t pageEnd)
 {
-    if ((columnStart >= SSD1306_WIDTH) || (columnEnd >= SSD1306_WIDTH)) {
+    if ((columnStart > columnEnd) || (columnEnd >= SSD1306_WIDTH)
+        || (pageStart > pageEnd) || (pageEnd >= SSD1306_PAGES)) {
         return false;
     }
-    uint8_t packet[] = { SSD1306_CMD_SETCOLUMNADDR, columnStart, columnEnd };
+    uint8_t packet[] = {
+        SSD1306_CMD_SETCOLUMNADDR, columnStart, columnEnd,
+        SSD1306_CMD_PAGEADDR     , pageStart  , pageEnd  ,
+    };
     return Ssd1306_Write(driver, false, packet, sizeof(packet));
 }
 
 bool SSD1306_WriteFullBuffer(I2CMaster *driver, const void *data, uintptr_t size)
 {
-    if (!SSD1306_SetColumnAddress(driver, 0, (SSD1306_WIDTH - 1))) {
+    if (size != (SSD1306_WIDTH * SSD1306_PAGES)) {
+        return false;
+    }
+    if (!SSD1306_SetWindow(driver, 0, (SSD1306_WIDTH - 1), 0, (SSD1306_PAGES - 1))) {
         return false;
     }
     return Ssd1306_Write(driver, true, data, size);
 }
 
+bool SSD1306_WriteFrame(I2CMaster *driver, SSD1306_Frame *frame)
+{
+    if (!SSD1306_SetWindow(driver, 0, (SSD1306_WIDTH - 1), 0, (SSD1306_PAGES - 1))) {
+        return false;
+    }
+    frame->header = ((Ssd1306_I2CHeader){ .isData = true, .cont = false }).mask;
+    return (I2CMaster_WriteSync(driver, SSD1306_ADDRESS, frame, sizeof(*frame)) == ERROR_NONE);
+}
+
+bool SSD1306_WriteWindow(
+    I2CMaster *driver, unsigned columnStart, unsigned columnEnd, unsigned pageStart, unsigned pageEnd,
+    const void *data, uintptr_t size)
+{
+    if ((columnStart > columnEnd) || (columnEnd >= SSD1306_WIDTH)
+        || (pageStart > pageEnd) || (pageEnd >= SSD1306_PAGES)) {
+        return false;
+    }
+    if (size != ((columnEnd - columnStart + 1) * (pageEnd - pageStart + 1))) {
+        return false;
+    }
+    if (!SSD1306_SetWindow(driver, columnStart, columnEnd, pageStart, pageEnd)) {
+        return false;
+    }
+    return Ssd1306_Write(driver, true, data, size);
+}
+
+// Rough cost in bus bytes of starting another window: the addressing commands and
+// the extra I2C address and control bytes.
+#define SSD1306_WINDOW_OVERHEAD 10
+
+bool SSD1306_WriteChanges(I2CMaster *driver, SSD1306_Shadow *shadow, const void *data, uintptr_t size)
+{
+    if (size != sizeof(shadow->data)) {
+        return false;
+    }
+
+    if (!shadow->valid) {
+        if (!SSD1306_WriteFullBuffer(driver, data, size)) {
+            return false;
+        }
+        __builtin_memcpy(shadow->data, data, size);
+        shadow->valid = true;
+        return true;
+    }
+
+    // Find the span of changed columns within each page.
+    const uint8_t *src = data;
+    uint8_t first[SSD1306_PAGES], last[SSD1306_PAGES];
+    unsigned c, p;
+    for (p = 0; p < SSD1306_PAGES; p++) {
+        first[p] = SSD1306_WIDTH;
+        last[p]  = 0;
+    }
+    for (c = 0; c < SSD1306_WIDTH; c++) {
+        const uint8_t *column = &src[c * SSD1306_PAGES];
+        const uint8_t *shown  = &shadow->data[c * SSD1306_PAGES];
+        for (p = 0; p < SSD1306_PAGES; p++) {
+            if (column[p] != shown[p]) {
+                if (first[p] == SSD1306_WIDTH) {
+                    first[p] = c;
+                }
+                last[p] = c;
+            }
+        }
+    }
+
+    // Send each page's span, merging pages into one window where resending the
+    // unchanged bytes between them is cheaper than another window.
+    p = 0;
+    while (p < SSD1306_PAGES) {
+        if (first[p] == SSD1306_WIDTH) {
+            p++;
+            continue;
+        }
+
+        unsigned pageStart = p, pageEnd = p;
+        unsigned columnStart = first[p], columnEnd = last[p];
+        uintptr_t cost = (columnEnd - columnStart + 1);
+
+        unsigned q;
+        for (q = (p + 1); q < SSD1306_PAGES; q++) {
+            if (first[q] == SSD1306_WIDTH) {
+                continue;
+            }
+            unsigned start = (first[q] < columnStart ? first[q] : columnStart);
+            unsigned end   = (last[q]  > columnEnd   ? last[q]  : columnEnd  );
+            uintptr_t merged   = ((end - start + 1) * (q - pageStart + 1));
+            uintptr_t separate = (cost + (last[q] - first[q] + 1) + SSD1306_WINDOW_OVERHEAD);
+            if (merged > separate) {
+                break;
+            }
+            pageEnd     = q;
+            columnStart = start;
+            columnEnd   = end;
+            cost        = merged;
+        }
+
+        unsigned columns = (columnEnd - columnStart + 1);
+        unsigned pages   = (pageEnd - pageStart + 1);
+        uintptr_t offset = ((columnStart * SSD1306_PAGES) + pageStart);
+        if (!SSD1306_SetWindow(driver, columnStart, columnEnd, pageStart, pageEnd)
+            || !Ssd1306_WriteColumns(driver, &src[offset], columns, pages, SSD1306_PAGES)) {
+            // The display is now in an unknown state, resend everything next time.
+            shadow->valid = false;
+            return false;
+        }
+
+        for (c = 0; c < columns; c++, offset += SSD1306_PAGES) {
+            __builtin_memcpy(&shadow->data[offset], &src[offset], pages);
+        }
+
+        p = (pageEnd + 1);
+    }
+
+    return true;
+}
+
 bool SSD1306_SetDisplayOnOff(I2CMaster *driver, bool displayOnTrue)
 {
     uint8_t value = SSD1306_CMD_DISPLAYONOFF | displayOnTrue;
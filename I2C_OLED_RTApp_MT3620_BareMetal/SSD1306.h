@@ -10,9 +10,27 @@
 
 #define SSD1306_WIDTH  128
 #define SSD1306_HEIGHT  64
+#define SSD1306_PAGES   (SSD1306_HEIGHT / 8)
 
 #define SSD1306_ADDRESS 0x3C
 
+/// <summary>A display buffer with room for the I2C control byte ahead of the pixels, so it
+/// can be sent to the controller without being copied. Pixels are in the controller's
+/// vertical addressing order: for each column, one byte per page of 8 rows, with the top row
+/// in the least significant bit.</summary>
+typedef struct __attribute__((__packed__)) {
+    uint8_t header;
+    uint8_t data[SSD1306_WIDTH * SSD1306_PAGES];
+} SSD1306_Frame;
+
+/// <summary>A copy of what was last sent to the display, so SSD1306_WriteChanges only needs
+/// to send what differs. A zero initialised shadow is invalid, so the first write sends the
+/// whole buffer.</summary>
+typedef struct {
+    uint8_t data[SSD1306_WIDTH * SSD1306_PAGES];
+    bool    valid;
+} SSD1306_Shadow;
+
 /// <summary>Enum for command bytes of the SSD1306 controller.</summary>
 typedef enum {
     SSD1306_CMD_CHARGEPUMP         = 0x8D,
@@ -72,6 +90,45 @@ typedef enum {
 /// <returns>True or false to indicate success of the write.</returns>
 bool SSD1306_WriteFullBuffer(I2CMaster *driver, const void *data, uintptr_t size);
 
+/// <summary>
+/// <para>A function to write a whole frame to display RAM straight from the frame, without
+/// staging it. The frame must be in SYSRAM, and its header is overwritten.</para>
+/// </summary>
+/// <param name="driver">The address of the I2C controller the device is connected to.</param>
+/// <param name="frame">A pointer to the frame to be sent to the display RAM.</param>
+/// <returns>True or false to indicate success of the write.</returns>
+bool SSD1306_WriteFrame(I2CMaster *driver, SSD1306_Frame *frame);
+
+/// <summary>
+/// <para>A function to write part of the display RAM, leaving the rest as it is.</para>
+/// </summary>
+/// <param name="driver">The address of the I2C controller the device is connected to.</param>
+/// <param name="columnStart">The first column of the window.</param>
+/// <param name="columnEnd">The last column of the window, inclusive.</param>
+/// <param name="pageStart">The first page (row of 8 pixels) of the window.</param>
+/// <param name="pageEnd">The last page of the window, inclusive.</param>
+/// <param name="data">A pointer to the data for the window, in the same order as a whole
+/// buffer: for each column, one byte per page.</param>
+/// <param name="size">The size of the data being sent, used for error checking. Should always
+/// be the number of columns multiplied by the number of pages.</param>
+/// <returns>True or false to indicate success of the write.</returns>
+bool SSD1306_WriteWindow(
+    I2CMaster *driver, unsigned columnStart, unsigned columnEnd, unsigned pageStart, unsigned pageEnd,
+    const void *data, uintptr_t size);
+
+/// <summary>
+/// <para>A function to write a whole buffer to display RAM, sending only the spans of each page
+/// which differ from the last buffer written through the same shadow.</para>
+/// </summary>
+/// <param name="driver">The address of the I2C controller the device is connected to.</param>
+/// <param name="shadow">The shadow of the display, updated with what is sent. If a write fails
+/// the shadow is invalidated, so the next write resends the whole buffer.</param>
+/// <param name="data">A pointer to the data to be sent to the display RAM.</param>
+/// <param name="size">The size of the data being sent, used for error checking. Should always
+/// be 128x64.</param>
+/// <returns>True or false to indicate success of the write.</returns>
+bool SSD1306_WriteChanges(I2CMaster *driver, SSD1306_Shadow *shadow, const void *data, uintptr_t size);
+
 /// <summary>
 /// <para>A function to turn the display on/off.</para>
 /// </summary>
@@ -1,65 +0,0 @@
-/* https://ccsearch.creativecommons.org/photos/68b40da1-78b8-4881-809e-d546069c288c */
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFD, 0xFF, 0xFF, 0xF7, 0xDE, 0xFB, 0x5B, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF,
-0xED, 0xB7, 0xDB, 0x6D, 0xBF, 0x7F, 0xDD, 0xFE, 0xBF, 0x7F, 0x7D, 0xB6, 0xDB, 0xF7, 0xDB, 0x6D,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xEB, 0x6B, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFF, 0x7D, 0xDE, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0x7F, 0xFF,
-0xDD, 0xDF, 0xF7, 0x77, 0x6F, 0xDD, 0xA6, 0xF7, 0x57, 0xFF, 0xED, 0xDD, 0xDD, 0xFF, 0xFB, 0xBB,
-0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFA, 0xBB, 0x5A, 0xBD, 0xBF, 0xFF, 0xFF, 0xFF, 0xF7, 0xEF, 0xFF,
-0xFF, 0xFF, 0xBF, 0xFD, 0xFF, 0x6D, 0x52, 0xEF, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF,
-0xED, 0xBE, 0xFB, 0x6F, 0xFD, 0xF4, 0xD7, 0x5A, 0x7E, 0xDF, 0xEE, 0xDB, 0x6D, 0xFF, 0xFF, 0x6F,
-0xFF, 0xFB, 0xFF, 0xFF, 0xB7, 0xD5, 0x5A, 0xED, 0x6D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFD,
-0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x55, 0x4F, 0x54, 0xFF, 0xB7, 0xFF, 0xFF, 0xFF, 0xBB, 0xFF, 0xFF,
-0xDD, 0xDF, 0xDB, 0xBB, 0xFF, 0xA9, 0x25, 0xDB, 0x5B, 0xFD, 0xFD, 0xDE, 0xF7, 0xFF, 0x7F, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x52, 0x17, 0x65, 0xFE, 0xAF, 0xFF, 0xFB, 0xFE, 0xFF, 0xF7, 0xB7,
-0xFF, 0xFB, 0x7F, 0xFF, 0xEE, 0x84, 0x9D, 0x9A, 0xAF, 0xFB, 0x7F, 0xFF, 0xDF, 0xEF, 0xFE, 0xFF,
-0xED, 0xBF, 0xFD, 0xB7, 0xBA, 0x22, 0x0B, 0x2D, 0xFB, 0xBF, 0xFF, 0x7F, 0xFF, 0xFD, 0xDF, 0xFF,
-0xFF, 0xFF, 0xEF, 0xFE, 0xFD, 0x05, 0x04, 0xB7, 0x6E, 0xED, 0x5F, 0xEF, 0x7B, 0xBF, 0xFF, 0xFB,
-0xFF, 0xF6, 0xFF, 0xFF, 0xF4, 0x08, 0x80, 0xBB, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xFF, 0x7B, 0xDF,
-0xDD, 0xDF, 0xFE, 0xF7, 0xFA, 0x00, 0x45, 0x5D, 0xB6, 0xDA, 0xEF, 0xFF, 0xFE, 0xF7, 0xFF, 0x7F,
-0xFF, 0xFF, 0xDB, 0xDF, 0xEA, 0x42, 0x82, 0xEF, 0xFF, 0xFF, 0x7F, 0xEF, 0xEF, 0xFF, 0xEF, 0xFF,
-0xFF, 0xFF, 0x7F, 0xFE, 0xE8, 0x00, 0xEA, 0xBE, 0xEB, 0x5A, 0xCB, 0xFF, 0xBF, 0xFD, 0xFF, 0xFB,
-0xED, 0xBB, 0xFF, 0xFF, 0xEE, 0x00, 0x52, 0xAB, 0xFF, 0xFD, 0xEF, 0xFD, 0xFD, 0xB7, 0xBD, 0xEF,
-0xFF, 0xFF, 0xFF, 0x7B, 0xD4, 0x01, 0x5A, 0xBF, 0x55, 0xB7, 0xAB, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xED, 0xFF, 0xD4, 0x40, 0xAD, 0x45, 0xFF, 0xFA, 0xD6, 0xFF, 0xF7, 0xFF, 0xF7, 0xBF,
-0xDD, 0xDB, 0x7F, 0xEF, 0x6A, 0x02, 0x56, 0xAD, 0xAE, 0xD7, 0xCB, 0xFF, 0xBF, 0xDE, 0xFF, 0xFD,
-0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x01, 0x3D, 0xB7, 0xB7, 0xBF, 0xAE, 0xFD, 0xFE, 0xFF, 0xFE, 0xF7,
-0xF7, 0xFF, 0xFF, 0x7D, 0xAA, 0x82, 0xA5, 0x7A, 0xBB, 0xBD, 0x8B, 0xEF, 0xFB, 0xFB, 0xDB, 0xFF,
-0xFF, 0x77, 0x6D, 0xF7, 0xD4, 0x85, 0x56, 0xEF, 0xAE, 0xEF, 0xD5, 0xFF, 0xDF, 0xEF, 0xFF, 0xFF,
-0xDF, 0xFF, 0xFF, 0xFF, 0xA2, 0x02, 0xEB, 0xBB, 0x5B, 0xFF, 0x47, 0x7E, 0xFF, 0xFF, 0x7F, 0xDD,
-0xFD, 0xFD, 0xFF, 0xDF, 0xAB, 0xC9, 0x55, 0xDD, 0xB7, 0x7B, 0xC9, 0xFB, 0xFF, 0x7F, 0xFE, 0xFF,
-0xFF, 0xDF, 0xEE, 0xFF, 0x85, 0x05, 0xAE, 0xEB, 0x6D, 0xEF, 0xA5, 0xFF, 0xF7, 0xFB, 0xEF, 0xF7,
-0xEF, 0xFF, 0xBF, 0xFD, 0xDA, 0xE9, 0xAB, 0x5D, 0xAF, 0xBD, 0xE5, 0xDF, 0xDF, 0xDF, 0xBF, 0xDF,
-0xFE, 0xF6, 0xFF, 0xF7, 0xAB, 0x51, 0x55, 0x75, 0x9A, 0xFF, 0xB5, 0x7F, 0x7E, 0xFF, 0xFD, 0xFF,
-0xFB, 0xFF, 0xFB, 0xBF, 0x95, 0xA2, 0x96, 0xCA, 0x97, 0xEB, 0xEA, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF,
-0xDF, 0xDF, 0xFF, 0xFF, 0xAA, 0xDA, 0xAA, 0xA2, 0x8B, 0x7E, 0xE5, 0xFF, 0xFB, 0xEF, 0xDF, 0x7B,
-0xFF, 0xFF, 0xDF, 0xFB, 0xA5, 0x2C, 0xAA, 0xAA, 0x2F, 0xDB, 0xAB, 0xFF, 0xEF, 0xBF, 0x7B, 0xEF,
-0xFF, 0x7B, 0x7D, 0xBF, 0xCA, 0xB6, 0xB5, 0xAB, 0xFD, 0x7F, 0xEA, 0xBB, 0xBF, 0xFF, 0xFF, 0xFF,
-0xED, 0xFF, 0xFF, 0xFF, 0x42, 0x55, 0x55, 0x55, 0x6F, 0xDD, 0xD5, 0xFF, 0xFF, 0xFB, 0xFF, 0x7F,
-0xFF, 0xFF, 0xF7, 0xED, 0xD2, 0x95, 0x6A, 0xAF, 0xFE, 0xF7, 0x6A, 0xBE, 0xFE, 0xEF, 0xDD, 0xFB,
-0xFF, 0xDB, 0xDF, 0x7F, 0xD5, 0x6D, 0x55, 0x16, 0xDB, 0xDF, 0xFA, 0xFF, 0xFB, 0xFF, 0x7F, 0xEF,
-0xDE, 0xFF, 0x7F, 0xFF, 0xD2, 0xB6, 0xAA, 0xAD, 0xFF, 0xFD, 0xAE, 0xBB, 0xEF, 0xFF, 0xFF, 0xFF,
-0xFB, 0xFF, 0xFF, 0xFB, 0xEA, 0x5B, 0x50, 0x57, 0xBE, 0xDF, 0xFF, 0xFF, 0xBF, 0xBB, 0xF7, 0x7F,
-0xFF, 0xF7, 0xFD, 0xDF, 0xE5, 0x2A, 0xAB, 0x6E, 0xEB, 0xF5, 0x6B, 0x7F, 0xFF, 0xFF, 0xDF, 0xF7,
-0xEF, 0xDF, 0x77, 0xFF, 0x72, 0xC7, 0xDA, 0x7B, 0xFF, 0x7F, 0xBF, 0xFB, 0xFD, 0xFF, 0x7F, 0xDF,
-0xFF, 0x7F, 0xFF, 0xFD, 0xF4, 0xB1, 0x6D, 0x57, 0x5D, 0xD5, 0xED, 0xFF, 0x77, 0xDB, 0xFD, 0xFF,
-0xFD, 0xFD, 0xFF, 0x6F, 0xF2, 0x55, 0x55, 0xBD, 0xD7, 0xBE, 0xBF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD,
-0xDF, 0xFF, 0xDD, 0xFF, 0xDC, 0x9A, 0xB6, 0xEE, 0xBE, 0xEB, 0xEB, 0xBF, 0xDF, 0xFF, 0xEF, 0xBF,
-0xFF, 0xF7, 0xFF, 0xFF, 0x7A, 0x4A, 0xDB, 0x5A, 0xF7, 0xB6, 0xBE, 0xFD, 0xFE, 0xDD, 0xBE, 0xFF,
-0xF7, 0xBF, 0x7F, 0xED, 0xFD, 0x2D, 0x6B, 0xF7, 0x5D, 0xDF, 0xEB, 0xFF, 0xFB, 0xFF, 0xFF, 0xF7,
-0xDE, 0xFF, 0xF6, 0xFF, 0xFE, 0x15, 0xAD, 0x5D, 0xEE, 0xAA, 0xBF, 0xFF, 0x6F, 0xF7, 0xFB, 0xFF,
-0xFF, 0xFB, 0xFF, 0xFF, 0xF7, 0x56, 0xB6, 0xEE, 0xB5, 0xBB, 0xDF, 0xED, 0xFF, 0xDF, 0x6F, 0xDD,
-0xFF, 0xEF, 0xBF, 0xB7, 0xBF, 0x09, 0xAB, 0x55, 0xEA, 0xEA, 0xB7, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F,
-0xF7, 0xBF, 0xF6, 0xFE, 0xFF, 0xC4, 0xAA, 0xDB, 0x5F, 0x57, 0xEF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF,
-0xDE, 0xFE, 0xFF, 0xFF, 0xFB, 0xEA, 0xB5, 0x6D, 0x53, 0xBA, 0xBF, 0xDB, 0xB7, 0xFF, 0xDD, 0xF7,
-0xFF, 0xFF, 0xFF, 0xF7, 0xEF, 0x69, 0x5A, 0x96, 0xDD, 0x6D, 0xFD, 0xFF, 0xFF, 0xEF, 0xFF, 0xDF,
-0xFF, 0xF7, 0xB7, 0x7F, 0x7F, 0xF5, 0x4A, 0xA3, 0x2A, 0xDB, 0x6F, 0xFF, 0x7F, 0xBE, 0xF7, 0x7F,
-0xED, 0xDF, 0xFF, 0xFD, 0xFF, 0xFC, 0xAA, 0xDC, 0xD5, 0x6E, 0xFF, 0x6D, 0xF6, 0xFF, 0xDF, 0xFD,
-0xFF, 0xFE, 0xFD, 0xDF, 0xFB, 0xBE, 0x55, 0x6B, 0x55, 0xB7, 0xFD, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-0xFF, 0x7F, 0xEF, 0xFF, 0xDF, 0xFB, 0xAA, 0xAA, 0xAA, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 0xEF,
-0xB7, 0xFB, 0xFF, 0xF7, 0x7F, 0x7F, 0xEB, 0x55, 0x57, 0x7B, 0xBF, 0xF7, 0xB7, 0xBF, 0x77, 0xBD,
-0xFF, 0xEF, 0xBE, 0xFF, 0xFD, 0xFF, 0xFD, 0x5B, 0x6A, 0xEF, 0xFF, 0xBE, 0xFE, 0xFB, 0xFF, 0xFF,
-0xFE, 0xFF, 0xFB, 0xDF, 0xF7, 0xEF, 0xFF, 0xAA, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-0xF7, 0xFF, 0xFF, 0xFD, 0xDF, 0xFE, 0xDD, 0xFF, 0xFF, 0xFE, 0xEF, 0xFB, 0xF7, 0xEF, 0x7E, 0xF7,
-0xDF, 0xDD, 0xDF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xED, 0xBB, 0xFF, 0xDF, 0xDF, 0xBF, 0xFF, 0xFF,
@@ -1,65 +0,0 @@
-/* https://ccsearch.creativecommons.org/photos/22ea2be2-097e-4330-b018-0ed727467008 */
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xDF, 0x7F, 0xFF, 0x76, 0xDB, 0x6D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFD, 0xFD, 0xF7, 0x6D, 0xFF, 0xFF, 0xFF, 0xB7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0x6D, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xF6, 0xFD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF7, 0xFD, 0xED, 0xFF, 0xB6, 0xDF, 0xDF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xDF, 0xDF, 0xDF, 0xBF, 0xB5, 0xFB, 0xFB, 0x7B, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x5E, 0xAF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xEE, 0xAB, 0xEB, 0xFD, 0xBF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBF, 0xFD, 0x7E, 0xD7, 0xFB, 0xFB, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFE, 0xFF, 0xFF, 0x7F, 0xF5, 0x57, 0xAB, 0x7D, 0x5F, 0xBF, 0x7F, 0xDF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x7D, 0xFD, 0xBF, 0xED, 0x7D, 0xD7, 0xF6, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x5B, 0xAB, 0x7D, 0x5F, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0x7D, 0xB6, 0xFF, 0xD7, 0xF5, 0xBF, 0xFF, 0xFF, 0xEF, 0x7E, 0xFF,
-0xFF, 0xF7, 0xFB, 0xFF, 0xFF, 0xD6, 0xDB, 0x55, 0x7A, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF7, 0xBB, 0x7B, 0x6D, 0xEF, 0xAF, 0xD5, 0x6D, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD5, 0xB6, 0xBA, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFE, 0xEB, 0xB6, 0xAB, 0xEF, 0xAF, 0x55, 0x5B, 0x7F, 0xBF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xEF, 0xDF, 0xFE, 0xDA, 0xDD, 0x7B, 0xFB, 0xEF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF,
-0xFF, 0xBF, 0xFF, 0xFF, 0xB7, 0x6B, 0x6B, 0xAE, 0xDD, 0x5A, 0xAD, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x7F, 0xFD, 0xFA, 0xAD, 0x5E, 0xFF, 0xF7, 0xBF, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB,
-0xFF, 0xFF, 0xFF, 0x7F, 0xAF, 0x6A, 0xAB, 0xFF, 0x7D, 0xEA, 0xAF, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF7, 0xF5, 0xAA, 0xB6, 0xDB, 0xEE, 0xB6, 0xFB, 0xEF, 0xDF, 0xFF, 0xFB, 0xDF,
-0xFF, 0xFB, 0xFD, 0xFE, 0xBA, 0xAA, 0xDF, 0xFF, 0xBB, 0xDB, 0x56, 0xFB, 0x7F, 0xFF, 0xEF, 0xFF,
-0xFF, 0xFF, 0xF7, 0xFB, 0xED, 0x55, 0x55, 0xBD, 0xFE, 0xAD, 0xBF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xDF, 0xDF, 0xDF, 0x56, 0xA9, 0x5F, 0xF7, 0xF7, 0xEA, 0xD5, 0xEF, 0xFD, 0xDF, 0xFF, 0xFF,
-0xFF, 0x7F, 0xFF, 0xFD, 0xFA, 0x95, 0x6B, 0x7F, 0xDD, 0x56, 0xB6, 0xBD, 0xF7, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF7, 0x55, 0x44, 0xAF, 0xFF, 0x7F, 0x6A, 0xAF, 0xF7, 0xBF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x7D, 0xD4, 0xAA, 0xB6, 0xEF, 0xF5, 0xAA, 0xDA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFE, 0xFD, 0xEF, 0x6A, 0x11, 0x5B, 0xFD, 0xFE, 0xAA, 0x55, 0xED, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xEF, 0xFA, 0xAA, 0xA4, 0xAF, 0xBF, 0xB6, 0xAA, 0xAE, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xB7, 0xD4, 0x82, 0x55, 0xF7, 0xFB, 0x52, 0xAB, 0xEE, 0xDF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFE, 0xFD, 0x52, 0x29, 0x2F, 0xDF, 0x6D, 0x49, 0x55, 0x7B, 0xFD, 0xF7, 0xFF, 0xFF,
-0xFF, 0x77, 0xBB, 0xEE, 0xD5, 0x00, 0xAA, 0xFD, 0xF5, 0x24, 0xAB, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF7, 0x54, 0x44, 0xAF, 0xBF, 0xAD, 0x52, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x5D, 0x52, 0x11, 0x15, 0xF6, 0xF4, 0x89, 0x2B, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xF7, 0xF7, 0xA9, 0x40, 0x55, 0x5F, 0xAA, 0x44, 0x95, 0x7F, 0xEF, 0xFF, 0xFF, 0xEF,
-0xFF, 0xFF, 0x7F, 0xFD, 0x54, 0x05, 0x2B, 0xF5, 0x51, 0x11, 0x56, 0xD6, 0xFF, 0x7F, 0xFF, 0xBF,
-0xFF, 0xFF, 0xFE, 0xAD, 0xAA, 0x90, 0x4A, 0x5B, 0x54, 0x84, 0x2B, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFD, 0xFB, 0xFB, 0x69, 0x21, 0x15, 0x55, 0x48, 0x21, 0x55, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xF7, 0xFF, 0xEE, 0xD4, 0x84, 0x45, 0x55, 0x22, 0x8A, 0x56, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF,
-0xFF, 0xDF, 0xFF, 0xBD, 0xAA, 0x40, 0x29, 0x54, 0x90, 0x01, 0x55, 0x57, 0xFB, 0xFF, 0x7F, 0xFF,
-0xFF, 0xFF, 0xFE, 0xF7, 0x75, 0x2A, 0x84, 0x89, 0x04, 0x29, 0x2B, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xEF, 0xFF, 0xAA, 0xA0, 0x52, 0x50, 0x40, 0x84, 0xAE, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xDA, 0xED, 0x55, 0x08, 0x85, 0x08, 0x12, 0xB5, 0xEF, 0xFF, 0xFB, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x7F, 0xB6, 0xA4, 0xA2, 0x20, 0x00, 0x44, 0xAF, 0x7F, 0xEF, 0xEF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFD, 0xFB, 0x6A, 0xAA, 0x48, 0x80, 0x02, 0x12, 0xB5, 0xDE, 0xFF, 0xBF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD5, 0x24, 0x08, 0x10, 0xAA, 0xDB, 0x7B, 0xFF, 0xFF, 0xFF, 0xEF,
-0xFF, 0xBF, 0xFF, 0xED, 0xAB, 0x54, 0x91, 0x20, 0x82, 0x15, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xF7, 0xFF, 0xFD, 0xB5, 0x4A, 0x02, 0x08, 0xD5, 0xB5, 0xB7, 0xF7, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFE, 0xD6, 0xD6, 0xA8, 0xA0, 0x22, 0x2A, 0xEF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xBB, 0xFF, 0xBA, 0xA5, 0x09, 0x15, 0x57, 0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xD6, 0xB4, 0xA4, 0xA2, 0xAA, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xBF, 0xFF, 0xBF, 0x7B, 0x55, 0x52, 0x15, 0x7F, 0xB7, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFE, 0xFE, 0xFB, 0xDD, 0xD5, 0x29, 0x6A, 0xAA, 0xFE, 0xDF, 0xDF, 0xFF, 0xFF, 0xDF,
-0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x76, 0xB5, 0xA5, 0x56, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFB, 0xFF, 0xFF, 0xFD, 0xFF, 0xDD, 0x55, 0x55, 0xBB, 0x7B, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xDA, 0xEB, 0x5B, 0x6E, 0xEF, 0xFF, 0x7D, 0xEE, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xAD, 0xB7, 0xBD, 0xEF, 0xEF, 0xBF, 0xFF, 0xFE, 0xFF,
-0xFF, 0xFF, 0xFF, 0xBF, 0x7F, 0x77, 0xD6, 0xF6, 0xDA, 0xF7, 0xBF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFE, 0xFB, 0xAB, 0x7F, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDE, 0xFE, 0xD6, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
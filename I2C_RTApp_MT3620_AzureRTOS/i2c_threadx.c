@@ -3,14 +3,74 @@
 
 #include "i2c_threadx.h"
 
+static void I2CMaster_RTOS_Callback(int32_t status, uintptr_t count, void *userData);
+
+static void I2CMaster_RTOS_Finish(i2c_rtos_transfer_t *xfer, int32_t status)
+{
+    /* The submitter may reuse xfer as soon as its status changes. */
+    TX_EVENT_FLAGS_GROUP *flags = xfer->flags;
+    ULONG                 flag  = xfer->flag;
+
+    xfer->status = status;
+    if (flags != NULL) {
+        (void)tx_event_flags_set(flags, flag, TX_OR);
+    }
+}
+
+/* Starts the transfer at the head of the queue if the bus is idle, completing
+   any which fail to start. Called from both threads and the completion
+   interrupt. */
+static void I2CMaster_RTOS_Advance(i2c_rtos_handle_t *handle)
+{
+    TX_INTERRUPT_SAVE_AREA
+
+    while (true) {
+        i2c_rtos_transfer_t *xfer = NULL;
+
+        TX_DISABLE
+        if ((handle->active == NULL) && (handle->queue != NULL)) {
+            xfer = handle->queue;
+            handle->queue = xfer->next;
+            handle->active = xfer;
+        }
+        TX_RESTORE
+
+        if (xfer == NULL) {
+            return;
+        }
+
+        int32_t rt = I2CMaster_TransferSequentialAsync_UserData(handle->i2c_handle,
+                                                                xfer->address,
+                                                                xfer->transfers,
+                                                                xfer->count,
+                                                                I2CMaster_RTOS_Callback,
+                                                                (void *)handle);
+        if (rt == ERROR_NONE) {
+            return;
+        }
+
+        TX_DISABLE
+        handle->active = NULL;
+        TX_RESTORE
+
+        I2CMaster_RTOS_Finish(xfer, rt);
+    }
+}
+
 static void I2CMaster_RTOS_Callback(int32_t status, uintptr_t count, void *userData)
 {
     (void)count;
 
-    i2c_rtos_handle_t *handle = (i2c_rtos_handle_t *)userData;
-    handle->async_status = status;
+    i2c_rtos_handle_t   *handle = (i2c_rtos_handle_t *)userData;
+    i2c_rtos_transfer_t *xfer   = handle->active;
+    handle->active = NULL;
+
+    /* Chain the next transfer before waking anyone, so the bus is kept busy. */
+    I2CMaster_RTOS_Advance(handle);
 
-    (void)tx_semaphore_put(&handle->semaphore);
+    if (xfer != NULL) {
+        I2CMaster_RTOS_Finish(xfer, status);
+    }
 }
 
 int32_t I2CMaster_RTOS_Init(i2c_rtos_handle_t *handle, Platform_Unit unit, I2C_BusSpeed speed)
@@ -26,17 +86,13 @@ int32_t I2CMaster_RTOS_Init(i2c_rtos_handle_t *handle, Platform_Unit unit, I2C_B
         return ERROR;
     }
 
-    (void)I2CMaster_SetBusSpeed(handle->i2c_handle, speed);    
+    (void)I2CMaster_SetBusSpeed(handle->i2c_handle, speed);
 
-    if (tx_mutex_create(&handle->mutex, "i2c mutex", TX_INHERIT) != TX_SUCCESS) {
+    if (tx_event_flags_create(&handle->events, "i2c events") != TX_SUCCESS) {
+        I2CMaster_Close(handle->i2c_handle);
         return ERROR;
     }
 
-    if (tx_semaphore_create(&handle->semaphore, "i2c semaphore", 0) != TX_SUCCESS) {
-        (void)tx_mutex_delete(&handle->mutex);
-        return ERROR;
-    }    
-
     return ERROR_NONE;
 }
 
@@ -44,41 +100,101 @@ int32_t I2CMaster_RTOS_Deinit(i2c_rtos_handle_t *handle)
 {
     I2CMaster_Close(handle->i2c_handle);
 
-    (void)tx_semaphore_delete(&handle->semaphore);
-    (void)tx_mutex_delete(&handle->mutex);
+    (void)tx_event_flags_delete(&handle->events);
+
+    return ERROR_NONE;
+}
+
+int32_t I2CMaster_RTOS_Submit(i2c_rtos_handle_t *handle, i2c_rtos_transfer_t *xfer,
+                              UINT priority, TX_EVENT_FLAGS_GROUP *flags, ULONG flag)
+{
+    TX_INTERRUPT_SAVE_AREA
+
+    if ((handle == NULL) || (xfer == NULL) || (xfer->count == 0) || (xfer->count > 2)) {
+        return ERROR_PARAMETER;
+    }
+
+    xfer->priority = priority;
+    xfer->flags    = flags;
+    xfer->flag     = flag;
+    xfer->status   = ERROR_BUSY;
+
+    /* Behind everything at the same or a more urgent priority. */
+    TX_DISABLE
+    i2c_rtos_transfer_t **link = &handle->queue;
+    while ((*link != NULL) && ((*link)->priority <= priority)) {
+        link = &(*link)->next;
+    }
+    xfer->next = *link;
+    *link = xfer;
+    TX_RESTORE
+
+    I2CMaster_RTOS_Advance(handle);
 
     return ERROR_NONE;
 }
 
 int32_t I2CMaster_RTOS_Transfer(i2c_rtos_handle_t *handle, i2c_rtos_transfer_t *xfer)
 {
+    TX_INTERRUPT_SAVE_AREA
     int32_t rt;
     UINT    status;
+    ULONG   actual;
 
-    if (tx_mutex_get(&handle->mutex, TX_WAIT_FOREVER) != TX_SUCCESS) {
-        return ERROR_BUSY;
+    if (handle == NULL) {
+        return ERROR_PARAMETER;
+    }
+
+    UINT       priority = TX_MAX_PRIORITIES;
+    TX_THREAD *thread   = tx_thread_identify();
+    if (thread != TX_NULL) {
+        (void)tx_thread_info_get(thread, TX_NULL, TX_NULL, TX_NULL, &priority,
+                                 TX_NULL, TX_NULL, TX_NULL, TX_NULL);
     }
 
-    rt = I2CMaster_TransferSequentialAsync_UserData(handle->i2c_handle, 
-                                                    xfer->address, 
-                                                    xfer->transfers, 
-                                                    xfer->count, 
-                                                    I2CMaster_RTOS_Callback,
-                                                    (void *)handle);
-    
-    if (rt != ERROR_NONE) {
-        tx_mutex_put(&handle->mutex);
-        return rt;
+    /* Take a flag of our own to wait on. */
+    TX_DISABLE
+    ULONG flag = (~handle->events_used & (handle->events_used + 1));
+    handle->events_used |= flag;
+    TX_RESTORE
+
+    if (flag == 0) {
+        return ERROR_BUSY;
     }
 
-    status = tx_semaphore_get(&handle->semaphore, xfer->timeout > 0 ? xfer->timeout : TX_WAIT_FOREVER);
-    if (status == TX_NO_INSTANCE) {
-        handle->async_status = ERROR_TIMEOUT;
-    } else if (status != TX_SUCCESS) {
-        handle->async_status = ERROR;
-    } 
+    rt = I2CMaster_RTOS_Submit(handle, xfer, priority, &handle->events, flag);
+    if (rt == ERROR_NONE) {
+        status = tx_event_flags_get(&handle->events, flag, TX_OR_CLEAR, &actual,
+                                    xfer->timeout > 0 ? xfer->timeout : TX_WAIT_FOREVER);
+        rt = xfer->status;
+
+        if (status != TX_SUCCESS) {
+            /* Only a transfer which hasn't started can be given up, as one on
+               the bus is still using our buffers. */
+            bool removed = false;
+            TX_DISABLE
+            i2c_rtos_transfer_t **link;
+            for (link = &handle->queue; *link != NULL; link = &(*link)->next) {
+                if (*link == xfer) {
+                    *link = xfer->next;
+                    removed = true;
+                    break;
+                }
+            }
+            TX_RESTORE
+
+            if (removed) {
+                rt = (status == TX_NO_EVENTS ? ERROR_TIMEOUT : ERROR);
+            } else {
+                (void)tx_event_flags_get(&handle->events, flag, TX_OR_CLEAR, &actual, TX_WAIT_FOREVER);
+                rt = xfer->status;
+            }
+        }
+    }
 
-    (void)tx_mutex_put(&handle->mutex);
+    TX_DISABLE
+    handle->events_used &= ~flag;
+    TX_RESTORE
 
-    return handle->async_status;
+    return rt;
 }
@@ -7,26 +7,51 @@
 #include "lib/I2CMaster.h"
 #include "tx_api.h"
 
-typedef struct _i2c_rtos_handle {
-    I2CMaster       *i2c_handle;       
-    int32_t         async_status;
-    TX_MUTEX        mutex;
-    TX_SEMAPHORE    semaphore;
-} i2c_rtos_handle_t;
+/* Transfers are queued on the handle in priority order, and each one is
+   started from the completion interrupt of the one before, so the bus doesn't
+   wait on a context switch between transactions. Each submitter is told of
+   completion through its own event flags. */
 
 typedef struct _i2c_rtos_transfer {
     uint8_t         count;
     uint16_t        address;
     I2C_Transfer    transfers[2];
     uint32_t        timeout;
+
+    /* Filled in when the transfer is submitted. */
+    UINT                        priority;
+    TX_EVENT_FLAGS_GROUP        *flags;
+    ULONG                       flag;
+    volatile int32_t            status;
+    struct _i2c_rtos_transfer   *next;
 } i2c_rtos_transfer_t;
 
+typedef struct _i2c_rtos_handle {
+    I2CMaster               *i2c_handle;
+    i2c_rtos_transfer_t     *active;
+    i2c_rtos_transfer_t     *queue;
+
+    /* Used by I2CMaster_RTOS_Transfer, one flag for each waiting thread. */
+    TX_EVENT_FLAGS_GROUP    events;
+    ULONG                   events_used;
+} i2c_rtos_handle_t;
+
 #if defined(__cplusplus)
 extern "C" {
 #endif
 
 int32_t I2CMaster_RTOS_Init(i2c_rtos_handle_t* handle, Platform_Unit unit, I2C_BusSpeed speed);
 int32_t I2CMaster_RTOS_Deinit(i2c_rtos_handle_t *handle);
+
+/* Queues xfer behind any transfers of the same or higher priority, where lower
+   numbers are more urgent as for ThreadX threads. Once it completes its status
+   is set and flag is set in flags, which may be NULL to poll the status while
+   it's ERROR_BUSY. xfer must stay valid until then. */
+int32_t I2CMaster_RTOS_Submit(i2c_rtos_handle_t *handle, i2c_rtos_transfer_t *xfer,
+                              UINT priority, TX_EVENT_FLAGS_GROUP *flags, ULONG flag);
+
+/* Submits xfer at the priority of the calling thread and sleeps until it
+   completes or its timeout expires. */
 int32_t I2CMaster_RTOS_Transfer(i2c_rtos_handle_t *handle, i2c_rtos_transfer_t *xfer);
 
 #if defined(__cplusplus)
@@ -15,23 +15,28 @@
 
 #include "tx_api.h"
 #include "i2c_threadx.h"
+#include "pool_threadx.h"
 #include "LSM6DS3.h"
 
 #define STARTUP_RETRY_COUNT     20
 #define DEMO_STACK_SIZE         1024
-#define DEMO_BYTE_POOL_SIZE     9120
+#define DEMO_STACK_COUNT        1
+#define DEMO_DRIVER_COUNT       1
 
 static const uint32_t       buttonAGpio                 = 12;
 static const int            buttonPressCheckPeriodMs    = 10;
 
 static UART                 *debug          = NULL;
 static i2c_rtos_handle_t    *driver         = NULL;
+static LSM6DS3              *imu            = NULL;
 static GPT                  *buttonTimeout  = NULL;
 static GPT                  *startUpTimer   = NULL;
 static TX_THREAD            thread;
 static TX_SEMAPHORE         semaphore;
-static TX_BYTE_POOL         byte_pool;
-static UCHAR                memory_area[DEMO_BYTE_POOL_SIZE];
+static pool_threadx         stack_pool;
+static pool_threadx         driver_pool;
+static ULONG                stack_area[POOL_THREADX_AREA(DEMO_STACK_SIZE, DEMO_STACK_COUNT)];
+static ULONG                driver_area[POOL_THREADX_AREA(sizeof(i2c_rtos_handle_t), DEMO_DRIVER_COUNT)];
 
 static void HandleButtonTimerIrq(GPT *handle)
 {
@@ -64,7 +69,7 @@ static void displaySensors(void)
     static bool initialised = false;
     uint32_t retryRemain = STARTUP_RETRY_COUNT;
     while (retryRemain > 0) {
-        if (!LSM6DS3_Status(driver, &hasTemp, &hasG, &hasXL)) {
+        if (!LSM6DS3_Status(imu, &hasTemp, &hasG, &hasXL)) {
             UART_Print(debug, "ERROR: Failed to read accelerometer status register.\r\n");
         }
         if (hasTemp && hasG && hasXL) {
@@ -79,32 +84,31 @@ static void displaySensors(void)
     }
 
     if (initialised) {
-        int16_t x, y, z;
+        // Read every output in one burst so they come from the same sample.
+        LSM6DS3_DataHuman data;
+        if (!LSM6DS3_ReadAllHuman(imu, &data)) {
+            UART_Print(debug, "ERROR: Failed to read sensor data registers.\r\n");
+            return;
+        }
+
         if (!hasXL) {
             UART_Print(debug, "INFO: No accelerometer data.\r\n");
-        } else if (!LSM6DS3_ReadXLHuman(driver, &x, &y, &z)) {
-            UART_Print(debug, "ERROR: Failed to read accelerometer data register.\r\n");
         } else {
             UART_Printf(debug, "INFO: Acceleration: %.3f, %.3f, %.3f\r\n",
-                        ((float)x) / 1000, ((float)y) / 1000, ((float)z) / 1000);
+                        ((float)data.xl[0]) / 1000, ((float)data.xl[1]) / 1000, ((float)data.xl[2]) / 1000);
         }
 
         if (!hasG) {
             UART_Print(debug, "INFO: No gyroscope data.\r\n");
-        } else if (!LSM6DS3_ReadGHuman(driver, &x, &y, &z)) {
-            UART_Print(debug, "ERROR: Failed to read gyroscope data register.\r\n");
         } else {
             UART_Printf(debug, "INFO: Gyroscope: %.3f, %.3f, %.3f\r\n",
-                ((float)x) / 1000, ((float)y) / 1000, ((float)z) / 1000);
+                        ((float)data.g[0]) / 1000, ((float)data.g[1]) / 1000, ((float)data.g[2]) / 1000);
         }
 
-        int16_t t;
         if (!hasTemp) {
             UART_Print(debug, "INFO: No temperature data.\r\n");
-        } else if (!LSM6DS3_ReadTempHuman(driver, &t)) {
-            UART_Print(debug, "ERROR: Failed to read temperature data register.\r\n");
         } else {
-            UART_Printf(debug, "INFO: Temperature: %.3f\r\n", ((float)t) / 1000);
+            UART_Printf(debug, "INFO: Temperature: %.3f\r\n", ((float)data.temp) / 1000);
         }
         UART_Print(debug, "\r\n");
     }
@@ -112,8 +116,7 @@ static void displaySensors(void)
 
 static void sensor_thread_entry(ULONG thread_input)
 {
-    if (tx_byte_allocate(&byte_pool, (VOID**)&driver, 
-            sizeof(i2c_rtos_handle_t), TX_NO_WAIT) != TX_SUCCESS) {
+    if (!(driver = pool_threadx_allocate(&driver_pool))) {
         UART_Print(debug,
             "ERROR: Failed to allocate I2C driver.\r\n");
     }
@@ -124,22 +127,27 @@ static void sensor_thread_entry(ULONG thread_input)
             "ERROR: Failed to init I2C driver.\r\n");
     }
 
-    if (!LSM6DS3_CheckWhoAmI(driver)) {
+    if (!(imu = LSM6DS3_Open(&LSM6DS3_TransportI2CThreadX, driver))) {
+        UART_Print(debug,
+            "ERROR: Open Failed for LSM6DS3.\r\n");
+    }
+
+    if (!LSM6DS3_CheckWhoAmI(imu)) {
         UART_Print(debug,
             "ERROR: CheckWhoAmI Failed for LSM6DS3.\r\n");
     }
 
-    if (!LSM6DS3_Reset(driver)) {
+    if (!LSM6DS3_Reset(imu)) {
         UART_Print(debug,
             "ERROR: Reset Failed for LSM6DS3.\r\n");
     }
 
-    if (!LSM6DS3_ConfigXL(driver, 1, 4, 400)) {
+    if (!LSM6DS3_ConfigXL(imu, 1, 4, 400)) {
         UART_Print(debug,
             "ERROR: Failed to configure LSM6DS3 accelerometer.\r\n");
     }
 
-    if (!LSM6DS3_ConfigG(driver, 1, 500)) {
+    if (!LSM6DS3_ConfigG(imu, 1, 500)) {
         UART_Print(debug,
             "ERROR: Failed to configure LSM6DS3 accelerometer.\r\n");
     }
@@ -162,6 +170,10 @@ static void sensor_thread_entry(ULONG thread_input)
     // Self test
     displaySensors();
 
+    UART_Print(debug, "INFO: Memory pools:\r\n");
+    pool_threadx_report(debug);
+    UART_Print(debug, "\r\n");
+
     int32_t error;
     if ((error = GPT_StartTimeout(buttonTimeout, buttonPressCheckPeriodMs,
         GPT_UNITS_MILLISEC, &HandleButtonTimerIrq)) != ERROR_NONE) {
@@ -180,19 +192,21 @@ static void sensor_thread_entry(ULONG thread_input)
     UART_Print(debug, "ERROR: thread exit\r\n");
 
     // Clean resources
+    LSM6DS3_Close(imu);
     (void)I2CMaster_RTOS_Deinit(driver);
-    (void)tx_byte_release(driver);
+    (void)pool_threadx_release(&driver_pool, driver);
 }
 
 void tx_application_define(void* first_unused_memory)
 {
     CHAR* pointer;
 
-    // Create a byte memory pool from which to allocate the thread stacks.
-    tx_byte_pool_create(&byte_pool, "byte pool", memory_area, DEMO_BYTE_POOL_SIZE);
+    // Create fixed block pools for the thread stacks and driver handles.
+    pool_threadx_create(&stack_pool, "stack pool", DEMO_STACK_SIZE, stack_area, sizeof(stack_area));
+    pool_threadx_create(&driver_pool, "driver pool", sizeof(i2c_rtos_handle_t), driver_area, sizeof(driver_area));
 
     // Allocate the stack for thread.
-    tx_byte_allocate(&byte_pool, (VOID**)&pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    pointer = pool_threadx_allocate(&stack_pool);
 
     // Create the main thread.
     tx_thread_create(&thread, "Sensor thread", sensor_thread_entry, 0,
@@ -15,35 +15,295 @@
 #include "lib/I2CMaster.h"
 
 #include "LSM6DS3.h"
+#include "EventQueue.h"
+#include "Input.h"
+#include "Fusion.h"
+#include "Profile.h"
+#include "Placement.h"
+
+#ifdef IMU_SOCKET
+#include "Socket.h"
+#endif
+
+// Samples are taken at 1.66 kHz and collected by the FIFO, each being the
+// gyroscope then the accelerometer, three words for each.
+#define IMU_ODR            8
+#define IMU_FIFO_FRAME     6
+#define IMU_FIFO_THRESHOLD (64 * IMU_FIFO_FRAME)
+#define IMU_FIFO_DATA_SIZE (2 * IMU_FIFO_THRESHOLD)
+
+// Each frame taken from the FIFO is fused into an orientation, with the
+// gyroscope at 500 dps full scale.
+#define IMU_RATE    1666
+#define IMU_G_FS    500
+#define IMU_G_SCALE FUSION_G_DPS_PER_LSB_500
+#define FUSION_KP   2.0f
+#define FUSION_KI   0.05f
+
+// Rate the orientation is sent to the high-level app at, set from CMake.
+#ifndef IMU_QUAT_RATE
+#define IMU_QUAT_RATE 100
+#endif
+#define IMU_QUAT_DECIMATION ((IMU_RATE + (IMU_QUAT_RATE / 2)) / IMU_QUAT_RATE)
+#if (IMU_QUAT_DECIMATION < 1)
+#error "IMU_QUAT_RATE is faster than the IMU"
+#endif
+
+// Updates timed at startup, to check they fit between samples.
+#define FUSION_BENCHMARK_UPDATES 1000
 
 #define STARTUP_RETRY_COUNT  20
 #define STARTUP_RETRY_PERIOD 500 // [ms]
 
 
 static const uint32_t buttonAGpio = 12;
-static const int buttonPressCheckPeriodMs = 10;
-static void HandleButtonTimerIrq(GPT *);
-static void HandleButtonTimerIrqDeferred(void);
+static void HandleButtonDeferred(void *payload);
+
+// INT1 of the LSM6DS3 is raised when the FIFO reaches its watermark.
+static const uint32_t imuInt1Gpio = 2;
+static void HandleFIFOWatermarkDeferred(void *payload);
+
+static SYSRAM_DATA int16_t fifoData[IMU_FIFO_DATA_SIZE];
+static int16_t  fifoFrame[IMU_FIFO_FRAME];
+static uint32_t fifoFrames   = 0;
+static uint32_t fifoBatches  = 0;
+static uint32_t fifoOverruns = 0;
+
+static Fusion fusion;
 
 static UART      *debug    = NULL;
 static I2CMaster *driver   = NULL;
-static GPT *buttonTimeout  = NULL;
+static LSM6DS3   *imu      = NULL;
 static GPT *startUpTimer   = NULL;
 
+#ifdef IMU_SOCKET
+// The orientations produced by each drain of the FIFO are sent together, up to
+// IMU_QUATS_MAX to a message, each message being a header followed by the
+// quaternions as w, x, y, z in Q14. The sequence number is that of the first.
+typedef struct __attribute__((__packed__)) {
+    uint16_t sequence;
+    uint8_t  count;
+    uint16_t decimation;
+} ImuQuatHeader;
 
-typedef struct CallbackNode {
-    bool enqueued;
-    struct CallbackNode *next;
-    void (*cb)(void);
-} CallbackNode;
+#define IMU_QUATS_MAX 32
 
-static void EnqueueCallback(CallbackNode *node);
+static int16_t  imuQuats[IMU_QUATS_MAX][4];
+static unsigned imuQuatCount    = 0;
+static uint16_t imuQuatSequence = 0;
 
-static void HandleButtonTimerIrq(GPT *handle)
+static Socket  *socket        = NULL;
+static uint32_t socketDropped = 0;
+
+static const Component_Id A7ID =
+{
+    .seg_0   = 0x25025d2c,
+    .seg_1   = 0x66da,
+    .seg_2   = 0x4448,
+    .seg_3_4 = {0xba, 0xe1, 0xac, 0x26, 0xfc, 0xdd, 0x36, 0x27}
+};
+#endif
+
+
+// Each button press is passed to the main loop, while one pending watermark
+// covers any repeats, as the handler drains all there is.
+EVENT_QUEUE_DEFINE(buttonEvents, Input_Event, 4);
+EVENT_QUEUE_DEFINE_SIGNAL(fifoEvents, 1);
+#ifdef IMU_SOCKET
+EVENT_QUEUE_DEFINE_SIGNAL(socketEvents, 1);
+
+static void sendQuats(void)
+{
+    if (imuQuatCount == 0) {
+        return;
+    }
+
+    if (socket) {
+        ImuQuatHeader header = {
+            .sequence   = imuQuatSequence,
+            .count      = imuQuatCount,
+            .decimation = IMU_QUAT_DECIMATION,
+        };
+        const Socket_IOVec iov[] = {
+            { .data = &header,  .size = sizeof(header) },
+            { .data = imuQuats, .size = (imuQuatCount * sizeof(imuQuats[0])) },
+        };
+        // Don't wait for space, the HLApp sees the gap in sequence numbers.
+        if (Socket_WriteV(socket, &A7ID, iov, 2) != ERROR_NONE) {
+            socketDropped++;
+        }
+    }
+
+    imuQuatSequence += imuQuatCount;
+    imuQuatCount = 0;
+}
+#endif
+
+// Fuses each frame as it's completed, so the filter runs straight from the
+// FIFO's words in the order the device took them.
+static void fuseFrame(void)
+{
+    Fusion_Update(&fusion, &fifoFrame[0], &fifoFrame[3]);
+
+#ifdef IMU_SOCKET
+    static unsigned decimation = 0;
+    if (++decimation < IMU_QUAT_DECIMATION) {
+        return;
+    }
+    decimation = 0;
+
+    Fusion_GetQuaternion(&fusion, imuQuats[imuQuatCount]);
+    if (++imuQuatCount == IMU_QUATS_MAX) {
+        sendQuats();
+    }
+#endif
+}
+
+static void HandleFIFOWatermarkDeferred(void *payload)
+{
+    (void)payload;
+
+    uintptr_t count;
+    do {
+        unsigned pattern;
+        uint8_t  status;
+        if (!LSM6DS3_ReadFIFO(imu, fifoData, IMU_FIFO_DATA_SIZE, &count, &pattern, &status)) {
+            UART_Print(debug, "ERROR: Failed to read LSM6DS3 FIFO.\r\n");
+            return;
+        }
+        if (status & LSM6DS3_FIFO_STATUS2_OVER_RUN) {
+            fifoOverruns++;
+        }
+
+        // Place each word by its position in the pattern, so a frame split
+        // between batches is still put together.
+        uintptr_t i;
+        for (i = 0; i < count; i++) {
+            unsigned slot = ((pattern + i) % IMU_FIFO_FRAME);
+            fifoFrame[slot] = fifoData[i];
+            if (slot == (IMU_FIFO_FRAME - 1)) {
+                fuseFrame();
+                fifoFrames++;
+            }
+        }
+        if (count > 0) {
+            fifoBatches++;
+        }
+    } while (count == IMU_FIFO_DATA_SIZE);
+
+#ifdef IMU_SOCKET
+    sendQuats();
+#endif
+}
+
+#ifdef IMU_SOCKET
+static void HandleSocketMsgDeferred(void *payload)
+{
+    (void)payload;
+
+    if (Socket_NegotiationPending(socket)) {
+        // NB: this is blocking.
+        if (Socket_Negotiate(socket) != ERROR_NONE) {
+            UART_Print(debug, "ERROR: renegotiating socket connection\r\n");
+        }
+    }
+
+    // Nothing is expected from the HLApp, so anything sent is discarded, a
+    // batch at a time until the ring is empty.
+    for (;;) {
+        Socket_Msg msgs[4];
+        uint32_t count = 4;
+        int32_t error = Socket_ReadBatch(socket, msgs, &count);
+        if (error != ERROR_NONE) {
+            // A bad block can't be stepped over, so it's dropped along with
+            // everything after it.
+            if (error != ERROR_SOCKET_EMPTY) {
+                Socket_ReadDiscard(socket);
+            }
+            break;
+        }
+        Socket_ReadRelease(socket);
+    }
+}
+
+static void HandleSocketMsg(Socket *handle)
 {
     (void)handle;
-    static CallbackNode cbn = {.enqueued = false, .cb = HandleButtonTimerIrqDeferred};
-    EnqueueCallback(&cbn);
+    EventQueue_Post(&socketEvents, NULL);
+}
+#endif
+
+// Times the filter on a device tilted and turning, so every update takes the
+// same path as a real one, and compares the worst case against the cycles
+// between samples at 1 kHz and at the rate the IMU runs at.
+static void benchmarkFusion(void)
+{
+    static const int16_t frames[4][IMU_FIFO_FRAME] = {
+        {  120,  -340,   55,   410, 2880, 7640 },
+        { -260,   180,  -90,  -530, 3010, 7570 },
+        {   75,   220, -410,   360, 2760, 7720 },
+        {  -30,  -150,  300,  -220, 2950, 7610 },
+    };
+
+    Fusion bench;
+    if (!Fusion_Init(&bench, IMU_RATE, IMU_G_SCALE, FUSION_KP, FUSION_KI)) {
+        return;
+    }
+
+    // Cycles are counted by the profiler's DWT clock, there's no GPT to fall
+    // back on.
+    if (!Profile_Init(NULL)) {
+        UART_Print(debug, "WARNING: No cycle counter to time the fusion with.\r\n");
+        return;
+    }
+
+    uint32_t total = 0, worst = 0;
+    unsigned i;
+    for (i = 0; i < FUSION_BENCHMARK_UPDATES; i++) {
+        const int16_t *frame = frames[i % 4];
+        uint32_t start = Profile_Now();
+        Fusion_Update(&bench, &frame[0], &frame[3]);
+        uint32_t cycles = (Profile_Now() - start);
+        total += cycles;
+        if (cycles > worst) {
+            worst = cycles;
+        }
+    }
+
+    unsigned freq = CPUFreq_Get();
+    UART_Printf(debug, "INFO: Fusion update: %lu cycles mean, %lu worst, at %u Hz.\r\n",
+                (total / FUSION_BENCHMARK_UPDATES), worst, freq);
+    UART_Printf(debug, "INFO: Fusion budget: %u cycles at 1 kHz (%lu%%), %u at %u Hz (%lu%%).\r\n",
+                (freq / 1000), ((worst * 100) / (freq / 1000)),
+                (freq / IMU_RATE), IMU_RATE, ((worst * 100) / (freq / IMU_RATE)));
+}
+
+static void displayFIFO(void)
+{
+    LSM6DS3_Data raw = { .temp = 0 };
+    __builtin_memcpy(raw.g , &fifoFrame[0], sizeof(raw.g));
+    __builtin_memcpy(raw.xl, &fifoFrame[3], sizeof(raw.xl));
+
+    LSM6DS3_DataHuman data;
+    if (!LSM6DS3_DataToHuman(imu, &raw, &data)) {
+        return;
+    }
+
+    UART_Printf(debug, "INFO: FIFO: %lu frames in %lu batches, %lu overruns.\r\n",
+                fifoFrames, fifoBatches, fifoOverruns);
+    UART_Printf(debug, "INFO: FIFO acceleration: %.3f, %.3f, %.3f\r\n",
+                ((float)data.xl[0]) / 1000, ((float)data.xl[1]) / 1000, ((float)data.xl[2]) / 1000);
+    UART_Printf(debug, "INFO: FIFO gyroscope: %.3f, %.3f, %.3f\r\n",
+                ((float)data.g[0]) / 1000, ((float)data.g[1]) / 1000, ((float)data.g[2]) / 1000);
+
+    int16_t q[4];
+    Fusion_GetQuaternion(&fusion, q);
+    UART_Printf(debug, "INFO: Orientation: %.4f, %.4f, %.4f, %.4f\r\n",
+                ((float)q[0]) / 16384, ((float)q[1]) / 16384, ((float)q[2]) / 16384, ((float)q[3]) / 16384);
+#ifdef IMU_SOCKET
+    UART_Printf(debug, "INFO: Orientations not sent: %lu\r\n", socketDropped);
+#endif
+    UART_Print(debug, "\r\n");
 }
 
 static void displaySensors()
@@ -55,7 +315,7 @@ static void displaySensors()
     static bool initialised = false;
     uint32_t retryRemain = STARTUP_RETRY_COUNT;
     while (retryRemain > 0) {
-        if (!LSM6DS3_Status(driver, &hasTemp, &hasG, &hasXL)) {
+        if (!LSM6DS3_Status(imu, &hasTemp, &hasG, &hasXL)) {
             UART_Print(debug, "ERROR: Failed to read accelerometer status register.\r\n");
         }
         if (hasTemp && hasG && hasXL) {
@@ -70,86 +330,45 @@ static void displaySensors()
     }
 
     if (initialised) {
-        int16_t x, y, z;
+        // Read every output in one burst so they come from the same sample.
+        LSM6DS3_DataHuman data;
+        if (!LSM6DS3_ReadAllHuman(imu, &data)) {
+            UART_Print(debug, "ERROR: Failed to read sensor data registers.\r\n");
+            return;
+        }
+
         if (!hasXL) {
             UART_Print(debug, "INFO: No accelerometer data.\r\n");
-        } else if (!LSM6DS3_ReadXLHuman(driver, &x, &y, &z)) {
-            UART_Print(debug, "ERROR: Failed to read accelerometer data register.\r\n");
         } else {
             UART_Printf(debug, "INFO: Acceleration: %.3f, %.3f, %.3f\r\n",
-                        ((float)x) / 1000, ((float)y) / 1000, ((float)z) / 1000);
+                        ((float)data.xl[0]) / 1000, ((float)data.xl[1]) / 1000, ((float)data.xl[2]) / 1000);
         }
 
         if (!hasG) {
             UART_Print(debug, "INFO: No gyroscope data.\r\n");
-        } else if (!LSM6DS3_ReadGHuman(driver, &x, &y, &z)) {
-            UART_Print(debug, "ERROR: Failed to read gyroscope data register.\r\n");
         } else {
             UART_Printf(debug, "INFO: Gyroscope: %.3f, %.3f, %.3f\r\n",
-                ((float)x) / 1000, ((float)y) / 1000, ((float)z) / 1000);
+                        ((float)data.g[0]) / 1000, ((float)data.g[1]) / 1000, ((float)data.g[2]) / 1000);
         }
 
-        int16_t t;
         if (!hasTemp) {
             UART_Print(debug, "INFO: No temperature data.\r\n");
-        } else if (!LSM6DS3_ReadTempHuman(driver, &t)) {
-            UART_Print(debug, "ERROR: Failed to read temperature data register.\r\n");
         } else {
-            UART_Printf(debug, "INFO: Temperature: %.3f\r\n", ((float)t) / 1000);
+            UART_Printf(debug, "INFO: Temperature: %.3f\r\n", ((float)data.temp) / 1000);
         }
         UART_Print(debug, "\r\n");
     }
 }
 
-static void HandleButtonTimerIrqDeferred(void)
+static void HandleButtonDeferred(void *payload)
 {
-    // Assume initial state is high, i.e. button not pressed.
-    static bool prevState = true;
-    bool newState;
-    GPIO_Read(buttonAGpio, &newState);
-
-    if (newState != prevState) {
-        bool pressed = !newState;
-        if (pressed) {
-            displaySensors();
-        }
-
-        prevState = newState;
+    const Input_Event *event = payload;
+    if (event->pressed) {
+        displaySensors();
+        displayFIFO();
     }
 }
 
-static CallbackNode *volatile callbacks = NULL;
-
-static void EnqueueCallback(CallbackNode *node)
-{
-    uint32_t prevBasePri = NVIC_BlockIRQs();
-    if (!node->enqueued) {
-        CallbackNode *prevHead = callbacks;
-        node->enqueued = true;
-        callbacks = node;
-        node->next = prevHead;
-    }
-    NVIC_RestoreIRQs(prevBasePri);
-}
-
-static void InvokeCallbacks(void)
-{
-    CallbackNode *node;
-    do {
-        uint32_t prevBasePri = NVIC_BlockIRQs();
-        node = callbacks;
-        if (node) {
-            node->enqueued = false;
-            callbacks = node->next;
-        }
-        NVIC_RestoreIRQs(prevBasePri);
-
-        if (node) {
-            (*node->cb)();
-        }
-    } while (node);
-}
-
 _Noreturn void RTCoreMain(void)
 {
     VectorTableInit();
@@ -160,43 +379,80 @@ _Noreturn void RTCoreMain(void)
     UART_Print(debug, "I2C_RTApp_MT3620_BareMetal\r\n");
     UART_Print(debug, "App built on: " __DATE__ " " __TIME__ "\r\n");
 
+    // The FIFO is drained before button presses are handled.
+    EventQueue_Init(&fifoEvents, 0, HandleFIFOWatermarkDeferred);
+#ifdef IMU_SOCKET
+    EventQueue_Init(&socketEvents, 1, HandleSocketMsgDeferred);
+#endif
+    EventQueue_Init(&buttonEvents, 2, HandleButtonDeferred);
+
+    if (!Fusion_Init(&fusion, IMU_RATE, IMU_G_SCALE, FUSION_KP, FUSION_KI)) {
+        UART_Print(debug, "ERROR: Fusion initialisation failed\r\n");
+    }
+    benchmarkFusion();
+
+#ifdef IMU_SOCKET
+    // NB: this blocks until the HLApp connects.
+    socket = Socket_Open(HandleSocketMsg);
+    if (!socket) {
+        UART_Print(debug, "ERROR: socket initialisation failed\r\n");
+    }
+#endif
+
     driver = I2CMaster_Open(MT3620_UNIT_ISU2);
     if (!driver) {
         UART_Print(debug,
             "ERROR: I2C initialisation failed\r\n");
     }
 
-    I2CMaster_SetBusSpeed(driver, I2C_BUS_SPEED_STANDARD);
+    // Streaming from the FIFO needs more than standard speed.
+    I2CMaster_SetBusSpeed(driver, I2C_BUS_SPEED_FAST);
+
+    if (!(imu = LSM6DS3_Open(&LSM6DS3_TransportI2C, driver))) {
+        UART_Print(debug,
+            "ERROR: Open Failed for LSM6DS3.\r\n");
+    }
 
-    if (!LSM6DS3_CheckWhoAmI(driver)) {
+    if (!LSM6DS3_CheckWhoAmI(imu)) {
         UART_Print(debug,
             "ERROR: CheckWhoAmI Failed for LSM6DS3.\r\n");
     }
 
-    if (!LSM6DS3_Reset(driver)) {
+    if (!LSM6DS3_Reset(imu)) {
         UART_Print(debug,
             "ERROR: Reset Failed for LSM6DS3.\r\n");
     }
 
-    if (!LSM6DS3_ConfigXL(driver, 1, 4, 400)) {
+    if (!LSM6DS3_ConfigXL(imu, IMU_ODR, 4, 400)) {
         UART_Print(debug,
             "ERROR: Failed to configure LSM6DS3 accelerometer.\r\n");
     }
 
-    if (!LSM6DS3_ConfigG(driver, 1, 500)) {
+    if (!LSM6DS3_ConfigG(imu, IMU_ODR, IMU_G_FS)) {
         UART_Print(debug,
             "ERROR: Failed to configure LSM6DS3 accelerometer.\r\n");
     }
 
+    // INT1 is high while the FIFO is over the watermark. Taking both edges
+    // doesn't depend on the EINT polarity, and the drain as it falls finds
+    // little to read.
+    if (!Input_Open(imuInt1Gpio, INPUT_EDGE_BOTH, &fifoEvents)) {
+        UART_Print(debug,
+            "ERROR: Failed to configure LSM6DS3 INT1 interrupt.\r\n");
+    }
+
+    if (!LSM6DS3_ConfigFIFO(imu, IMU_ODR, 1, 1, IMU_FIFO_THRESHOLD)
+        || !LSM6DS3_ConfigINT1(imu, LSM6DS3_INT1_CTRL_FTH)) {
+        UART_Print(debug,
+            "ERROR: Failed to configure LSM6DS3 FIFO.\r\n");
+    }
+
     UART_Print(
         debug,
         "Connect LSM6DS3, and press button A to read accelerometer.\r\n");
 
-    GPIO_ConfigurePinForInput(buttonAGpio);
-
-    // Setup GPT1 to poll for button press
-    if (!(buttonTimeout = GPT_Open(MT3620_UNIT_GPT1, 1000, GPT_MODE_REPEAT))) {
-        UART_Print(debug, "ERROR: Opening button timer\r\n");
+    if (!Input_Open(buttonAGpio, INPUT_EDGE_PRESS, &buttonEvents)) {
+        UART_Print(debug, "ERROR: Configuring button interrupt\r\n");
     }
 
     // Setup GPT0 for startup polling
@@ -207,14 +463,11 @@ _Noreturn void RTCoreMain(void)
     // Self test
     displaySensors();
 
-    int32_t error;
-    if ((error = GPT_StartTimeout(buttonTimeout, buttonPressCheckPeriodMs,
-                                  GPT_UNITS_MILLISEC, &HandleButtonTimerIrq)) != ERROR_NONE) {
-        UART_Printf(debug, "ERROR: Starting timer (%ld)\r\n", error);
-    }
+    // Drain anything which reached the watermark before INT1 was enabled.
+    HandleFIFOWatermarkDeferred(NULL);
 
     for (;;) {
         __asm__("wfi");
-        InvokeCallbacks();
+        EventQueue_Dispatch();
     }
 }
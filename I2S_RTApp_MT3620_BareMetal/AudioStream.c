@@ -0,0 +1,247 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "AudioStream.h"
+#include "lib/NVIC.h"
+#include "Placement.h"
+#include <stddef.h>
+
+// This is the maximum number of streams which can be opened at once.
+#define AUDIO_STREAM_MAX 2
+
+struct AudioStream {
+    AudioStream_Render render;
+    void             (*request)(void);
+    int16_t           *buffer;
+    bool               input;
+    unsigned           channels;
+    uintptr_t          blockSize;
+    unsigned           blocks;
+
+    // Output plays from the block at head while the application renders the
+    // blocks after the filled ones. Input captures into the block after the
+    // filled ones while the application holds those from head. The application
+    // only changes these with IRQs blocked, and offset is within the block the
+    // interrupt is working on.
+    unsigned           head;
+    volatile unsigned  filled;
+    uintptr_t          offset;
+
+    AudioStream_Stats  stats;
+};
+
+static AudioStream *AudioStream__Open(
+    bool input, unsigned channels, uintptr_t blockFrames, unsigned blocks, int16_t *buffer,
+    AudioStream_Render render, void (*request)(void))
+{
+    if ((channels == 0) || (blockFrames == 0) || (blocks < 2) || !buffer) {
+        return NULL;
+    }
+
+    static AudioStream Handles[AUDIO_STREAM_MAX] = {0};
+    AudioStream *stream = NULL;
+    unsigned h;
+    for (h = 0; h < AUDIO_STREAM_MAX; h++) {
+        if (!Handles[h].buffer) {
+            stream = &Handles[h];
+            break;
+        }
+    }
+    if (!stream) {
+        return NULL;
+    }
+
+    stream->render    = render;
+    stream->request   = request;
+    stream->input     = input;
+    stream->channels  = channels;
+    stream->blockSize = (blockFrames * channels * sizeof(int16_t));
+    stream->blocks    = blocks;
+    stream->head      = 0;
+    stream->filled    = 0;
+    stream->offset    = 0;
+    stream->stats     = (AudioStream_Stats){0};
+    stream->buffer    = buffer;
+    return stream;
+}
+
+AudioStream *AudioStream_Open(
+    unsigned channels, uintptr_t blockFrames, unsigned blocks, int16_t *buffer,
+    AudioStream_Render render, void (*request)(void))
+{
+    if (!render) {
+        return NULL;
+    }
+
+    AudioStream *stream = AudioStream__Open(
+        false, channels, blockFrames, blocks, buffer, render, request);
+    AudioStream_Fill(stream);
+    return stream;
+}
+
+AudioStream *AudioStream_OpenInput(
+    unsigned channels, uintptr_t blockFrames, unsigned blocks, int16_t *buffer,
+    void (*request)(void))
+{
+    return AudioStream__Open(
+        true, channels, blockFrames, blocks, buffer, NULL, request);
+}
+
+void AudioStream_Close(AudioStream *stream)
+{
+    if (!stream) {
+        return;
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    stream->buffer = NULL;
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+TCM_CODE void AudioStream_Fill(AudioStream *stream)
+{
+    if (!stream || stream->input) {
+        return;
+    }
+
+    uintptr_t frames = (stream->blockSize / (stream->channels * sizeof(int16_t)));
+    for (;;) {
+        uint32_t prevBasePri = NVIC_BlockIRQs();
+        unsigned filled = stream->filled;
+        unsigned tail   = ((stream->head + filled) % stream->blocks);
+        NVIC_RestoreIRQs(prevBasePri);
+
+        if (filled >= stream->blocks) {
+            break;
+        }
+
+        // The interrupt never touches blocks past the filled ones, so this one
+        // can be rendered with interrupts enabled.
+        int16_t *block = &stream->buffer[(tail * stream->blockSize) / sizeof(int16_t)];
+        stream->render(block, frames, stream->channels);
+
+        prevBasePri = NVIC_BlockIRQs();
+        stream->filled++;
+        NVIC_RestoreIRQs(prevBasePri);
+    }
+}
+
+TCM_CODE bool AudioStream_Output(AudioStream *stream, void *data, uintptr_t size)
+{
+    if (!stream || !stream->buffer || stream->input) {
+        return false;
+    }
+
+    uint8_t *dst = data;
+    bool freed = false;
+    while (size > 0) {
+        if (stream->filled == 0) {
+            // Nothing has been rendered in time, play silence rather than
+            // repeating stale audio.
+            __builtin_memset(dst, 0x00, size);
+            stream->stats.underruns++;
+            break;
+        }
+
+        const uint8_t *block = (const uint8_t *)stream->buffer + (stream->head * stream->blockSize);
+        uintptr_t chunk = (stream->blockSize - stream->offset);
+        if (chunk > size) {
+            chunk = size;
+        }
+        __builtin_memcpy(dst, &block[stream->offset], chunk);
+        dst  += chunk;
+        size -= chunk;
+
+        stream->offset += chunk;
+        if (stream->offset >= stream->blockSize) {
+            stream->offset = 0;
+            stream->head = ((stream->head + 1) % stream->blocks);
+            stream->filled--;
+            stream->stats.blocks++;
+            freed = true;
+        }
+    }
+
+    if (freed && stream->request) {
+        stream->request();
+    }
+    return true;
+}
+
+bool AudioStream_Input(AudioStream *stream, const void *data, uintptr_t size)
+{
+    if (!stream || !stream->buffer || !stream->input) {
+        return false;
+    }
+
+    const uint8_t *src = data;
+    bool ready = false;
+    while (size > 0) {
+        if (stream->filled >= stream->blocks) {
+            // The application still holds every block, drop the rest.
+            stream->stats.overruns++;
+            break;
+        }
+
+        unsigned tail = ((stream->head + stream->filled) % stream->blocks);
+        uint8_t *block = (uint8_t *)stream->buffer + (tail * stream->blockSize);
+        uintptr_t chunk = (stream->blockSize - stream->offset);
+        if (chunk > size) {
+            chunk = size;
+        }
+        __builtin_memcpy(&block[stream->offset], src, chunk);
+        src  += chunk;
+        size -= chunk;
+
+        stream->offset += chunk;
+        if (stream->offset >= stream->blockSize) {
+            stream->offset = 0;
+            stream->filled++;
+            stream->stats.blocks++;
+            ready = true;
+        }
+    }
+
+    if (ready && stream->request) {
+        stream->request();
+    }
+    return true;
+}
+
+int16_t *AudioStream_Acquire(AudioStream *stream)
+{
+    if (!stream || !stream->input || (stream->filled == 0)) {
+        return NULL;
+    }
+    return &stream->buffer[(stream->head * stream->blockSize) / sizeof(int16_t)];
+}
+
+void AudioStream_Release(AudioStream *stream)
+{
+    if (!stream || !stream->input) {
+        return;
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (stream->filled > 0) {
+        stream->head = ((stream->head + 1) % stream->blocks);
+        stream->filled--;
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+void AudioStream_GetStats(AudioStream *stream, AudioStream_Stats *stats, bool reset)
+{
+    if (!stream) {
+        return;
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (stats) {
+        *stats = stream->stats;
+    }
+    if (reset) {
+        stream->stats = (AudioStream_Stats){0};
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
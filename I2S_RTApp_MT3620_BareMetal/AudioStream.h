@@ -0,0 +1,71 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef AUDIO_STREAM_H_
+#define AUDIO_STREAM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Streams 16-bit audio to an I2S output through a ring of blocks, so synthesis
+// is done a block at a time ahead of playback rather than a sample at a time in
+// the I2S interrupt. The interrupt only copies out rendered frames, asking for
+// more through the request callback as each block is played, and the
+// application renders the free blocks with AudioStream_Fill from its main loop.
+// The ring absorbs up to (blocks - 1) blocks of delay before the output runs
+// dry, at which point silence is sent and the underrun is counted.
+//
+// Input streams work the other way round: the I2S input callback copies
+// captured frames into the free blocks, calling request as each one fills,
+// and the application takes whole blocks by pointer to process them in place.
+// Frames arriving while every block is still held are dropped, counting an
+// overrun.
+
+typedef struct AudioStream AudioStream;
+
+// Renders frames frames of interleaved samples, channels per frame.
+typedef void (*AudioStream_Render)(int16_t *data, uintptr_t frames, unsigned channels);
+
+typedef struct {
+    uint32_t blocks;    // Blocks played or captured.
+    uint32_t underruns; // Times the output ran out of rendered frames.
+    uint32_t overruns;  // Times input was dropped for want of a free block.
+} AudioStream_Stats;
+
+// Size in bytes of the buffer needed by AudioStream_Open.
+#define AUDIO_STREAM_BUFFER_SIZE(channels, blockFrames, blocks) \
+    ((channels) * (blockFrames) * (blocks) * sizeof(int16_t))
+
+// buffer holds AUDIO_STREAM_BUFFER_SIZE bytes and must be 2 byte aligned, and
+// blocks must be at least 2. request is called in interrupt context when a
+// block is free, and may be NULL if the stream is filled by polling. All blocks
+// are rendered before returning, so the stream starts full.
+AudioStream *AudioStream_Open(
+    unsigned channels, uintptr_t blockFrames, unsigned blocks, int16_t *buffer,
+    AudioStream_Render render, void (*request)(void));
+// As AudioStream_Open for capture, request is called in interrupt context as
+// each block is filled.
+AudioStream *AudioStream_OpenInput(
+    unsigned channels, uintptr_t blockFrames, unsigned blocks, int16_t *buffer,
+    void (*request)(void));
+void AudioStream_Close(AudioStream *stream);
+
+// Renders all free blocks.
+void AudioStream_Fill(AudioStream *stream);
+
+// Copies size bytes of rendered frames to data, to be called from the I2S
+// output callback.
+bool AudioStream_Output(AudioStream *stream, void *data, uintptr_t size);
+
+// Copies size bytes of captured frames from data, to be called from the I2S
+// input callback.
+bool AudioStream_Input(AudioStream *stream, const void *data, uintptr_t size);
+
+// Returns the oldest captured block of blockFrames frames, or NULL if none is
+// ready. It stays valid until AudioStream_Release hands it back to the stream.
+int16_t *AudioStream_Acquire(AudioStream *stream);
+void     AudioStream_Release(AudioStream *stream);
+
+void AudioStream_GetStats(AudioStream *stream, AudioStream_Stats *stats, bool reset);
+
+#endif // #ifndef AUDIO_STREAM_H_
@@ -2,6 +2,7 @@
    Licensed under the MIT License. */
 
 #include "max98090.h"
+#include "Placement.h"
 #include <stddef.h>
 
 typedef enum
@@ -113,6 +114,10 @@ static const uint8_t MAX98090_REVISION_ID = 0x43;
 // This is the maximum number of CODECs which can be opened at once.
 #define HANDLE_MAX 2
 
+// Bits of MAX98090_REG_IO_CONFIGURATION enabling the I2S data pins.
+#define MAX98090_IO_SDIEN 0x01
+#define MAX98090_IO_SDOEN 0x02
+
 struct MAX98090 {
     I2S       *interface;
     I2CMaster *bus;
@@ -120,6 +125,13 @@ struct MAX98090 {
     uint8_t    addr;
     bool       mclkExternal;
     unsigned   mclk;
+
+    // Format shared by input and output while both are enabled.
+    bool       outputEnabled;
+    bool       inputEnabled;
+    unsigned   channels;
+    unsigned   bits;
+    unsigned   rate;
 };
 
 static bool MAX98090_RegWrite(MAX98090 *handle,
@@ -132,7 +144,7 @@ static bool MAX98090_RegWrite(MAX98090 *handle,
     uintptr_t packetSize = (sizeof(addr) + size);
 
     // This needs to be in sysram as it's too large for the I2C buffer.
-    static __attribute__((section(".sysram"))) uint8_t packet[16];
+    static SYSRAM_DATA uint8_t packet[16];
     if (packetSize > sizeof(packet)) {
         return false;
     }
@@ -193,8 +205,8 @@ static unsigned gcd(unsigned a, unsigned b)
     return a;
 }
 
-static bool MAX98090_Configure(
-    MAX98090 *handle, MAX98090_Output output, unsigned channels, unsigned rate)
+static bool MAX98090_ConfigureClocks(
+    MAX98090 *handle, unsigned channels, unsigned rate, uint8_t io)
 {
     if (!handle) {
         return false;
@@ -294,9 +306,14 @@ static bool MAX98090_Configure(
         (tdm ? 0x08 : 0x04),
         (tdm ? 0x01 : 0x00),
         (tdm ? 0x10 : 0x00),
-        0x01,
+        io,
     };
 
+    return MAX98090_RegWrite(handle, MAX98090_REG_SYSTEM_CLOCK, regs, sizeof(regs));
+}
+
+static bool MAX98090_ConfigureOutput(MAX98090 *handle, MAX98090_Output output)
+{
     uint8_t outen = 0x3;
     switch (output) {
     case MAX98090_OUTPUT_HEADPHONE:
@@ -315,15 +332,102 @@ static bool MAX98090_Configure(
         return false;
     }
 
-    if (!MAX98090_RegWrite(handle, MAX98090_REG_SYSTEM_CLOCK, regs, sizeof(regs))) {
+    return MAX98090_RegWrite(handle, MAX98090_REG_OUTPUT_ENABLE, &outen, sizeof(outen));
+}
+
+static bool MAX98090_ConfigureInput(MAX98090 *handle, MAX98090_Input input)
+{
+    // Line inputs are IN1 and IN2 single ended, through line mixers A and B.
+    uint8_t lineConfig = 0x00;
+    // Microphone preamps at +20dB with the PGA at 0dB when used, else off.
+    uint8_t micLevel[2] = { 0x00, 0x00 };
+    uint8_t mixer[2];
+    uint8_t inen = 0x03;
+
+    switch (input) {
+    case MAX98090_INPUT_MIC1:
+        micLevel[0] = 0x54;
+        mixer[0] = mixer[1] = 0x20;
+        inen |= 0x10;
+        break;
+
+    case MAX98090_INPUT_MIC2:
+        micLevel[1] = 0x54;
+        mixer[0] = mixer[1] = 0x40;
+        inen |= 0x10;
+        break;
+
+    case MAX98090_INPUT_LINE:
+        lineConfig = 0x30;
+        mixer[0] = 0x08;
+        mixer[1] = 0x10;
+        inen |= 0x0C;
+        break;
+
+    default:
         return false;
     }
 
-    // TODO: Separate out configuration of clocks and output/input.
+    return MAX98090_RegWrite(handle, MAX98090_REG_LINE_INPUT_CONFIG, &lineConfig, sizeof(lineConfig))
+        && MAX98090_RegWrite(handle, MAX98090_REG_MIC1_INPUT_LEVEL, micLevel, sizeof(micLevel))
+        && MAX98090_RegWrite(handle, MAX98090_REG_LEFT_ADC_MIXER, mixer, sizeof(mixer))
+        && MAX98090_RegWrite(handle, MAX98090_REG_INPUT_ENABLE, &inen, sizeof(inen));
+}
 
-    return MAX98090_RegWrite(handle, MAX98090_REG_OUTPUT_ENABLE, &outen, sizeof(outen));
+// Clocks can only be changed in shutdown, so enabling a second direction briefly
+// interrupts the first, which must be running in the same format. Once in
+// shutdown, the codec is brought out of it by MAX98090_End on success or
+// MAX98090_Abort on failure.
+static bool MAX98090_Begin(MAX98090 *handle,
+    bool input, unsigned channels, unsigned bits, unsigned rate)
+{
+    if (!handle) {
+        return false;
+    }
+
+    bool other = (input ? handle->outputEnabled : handle->inputEnabled);
+    if (other && ((channels != handle->channels)
+        || (bits != handle->bits) || (rate != handle->rate))) {
+        return false;
+    }
+
+    return MAX98090_Shutdown(handle, true);
 }
 
+static bool MAX98090_ConfigureIO(MAX98090 *handle,
+    bool input, unsigned channels, unsigned rate)
+{
+    bool other = (input ? handle->outputEnabled : handle->inputEnabled);
+    uint8_t io = (input ? MAX98090_IO_SDOEN : MAX98090_IO_SDIEN);
+    if (other) {
+        io = (MAX98090_IO_SDOEN | MAX98090_IO_SDIEN);
+    }
+    return MAX98090_ConfigureClocks(handle, channels, rate, io);
+}
+
+static void MAX98090_End(MAX98090 *handle,
+    bool input, unsigned channels, unsigned bits, unsigned rate)
+{
+    if (input) {
+        handle->inputEnabled = true;
+    } else {
+        handle->outputEnabled = true;
+    }
+    handle->channels = channels;
+    handle->bits     = bits;
+    handle->rate     = rate;
+
+    MAX98090_Shutdown(handle, false);
+}
+
+// A direction which was already running carries on, otherwise the codec is
+// left in shutdown as it was.
+static void MAX98090_Abort(MAX98090 *handle)
+{
+    if (handle->inputEnabled || handle->outputEnabled) {
+        MAX98090_Shutdown(handle, false);
+    }
+}
 
 MAX98090 *MAX98090_Open(
     I2CMaster *bus, Platform_Unit interface, GPT *timer,
@@ -371,6 +475,9 @@ MAX98090 *MAX98090_Open(
     handle->mclkExternal = mclkExternal;
     handle->mclk         = mclk;
 
+    handle->outputEnabled = false;
+    handle->inputEnabled  = false;
+
     handle->interface = I2S_Open(interface, (mclkExternal ? 0 : mclk));
     if (!handle->interface) {
         MAX98090_Close(handle);
@@ -402,35 +509,58 @@ bool MAX98090_OutputEnable(MAX98090 *handle,
     MAX98090_Output output, unsigned channels, unsigned bits, unsigned rate,
     bool (*callback)(void *, uintptr_t))
 {
-    MAX98090_Shutdown(handle, true);
-
-    if (!MAX98090_Configure(handle, output, channels, rate)) {
+    if (!MAX98090_Begin(handle, false, channels, bits, rate)) {
         return false;
     }
 
+    if (!MAX98090_ConfigureIO(handle, false, channels, rate)
+        || !MAX98090_ConfigureOutput(handle, output)) {
+        goto fail;
+    }
+
     // We have to wait for at least 2 BCLK cycles, but have no way of detecting this.
     GPT_WaitTimer_Blocking(handle->timer, 20, GPT_UNITS_MILLISEC);
 
     if (I2S_Output(handle->interface,
         (channels <= 2 ? I2S_FORMAT_I2S : I2S_FORMAT_TDM),
         channels, bits, rate, callback) != ERROR_NONE) {
-        return false;
+        goto fail;
     }
 
-    MAX98090_Shutdown(handle, false);
+    MAX98090_End(handle, false, channels, bits, rate);
     return true;
+
+fail:
+    MAX98090_Abort(handle);
+    return false;
 }
 
 bool MAX98090_InputEnable(MAX98090 *handle,
-    unsigned input, unsigned channels, unsigned bits, unsigned rate,
+    MAX98090_Input input, unsigned channels, unsigned bits, unsigned rate,
     bool (*callback)(void *, uintptr_t))
 {
-    (void)input;
-    (void)channels;
-    (void)bits;
-    (void)rate;
-    (void)callback;
+    if (!MAX98090_Begin(handle, true, channels, bits, rate)) {
+        return false;
+    }
+
+    if (!MAX98090_ConfigureIO(handle, true, channels, rate)
+        || !MAX98090_ConfigureInput(handle, input)) {
+        goto fail;
+    }
+
+    // We have to wait for at least 2 BCLK cycles, but have no way of detecting this.
+    GPT_WaitTimer_Blocking(handle->timer, 20, GPT_UNITS_MILLISEC);
+
+    if (I2S_Input(handle->interface,
+        (channels <= 2 ? I2S_FORMAT_I2S : I2S_FORMAT_TDM),
+        channels, bits, rate, callback) != ERROR_NONE) {
+        goto fail;
+    }
+
+    MAX98090_End(handle, true, channels, bits, rate);
+    return true;
 
-    // TODO: Implement.
+fail:
+    MAX98090_Abort(handle);
     return false;
 }
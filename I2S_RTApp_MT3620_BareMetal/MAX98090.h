@@ -26,6 +26,14 @@ typedef enum {
     MAX98090_OUTPUT_COUNT
 } MAX98090_Output;
 
+typedef enum {
+    MAX98090_INPUT_MIC1 = 0,
+    MAX98090_INPUT_MIC2,
+    // IN1 to the left channel and IN2 to the right, single ended.
+    MAX98090_INPUT_LINE,
+    MAX98090_INPUT_COUNT
+} MAX98090_Input;
+
 MAX98090 *MAX98090_Open(
     I2CMaster *bus, Platform_Unit interface, GPT *timer,
     MAX98090_Variant variant, bool mclkExternal, unsigned mclk);
@@ -33,11 +41,15 @@ void MAX98090_Close(MAX98090 *handle);
 
 bool MAX98090_Reset(MAX98090 *handle);
 
+// Output and input can run at once, as long as both use the same format. Enabling
+// one while the other is running interrupts it for around 20ms. callback is
+// called in interrupt context with the I2S driver's own DMA buffer, which is
+// only valid until it returns.
 bool MAX98090_OutputEnable(MAX98090 *handle,
     MAX98090_Output output, unsigned channels, unsigned bits, unsigned rate,
     bool (*callback)(void *, uintptr_t));
 bool MAX98090_InputEnable(MAX98090 *handle,
-    unsigned input, unsigned channels, unsigned bits, unsigned rate,
+    MAX98090_Input input, unsigned channels, unsigned bits, unsigned rate,
     bool (*callback)(void *, uintptr_t));
 
 #endif // #ifndef MAX98090_H_
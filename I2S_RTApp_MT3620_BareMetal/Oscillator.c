@@ -0,0 +1,225 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "Oscillator.h"
+#include "DSP.h"
+#include "Placement.h"
+#include <stddef.h>
+
+// This is the maximum number of banks which can be opened at once.
+#define OSCILLATOR_BANK_MAX 2
+
+// Voices are rendered into a mix this many frames at a time, with envelopes
+// being stepped once per chunk.
+#define OSCILLATOR_CHUNK 32
+
+// The wavetable holds a whole cycle, indexed by the top bits of the phase.
+// Each entry packs a sample with the difference to the next so interpolating
+// between them is a single SMLAD.
+#define OSCILLATOR_TABLE_BITS 10
+#define OSCILLATOR_TABLE_SIZE (1U << OSCILLATOR_TABLE_BITS)
+#define OSCILLATOR_FRACT_BITS 14
+
+// Read for every frame of every voice, so kept in TCM with the render loop.
+static TCM_DATA uint32_t Oscillator_Table[OSCILLATOR_TABLE_SIZE];
+
+struct OscillatorBank {
+    unsigned rate;
+
+    // Kept as separate arrays so each voice's loop only touches its own state.
+    // Gains are Q30 so ramps can step by less than a Q15 unit per frame.
+    uint32_t phase[OSCILLATOR_VOICES];
+    uint32_t step[OSCILLATOR_VOICES];
+    int32_t  gain[OSCILLATOR_VOICES];
+    int32_t  target[OSCILLATOR_VOICES];
+    int32_t  slope[OSCILLATOR_VOICES];
+};
+
+static void Oscillator_BuildTable(void)
+{
+    // A quarter cycle of sine in Q16, with the peak of 0x10000 left out.
+    static const uint16_t quarter[] = {
+        #include "sin.h"
+    };
+    static bool built = false;
+    if (built) {
+        return;
+    }
+
+    int16_t cycle[OSCILLATOR_TABLE_SIZE];
+    unsigned n;
+    for (n = 0; n < OSCILLATOR_TABLE_SIZE; n++) {
+        unsigned phase = (n >> 8) & 3;
+        unsigned index = n & 0xFF;
+
+        int32_t value;
+        if (phase & 1) {
+            value = (index == 0 ? 0x10000 : quarter[256 - index]);
+        } else {
+            value = quarter[index];
+        }
+
+        // Round to Q15, the peak being the one value that needs saturating.
+        value = ((value + 1) >> 1);
+        if (value > INT16_MAX) {
+            value = INT16_MAX;
+        }
+        cycle[n] = (int16_t)(phase & 2 ? -value : value);
+    }
+
+    for (n = 0; n < OSCILLATOR_TABLE_SIZE; n++) {
+        int16_t value = cycle[n];
+        int16_t delta = (int16_t)(cycle[(n + 1) % OSCILLATOR_TABLE_SIZE] - value);
+        Oscillator_Table[n] = ((uint32_t)(uint16_t)value | ((uint32_t)(uint16_t)delta << 16));
+    }
+    built = true;
+}
+
+OscillatorBank *OscillatorBank_Open(unsigned rate)
+{
+    if (rate == 0) {
+        return NULL;
+    }
+
+    static OscillatorBank Handles[OSCILLATOR_BANK_MAX] = {0};
+    OscillatorBank *bank = NULL;
+    unsigned h;
+    for (h = 0; h < OSCILLATOR_BANK_MAX; h++) {
+        if (Handles[h].rate == 0) {
+            bank = &Handles[h];
+            break;
+        }
+    }
+    if (!bank) {
+        return NULL;
+    }
+
+    Oscillator_BuildTable();
+
+    *bank = (OscillatorBank){0};
+    bank->rate = rate;
+    return bank;
+}
+
+void OscillatorBank_Close(OscillatorBank *bank)
+{
+    if (!bank) {
+        return;
+    }
+    bank->rate = 0;
+}
+
+bool OscillatorBank_SetFrequency(OscillatorBank *bank, unsigned voice, unsigned frequency)
+{
+    if (!bank || (voice >= OSCILLATOR_VOICES) || (frequency >= (bank->rate / 2))) {
+        return false;
+    }
+
+    // Phase advance per frame, where a whole cycle is 2^32.
+    bank->step[voice] = ((((uint64_t)frequency << 32) + (bank->rate / 2)) / bank->rate);
+    return true;
+}
+
+bool OscillatorBank_SetGain(OscillatorBank *bank, unsigned voice, int16_t gain, uint32_t frames)
+{
+    if (!bank || (voice >= OSCILLATOR_VOICES)) {
+        return false;
+    }
+
+    int32_t target = ((int32_t)gain * (1 << 15));
+    int32_t delta  = (target - bank->gain[voice]);
+    int32_t slope  = (frames > 0 ? (delta / (int32_t)(frames > INT32_MAX ? INT32_MAX : frames)) : delta);
+    if ((slope == 0) && (delta != 0)) {
+        slope = (delta > 0 ? 1 : -1);
+    }
+
+    bank->target[voice] = target;
+    bank->slope[voice]  = slope;
+    return true;
+}
+
+bool OscillatorBank_ResetPhase(OscillatorBank *bank, unsigned voice)
+{
+    if (!bank || (voice >= OSCILLATOR_VOICES)) {
+        return false;
+    }
+    bank->phase[voice] = 0;
+    return true;
+}
+
+bool OscillatorBank_IsActive(OscillatorBank *bank, unsigned voice)
+{
+    if (!bank || (voice >= OSCILLATOR_VOICES)) {
+        return false;
+    }
+    return ((bank->gain[voice] != 0) || (bank->target[voice] != 0));
+}
+
+// Adds frames frames of the voice to mix, its gain changing by slope per frame.
+static inline void OscillatorBank__RenderVoice(
+    int32_t *mix, uintptr_t frames, uint32_t *phase, uint32_t step, int32_t gain, int32_t slope)
+{
+    uint32_t p = *phase;
+    uintptr_t i;
+    for (i = 0; i < frames; i++) {
+        uint32_t entry = Oscillator_Table[p >> (32 - OSCILLATOR_TABLE_BITS)];
+        uint32_t fract = ((p >> (32 - OSCILLATOR_TABLE_BITS - OSCILLATOR_FRACT_BITS))
+            & ((1U << OSCILLATOR_FRACT_BITS) - 1));
+
+        // sample * 2^14 + delta * fract
+        int32_t sample = (DSP_SMLAD(entry, ((fract << 16) | (1U << OSCILLATOR_FRACT_BITS)), 0)
+            >> OSCILLATOR_FRACT_BITS);
+        mix[i] += ((sample * (gain >> 15)) >> 15);
+
+        gain += slope;
+        p    += step;
+    }
+    *phase = p;
+}
+
+TCM_CODE void OscillatorBank_Render(
+    OscillatorBank *bank, int16_t *data, uintptr_t frames, unsigned channels)
+{
+    if (!bank || !data) {
+        return;
+    }
+
+    while (frames > 0) {
+        uintptr_t chunk = (frames < OSCILLATOR_CHUNK ? frames : OSCILLATOR_CHUNK);
+        int32_t mix[OSCILLATOR_CHUNK] = {0};
+
+        unsigned v;
+        for (v = 0; v < OSCILLATOR_VOICES; v++) {
+            int32_t gain   = bank->gain[v];
+            int32_t target = bank->target[v];
+            if ((gain == 0) && (target == 0)) {
+                continue;
+            }
+
+            // Work out where this chunk's ramp ends, stopping at the target,
+            // then step evenly towards it.
+            int32_t end = target;
+            if (gain != target) {
+                int64_t next = (gain + ((int64_t)bank->slope[v] * (int64_t)chunk));
+                if ((target > gain) ? (next < target) : (next > target)) {
+                    end = (int32_t)next;
+                }
+            }
+            int32_t slope = ((end - gain) / (int32_t)chunk);
+
+            OscillatorBank__RenderVoice(
+                mix, chunk, &bank->phase[v], bank->step[v], gain, slope);
+            bank->gain[v] = end;
+        }
+
+        uintptr_t i;
+        for (i = 0; i < chunk; i++) {
+            int16_t sample = DSP_SatQ15(mix[i]);
+            unsigned c;
+            for (c = 0; c < channels; c++) {
+                *data++ = sample;
+            }
+        }
+        frames -= chunk;
+    }
+}
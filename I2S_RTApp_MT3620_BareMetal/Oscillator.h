@@ -0,0 +1,52 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef OSCILLATOR_H_
+#define OSCILLATOR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// A bank of sine oscillators mixed into one output, for tones, alerts and
+// multi-frequency signalling. Every voice reads the same interpolated
+// wavetable through a 32-bit phase accumulator, so frequencies are accurate to
+// a fraction of a millihertz at any sample rate, and the cost is a handful of
+// cycles per sounding voice per frame whatever the frequency.
+//
+// Frequency changes only alter how fast the phase advances, so they never
+// cause a discontinuity. Each voice's gain ramps linearly to its target over
+// a given number of frames, which gives a simple attack and release envelope
+// when a voice is started or stopped. Voices whose gain is zero cost nothing.
+//
+// The bank isn't locked, so voices must be changed from the same context that
+// renders it.
+
+// This is the number of voices in each bank.
+#define OSCILLATOR_VOICES 8
+
+typedef struct OscillatorBank OscillatorBank;
+
+OscillatorBank *OscillatorBank_Open(unsigned rate);
+void OscillatorBank_Close(OscillatorBank *bank);
+
+// Sets the voice's frequency in Hz, which must be below half the sample rate,
+// keeping its phase.
+bool OscillatorBank_SetFrequency(OscillatorBank *bank, unsigned voice, unsigned frequency);
+
+// Ramps the voice's gain, in Q15, to gain over frames frames. A gain of zero
+// silences the voice once the ramp is done.
+bool OscillatorBank_SetGain(OscillatorBank *bank, unsigned voice, int16_t gain, uint32_t frames);
+
+// Restarts the voice from the beginning of its cycle, which is only needed to
+// line up the phases of related voices.
+bool OscillatorBank_ResetPhase(OscillatorBank *bank, unsigned voice);
+
+// True while the voice is sounding or ramping.
+bool OscillatorBank_IsActive(OscillatorBank *bank, unsigned voice);
+
+// Renders frames frames of the mixed voices, saturating rather than wrapping
+// if it's too loud, writing the same sample to every channel of each frame.
+void OscillatorBank_Render(
+    OscillatorBank *bank, int16_t *data, uintptr_t frames, unsigned channels);
+
+#endif // #ifndef OSCILLATOR_H_
@@ -17,177 +17,224 @@
 #include "lib/I2CMaster.h"
 
 #include "MAX98090.h"
+#include "AudioStream.h"
+#include "Oscillator.h"
+#include "DSP.h"
+#include "EventQueue.h"
+#include "Input.h"
+#include "Profile.h"
+#include "Placement.h"
+#include "Governor.h"
 
 
 static const uint32_t buttonAGpio = 12;
 static const uint32_t buttonBGpio = 13;
-static const int buttonPressCheckPeriodMs = 10;
-static void HandleButtonTimerIrq(GPT *);
-static void HandleButtonTimerIrqDeferred(void);
+static void HandleButtonDeferred(void *payload);
+static void HandleAudioRequestDeferred(void *payload);
+static void HandleCaptureReadyDeferred(void *payload);
 
 static I2CMaster *bus   = NULL;
 static MAX98090  *codec = NULL;
 static UART      *debug = NULL;
 static GPT       *timer = NULL;
 
-static unsigned audioRate   = 48000;
-static unsigned audioFreq   = 440;
-static uint64_t audioPeriod = 0;
-static uint64_t audioOffset = 0;
-
-typedef struct CallbackNode {
-    bool enqueued;
-    struct CallbackNode *next;
-    void (*cb)(void);
-} CallbackNode;
-
-static void EnqueueCallback(CallbackNode *node);
+static unsigned audioRate = 48000;
+static unsigned audioFreq = 440;
+
+// The tone is made up of a fundamental and its first few harmonics, each
+// played by its own voice, and fades in and out over 10ms to avoid clicks.
+#define HARMONICS        4
+#define AUDIO_FADE_RATIO 100
+static OscillatorBank *tones = NULL;
+
+// Audio is rendered in blocks of about 5ms, with enough queued to cover 10ms
+// of other work before the output underruns.
+#define AUDIO_CHANNELS     2
+#define AUDIO_BLOCK_FRAMES 256
+#define AUDIO_BLOCKS       3
+static int16_t audioBuffer[AUDIO_CHANNELS * AUDIO_BLOCK_FRAMES * AUDIO_BLOCKS];
+static AudioStream *audio = NULL;
+
+// Captured audio is handed over a block at a time, the peak level being reported
+// every few seconds.
+#define CAPTURE_BLOCKS        4
+#define CAPTURE_REPORT_PERIOD 5
+static int16_t captureBuffer[AUDIO_CHANNELS * AUDIO_BLOCK_FRAMES * CAPTURE_BLOCKS];
+static AudioStream *capture = NULL;
+
+// The microphone's DC offset is filtered out so it doesn't count towards the
+// peak level, with a single pole high pass at around 40Hz.
+DSP_BIQUAD_Q15_DEFINE(captureHighPass, 1, AUDIO_CHANNELS)
+static const DSP_BiquadQ15 captureHighPassCoeffs[1] = {
+    DSP_BIQUAD_Q15(0.9974, -0.9974, 0.0, -0.9948, 0.0),
+};
+static DSP_BiquadQ15State captureHighPassState[AUDIO_CHANNELS] = {0};
+
+// One pending audio event covers everything a repeat would have, as each
+// handler deals with all there is to do, while button presses are handled in
+// the order they happened.
+EVENT_QUEUE_DEFINE_SIGNAL(audioEvents, 1);
+EVENT_QUEUE_DEFINE_SIGNAL(captureEvents, 1);
+EVENT_QUEUE_DEFINE(buttonEvents, Input_Event, 4);
+
+static void HandleAudioRequest(void)
+{
+    EventQueue_Post(&audioEvents, NULL);
+}
 
-static void HandleButtonTimerIrq(GPT *handle)
+static void HandleAudioRequestDeferred(void *payload)
 {
-    (void)handle;
-    static CallbackNode cbn = {.enqueued = false, .cb = HandleButtonTimerIrqDeferred};
-    EnqueueCallback(&cbn);
+    (void)payload;
+
+    // Rendering is the only work worth running the core at full speed for.
+    Governor_Begin();
+    AudioStream_Fill(audio);
+    Governor_End();
 }
 
-uint64_t period(unsigned tone, unsigned rate)
+static void HandleCaptureReady(void)
 {
-    return (((uint64_t)rate * 65536ULL) + (tone / 2)) / tone;
+    EventQueue_Post(&captureEvents, NULL);
 }
 
-static void HandleButtonTimerIrqDeferred(void)
+static void HandleCaptureReadyDeferred(void *payload)
 {
-    // Assume initial state is high, i.e. button not pressed.
-    static bool prevState[2] = { true, true };
-    bool newState[2];
-    GPIO_Read(buttonAGpio, &newState[0]);
-    GPIO_Read(buttonBGpio, &newState[1]);
-
-    unsigned i;
-    for (i = 0; i < 2; i++) {
-        if (newState[i] != prevState[i]) {
-            bool pressed = !newState[i];
-            if (pressed) {
-                if (i == 0)
-                {
-                    audioFreq += 10;
-                    UART_Printf(debug, "Frequency increased to %u Hz\r\n", audioFreq);
-                } else {
-                    audioFreq -= 10;
-                    UART_Printf(debug, "Frequency decreased to %u Hz\r\n", audioFreq);
-                }
-                audioPeriod = period(audioFreq, audioRate);
-            }
+    (void)payload;
 
-            prevState[i] = newState[i];
-        }
-    }
-}
+    static unsigned frames = 0;
+    static int32_t  peak   = 0;
 
-static CallbackNode *volatile callbacks = NULL;
+    int16_t *block;
+    while ((block = AudioStream_Acquire(capture))) {
+        captureHighPass(captureHighPassCoeffs, captureHighPassState,
+            block, block, AUDIO_BLOCK_FRAMES);
 
-static void EnqueueCallback(CallbackNode *node)
-{
-    uint32_t prevBasePri = NVIC_BlockIRQs();
-    if (!node->enqueued) {
-        CallbackNode *prevHead = callbacks;
-        node->enqueued = true;
-        callbacks = node;
-        node->next = prevHead;
-    }
-    NVIC_RestoreIRQs(prevBasePri);
+        unsigned i;
+        for (i = 0; i < (AUDIO_BLOCK_FRAMES * AUDIO_CHANNELS); i++) {
+            int32_t level = (block[i] < 0 ? -block[i] : block[i]);
+            if (level > peak) {
+                peak = level;
+            }
+        }
+        AudioStream_Release(capture);
+
+        frames += AUDIO_BLOCK_FRAMES;
+        if (frames >= (audioRate * CAPTURE_REPORT_PERIOD)) {
+            AudioStream_Stats stats;
+            AudioStream_GetStats(capture, &stats, false);
+            UART_Printf(debug, "Input peak %" PRId32 ", %" PRIu32 " overruns\r\n",
+                peak, stats.overruns);
+            frames = 0;
+            peak   = 0;
+        }
+    }
 }
 
-static void InvokeCallbacks(void)
+static void SetTone(unsigned frequency)
 {
-    CallbackNode *node;
-    do {
-        uint32_t prevBasePri = NVIC_BlockIRQs();
-        node = callbacks;
-        if (node) {
-            node->enqueued = false;
-            callbacks = node->next;
-        }
-        NVIC_RestoreIRQs(prevBasePri);
-
-        if (node) {
-            (*node->cb)();
+    unsigned h;
+    for (h = 0; h < HARMONICS; h++) {
+        // Harmonics at or above the Nyquist frequency would alias, so are
+        // faded out instead.
+        int16_t gain = 0;
+        if (OscillatorBank_SetFrequency(tones, h, (frequency * (h + 1)))) {
+            gain = (0x4000 >> (h * 2));
         }
-    } while (node);
+        OscillatorBank_SetGain(tones, h, gain, (audioRate / AUDIO_FADE_RATIO));
+    }
 }
 
-int32_t sine(uint32_t angle)
+static void HandleButtonDeferred(void *payload)
 {
-    static const uint16_t table[] = {
-        #include "sin.h"
-    };
-
-    unsigned phase = (angle >> 16) &    3;
-    unsigned imin  = (angle >>  8) & 0xFF;
-    unsigned fract =  angle        & 0xFF;
-
-    unsigned imax;
-    if (phase & 1) {
-        imax = (256 - imin);
-        imin = imax - 1;
-        fract = (256 - fract);
-    } else {
-        imax = imin + 1;
+    const Input_Event *event = payload;
+    if (!event->pressed) {
+        return;
     }
 
-    uint32_t min = table[imin];
-    uint32_t max = (imax >= 256 ? 0x10000 : table[imax]);
-    int32_t value = ((min * (256 - fract)) + (max * fract)) >> 8;
+    if (event->pin == buttonAGpio)
+    {
+        audioFreq += 10;
+        UART_Printf(debug, "Frequency increased to %u Hz\r\n", audioFreq);
+    } else {
+        audioFreq -= 10;
+        UART_Printf(debug, "Frequency decreased to %u Hz\r\n", audioFreq);
+    }
+    SetTone(audioFreq);
+
+    AudioStream_Stats stats;
+    AudioStream_GetStats(audio, &stats, false);
+    UART_Printf(debug, "Played %" PRIu32 " blocks, %" PRIu32 " underruns\r\n",
+        stats.blocks, stats.underruns);
+
+    Governor_Stats governor;
+    Governor_GetStats(&governor, true);
+    UART_Printf(debug, "Raised the clock %" PRIu32 " times for %" PRIu32 " renders\r\n",
+        governor.raises, governor.bursts);
+    PROFILE_PRINT(debug, false);
+}
 
-    return (phase & 2 ? -value : value);
+static TCM_CODE void audioRender(int16_t *data, uintptr_t frames, unsigned channels)
+{
+    OscillatorBank_Render(tones, data, frames, channels);
 }
 
-#define HARMONICS 4
+PROFILE_MARKER(audioCallback);
 
-int32_t tone(uint64_t period, uint64_t* offset)
+static TCM_CODE bool audioCallback(void *data, uintptr_t size)
 {
-    uint32_t angle = ((*offset) * (1ULL << 18)) / period;
-
-    int32_t sample = 0;
-    unsigned h;
-    for (h = 0; h < HARMONICS; h++) {
-        sample += sine(angle * (h + 1)) >> ((h * 2) + 1);
-    }
+    PROFILE_SCOPE(audioCallback);
 
-    *offset += 65536;
-    if (*offset > period) {
-        *offset -= period;
+    uintptr_t chunk = (sizeof(int16_t) * AUDIO_CHANNELS);
+    if (size % chunk) {
+        return false;
     }
-    return sample;
+    return AudioStream_Output(audio, data, size);
 }
 
-static bool audioCallback(uint16_t *data, uintptr_t size)
+static bool captureCallback(void *data, uintptr_t size)
 {
-    uintptr_t chunk = (sizeof(int16_t) * 2);
+    uintptr_t chunk = (sizeof(int16_t) * AUDIO_CHANNELS);
     if (size % chunk) {
         return false;
     }
-
-    while (size >= chunk) {
-        int16_t sample = tone(audioPeriod, &audioOffset);
-        __builtin_memcpy(data++, &sample, sizeof(sample));
-        __builtin_memcpy(data++, &sample, sizeof(sample));
-        size -= chunk;
-    }
-    return true;
+    return AudioStream_Input(capture, data, size);
 }
 
 _Noreturn void RTCoreMain(void)
 {
     VectorTableInit();
-    CPUFreq_Set(197600000);
+    // The core idles at 26 MHz, and is raised to 197.6 MHz to render audio.
+    bool governed = Governor_Init(26000000, 197600000);
+    if (!governed) {
+        CPUFreq_Set(197600000);
+    }
+    PROFILE_INIT(NULL);
 
     debug = UART_Open(MT3620_UNIT_UART_DEBUG, 115200, UART_PARITY_NONE, 1, NULL);
     UART_Print(debug, "--------------------------------\r\n");
     UART_Print(debug, "I2S_RTApp_MT3620_BareMetal\r\n");
     UART_Print(debug, "App built on: " __DATE__ " " __TIME__ "\r\n");
+    if (!governed) {
+        UART_Print(debug, "ERROR: Failed to set up the clock governor\r\n");
+    }
+
+    // Keeping the output fed comes first, then draining the input.
+    EventQueue_Init(&audioEvents, 0, HandleAudioRequestDeferred);
+    EventQueue_Init(&captureEvents, 1, HandleCaptureReadyDeferred);
+    EventQueue_Init(&buttonEvents, 2, HandleButtonDeferred);
+
+    tones = OscillatorBank_Open(audioRate);
+    if (!tones) {
+        UART_Print(debug, "ERROR: Failed to open oscillator bank\r\n");
+    }
+    SetTone(audioFreq);
 
-    audioPeriod = period(audioFreq, audioRate);
+    audio = AudioStream_Open(
+        AUDIO_CHANNELS, AUDIO_BLOCK_FRAMES, AUDIO_BLOCKS, audioBuffer,
+        audioRender, HandleAudioRequest);
+    capture = AudioStream_OpenInput(
+        AUDIO_CHANNELS, AUDIO_BLOCK_FRAMES, CAPTURE_BLOCKS, captureBuffer,
+        HandleCaptureReady);
 
     timer = GPT_Open(MT3620_UNIT_GPT1, 32768, GPT_MODE_REPEAT);
     if (!timer) {
@@ -206,23 +253,33 @@ _Noreturn void RTCoreMain(void)
         UART_Print(debug, "ERROR: I2S initialisation failed\r\n");
     }
 
-    if (!MAX98090_OutputEnable(codec, MAX98090_OUTPUT_HEADPHONE, 2, 16, audioRate, (void *)audioCallback)) {
+    if (!MAX98090_OutputEnable(codec, MAX98090_OUTPUT_HEADPHONE, AUDIO_CHANNELS, 16, audioRate, audioCallback)) {
         UART_Print(debug, "ERROR: Failed to enable output on codec\r\n");
     }
 
-    UART_Print(debug, "Press button A or B to change frequency.\r\n");
+    if (!MAX98090_InputEnable(codec, MAX98090_INPUT_MIC1, AUDIO_CHANNELS, 16, audioRate, captureCallback)) {
+        UART_Print(debug, "ERROR: Failed to enable input on codec\r\n");
+    }
 
-    GPIO_ConfigurePinForInput(buttonAGpio);
+    UART_Print(debug, "Press button A or B to change frequency.\r\n");
 
-    int32_t error = GPT_StartTimeout(
-        timer, buttonPressCheckPeriodMs,
-        GPT_UNITS_MILLISEC, HandleButtonTimerIrq);
-    if (error != ERROR_NONE) {
-        UART_Printf(debug, "ERROR(%" PRId32 "): Failed to start timer\r\n", error);
+    if (!Input_Open(buttonAGpio, INPUT_EDGE_PRESS, &buttonEvents)
+        || !Input_Open(buttonBGpio, INPUT_EDGE_PRESS, &buttonEvents)) {
+        UART_Print(debug, "ERROR: Configuring button interrupts\r\n");
     }
 
     for (;;) {
-        __asm__("wfi");
-        InvokeCallbacks();
+        EventQueue_Dispatch();
+
+        // An event posted after the queues were checked still wakes the core,
+        // as wfi returns for an interrupt pending while they're masked. The
+        // clock is dropped masked too, so a burst started by an interrupt
+        // meanwhile wakes the core to drop it again.
+        __asm__ volatile ("cpsid i" ::: "memory");
+        Governor_Idle();
+        if (!EventQueue_Pending()) {
+            __asm__ volatile ("wfi");
+        }
+        __asm__ volatile ("cpsie i" ::: "memory");
     }
 }
@@ -0,0 +1,92 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stddef.h>
+
+#include "Input.h"
+#include "lib/NVIC.h"
+
+typedef struct {
+    EventQueue       *queue;
+    gpio_eint_attr_t  attr;
+    bool              pressed;
+} Input_Pin;
+
+static Input_Pin pins[INPUT_PIN_COUNT] = { 0 };
+
+static void Input__Irq(uint32_t pin)
+{
+    Input_Pin *p = &pins[pin];
+    if (!p->queue) {
+        return;
+    }
+
+    Input_Event event = { .pin = pin, .pressed = true };
+    if (p->attr.dualEdge) {
+        // The level has settled by the time the debounced interrupt fires.
+        bool level;
+        event.pressed = ((GPIO_Read(pin, &level) == ERROR_NONE) ? !level : !p->pressed);
+        if (event.pressed == p->pressed) {
+            return;
+        }
+        p->pressed = event.pressed;
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    EventQueue_Post(p->queue, &event);
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+// Each group of four pins has an interrupt per pin, numbered within the group.
+#define INPUT_IRQ(group, irq) \
+    void gpio_g##group##_irq##irq(void) \
+    { \
+        Input__Irq(((group) * 4) + (irq)); \
+    }
+
+#define INPUT_IRQ_GROUP(group) \
+    INPUT_IRQ(group, 0) \
+    INPUT_IRQ(group, 1) \
+    INPUT_IRQ(group, 2) \
+    INPUT_IRQ(group, 3)
+
+INPUT_IRQ_GROUP(0)
+INPUT_IRQ_GROUP(1)
+INPUT_IRQ_GROUP(2)
+INPUT_IRQ_GROUP(3)
+INPUT_IRQ_GROUP(4)
+INPUT_IRQ_GROUP(5)
+
+bool Input_Open(uint32_t pin, Input_Edges edges, EventQueue *queue)
+{
+    if ((pin >= INPUT_PIN_COUNT) || !queue) {
+        return false;
+    }
+
+    Input_Pin *p = &pins[pin];
+    p->queue         = NULL;
+    p->attr          = gpioEINTAttrDefault;
+    p->attr.dualEdge = (edges == INPUT_EDGE_BOTH);
+
+    bool level = true;
+    (void)GPIO_Read(pin, &level);
+    p->pressed = !level;
+
+    p->queue = queue;
+    if (EINT_ConfigurePin(pin, &p->attr) != ERROR_NONE) {
+        p->queue = NULL;
+        return false;
+    }
+    return true;
+}
+
+bool Input_SetDebounce(uint32_t pin, gpio_eint_dbnc_freq_e freq)
+{
+    if ((pin >= INPUT_PIN_COUNT) || !pins[pin].queue
+        || (freq >= GPIO_EINT_DBNC_FREQ_INVALID)) {
+        return false;
+    }
+
+    pins[pin].attr.freq = freq;
+    return (EINT_ConfigurePin(pin, &pins[pin].attr) == ERROR_NONE);
+}
@@ -0,0 +1,55 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef INPUT_H_
+#define INPUT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "EventQueue.h"
+#include "lib/GPIO.h"
+
+// Button input for the bare-metal samples, using the external interrupt of
+// each pin rather than polling it from a timer.
+//
+// The EINT controller debounces each pin in hardware, so the core is only
+// woken when a button has settled into a new state. Each change is posted to
+// an event queue defined for Input_Event, which is handled in the main loop
+// like any other. Buttons are taken to be active low, as those on the dev kit
+// are.
+//
+//     EVENT_QUEUE_DEFINE(buttonEvents, Input_Event, 4);
+//
+//     EventQueue_Init(&buttonEvents, 1, HandleButton);
+//     Input_Open(12, INPUT_EDGE_PRESS, &buttonEvents);
+//
+// Each pin has its own interrupt, so events are posted with interrupts blocked
+// and any number of pins may share one queue. A signal queue may be given too,
+// where only a change matters and not which.
+//
+// This module defines the handlers of every external interrupt, so a sample
+// using it opens all its external interrupts through it, buttons or not.
+
+// Only GPIO0 to GPIO23 have external interrupts.
+#define INPUT_PIN_COUNT 24
+
+typedef enum {
+    INPUT_EDGE_PRESS,
+    INPUT_EDGE_BOTH,
+} Input_Edges;
+
+typedef struct {
+    uint32_t pin;
+    bool     pressed;
+} Input_Event;
+
+// Starts posting changes of the pin to queue, with the default debounce.
+// Returns false if the pin has no external interrupt or couldn't be
+// configured.
+bool Input_Open(uint32_t pin, Input_Edges edges, EventQueue *queue);
+
+// Changes how long the pin must be stable for before a change is posted.
+bool Input_SetDebounce(uint32_t pin, gpio_eint_dbnc_freq_e freq);
+
+#endif // #ifndef INPUT_H_
@@ -0,0 +1,138 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <applibs/log.h>
+
+#include "intercore_adc.h"
+
+// The RTApp's ADC has 8 channels of 12 bits, referenced to 2.5V.
+#define ADC_CHANNELS_MAX 8
+#define ADC_MAX_VAL 0xFFF
+#define ADC_VREF_MV 2500
+
+static bool sequenceValid = false;
+static uint32_t sequenceNext = 0;
+
+static uint32_t blocks = 0;
+static uint32_t dropped = 0;
+static uint32_t malformed = 0;
+
+static uint8_t meanMask = 0;
+static uint32_t mean[ADC_CHANNELS_MAX];
+
+static unsigned CountChannels(uint8_t mask)
+{
+    unsigned count = 0;
+    for (; mask != 0; mask &= (mask - 1)) {
+        count++;
+    }
+    return count;
+}
+
+static int HandleBlock(const IntercoreAdcHeader *header, const uint8_t *samples, size_t size)
+{
+    unsigned channels = CountChannels(header->channelMask);
+    if ((channels == 0) || (header->frames == 0) ||
+        (size != (channels * header->frames * sizeof(uint16_t)))) {
+        return -1;
+    }
+
+    // Anything other than the next block in sequence means the ones between were
+    // dropped, as the RTApp never sends them out of order.
+    if (sequenceValid) {
+        dropped += (header->sequence - sequenceNext);
+    }
+    sequenceNext = (header->sequence + 1);
+    sequenceValid = true;
+    blocks++;
+
+    // The samples aren't aligned in the message, so each is read as bytes.
+    unsigned c = 0;
+    for (unsigned bit = 0; bit < ADC_CHANNELS_MAX; bit++) {
+        if ((header->channelMask & (1U << bit)) == 0) {
+            continue;
+        }
+        const uint8_t *channel = &samples[c * header->frames * sizeof(uint16_t)];
+        uint32_t sum = 0;
+        for (unsigned i = 0; i < header->frames; i++) {
+            sum += (uint32_t)(channel[i * 2] | (channel[(i * 2) + 1] << 8));
+        }
+        mean[bit] = (sum / header->frames);
+        c++;
+    }
+    meanMask = header->channelMask;
+    return 0;
+}
+
+static int HandleTiming(const uint8_t *data, size_t size)
+{
+    IntercoreAdcTiming timing;
+    if (size != sizeof(timing)) {
+        return -1;
+    }
+    memcpy(&timing, data, sizeof(timing));
+
+    uint32_t meanInterval = (timing.count ? (uint32_t)(timing.total / timing.count) : 0);
+    Log_Debug("ADC callbacks: %u, interval min=%uus mean=%uus max=%uus expected=%uus, missed %u\n",
+              timing.count, timing.min, meanInterval, timing.max, timing.expected, timing.missed);
+
+    Log_Debug("ADC interval histogram (%uus bins):", timing.binWidth);
+    for (unsigned i = 0; i < INTERCORE_ADC_TIMING_BINS; i++) {
+        Log_Debug(" %u", timing.histogram[i]);
+    }
+    Log_Debug("\n");
+    return 0;
+}
+
+int HandleIntercoreAdcMessage(const void *data, size_t size)
+{
+    IntercoreAdcHeader header;
+    if (size < sizeof(header)) {
+        malformed++;
+        return -1;
+    }
+    memcpy(&header, data, sizeof(header));
+
+    const uint8_t *body = (const uint8_t *)data + sizeof(header);
+    size_t bodySize = (size - sizeof(header));
+
+    int result = -1;
+    switch (header.type) {
+    case IntercoreAdcMsg_Block:
+        result = HandleBlock(&header, body, bodySize);
+        break;
+    case IntercoreAdcMsg_Timing:
+        result = HandleTiming(body, bodySize);
+        break;
+    default:
+        break;
+    }
+
+    if (result != 0) {
+        malformed++;
+    }
+    return result;
+}
+
+void LogIntercoreAdcStats(void)
+{
+    Log_Debug("ADC blocks: %u received, %u dropped, %u malformed\n", blocks, dropped, malformed);
+    blocks = 0;
+    dropped = 0;
+    malformed = 0;
+
+    if (meanMask == 0) {
+        return;
+    }
+    Log_Debug("ADC means:");
+    for (unsigned bit = 0; bit < ADC_CHANNELS_MAX; bit++) {
+        if (meanMask & (1U << bit)) {
+            uint32_t mV = ((mean[bit] * ADC_VREF_MV) / ADC_MAX_VAL);
+            Log_Debug(" %u=%u.%03uV", bit, (mV / 1000), (mV % 1000));
+        }
+    }
+    Log_Debug("\n");
+}
@@ -0,0 +1,61 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Consumer of the ADC blocks streamed by ADC_RTApp_MT3620_BareMetal built with
+// ADC_SOCKET, which uses the same message format.
+//
+// Every block is checked against the sequence numbers seen so far, so blocks the
+// RTApp dropped because the ring was full are counted, and the mean of each of its
+// channels is kept for the next report. Sending INTERCORE_ADC_TIMING_CMD asks the
+// RTApp for its callback timing, which is logged when the reply arrives.
+
+/// <summary>Command which asks the RTApp for its callback timing.</summary>
+#define INTERCORE_ADC_TIMING_CMD "timing"
+
+typedef enum {
+    IntercoreAdcMsg_Block = 0,
+    IntercoreAdcMsg_Timing = 1
+} IntercoreAdcMsgType;
+
+/// <summary>
+/// Starts every message. A block is followed by frames samples of each channel in
+/// channelMask in turn, a timing reply by IntercoreAdcTiming.
+/// </summary>
+typedef struct __attribute__((__packed__)) {
+    uint32_t sequence;
+    uint8_t channelMask;
+    uint8_t type;
+    uint16_t frames;
+} IntercoreAdcHeader;
+
+/// <summary>Bins in the RTApp's callback interval histogram.</summary>
+#define INTERCORE_ADC_TIMING_BINS 16
+
+/// <summary>AdcTiming_Stats in the RTApp, in ticks of its 1 MHz clock.</summary>
+typedef struct __attribute__((__packed__)) {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t missed;
+    uint64_t total;
+    uint32_t expected;
+    uint32_t binWidth;
+    uint32_t histogram[INTERCORE_ADC_TIMING_BINS];
+} IntercoreAdcTiming;
+
+/// <summary>
+/// Handle one message received from the ADC RTApp.
+/// </summary>
+/// <returns>0 on success, -1 if the message is malformed, in which case it's counted
+/// and otherwise ignored.</returns>
+int HandleIntercoreAdcMessage(const void *data, size_t size);
+
+/// <summary>
+/// Log the blocks received and dropped since the last report, and the latest mean of
+/// each channel, then start counting again.
+/// </summary>
+void LogIntercoreAdcStats(void);
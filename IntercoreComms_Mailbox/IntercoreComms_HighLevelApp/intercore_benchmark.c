@@ -0,0 +1,382 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <sys/socket.h>
+
+#include <applibs/log.h>
+
+#include "intercore_benchmark.h"
+
+// Largest message the RTApp accepts, SOCKET_MAX_PAYLOAD_LEN in Socket.h.
+#define MAX_PAYLOAD_LEN 1040
+
+// Messages measured for each size and window.
+#define ITERATIONS 256
+
+static const size_t sizes[] = {16, 32, 64, 128, 256, 512, 1024, MAX_PAYLOAD_LEN};
+#define SIZE_COUNT (sizeof(sizes) / sizeof(sizes[0]))
+
+// Messages in flight during the echo phase, 1 is ping-pong.
+static const uint32_t windows[] = {1, 4, 16};
+#define WINDOW_COUNT (sizeof(windows) / sizeof(windows[0]))
+
+typedef enum {
+    Phase_Idle,
+    Phase_Echo,
+    Phase_Stream,
+    Phase_StreamWait
+} Phase;
+
+struct IntercoreBenchmark {
+    EventLoop *eventLoop;
+    EventRegistration *reg;
+    int fd;
+    // A send would have blocked, so wait for the socket to become writable.
+    bool blocked;
+    bool outputRegistered;
+
+    // Responder state, a reply which didn't fit in the ring is held in
+    // replyBuffer and nothing more is read until it has been sent.
+    bool replyPending;
+    size_t replySize;
+    uint32_t streamMsgs;
+    uint32_t streamBytes;
+
+    // Initiator state
+    Phase phase;
+    unsigned sizeIndex;
+    unsigned windowIndex;
+    uint32_t sent;
+    uint32_t received;
+    uint32_t start;
+    uint32_t latency[ITERATIONS];
+
+    uint8_t rxBuffer[MAX_PAYLOAD_LEN];
+    uint8_t txBuffer[MAX_PAYLOAD_LEN];
+    uint8_t replyBuffer[MAX_PAYLOAD_LEN];
+};
+
+/// <summary>
+///     Microsecond clock, wrapping at 32 bits like the RTApp's GPT.
+/// </summary>
+static uint32_t Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000);
+}
+
+/// <summary>
+///     Send one message without blocking.
+/// </summary>
+/// <returns>true if the message was sent.</returns>
+static bool SendRaw(IntercoreBenchmark *bench, const void *data, size_t size)
+{
+    if (send(bench->fd, data, size, MSG_DONTWAIT) != -1) {
+        return true;
+    }
+
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+        bench->blocked = true;
+    } else {
+        Log_Debug("ERROR: Benchmark send failed: %d (%s)\n", errno, strerror(errno));
+    }
+    return false;
+}
+
+static bool Send(IntercoreBenchmark *bench, uint16_t type, uint32_t seq, size_t size)
+{
+    IntercoreBenchmarkHeader *header = (IntercoreBenchmarkHeader *)bench->txBuffer;
+    header->magic = INTERCORE_BENCHMARK_MAGIC;
+    header->type = type;
+    header->reserved = 0;
+    header->seq = seq;
+    header->timestamp = Now();
+
+    return SendRaw(bench, bench->txBuffer, size);
+}
+
+/// <summary>
+///     Queue a message to the RTApp's initiator, sent as soon as there is space.
+/// </summary>
+static void Reply(IntercoreBenchmark *bench, const void *data, size_t size)
+{
+    memcpy(bench->replyBuffer, data, size);
+    bench->replySize = size;
+    bench->replyPending = true;
+}
+
+static void StartPoint(IntercoreBenchmark *bench)
+{
+    bench->sent = 0;
+    bench->received = 0;
+    bench->start = Now();
+}
+
+static int CompareLatency(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void ReportEcho(IntercoreBenchmark *bench, uint32_t elapsed)
+{
+    qsort(bench->latency, ITERATIONS, sizeof(bench->latency[0]), CompareLatency);
+
+    uint32_t rate = (uint32_t)(((uint64_t)ITERATIONS * 1000000) / (elapsed ? elapsed : 1));
+
+    Log_Debug("BENCH echo size=%zu window=%u min=%uus p50=%uus p99=%uus rate=%u/s\n",
+              sizes[bench->sizeIndex], windows[bench->windowIndex], bench->latency[0],
+              bench->latency[ITERATIONS / 2], bench->latency[(ITERATIONS * 99) / 100], rate);
+}
+
+static void ReportStream(IntercoreBenchmark *bench, uint32_t elapsed,
+                         const IntercoreBenchmarkStreamAck *ack)
+{
+    uint32_t throughput = (uint32_t)(((uint64_t)ack->bytes * 1000000) / (elapsed ? elapsed : 1));
+
+    Log_Debug("BENCH stream size=%zu msgs=%u/%u time=%uus throughput=%uB/s\n",
+              sizes[bench->sizeIndex], ack->msgs, ITERATIONS, elapsed, throughput);
+}
+
+/// <summary>
+///     Send as much as the current phase and the socket allow.
+/// </summary>
+static void Pump(IntercoreBenchmark *bench)
+{
+    size_t size = sizes[bench->sizeIndex];
+
+    switch (bench->phase) {
+    case Phase_Echo:
+        while (bench->sent < ITERATIONS &&
+               (bench->sent - bench->received) < windows[bench->windowIndex]) {
+            if (!Send(bench, IntercoreBenchmarkMsg_EchoReq, bench->sent, size)) {
+                break;
+            }
+            bench->sent++;
+        }
+        break;
+
+    case Phase_Stream:
+        while (bench->sent < ITERATIONS) {
+            if (!Send(bench, IntercoreBenchmarkMsg_Stream, bench->sent, size)) {
+                return;
+            }
+            bench->sent++;
+        }
+        if (Send(bench, IntercoreBenchmarkMsg_StreamEnd, bench->sent,
+                 sizeof(IntercoreBenchmarkHeader))) {
+            bench->phase = Phase_StreamWait;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void HandleEchoRsp(IntercoreBenchmark *bench, const IntercoreBenchmarkHeader *header)
+{
+    if (bench->phase != Phase_Echo || header->seq >= bench->sent) {
+        return;
+    }
+
+    bench->latency[bench->received++] = Now() - header->timestamp;
+    if (bench->received < ITERATIONS) {
+        return;
+    }
+
+    ReportEcho(bench, Now() - bench->start);
+
+    bench->windowIndex++;
+    if (bench->windowIndex >= WINDOW_COUNT) {
+        bench->windowIndex = 0;
+        bench->phase = Phase_Stream;
+    }
+    StartPoint(bench);
+}
+
+static void HandleStreamAck(IntercoreBenchmark *bench, const IntercoreBenchmarkStreamAck *ack)
+{
+    if (bench->phase != Phase_StreamWait) {
+        return;
+    }
+
+    ReportStream(bench, Now() - bench->start, ack);
+
+    bench->sizeIndex++;
+    if (bench->sizeIndex >= SIZE_COUNT) {
+        bench->sizeIndex = 0;
+        bench->phase = Phase_Idle;
+        Log_Debug("BENCH HLApp sweep complete, starting RTApp sweep\n");
+
+        IntercoreBenchmarkHeader start = {.magic = INTERCORE_BENCHMARK_MAGIC,
+                                          .type = IntercoreBenchmarkMsg_Start,
+                                          .timestamp = Now()};
+        Reply(bench, &start, sizeof(start));
+        return;
+    }
+
+    bench->phase = Phase_Echo;
+    StartPoint(bench);
+}
+
+static void HandleMessage(IntercoreBenchmark *bench, size_t size)
+{
+    if (size < sizeof(IntercoreBenchmarkHeader)) {
+        return;
+    }
+
+    IntercoreBenchmarkHeader header;
+    memcpy(&header, bench->rxBuffer, sizeof(header));
+    if (header.magic != INTERCORE_BENCHMARK_MAGIC) {
+        return;
+    }
+
+    switch (header.type) {
+    // Responder
+    case IntercoreBenchmarkMsg_EchoReq:
+        ((IntercoreBenchmarkHeader *)bench->rxBuffer)->type = IntercoreBenchmarkMsg_EchoRsp;
+        Reply(bench, bench->rxBuffer, size);
+        break;
+
+    case IntercoreBenchmarkMsg_Stream:
+        bench->streamMsgs++;
+        bench->streamBytes += (uint32_t)size;
+        break;
+
+    case IntercoreBenchmarkMsg_StreamEnd: {
+        struct __attribute__((__packed__)) {
+            IntercoreBenchmarkHeader header;
+            IntercoreBenchmarkStreamAck ack;
+        } reply = {.header = header,
+                   .ack = {.msgs = bench->streamMsgs, .bytes = bench->streamBytes}};
+        reply.header.type = IntercoreBenchmarkMsg_StreamAck;
+        Reply(bench, &reply, sizeof(reply));
+
+        bench->streamMsgs = 0;
+        bench->streamBytes = 0;
+    } break;
+
+    case IntercoreBenchmarkMsg_Done:
+        Log_Debug("BENCH RTApp sweep complete\n");
+        break;
+
+    // Initiator
+    case IntercoreBenchmarkMsg_EchoRsp:
+        HandleEchoRsp(bench, &header);
+        break;
+
+    case IntercoreBenchmarkMsg_StreamAck:
+        if (size >= sizeof(IntercoreBenchmarkHeader) + sizeof(IntercoreBenchmarkStreamAck)) {
+            IntercoreBenchmarkStreamAck ack;
+            memcpy(&ack, &bench->rxBuffer[sizeof(IntercoreBenchmarkHeader)], sizeof(ack));
+            HandleStreamAck(bench, &ack);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/// <summary>
+///     Only ask for output events while a send is blocked, otherwise the event loop would
+///     spin on a writable socket.
+/// </summary>
+static void UpdateEvents(IntercoreBenchmark *bench)
+{
+    if (bench->blocked == bench->outputRegistered) {
+        return;
+    }
+
+    EventLoop_IoEvents events = EventLoop_Input | (bench->blocked ? EventLoop_Output : 0);
+    if (EventLoop_ModifyIoEvents(bench->eventLoop, bench->reg, events) == -1) {
+        Log_Debug("ERROR: Unable to modify socket events: %d (%s)\n", errno, strerror(errno));
+        return;
+    }
+    bench->outputRegistered = bench->blocked;
+}
+
+static void Service(IntercoreBenchmark *bench)
+{
+    bench->blocked = false;
+
+    for (;;) {
+        if (bench->replyPending) {
+            if (!SendRaw(bench, bench->replyBuffer, bench->replySize)) {
+                break;
+            }
+            bench->replyPending = false;
+        }
+
+        ssize_t bytesReceived = recv(bench->fd, bench->rxBuffer, sizeof(bench->rxBuffer),
+                                     MSG_DONTWAIT);
+        if (bytesReceived <= 0) {
+            if (bytesReceived == -1 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                Log_Debug("ERROR: Benchmark receive failed: %d (%s)\n", errno, strerror(errno));
+            }
+            break;
+        }
+
+        HandleMessage(bench, (size_t)bytesReceived);
+    }
+
+    // Replies take priority, so only start new requests once the reply is out.
+    if (!bench->replyPending) {
+        Pump(bench);
+    }
+
+    UpdateEvents(bench);
+}
+
+static void SocketEventHandler(EventLoop *el, int fd, EventLoop_IoEvents events, void *context)
+{
+    Service((IntercoreBenchmark *)context);
+}
+
+IntercoreBenchmark *CreateIntercoreBenchmark(EventLoop *eventLoop, int fd)
+{
+    if (eventLoop == NULL || fd < 0) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    IntercoreBenchmark *bench = calloc(1, sizeof(IntercoreBenchmark));
+    if (bench == NULL) {
+        return NULL;
+    }
+
+    bench->eventLoop = eventLoop;
+    bench->fd = fd;
+
+    bench->reg = EventLoop_RegisterIo(eventLoop, fd, EventLoop_Input, SocketEventHandler, bench);
+    if (bench->reg == NULL) {
+        free(bench);
+        return NULL;
+    }
+
+    Log_Debug("BENCH starting HLApp sweep\n");
+    bench->phase = Phase_Echo;
+    StartPoint(bench);
+    Service(bench);
+
+    return bench;
+}
+
+void DisposeIntercoreBenchmark(IntercoreBenchmark *bench)
+{
+    if (bench == NULL) {
+        return;
+    }
+
+    EventLoop_UnregisterIo(bench->eventLoop, bench->reg);
+    free(bench);
+}
@@ -0,0 +1,70 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#pragma once
+#include <stdint.h>
+
+#include <applibs/eventloop.h>
+
+// Intercore socket throughput/latency benchmark, the partner of Benchmark.c in
+// IntercoreComms_RTApp_MT3620_BareMetal, which uses the same message format.
+//
+// This side runs its sweep first while the RTApp echoes, then hands over and the
+// roles swap. For each payload size from 16 bytes up to the maximum message size the
+// initiator measures round trips with 1, 4 and 16 messages in flight, followed by
+// one-way streaming throughput. Results are written with Log_Debug.
+
+/// <summary>Identifies benchmark messages.</summary>
+#define INTERCORE_BENCHMARK_MAGIC 0x48434e42
+
+typedef enum {
+    IntercoreBenchmarkMsg_EchoReq = 1,
+    IntercoreBenchmarkMsg_EchoRsp = 2,
+    IntercoreBenchmarkMsg_Stream = 3,
+    IntercoreBenchmarkMsg_StreamEnd = 4,
+    IntercoreBenchmarkMsg_StreamAck = 5,
+    IntercoreBenchmarkMsg_Start = 6,
+    IntercoreBenchmarkMsg_Done = 7
+} IntercoreBenchmarkMsgType;
+
+/// <summary>
+/// Starts every benchmark message, which is why the smallest is 16 bytes.
+/// </summary>
+typedef struct __attribute__((__packed__)) {
+    uint32_t magic;
+    uint16_t type;
+    uint16_t reserved;
+    uint32_t seq;
+    /// <summary>Initiator clock in microseconds when the message was sent.</summary>
+    uint32_t timestamp;
+} IntercoreBenchmarkHeader;
+
+/// <summary>Payload of IntercoreBenchmarkMsg_StreamAck following the header.</summary>
+typedef struct __attribute__((__packed__)) {
+    uint32_t msgs;
+    uint32_t bytes;
+} IntercoreBenchmarkStreamAck;
+
+/// <summary>
+/// Opaque handle. Obtain via <see cref="CreateIntercoreBenchmark" /> and dispose of via
+/// <see cref="DisposeIntercoreBenchmark" />.
+/// </summary>
+typedef struct IntercoreBenchmark IntercoreBenchmark;
+
+/// <summary>
+/// Register the benchmark on the event loop and start the sweep. The benchmark takes
+/// over all events on the socket, so the caller must not register its own handler.
+/// </summary>
+/// <param name="eventLoop">Event loop which services the socket.</param>
+/// <param name="fd">Socket returned by Application_Connect.</param>
+/// <returns>On success, pointer to new IntercoreBenchmark, which should be disposed of
+/// with <see cref="DisposeIntercoreBenchmark" />. On failure, returns NULL, with more
+/// information available in errno.</returns>
+IntercoreBenchmark *CreateIntercoreBenchmark(EventLoop *eventLoop, int fd);
+
+/// <summary>
+/// Unregister and free a benchmark. The socket is not closed.
+/// It is safe to call this function with a NULL pointer.
+/// </summary>
+/// <param name="bench">Successfully allocated benchmark, or NULL.</param>
+void DisposeIntercoreBenchmark(IntercoreBenchmark *bench);
@@ -0,0 +1,68 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <applibs/log.h>
+
+#include "intercore_imu.h"
+
+static bool sequenceValid = false;
+static uint16_t sequenceNext = 0;
+
+static uint32_t received = 0;
+static uint32_t dropped = 0;
+static uint32_t malformed = 0;
+
+static bool latestValid = false;
+static int16_t latest[4];
+static uint16_t decimation = 0;
+
+int HandleIntercoreImuMessage(const void *data, size_t size)
+{
+    IntercoreImuHeader header;
+    if (size < sizeof(header)) {
+        malformed++;
+        return -1;
+    }
+    memcpy(&header, data, sizeof(header));
+
+    size_t quatSize = (4 * sizeof(int16_t));
+    if ((header.count == 0) || ((size - sizeof(header)) != (header.count * quatSize))) {
+        malformed++;
+        return -1;
+    }
+
+    // Sequence numbers are 16 bits, so a gap is only counted modulo that, which at
+    // the rates the RTApp sends at is several minutes of orientations.
+    if (sequenceValid) {
+        dropped += (uint16_t)(header.sequence - sequenceNext);
+    }
+    sequenceNext = (uint16_t)(header.sequence + header.count);
+    sequenceValid = true;
+    received += header.count;
+
+    // The quaternions aren't aligned in the message, so the last is copied out.
+    const uint8_t *quats = (const uint8_t *)data + sizeof(header);
+    memcpy(latest, &quats[(header.count - 1) * quatSize], quatSize);
+    latestValid = true;
+    decimation = header.decimation;
+    return 0;
+}
+
+void LogIntercoreImuStats(void)
+{
+    Log_Debug("IMU orientations: %u received, %u dropped, %u malformed\n", received, dropped,
+              malformed);
+    received = 0;
+    dropped = 0;
+    malformed = 0;
+
+    if (latestValid) {
+        Log_Debug("IMU orientation: w=%.4f x=%.4f y=%.4f z=%.4f, every %u samples\n",
+                  (float)latest[0] / INTERCORE_IMU_QUAT_ONE, (float)latest[1] / INTERCORE_IMU_QUAT_ONE,
+                  (float)latest[2] / INTERCORE_IMU_QUAT_ONE, (float)latest[3] / INTERCORE_IMU_QUAT_ONE,
+                  decimation);
+    }
+}
@@ -0,0 +1,39 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Consumer of the orientations streamed by I2C_RTApp_MT3620_BareMetal built with
+// IMU_SOCKET, which uses the same message format.
+//
+// Every message is checked against the sequence numbers seen so far, so
+// orientations the RTApp dropped because the ring was full are counted, and the
+// latest orientation is kept for the next report.
+
+/// <summary>
+/// Starts every message, followed by count quaternions. sequence is that of the
+/// first, and decimation the IMU samples between each.
+/// </summary>
+typedef struct __attribute__((__packed__)) {
+    uint16_t sequence;
+    uint8_t count;
+    uint16_t decimation;
+} IntercoreImuHeader;
+
+/// <summary>Each quaternion is w, x, y, z in Q14, so 16384 is 1.</summary>
+#define INTERCORE_IMU_QUAT_ONE 16384
+
+/// <summary>
+/// Handle one message received from the IMU RTApp.
+/// </summary>
+/// <returns>0 on success, -1 if the message is malformed, in which case it's counted
+/// and otherwise ignored.</returns>
+int HandleIntercoreImuMessage(const void *data, size_t size);
+
+/// <summary>
+/// Log the orientations received and dropped since the last report, and the latest
+/// one, then start counting again.
+/// </summary>
+void LogIntercoreImuStats(void);
@@ -0,0 +1,379 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include <applibs/log.h>
+
+#include "intercore_pipe.h"
+
+struct IntercorePipe {
+    EventLoop *eventLoop;
+    EventRegistration *reg;
+    int fd;
+    IntercorePipeRxHandler rxHandler;
+    IntercorePipeReadyHandler readyHandler;
+    IntercorePipeErrorHandler errorHandler;
+    void *context;
+    IntercorePipeConfig config;
+
+    // Send pool. txFree is a stack of the free buffers, and txQueue a ring of those
+    // waiting to be written, oldest at txHead. txSize is the message size of each.
+    uint8_t *txPool;
+    size_t *txFree;
+    size_t txFreeCount;
+    size_t *txQueue;
+    size_t txHead;
+    size_t txCount;
+    size_t *txSize;
+    uint64_t txQueued;
+
+    // A send would have blocked, so wait for the socket to become writable. While the
+    // ready handler is producing, carry on once the socket is writable too.
+    bool blocked;
+    bool producing;
+    bool outputRegistered;
+
+    // Reused for every batch received.
+    uint8_t *rxPool;
+    IntercorePipeMessage *rxMessages;
+
+    IntercorePipeStats stats;
+};
+
+static uint8_t *TxBuffer(IntercorePipe *pipe, size_t index)
+{
+    return &pipe->txPool[index * INTERCORE_PIPE_MAX_MESSAGE_LEN];
+}
+
+static bool IsWouldBlock(int error)
+{
+    // The intercore socket reports a full ring as ENOBUFS.
+    return error == EAGAIN || error == EWOULDBLOCK || error == ENOBUFS;
+}
+
+/// <summary>
+///     Return the buffer at the head of the queue to the pool.
+/// </summary>
+static void Dequeue(IntercorePipe *pipe)
+{
+    size_t index = pipe->txQueue[pipe->txHead];
+    pipe->txHead = (pipe->txHead + 1) % pipe->config.txBuffers;
+    pipe->txCount--;
+    pipe->txFree[pipe->txFreeCount++] = index;
+}
+
+/// <summary>
+///     Write queued messages until the queue is empty or the socket would block. A
+///     message which fails to send is dropped, so it can't hold up the rest of the queue,
+///     and the rest are left for the next write.
+/// </summary>
+static int Write(IntercorePipe *pipe)
+{
+    pipe->blocked = false;
+
+    while (pipe->txCount > 0) {
+        size_t index = pipe->txQueue[pipe->txHead];
+        size_t size = pipe->txSize[index];
+
+        if (send(pipe->fd, TxBuffer(pipe, index), size, MSG_DONTWAIT) == -1) {
+            if (IsWouldBlock(errno)) {
+                pipe->blocked = true;
+                pipe->stats.txBlocked++;
+                return 0;
+            }
+            pipe->stats.txDropped++;
+            Dequeue(pipe);
+            return -1;
+        }
+
+        pipe->stats.txMessages++;
+        pipe->stats.txBytes += size;
+        Dequeue(pipe);
+    }
+
+    return 0;
+}
+
+/// <summary>
+///     Read every message waiting, a batch at a time, until the socket would block.
+/// </summary>
+static int Receive(IntercorePipe *pipe)
+{
+    for (;;) {
+        size_t count = 0;
+        bool drained = false;
+        int error = 0;
+
+        while (count < pipe->config.rxBatch) {
+            uint8_t *buffer = &pipe->rxPool[count * INTERCORE_PIPE_MAX_MESSAGE_LEN];
+            ssize_t bytesReceived =
+                recv(pipe->fd, buffer, INTERCORE_PIPE_MAX_MESSAGE_LEN, MSG_DONTWAIT);
+            if (bytesReceived <= 0) {
+                if (bytesReceived == -1 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                    error = errno;
+                }
+                drained = true;
+                break;
+            }
+
+            pipe->rxMessages[count].data = buffer;
+            pipe->rxMessages[count].size = (size_t)bytesReceived;
+            pipe->stats.rxBytes += (size_t)bytesReceived;
+            count++;
+        }
+
+        // Whatever was read before an error is still handled.
+        if (count > 0) {
+            pipe->stats.rxMessages += count;
+            pipe->stats.rxBatches++;
+            pipe->rxHandler(pipe->rxMessages, count, pipe->context);
+        }
+
+        if (error != 0) {
+            errno = error;
+            return -1;
+        }
+        if (drained) {
+            return 0;
+        }
+    }
+}
+
+/// <summary>
+///     Only ask for output events while a send is blocked or a producer is waiting for
+///     buffers, otherwise the event loop would spin on a writable socket.
+/// </summary>
+static void UpdateEvents(IntercorePipe *pipe)
+{
+    bool output = pipe->blocked || pipe->producing;
+    if (output == pipe->outputRegistered) {
+        return;
+    }
+
+    EventLoop_IoEvents events = EventLoop_Input | (output ? EventLoop_Output : 0);
+    if (EventLoop_ModifyIoEvents(pipe->eventLoop, pipe->reg, events) == -1) {
+        Log_Debug("ERROR: Unable to modify socket events: %d (%s)\n", errno, strerror(errno));
+        return;
+    }
+    pipe->outputRegistered = output;
+}
+
+/// <summary>
+///     Pass a failure servicing the socket on to the application.
+/// </summary>
+static void Error(IntercorePipe *pipe, bool send)
+{
+    int error = errno;
+    Log_Debug("ERROR: Pipe %s failed: %d (%s)\n", send ? "send" : "receive", error,
+              strerror(error));
+    if (pipe->errorHandler != NULL) {
+        pipe->errorHandler(pipe, send, error, pipe->context);
+    }
+}
+
+static void Service(IntercorePipe *pipe)
+{
+    if (Receive(pipe) == -1) {
+        Error(pipe, false);
+    }
+
+    if (Write(pipe) == -1) {
+        Error(pipe, true);
+    }
+
+    // Offer the producer whatever the RTApp has made room for. Only a producer which
+    // used its turn is given another once the socket is writable again, so an idle one
+    // doesn't keep the event loop awake.
+    pipe->producing = false;
+    if (pipe->readyHandler != NULL && !pipe->blocked && pipe->txFreeCount > 0) {
+        uint64_t txQueued = pipe->txQueued;
+        pipe->readyHandler(pipe, pipe->context);
+        pipe->producing = (pipe->txQueued != txQueued);
+
+        if (Write(pipe) == -1) {
+            Error(pipe, true);
+        }
+    }
+
+    UpdateEvents(pipe);
+}
+
+static void SocketEventHandler(EventLoop *el, int fd, EventLoop_IoEvents events, void *context)
+{
+    Service((IntercorePipe *)context);
+}
+
+IntercorePipe *CreateIntercorePipe(EventLoop *eventLoop, int fd, const IntercorePipeConfig *config,
+                                   IntercorePipeRxHandler rxHandler,
+                                   IntercorePipeReadyHandler readyHandler,
+                                   IntercorePipeErrorHandler errorHandler, void *context)
+{
+    if (eventLoop == NULL || fd < 0 || config == NULL || config->txBuffers == 0 ||
+        config->txBatch == 0 || config->txBatch > config->txBuffers || config->rxBatch == 0 ||
+        rxHandler == NULL) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    IntercorePipe *pipe = calloc(1, sizeof(IntercorePipe));
+    if (pipe == NULL) {
+        return NULL;
+    }
+
+    pipe->eventLoop = eventLoop;
+    pipe->fd = fd;
+    pipe->rxHandler = rxHandler;
+    pipe->readyHandler = readyHandler;
+    pipe->errorHandler = errorHandler;
+    pipe->context = context;
+    pipe->config = *config;
+
+    pipe->txPool = malloc(config->txBuffers * INTERCORE_PIPE_MAX_MESSAGE_LEN);
+    pipe->txFree = calloc(config->txBuffers, sizeof(size_t));
+    pipe->txQueue = calloc(config->txBuffers, sizeof(size_t));
+    pipe->txSize = calloc(config->txBuffers, sizeof(size_t));
+    pipe->rxPool = malloc(config->rxBatch * INTERCORE_PIPE_MAX_MESSAGE_LEN);
+    pipe->rxMessages = calloc(config->rxBatch, sizeof(IntercorePipeMessage));
+    if (pipe->txPool == NULL || pipe->txFree == NULL || pipe->txQueue == NULL ||
+        pipe->txSize == NULL || pipe->rxPool == NULL || pipe->rxMessages == NULL) {
+        DisposeIntercorePipe(pipe);
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    // Free buffers are taken from the end, so the first to be used is buffer 0.
+    for (size_t i = 0; i < config->txBuffers; i++) {
+        pipe->txFree[i] = config->txBuffers - 1 - i;
+    }
+    pipe->txFreeCount = config->txBuffers;
+
+    pipe->reg = EventLoop_RegisterIo(eventLoop, fd, EventLoop_Input, SocketEventHandler, pipe);
+    if (pipe->reg == NULL) {
+        int error = errno;
+        DisposeIntercorePipe(pipe);
+        errno = error;
+        return NULL;
+    }
+
+    // Give a producer its first turn, and pick up anything already waiting.
+    Service(pipe);
+
+    return pipe;
+}
+
+void DisposeIntercorePipe(IntercorePipe *pipe)
+{
+    if (pipe == NULL) {
+        return;
+    }
+
+    if (pipe->reg != NULL) {
+        EventLoop_UnregisterIo(pipe->eventLoop, pipe->reg);
+    }
+    free(pipe->rxMessages);
+    free(pipe->rxPool);
+    free(pipe->txSize);
+    free(pipe->txQueue);
+    free(pipe->txFree);
+    free(pipe->txPool);
+    free(pipe);
+}
+
+void *AcquireIntercorePipeBuffer(IntercorePipe *pipe)
+{
+    if (pipe == NULL) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    if (pipe->txFreeCount == 0) {
+        errno = ENOBUFS;
+        return NULL;
+    }
+
+    return TxBuffer(pipe, pipe->txFree[--pipe->txFreeCount]);
+}
+
+int SendIntercorePipeBuffer(IntercorePipe *pipe, void *buffer, size_t size)
+{
+    if (pipe == NULL || buffer == NULL || size == 0 || size > INTERCORE_PIPE_MAX_MESSAGE_LEN) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    size_t offset = (size_t)((uint8_t *)buffer - pipe->txPool);
+    if ((uint8_t *)buffer < pipe->txPool || offset % INTERCORE_PIPE_MAX_MESSAGE_LEN != 0 ||
+        offset / INTERCORE_PIPE_MAX_MESSAGE_LEN >= pipe->config.txBuffers) {
+        errno = EINVAL;
+        return -1;
+    }
+    size_t index = offset / INTERCORE_PIPE_MAX_MESSAGE_LEN;
+
+    pipe->txSize[index] = size;
+    pipe->txQueue[(pipe->txHead + pipe->txCount) % pipe->config.txBuffers] = index;
+    pipe->txCount++;
+    pipe->txQueued++;
+
+    // Held back until a batch is queued, unless the socket is already blocked, in
+    // which case it goes when the socket is writable.
+    if (pipe->txCount < pipe->config.txBatch || pipe->blocked) {
+        return 0;
+    }
+
+    int result = Write(pipe);
+    UpdateEvents(pipe);
+    return result;
+}
+
+int SendIntercorePipeMessage(IntercorePipe *pipe, const void *data, size_t size)
+{
+    if (data == NULL || size == 0 || size > INTERCORE_PIPE_MAX_MESSAGE_LEN) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    void *buffer = AcquireIntercorePipeBuffer(pipe);
+    if (buffer == NULL) {
+        return -1;
+    }
+
+    memcpy(buffer, data, size);
+    return SendIntercorePipeBuffer(pipe, buffer, size);
+}
+
+int FlushIntercorePipe(IntercorePipe *pipe)
+{
+    if (pipe == NULL) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    int result = Write(pipe);
+    UpdateEvents(pipe);
+    return result;
+}
+
+size_t GetIntercorePipeFreeBuffers(const IntercorePipe *pipe)
+{
+    return pipe == NULL ? 0 : pipe->txFreeCount;
+}
+
+void GetIntercorePipeStats(IntercorePipe *pipe, IntercorePipeStats *stats, bool reset)
+{
+    if (pipe == NULL) {
+        return;
+    }
+
+    if (stats != NULL) {
+        *stats = pipe->stats;
+    }
+    if (reset) {
+        memset(&pipe->stats, 0, sizeof(pipe->stats));
+    }
+}
@@ -0,0 +1,150 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <applibs/eventloop.h>
+
+// Moves messages over an intercore socket as fast as the shared buffer allows.
+//
+// Whenever the socket is readable, every message waiting is read without blocking
+// until the socket would block, and handed to the application a batch at a time
+// rather than one event per message. The receive buffers are allocated once and
+// reused for every batch.
+//
+// Outgoing messages are built in buffers taken from a pool, and queued. The queue is
+// written back to back until the socket would block, which is the RTApp's
+// back-pressure: the pipe then waits for the socket to become writable, and carries on
+// from where it stopped. Each time buffers are returned to the pool the application's
+// ready handler is called to fill them, so a producer sends at whatever rate the RTApp
+// drains the ring instead of on a timer. Messages can be held back until a batch of
+// them is queued, so they're written together.
+
+/// <summary>
+/// Largest message on the intercore socket, SOCKET_MAX_PAYLOAD_LEN in the RTApp.
+/// </summary>
+#define INTERCORE_PIPE_MAX_MESSAGE_LEN 1040
+
+/// <summary>
+/// Opaque handle. Obtain via <see cref="CreateIntercorePipe" /> and dispose of via
+/// <see cref="DisposeIntercorePipe" />.
+/// </summary>
+typedef struct IntercorePipe IntercorePipe;
+
+/// <summary>A message received, valid only for the duration of the handler.</summary>
+typedef struct {
+    const void *data;
+    size_t size;
+} IntercorePipeMessage;
+
+/// <summary>
+/// Applications implement a function with this signature to handle each batch of
+/// messages received.
+/// </summary>
+/// <param name="messages">Messages in the order received.</param>
+/// <param name="count">Number of messages, at least 1.</param>
+/// <param name="context">Context passed to <see cref="CreateIntercorePipe" />.</param>
+typedef void (*IntercorePipeRxHandler)(const IntercorePipeMessage *messages, size_t count,
+                                       void *context);
+
+/// <summary>
+/// Applications implement a function with this signature to be told there are free
+/// buffers to send from, such as to keep a stream of messages going.
+/// </summary>
+typedef void (*IntercorePipeReadyHandler)(IntercorePipe *pipe, void *context);
+
+/// <summary>
+/// Applications implement a function with this signature to be told a receive or send
+/// made while servicing the socket failed.
+/// </summary>
+/// <param name="send">True if a send failed, in which case the message at the head of
+/// the queue was dropped, false if a receive failed.</param>
+/// <param name="error">The errno of the failure.</param>
+typedef void (*IntercorePipeErrorHandler)(IntercorePipe *pipe, bool send, int error,
+                                          void *context);
+
+typedef struct {
+    uint64_t rxMessages;
+    uint64_t rxBytes;
+    /// <summary>Batches handed to the receive handler.</summary>
+    uint64_t rxBatches;
+    uint64_t txMessages;
+    uint64_t txBytes;
+    /// <summary>Times sending stopped until the socket was writable again.</summary>
+    uint64_t txBlocked;
+    /// <summary>Messages dropped because sending them failed.</summary>
+    uint64_t txDropped;
+} IntercorePipeStats;
+
+typedef struct {
+    /// <summary>Buffers in the send pool, the most messages queued at once.</summary>
+    size_t txBuffers;
+    /// <summary>Messages queued before they're written, 1 to write each at once.</summary>
+    size_t txBatch;
+    /// <summary>Most messages handed to the receive handler at once.</summary>
+    size_t rxBatch;
+} IntercorePipeConfig;
+
+/// <summary>
+/// Register the pipe on the event loop. The pipe takes over all events on the socket,
+/// so the caller must not register its own handler.
+/// </summary>
+/// <param name="eventLoop">Event loop which services the socket.</param>
+/// <param name="fd">Socket returned by Application_Connect, which isn't closed on dispose.</param>
+/// <param name="config">Sizes of the pool and batches.</param>
+/// <param name="rxHandler">Callback invoked for every batch of messages received.</param>
+/// <param name="readyHandler">Callback invoked when buffers are free to send from, or
+/// NULL.</param>
+/// <param name="errorHandler">Callback invoked when servicing the socket fails, or
+/// NULL.</param>
+/// <param name="context">Passed to the callbacks.</param>
+/// <returns>On success, pointer to new IntercorePipe, which should be disposed of
+/// with <see cref="DisposeIntercorePipe" />. On failure, returns NULL, with more
+/// information available in errno.</returns>
+IntercorePipe *CreateIntercorePipe(EventLoop *eventLoop, int fd, const IntercorePipeConfig *config,
+                                   IntercorePipeRxHandler rxHandler,
+                                   IntercorePipeReadyHandler readyHandler,
+                                   IntercorePipeErrorHandler errorHandler, void *context);
+
+/// <summary>
+/// Unregister and free a pipe, dropping anything still queued.
+/// It is safe to call this function with a NULL pointer.
+/// </summary>
+void DisposeIntercorePipe(IntercorePipe *pipe);
+
+/// <summary>
+/// Take a buffer of INTERCORE_PIPE_MAX_MESSAGE_LEN bytes from the send pool to build a
+/// message in, which must then be passed to <see cref="SendIntercorePipeBuffer" />.
+/// </summary>
+/// <returns>The buffer, or NULL with errno set to ENOBUFS if the pool is empty.</returns>
+void *AcquireIntercorePipeBuffer(IntercorePipe *pipe);
+
+/// <summary>
+/// Queue size bytes of a buffer from <see cref="AcquireIntercorePipeBuffer" /> to be sent.
+/// The buffer returns to the pool once it has been written, or dropped because writing
+/// it failed.
+/// </summary>
+/// <returns>0 on success, -1 on failure, in which case errno contains more information.</returns>
+int SendIntercorePipeBuffer(IntercorePipe *pipe, void *buffer, size_t size);
+
+/// <summary>
+/// Copy a message into a buffer from the pool, and queue it.
+/// </summary>
+/// <returns>0 on success, -1 on failure, in which case errno contains more information.
+/// errno is ENOBUFS if the pool is empty.</returns>
+int SendIntercorePipeMessage(IntercorePipe *pipe, const void *data, size_t size);
+
+/// <summary>
+/// Write as much of the queue as the socket accepts without blocking, even if less than
+/// a batch is queued.
+/// </summary>
+/// <returns>0 on success, -1 on failure, in which case errno contains more information.</returns>
+int FlushIntercorePipe(IntercorePipe *pipe);
+
+/// <summary>Buffers free in the send pool.</summary>
+size_t GetIntercorePipeFreeBuffers(const IntercorePipe *pipe);
+
+void GetIntercorePipeStats(IntercorePipe *pipe, IntercorePipeStats *stats, bool reset);
@@ -0,0 +1,255 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include "intercore_stream.h"
+
+#define FRAGMENT_LEN (INTERCORE_STREAM_MAX_PAYLOAD_LEN - sizeof(IntercoreStreamHeader))
+
+struct IntercoreStream {
+    int fd;
+    IntercoreStreamRxHandler handler;
+    void *context;
+
+    // Message currently being sent.
+    const uint8_t *txData;
+    size_t txSize;
+    size_t txOffset;
+    uint16_t txSeq;
+
+    // Message currently being reassembled. rxOffset is zero whenever rxActive is false.
+    uint8_t *rxBuffer;
+    size_t rxBufferSize;
+    size_t rxSize;
+    size_t rxOffset;
+    bool rxActive;
+    bool rxSeqValid;
+    uint16_t rxSeq;
+};
+
+IntercoreStream *CreateIntercoreStream(int fd, size_t maxMessageSize,
+                                       IntercoreStreamRxHandler handler, void *context)
+{
+    if (fd < 0 || maxMessageSize == 0 || handler == NULL) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    IntercoreStream *stream = calloc(1, sizeof(IntercoreStream));
+    if (stream == NULL) {
+        return NULL;
+    }
+
+    stream->rxBuffer = malloc(maxMessageSize);
+    if (stream->rxBuffer == NULL) {
+        free(stream);
+        return NULL;
+    }
+
+    stream->fd = fd;
+    stream->handler = handler;
+    stream->context = context;
+    stream->rxBufferSize = maxMessageSize;
+
+    return stream;
+}
+
+void DisposeIntercoreStream(IntercoreStream *stream)
+{
+    if (stream == NULL) {
+        return;
+    }
+
+    free(stream->rxBuffer);
+    free(stream);
+}
+
+int SendIntercoreStreamMessage(IntercoreStream *stream, const void *data, size_t size)
+{
+    if (stream == NULL || data == NULL || size == 0 || size > UINT32_MAX) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    if (stream->txData != NULL) {
+        errno = EBUSY;
+        return -1;
+    }
+
+    stream->txData = data;
+    stream->txSize = size;
+    stream->txOffset = 0;
+
+    return FlushIntercoreStream(stream);
+}
+
+int FlushIntercoreStream(IntercoreStream *stream)
+{
+    if (stream == NULL) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    while (stream->txOffset < stream->txSize) {
+        size_t len = stream->txSize - stream->txOffset;
+        if (len > FRAGMENT_LEN) {
+            len = FRAGMENT_LEN;
+        }
+
+        IntercoreStreamHeader header = {
+            .seq = stream->txSeq, .flags = 0, .size = (uint32_t)stream->txSize};
+        if (stream->txOffset == 0) {
+            header.flags |= INTERCORE_STREAM_FLAG_FIRST;
+        }
+        if (stream->txOffset + len == stream->txSize) {
+            header.flags |= INTERCORE_STREAM_FLAG_LAST;
+        }
+
+        // Gather the header and data so the fragment isn't staged in a separate buffer.
+        struct iovec iov[2] = {
+            {.iov_base = &header, .iov_len = sizeof(header)},
+            {.iov_base = (void *)&stream->txData[stream->txOffset], .iov_len = len}};
+        struct msghdr msg = {.msg_iov = iov, .msg_iovlen = 2};
+
+        if (sendmsg(stream->fd, &msg, MSG_DONTWAIT) == -1) {
+            // The ring is full, carry on when the socket is writable again.
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+                return 0;
+            }
+            return -1;
+        }
+
+        stream->txSeq++;
+        stream->txOffset += len;
+    }
+
+    stream->txData = NULL;
+    return 0;
+}
+
+bool IsIntercoreStreamSendPending(const IntercoreStream *stream)
+{
+    return stream != NULL && stream->txData != NULL;
+}
+
+// Handles a fragment whose data has already been received at rxBuffer[dataOffset].
+// Returns 0, or an errno value if a message had to be dropped.
+static int HandleFragment(IntercoreStream *stream, const IntercoreStreamHeader *header,
+                          size_t dataOffset, size_t bytesReceived, bool truncated)
+{
+    if (bytesReceived < sizeof(IntercoreStreamHeader)) {
+        stream->rxActive = false;
+        stream->rxOffset = 0;
+        return EPROTO;
+    }
+
+    int error = 0;
+
+    // A gap in the sequence means a fragment of the current message is lost.
+    if (stream->rxSeqValid && header->seq != stream->rxSeq) {
+        if (stream->rxActive) {
+            error = EPROTO;
+        }
+        stream->rxActive = false;
+        stream->rxOffset = 0;
+    }
+    stream->rxSeq = (uint16_t)(header->seq + 1);
+    stream->rxSeqValid = true;
+
+    size_t len = bytesReceived - sizeof(IntercoreStreamHeader);
+
+    if (header->flags & INTERCORE_STREAM_FLAG_FIRST) {
+        if (stream->rxActive) {
+            // Previous message never completed, its data is discarded.
+            error = EPROTO;
+        }
+        if (dataOffset != 0) {
+            memmove(stream->rxBuffer, &stream->rxBuffer[dataOffset], len);
+        }
+
+        stream->rxSize = header->size;
+        stream->rxOffset = 0;
+        stream->rxActive = (header->size <= stream->rxBufferSize);
+        if (!stream->rxActive) {
+            error = EMSGSIZE;
+        }
+    }
+
+    // Skip the remainder of any message we've already given up on.
+    if (!stream->rxActive) {
+        stream->rxOffset = 0;
+        return error;
+    }
+
+    if (truncated || header->size != stream->rxSize ||
+        len > stream->rxSize - stream->rxOffset) {
+        stream->rxActive = false;
+        stream->rxOffset = 0;
+        return EPROTO;
+    }
+
+    stream->rxOffset += len;
+
+    if (header->flags & INTERCORE_STREAM_FLAG_LAST) {
+        size_t size = stream->rxOffset;
+        stream->rxActive = false;
+        stream->rxOffset = 0;
+        if (size != stream->rxSize) {
+            return EPROTO;
+        }
+        stream->handler(stream->rxBuffer, size, stream->context);
+    }
+
+    return error;
+}
+
+int ReceiveIntercoreStreamMessages(IntercoreStream *stream)
+{
+    if (stream == NULL) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    int result = 0;
+
+    for (;;) {
+        // Scatter the fragment data straight to its place in the reassembly buffer.
+        IntercoreStreamHeader header;
+        size_t dataOffset = stream->rxOffset;
+        struct iovec iov[2] = {{.iov_base = &header, .iov_len = sizeof(header)},
+                               {.iov_base = &stream->rxBuffer[dataOffset],
+                                .iov_len = stream->rxBufferSize - dataOffset}};
+        struct msghdr msg = {.msg_iov = iov, .msg_iovlen = 2};
+
+        ssize_t bytesReceived = recvmsg(stream->fd, &msg, MSG_DONTWAIT);
+        if (bytesReceived == -1) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+            return -1;
+        }
+        if (bytesReceived == 0) {
+            break;
+        }
+
+        int error = HandleFragment(stream, &header, dataOffset, (size_t)bytesReceived,
+                                   (msg.msg_flags & MSG_TRUNC) != 0);
+        if (error != 0) {
+            result = error;
+        }
+    }
+
+    if (result != 0) {
+        errno = result;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Sends and receives messages of arbitrary size over an intercore socket by
+// splitting them into fragments. This is the high-level app counterpart of
+// SocketStream.c in IntercoreComms_RTApp_MT3620_BareMetal and uses the same
+// fragment header.
+
+/// <summary>
+/// Maximum size of a single message on the intercore socket.
+/// </summary>
+#define INTERCORE_STREAM_MAX_PAYLOAD_LEN 1040
+
+/// <summary>Set on the first fragment of a message.</summary>
+#define INTERCORE_STREAM_FLAG_FIRST 0x0001
+/// <summary>Set on the last fragment of a message.</summary>
+#define INTERCORE_STREAM_FLAG_LAST 0x0002
+
+/// <summary>
+/// Prepended to the payload of every fragment.
+/// </summary>
+typedef struct __attribute__((__packed__)) {
+    /// <summary>Fragment sequence number, incremented for every fragment sent.</summary>
+    uint16_t seq;
+    uint16_t flags;
+    /// <summary>Size of the whole message in bytes.</summary>
+    uint32_t size;
+} IntercoreStreamHeader;
+
+/// <summary>
+/// Opaque handle. Obtain via <see cref="CreateIntercoreStream" /> and dispose of via
+/// <see cref="DisposeIntercoreStream" />.
+/// </summary>
+typedef struct IntercoreStream IntercoreStream;
+
+/// <summary>
+/// Applications implement a function with this signature to be notified when a
+/// message has been reassembled.
+/// </summary>
+/// <param name="data">Message contents, only valid for the duration of the call.</param>
+/// <param name="size">Message size in bytes.</param>
+/// <param name="context">Context passed to <see cref="CreateIntercoreStream" />.</param>
+typedef void (*IntercoreStreamRxHandler)(const void *data, size_t size, void *context);
+
+/// <summary>
+/// Wrap a connected intercore socket. The socket is not closed on dispose.
+/// </summary>
+/// <param name="fd">Socket returned by Application_Connect.</param>
+/// <param name="maxMessageSize">Size of the largest message that can be received.</param>
+/// <param name="handler">Callback invoked for every message received.</param>
+/// <param name="context">Passed to the callback.</param>
+/// <returns>On success, pointer to new IntercoreStream, which should be disposed of
+/// with <see cref="DisposeIntercoreStream" />. On failure, returns NULL, with more
+/// information available in errno.</returns>
+IntercoreStream *CreateIntercoreStream(int fd, size_t maxMessageSize,
+                                       IntercoreStreamRxHandler handler, void *context);
+
+/// <summary>
+/// Dispose of a stream which was allocated with <see cref="CreateIntercoreStream" />.
+/// It is safe to call this function with a NULL pointer.
+/// </summary>
+/// <param name="stream">Successfully allocated stream, or NULL.</param>
+void DisposeIntercoreStream(IntercoreStream *stream);
+
+/// <summary>
+/// Start sending a message, writing as many fragments as the socket accepts without
+/// blocking. The data must remain valid until <see cref="IsIntercoreStreamSendPending" />
+/// returns false.
+/// </summary>
+/// <returns>0 on success, -1 on failure, in which case errno contains more information.
+/// errno is EBUSY if a previous message is still being sent.</returns>
+int SendIntercoreStreamMessage(IntercoreStream *stream, const void *data, size_t size);
+
+/// <summary>
+/// Write as many outstanding fragments as the socket accepts without blocking. Call
+/// this when the socket becomes writable.
+/// </summary>
+/// <returns>0 on success, -1 on failure, in which case errno contains more information.</returns>
+int FlushIntercoreStream(IntercoreStream *stream);
+
+/// <summary>
+/// Whether part of the last message passed to <see cref="SendIntercoreStreamMessage" />
+/// still has to be sent.
+/// </summary>
+bool IsIntercoreStreamSendPending(const IntercoreStream *stream);
+
+/// <summary>
+/// Read every fragment available without blocking, invoking the handler for each
+/// message completed. Call this when the socket becomes readable.
+/// </summary>
+/// <returns>0 on success, -1 on failure, in which case errno contains more information.
+/// errno is EPROTO if a message was dropped because a fragment was lost, or EMSGSIZE
+/// if a message was too large.</returns>
+int ReceiveIntercoreStreamMessages(IntercoreStream *stream);
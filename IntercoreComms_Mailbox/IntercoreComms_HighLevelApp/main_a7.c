@@ -4,6 +4,10 @@
 // This sample C application for Azure Sphere sends messages to, and receives
 // responses from, a real-time capable application. It sends a message every
 // second and prints the message which was sent, and the response which was received.
+// Built with INTERCORE_STREAMING, it instead sends as fast as the RTApp takes messages
+// and prints the throughput each second. Built with INTERCORE_PARTNER_ADC or
+// INTERCORE_PARTNER_IMU, it instead connects to ADC_RTApp_MT3620_BareMetal or
+// I2C_RTApp_MT3620_BareMetal and consumes the ADC blocks or orientations it streams.
 //
 // It uses the following Azure Sphere libraries
 // - log (messages shown in Visual Studio's Device Output window during debugging);
@@ -26,8 +30,16 @@
 #include <applibs/application.h>
 
 #include "eventloop_timer_utilities.h"
-
-#define RECV_BUFF_SIZE 32
+#include "intercore_pipe.h"
+#ifdef INTERCORE_BENCHMARK
+#include "intercore_benchmark.h"
+#endif
+#ifdef INTERCORE_PARTNER_ADC
+#include "intercore_adc.h"
+#endif
+#ifdef INTERCORE_PARTNER_IMU
+#include "intercore_imu.h"
+#endif
 
 /// <summary>
 /// Exit codes for this application. These are used for the
@@ -46,21 +58,47 @@ typedef enum {
     ExitCode_Init_SetSockOpt = 8,
     ExitCode_Init_RegisterIo = 9,
     ExitCode_Main_EventLoopFail = 10,
-    ExitCode_Main_EventLoopSimReboot = 11
+    ExitCode_Main_EventLoopSimReboot = 11,
+    ExitCode_Init_Benchmark = 12
 } ExitCode;
 
 static int sockFd = -1;
 static EventLoop *eventLoop = NULL;
 static EventLoopTimer *sendTimer = NULL;
-static EventRegistration *socketEventReg = NULL;
+static IntercorePipe *intercorePipe = NULL;
+#ifdef INTERCORE_BENCHMARK
+static IntercoreBenchmark *benchmark = NULL;
+#endif
 static volatile sig_atomic_t exitCode = ExitCode_Success;
 
-static const char rtAppComponentId[] = "005180bc-402f-4cb3-a662-72937dbcde47";
+// The RTApp to connect to, which must also be in AllowedApplicationConnections in
+// app_manifest.json. CMake sets it for the partner chosen with INTERCORE_PARTNER.
+#ifndef INTERCORE_RTAPP_COMPONENT_ID
+#define INTERCORE_RTAPP_COMPONENT_ID "005180bc-402f-4cb3-a662-72937dbcde47"
+#endif
+static const char rtAppComponentId[] = INTERCORE_RTAPP_COMPONENT_ID;
+
+#ifdef INTERCORE_PARTNER_ADC
+// Seconds between each request for the ADC RTApp's callback timing.
+#define ADC_TIMING_PERIOD 10
+#endif
+
+#ifdef INTERCORE_STREAMING
+// Messages are written eight at a time, from a pool of enough to keep the ring full.
+static const IntercorePipeConfig pipeConfig = {.txBuffers = 32, .txBatch = 8, .rxBatch = 16};
+#else
+static const IntercorePipeConfig pipeConfig = {.txBuffers = 4, .txBatch = 1, .rxBatch = 8};
+#endif
 
 static void TerminationHandler(int signalNumber);
 static void SendTimerEventHandler(EventLoopTimer *timer);
+static size_t FormatMessage(char *txMessage, size_t size);
 static void SendMessageToRTApp(void);
-static void SocketEventHandler(EventLoop *el, int fd, EventLoop_IoEvents events, void *context);
+static void PipeRxHandler(const IntercorePipeMessage *messages, size_t count, void *context);
+#ifdef INTERCORE_STREAMING
+static void PipeReadyHandler(IntercorePipe *readyPipe, void *context);
+#endif
+static void PipeErrorHandler(IntercorePipe *errorPipe, bool send, int error, void *context);
 static void InitSigterm(void);
 static ExitCode InitHandlers(void);
 static void CloseHandlers(void);
@@ -75,7 +113,10 @@ static void TerminationHandler(int signalNumber)
 }
 
 /// <summary>
-///     Handle send timer event by writing data to the real-time capable application.
+///     Handle send timer event by writing data to the real-time capable application,
+///     when streaming by printing the throughput since the last one, or for the sensor
+///     RTApps by printing what they sent, asking the ADC RTApp for its timing now and
+///     then.
 /// </summary>
 static void SendTimerEventHandler(EventLoopTimer *timer)
 {
@@ -84,68 +125,137 @@ static void SendTimerEventHandler(EventLoopTimer *timer)
         return;
     }
 
+#if defined(INTERCORE_PARTNER_ADC)
+    LogIntercoreAdcStats();
+
+    static unsigned seconds = 0;
+    if (++seconds == ADC_TIMING_PERIOD) {
+        seconds = 0;
+        static const char timingCmd[] = INTERCORE_ADC_TIMING_CMD;
+        if (SendIntercorePipeMessage(intercorePipe, timingCmd, (sizeof(timingCmd) - 1)) == -1) {
+            Log_Debug("WARNING: Unable to request ADC timing: %d (%s)\n", errno, strerror(errno));
+        }
+    }
+#elif defined(INTERCORE_PARTNER_IMU)
+    LogIntercoreImuStats();
+#elif defined(INTERCORE_STREAMING)
+    IntercorePipeStats stats;
+    GetIntercorePipeStats(intercorePipe, &stats, true);
+    Log_Debug("Sent %llu msgs (%llu bytes), blocked %llu times, received %llu msgs (%llu bytes) "
+              "in %llu batches\n",
+              stats.txMessages, stats.txBytes, stats.txBlocked, stats.rxMessages, stats.rxBytes,
+              stats.rxBatches);
+#else
     SendMessageToRTApp();
+#endif
 }
 
 /// <summary>
-///     Helper function for TimerEventHandler sends message to real-time capable application.
+///     Write the next "hl-app-to-rt-app-adding%02d" message, where the number cycles from
+///     00 to 99.
 /// </summary>
-static void SendMessageToRTApp(void)
+/// <returns>Length of the message.</returns>
+static size_t FormatMessage(char *txMessage, size_t size)
 {
-    // Send "hl-app-to-rt-app-%02d" message to RTApp, where the number cycles from 00 to 99.
     static int iter = 0;
 
-    static char txMessage[48];
-    snprintf(txMessage, sizeof(txMessage), "hl-app-to-rt-app-adding%02d", iter);
+    int len = snprintf(txMessage, size, "hl-app-to-rt-app-adding%02d", iter);
     iter = (iter + 1) % 100;
-    Log_Debug("Sending: %s\n", txMessage);
+    return (len < 0) ? 0 : (((size_t)len < size) ? (size_t)len : (size - 1));
+}
 
-    int bytesSent = send(sockFd, txMessage, strlen(txMessage), 0);
-    if (bytesSent == -1) {
+/// <summary>
+///     Helper function for TimerEventHandler sends message to real-time capable application.
+/// </summary>
+static void SendMessageToRTApp(void)
+{
+    char *txMessage = AcquireIntercorePipeBuffer(intercorePipe);
+    if (txMessage == NULL) {
+        // Earlier messages are still waiting for room in the ring.
+        Log_Debug("WARNING: Dropping message: %d (%s)\n", errno, strerror(errno));
+        return;
+    }
+
+    size_t len = FormatMessage(txMessage, INTERCORE_PIPE_MAX_MESSAGE_LEN);
+    Log_Debug("Sending: %.*s\n", (int)len, txMessage);
+
+    if (SendIntercorePipeBuffer(intercorePipe, txMessage, len) == -1) {
         Log_Debug("ERROR: Unable to send message: %d (%s)\n", errno, strerror(errno));
         exitCode = ExitCode_SendMsg_Send;
         return;
     }
 }
 
-static bool MsgParseIsReboot(char rxBuf[RECV_BUFF_SIZE], int len)
+#ifdef INTERCORE_STREAMING
+/// <summary>
+///     Fill every buffer the RTApp has made room for, so messages go as fast as it
+///     takes them.
+/// </summary>
+static void PipeReadyHandler(IntercorePipe *readyPipe, void *context)
+{
+    // Buffers freed by the writes made here wait for the next turn, otherwise this
+    // would never return while the RTApp keeps up.
+    for (size_t count = GetIntercorePipeFreeBuffers(readyPipe); count > 0; count--) {
+        char *txMessage = AcquireIntercorePipeBuffer(readyPipe);
+        size_t len = FormatMessage(txMessage, INTERCORE_PIPE_MAX_MESSAGE_LEN);
+        if (SendIntercorePipeBuffer(readyPipe, txMessage, len) == -1) {
+            Log_Debug("ERROR: Unable to send message: %d (%s)\n", errno, strerror(errno));
+            exitCode = ExitCode_SendMsg_Send;
+            return;
+        }
+    }
+}
+#endif
+
+#if !defined(INTERCORE_PARTNER_ADC) && !defined(INTERCORE_PARTNER_IMU)
+static bool MsgParseIsReboot(const char *rxBuf, size_t len)
 {
-    if (!rxBuf || len <= 0) {
+    if (!rxBuf || len == 0) {
         return false;
     }
 
-    return (strncmp(rxBuf, "reboot!!", (size_t)len) == 0);
+    return (strncmp(rxBuf, "reboot!!", len) == 0);
 }
+#endif
 
 /// <summary>
-///     Handle socket event by reading incoming data from real-time capable application.
+///     Handle each batch of messages drained from the real-time capable application.
 /// </summary>
-static void SocketEventHandler(EventLoop *el, int fd, EventLoop_IoEvents events, void *context)
+static void PipeRxHandler(const IntercorePipeMessage *messages, size_t count, void *context)
 {
-    // Read response from real-time capable application.
-    // If the RTApp has sent more than 32 bytes, then truncate.
-    char rxBuf[RECV_BUFF_SIZE];
-    int bytesReceived = recv(fd, rxBuf, sizeof(rxBuf), 0);
-    Log_Debug("SocketEventHandler\n");
-
-    if (bytesReceived == -1) {
-        Log_Debug("ERROR: Unable to receive message: %d (%s)\n", errno, strerror(errno));
-        exitCode = ExitCode_SocketHandler_Recv;
-        return;
-    }
-
-    Log_Debug("Received %d bytes: ", bytesReceived);
-    for (int i = 0; i < bytesReceived; ++i) {
-        Log_Debug("%c", isprint(rxBuf[i]) ? rxBuf[i] : '.');
-    }
-    Log_Debug("\n");
+    for (size_t m = 0; m < count; m++) {
+        const char *rxBuf = messages[m].data;
+        size_t bytesReceived = messages[m].size;
+
+        // Malformed messages from the sensor RTApps are counted in the next report.
+#if defined(INTERCORE_PARTNER_ADC)
+        HandleIntercoreAdcMessage(rxBuf, bytesReceived);
+#elif defined(INTERCORE_PARTNER_IMU)
+        HandleIntercoreImuMessage(rxBuf, bytesReceived);
+#else
+#ifndef INTERCORE_STREAMING
+        Log_Debug("Received %zu bytes: ", bytesReceived);
+        for (size_t i = 0; i < bytesReceived; ++i) {
+            Log_Debug("%c", isprint(rxBuf[i]) ? rxBuf[i] : '.');
+        }
+        Log_Debug("\n");
+#endif
 
-    if (MsgParseIsReboot(rxBuf, bytesReceived)) {
-        Log_Debug("Simulated reboot cmd received\n");
-        exitCode = ExitCode_Main_EventLoopSimReboot;
+        if (MsgParseIsReboot(rxBuf, bytesReceived)) {
+            Log_Debug("Simulated reboot cmd received\n");
+            exitCode = ExitCode_Main_EventLoopSimReboot;
+        }
+#endif
     }
 }
 
+/// <summary>
+///     Exit once receiving from, or sending to, the real-time capable application fails.
+/// </summary>
+static void PipeErrorHandler(IntercorePipe *errorPipe, bool send, int error, void *context)
+{
+    exitCode = send ? ExitCode_SendMsg_Send : ExitCode_SocketHandler_Recv;
+}
 
 /// <summary>
 ///     Set up SIGTERM termination handler and event handlers for send timer
@@ -174,12 +284,15 @@ static ExitCode InitHandlers(void)
         return ExitCode_Init_EventLoop;
     }
 
-    // Register a one second timer to send a message to the RTApp.
+#ifndef INTERCORE_BENCHMARK
+    // Register a one second timer to send a message to the RTApp, or print the
+    // throughput when streaming.
     static const struct timespec sendPeriod = {.tv_sec = 1, .tv_nsec = 0};
     sendTimer = CreateEventLoopPeriodicTimer(eventLoop, &SendTimerEventHandler, &sendPeriod);
     if (sendTimer == NULL) {
         return ExitCode_Init_SendTimer;
     }
+#endif
 
     // Open a connection to the RTApp.
     sockFd = Application_Connect(rtAppComponentId);
@@ -196,13 +309,28 @@ static ExitCode InitHandlers(void)
         return ExitCode_Init_SetSockOpt;
     }
 
-    // Register handler for incoming messages from real-time capable application.
-    socketEventReg = EventLoop_RegisterIo(eventLoop, sockFd, EventLoop_Input, SocketEventHandler,
-                                          /* context */ NULL);
-    if (socketEventReg == NULL) {
+#ifdef INTERCORE_BENCHMARK
+    // The benchmark takes over the socket in place of the timer and message handler.
+    benchmark = CreateIntercoreBenchmark(eventLoop, sockFd);
+    if (benchmark == NULL) {
+        Log_Debug("ERROR: Unable to start benchmark: %d (%s)\n", errno, strerror(errno));
+        return ExitCode_Init_Benchmark;
+    }
+#else
+    // Drain incoming messages from the real-time capable application, and when
+    // streaming keep sending to it.
+#ifdef INTERCORE_STREAMING
+    IntercorePipeReadyHandler readyHandler = PipeReadyHandler;
+#else
+    IntercorePipeReadyHandler readyHandler = NULL;
+#endif
+    intercorePipe = CreateIntercorePipe(eventLoop, sockFd, &pipeConfig, PipeRxHandler,
+                                        readyHandler, PipeErrorHandler, /* context */ NULL);
+    if (intercorePipe == NULL) {
         Log_Debug("ERROR: Unable to register socket event: %d (%s)\n", errno, strerror(errno));
         return ExitCode_Init_RegisterIo;
     }
+#endif
 
     return ExitCode_Success;
 }
@@ -227,8 +355,13 @@ static void CloseFdAndPrintError(int fd, const char *fdName)
 /// </summary>
 static void CloseHandlers(void)
 {
+#ifdef INTERCORE_BENCHMARK
+    DisposeIntercoreBenchmark(benchmark);
+    benchmark = NULL;
+#endif
     DisposeEventLoopTimer(sendTimer);
-    EventLoop_UnregisterIo(eventLoop, socketEventReg);
+    DisposeIntercorePipe(intercorePipe);
+    intercorePipe = NULL;
     EventLoop_Close(eventLoop);
 
     Log_Debug("Closing file descriptors.\n");
@@ -0,0 +1,327 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "lib/Print.h"
+
+#include "Benchmark.h"
+
+// Messages measured for each size and window.
+#define BENCHMARK_ITERATIONS 256
+
+static const uint32_t Benchmark_Sizes[] = {
+    16, 32, 64, 128, 256, 512, 1024, SOCKET_MAX_PAYLOAD_LEN };
+#define BENCHMARK_SIZE_COUNT (sizeof(Benchmark_Sizes) / sizeof(Benchmark_Sizes[0]))
+
+// Messages in flight during the echo phase, 1 is ping-pong.
+static const uint32_t Benchmark_Windows[] = { 1, 4, 16 };
+#define BENCHMARK_WINDOW_COUNT (sizeof(Benchmark_Windows) / sizeof(Benchmark_Windows[0]))
+
+typedef enum {
+    BENCHMARK_PHASE_IDLE,
+    BENCHMARK_PHASE_ECHO,
+    BENCHMARK_PHASE_STREAM,
+    BENCHMARK_PHASE_STREAM_WAIT,
+} Benchmark_Phase;
+
+static struct {
+    Socket          *socket;
+    Component_Id     partner;
+    GPT             *clock;
+    UART            *debug;
+
+    // Responder state, a reply which didn't fit in the ring is held in
+    // replyBuffer and nothing more is read until it has been sent.
+    bool             replyPending;
+    uint32_t         replySize;
+    uint32_t         streamMsgs;
+    uint32_t         streamBytes;
+
+    // Initiator state
+    Benchmark_Phase  phase;
+    unsigned         sizeIndex;
+    unsigned         windowIndex;
+    uint32_t         sent;
+    uint32_t         received;
+    uint32_t         start;
+    uint32_t         latency[BENCHMARK_ITERATIONS];
+} bench = {0};
+
+static uint8_t rxBuffer[SOCKET_MAX_PAYLOAD_LEN]    __attribute__((aligned(4)));
+static uint8_t txBuffer[SOCKET_MAX_PAYLOAD_LEN]    __attribute__((aligned(4)));
+static uint8_t replyBuffer[SOCKET_MAX_PAYLOAD_LEN] __attribute__((aligned(4)));
+
+static uint32_t Benchmark__Now(void)
+{
+    return GPT_GetCount(bench.clock);
+}
+
+static bool Benchmark__Send(uint16_t type, uint32_t seq, uint32_t size)
+{
+    Benchmark_Header *header = (Benchmark_Header *)txBuffer;
+    header->magic     = BENCHMARK_MAGIC;
+    header->type      = type;
+    header->reserved  = 0;
+    header->seq       = seq;
+    header->timestamp = Benchmark__Now();
+
+    return (Socket_Write(bench.socket, &bench.partner, txBuffer, size) == ERROR_NONE);
+}
+
+static void Benchmark__Start_Point(void)
+{
+    bench.sent     = 0;
+    bench.received = 0;
+    bench.start    = Benchmark__Now();
+}
+
+// Insertion sort, the sample count is small and this avoids pulling in libc.
+static void Benchmark__Sort(uint32_t *values, unsigned count)
+{
+    for (unsigned i = 1; i < count; i++) {
+        uint32_t value = values[i];
+        unsigned j = i;
+        for (; (j > 0) && (values[j - 1] > value); j--) {
+            values[j] = values[j - 1];
+        }
+        values[j] = value;
+    }
+}
+
+static void Benchmark__Report_Echo(uint32_t elapsed)
+{
+    Benchmark__Sort(bench.latency, BENCHMARK_ITERATIONS);
+
+    uint32_t rate = (uint32_t)(((uint64_t)BENCHMARK_ITERATIONS * 1000000) /
+        (elapsed ? elapsed : 1));
+
+    UART_Printf(bench.debug,
+        "BENCH echo size=%lu window=%lu min=%luus p50=%luus p99=%luus rate=%lu/s\r\n",
+        Benchmark_Sizes[bench.sizeIndex], Benchmark_Windows[bench.windowIndex],
+        bench.latency[0],
+        bench.latency[BENCHMARK_ITERATIONS / 2],
+        bench.latency[(BENCHMARK_ITERATIONS * 99) / 100],
+        rate);
+}
+
+static void Benchmark__Report_Stream(uint32_t elapsed, const Benchmark_StreamAck *ack)
+{
+    uint32_t throughput = (uint32_t)(((uint64_t)ack->bytes * 1000000) /
+        (elapsed ? elapsed : 1));
+
+    UART_Printf(bench.debug,
+        "BENCH stream size=%lu msgs=%lu/%u time=%luus throughput=%luB/s\r\n",
+        Benchmark_Sizes[bench.sizeIndex], ack->msgs, BENCHMARK_ITERATIONS,
+        elapsed, throughput);
+}
+
+// Sends as much as the current phase and the ring allow.
+static void Benchmark__Pump(void)
+{
+    uint32_t size = Benchmark_Sizes[bench.sizeIndex];
+
+    switch (bench.phase) {
+    case BENCHMARK_PHASE_ECHO:
+        while ((bench.sent < BENCHMARK_ITERATIONS) &&
+               ((bench.sent - bench.received) < Benchmark_Windows[bench.windowIndex])) {
+            if (!Benchmark__Send(BENCHMARK_MSG_ECHO_REQ, bench.sent, size)) {
+                break;
+            }
+            bench.sent++;
+        }
+        break;
+
+    case BENCHMARK_PHASE_STREAM:
+        while (bench.sent < BENCHMARK_ITERATIONS) {
+            if (!Benchmark__Send(BENCHMARK_MSG_STREAM, bench.sent, size)) {
+                return;
+            }
+            bench.sent++;
+        }
+        if (Benchmark__Send(BENCHMARK_MSG_STREAM_END, bench.sent, sizeof(Benchmark_Header))) {
+            bench.phase = BENCHMARK_PHASE_STREAM_WAIT;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void Benchmark__Echo_Rsp(const Benchmark_Header *header)
+{
+    if ((bench.phase != BENCHMARK_PHASE_ECHO) ||
+        (header->seq >= bench.sent)) {
+        return;
+    }
+
+    bench.latency[bench.received++] = Benchmark__Now() - header->timestamp;
+    if (bench.received < BENCHMARK_ITERATIONS) {
+        return;
+    }
+
+    Benchmark__Report_Echo(Benchmark__Now() - bench.start);
+
+    bench.windowIndex++;
+    if (bench.windowIndex >= BENCHMARK_WINDOW_COUNT) {
+        bench.windowIndex = 0;
+        bench.phase = BENCHMARK_PHASE_STREAM;
+    }
+    Benchmark__Start_Point();
+}
+
+// Queues a reply to the partner's initiator, sent as soon as there is space.
+static void Benchmark__Reply(const void *data, uint32_t size)
+{
+    __builtin_memcpy(replyBuffer, data, size);
+    bench.replySize    = size;
+    bench.replyPending = true;
+}
+
+static void Benchmark__Stream_Ack(const Benchmark_StreamAck *ack)
+{
+    if (bench.phase != BENCHMARK_PHASE_STREAM_WAIT) {
+        return;
+    }
+
+    Benchmark__Report_Stream(Benchmark__Now() - bench.start, ack);
+
+    bench.sizeIndex++;
+    if (bench.sizeIndex >= BENCHMARK_SIZE_COUNT) {
+        bench.sizeIndex = 0;
+        bench.phase = BENCHMARK_PHASE_IDLE;
+        UART_Print(bench.debug, "BENCH complete\r\n");
+
+        Benchmark_Header done = {
+            .magic     = BENCHMARK_MAGIC,
+            .type      = BENCHMARK_MSG_DONE,
+            .timestamp = Benchmark__Now(),
+        };
+        Benchmark__Reply(&done, sizeof(done));
+        return;
+    }
+
+    bench.phase = BENCHMARK_PHASE_ECHO;
+    Benchmark__Start_Point();
+}
+
+static void Benchmark__Handle(uint32_t size)
+{
+    if (size < sizeof(Benchmark_Header)) {
+        return;
+    }
+
+    Benchmark_Header header;
+    __builtin_memcpy(&header, rxBuffer, sizeof(header));
+    if (header.magic != BENCHMARK_MAGIC) {
+        return;
+    }
+
+    switch (header.type) {
+    // Responder
+    case BENCHMARK_MSG_ECHO_REQ:
+        ((Benchmark_Header *)rxBuffer)->type = BENCHMARK_MSG_ECHO_RSP;
+        Benchmark__Reply(rxBuffer, size);
+        break;
+
+    case BENCHMARK_MSG_STREAM:
+        bench.streamMsgs++;
+        bench.streamBytes += size;
+        break;
+
+    case BENCHMARK_MSG_STREAM_END:
+        {
+            struct __attribute__((__packed__)) {
+                Benchmark_Header    header;
+                Benchmark_StreamAck ack;
+            } reply = {
+                .header = header,
+                .ack    = { .msgs = bench.streamMsgs, .bytes = bench.streamBytes },
+            };
+            reply.header.type = BENCHMARK_MSG_STREAM_ACK;
+            Benchmark__Reply(&reply, sizeof(reply));
+
+            bench.streamMsgs  = 0;
+            bench.streamBytes = 0;
+        }
+        break;
+
+    case BENCHMARK_MSG_START:
+        UART_Print(bench.debug, "BENCH HLApp sweep complete, starting RTApp sweep\r\n");
+        bench.sizeIndex   = 0;
+        bench.windowIndex = 0;
+        bench.phase       = BENCHMARK_PHASE_ECHO;
+        Benchmark__Start_Point();
+        break;
+
+    // Initiator
+    case BENCHMARK_MSG_ECHO_RSP:
+        Benchmark__Echo_Rsp(&header);
+        break;
+
+    case BENCHMARK_MSG_STREAM_ACK:
+        if (size >= (sizeof(Benchmark_Header) + sizeof(Benchmark_StreamAck))) {
+            Benchmark_StreamAck ack;
+            __builtin_memcpy(&ack, &rxBuffer[sizeof(Benchmark_Header)], sizeof(ack));
+            Benchmark__Stream_Ack(&ack);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+void Benchmark_Init(
+    Socket             *socket,
+    const Component_Id *partner,
+    GPT                *clock,
+    UART               *debug)
+{
+    bench.socket  = socket;
+    bench.partner = *partner;
+    bench.clock   = clock;
+    bench.debug   = debug;
+    bench.phase   = BENCHMARK_PHASE_IDLE;
+
+    UART_Print(debug, "BENCH waiting for HLApp sweep\r\n");
+}
+
+void Benchmark_Recv(void)
+{
+    if (!bench.socket) {
+        return;
+    }
+
+    for (;;) {
+        if (bench.replyPending) {
+            if (Socket_Write(bench.socket, &bench.partner,
+                replyBuffer, bench.replySize) != ERROR_NONE) {
+                break;
+            }
+            bench.replyPending = false;
+        }
+
+        Component_Id sender;
+        uint32_t size = sizeof(rxBuffer);
+        int32_t error = Socket_Read(bench.socket, &sender, rxBuffer, &size);
+        if (error != ERROR_NONE) {
+            // A bad block would otherwise be read again on every poll.
+            if (error != ERROR_SOCKET_EMPTY) {
+                Socket_ReadDiscard(bench.socket);
+            }
+            break;
+        }
+
+        Benchmark__Handle(size);
+    }
+
+    Benchmark__Pump();
+}
+
+void Benchmark_Poll(void)
+{
+    Benchmark_Recv();
+}
@@ -0,0 +1,74 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef AZURE_SPHERE_BENCHMARK_H_
+#define AZURE_SPHERE_BENCHMARK_H_
+
+#include "lib/GPT.h"
+#include "lib/UART.h"
+
+#include "Socket.h"
+
+#include <stdint.h>
+
+// Intercore socket throughput/latency benchmark, the partner of
+// intercore_benchmark.c in IntercoreComms_HighLevelApp.
+//
+// The HLApp runs its sweep first while this side echoes, then hands over
+// and the roles swap. For each payload size from 16 bytes up to
+// SOCKET_MAX_PAYLOAD_LEN the initiator measures round trips with 1, 4 and 16
+// messages in flight, followed by one-way streaming throughput. Results are
+// printed on the debug UART.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Identifies benchmark messages, the initiator owns the seq and timestamp.
+#define BENCHMARK_MAGIC 0x48434e42
+
+typedef enum {
+    BENCHMARK_MSG_ECHO_REQ   = 1,
+    BENCHMARK_MSG_ECHO_RSP   = 2,
+    BENCHMARK_MSG_STREAM     = 3,
+    BENCHMARK_MSG_STREAM_END = 4,
+    BENCHMARK_MSG_STREAM_ACK = 5,
+    /// Sent by the HLApp when its sweep is done, to start ours.
+    BENCHMARK_MSG_START      = 6,
+    /// Sent when our sweep is done.
+    BENCHMARK_MSG_DONE       = 7,
+} Benchmark_MsgType;
+
+/// Starts every benchmark message, which is why the smallest is 16 bytes.
+typedef struct __attribute__((__packed__)) {
+    uint32_t magic;
+    uint16_t type;
+    uint16_t reserved;
+    uint32_t seq;
+    /// Initiator clock in microseconds when the message was sent.
+    uint32_t timestamp;
+} Benchmark_Header;
+
+/// Payload of BENCHMARK_MSG_STREAM_ACK following the header.
+typedef struct __attribute__((__packed__)) {
+    uint32_t msgs;
+    uint32_t bytes;
+} Benchmark_StreamAck;
+
+/// clock must be free running at 1MHz.
+void Benchmark_Init(
+    Socket             *socket,
+    const Component_Id *partner,
+    GPT                *clock,
+    UART               *debug);
+
+/// Call on every receive notification.
+void Benchmark_Recv(void);
+/// Call periodically to push messages which didn't fit in the ring.
+void Benchmark_Poll(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef AZURE_SPHERE_BENCHMARK_H_
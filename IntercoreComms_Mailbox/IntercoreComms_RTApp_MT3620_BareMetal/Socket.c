@@ -13,9 +13,13 @@
 #include "lib/MBox.h"
 
 #include "Socket.h"
+#include "Profile.h"
+#include "Placement.h"
 
 #define FIFO_MSG_NEG_LEN 3
 
+PROFILE_MARKER(Socket_Write);
+
 typedef struct __attribute__((__packed__)) {
     // read and write index in bytes
     uint32_t writeIndex;
@@ -51,6 +55,17 @@ struct Socket {
     MBox              *mailbox;
     Socket_Ringbuffer  ringRemote;
     Socket_Ringbuffer  ringLocal;
+
+    // Outstanding zero-copy operations and batches, only ever touched by
+    // the M4 core.
+    uint32_t           writeReserved;
+    bool               writeBatch;
+    uint32_t           writePending;
+    bool               readPeeked;
+    uint32_t           readNext;
+
+    // Set while rx_cb is suppressed, e.g. during a drain.
+    volatile bool      rxMuted;
 };
 
 static Socket context = {0};
@@ -64,7 +79,7 @@ static Socket context = {0};
 #define RB_ALIGNMENT 16
 // Maximum payload size in bytes. This does not include a header which
 // is prepended by
-#define RB_MAX_PAYLOAD_LEN 1040
+#define RB_MAX_PAYLOAD_LEN SOCKET_MAX_PAYLOAD_LEN
 
 static const uint8_t SOCKET_PORT_MSG_RECV = 1;
 static const uint8_t SOCKET_PORT_MSG_SENT = 0;
@@ -99,7 +114,32 @@ static void Socket__Msg_Available(void *user_data, uint8_t port)
 
     Socket *handle = (Socket*)user_data;
 
-    handle->rx_cb(handle);
+    if (!handle->rxMuted) {
+        handle->rx_cb(handle);
+    }
+}
+
+static bool Socket__Rx_Available(Socket *socket)
+{
+    uint32_t remoteWritePosition;
+    __atomic_load(&(RB_WRITE_INDEX(socket->ringRemote)), &remoteWritePosition, __ATOMIC_ACQUIRE);
+
+    return (remoteWritePosition != RB_READ_INDEX(socket->ringLocal));
+}
+
+void Socket_SetRxNotify(Socket *socket, bool enable)
+{
+    if (!socket) {
+        return;
+    }
+
+    socket->rxMuted = !enable;
+
+    // Anything which arrived while muted would otherwise go unnoticed until
+    // the next message.
+    if (enable && Socket__Rx_Available(socket)) {
+        socket->rx_cb(socket);
+    }
 }
 
 Socket* Socket_Open(void (*rx_cb)(Socket*))
@@ -131,8 +171,9 @@ Socket* Socket_Open(void (*rx_cb)(Socket*))
     }
 
     // Update context
-    context.rx_cb = rx_cb;
-    context.open  = true;
+    context.rx_cb   = rx_cb;
+    context.rxMuted = false;
+    context.open    = true;
 
     return &context;
 }
@@ -211,6 +252,10 @@ int32_t Socket_Negotiate(Socket *socket)
     socket->ringRemote = ringRemote;
     socket->ringLocal  = ringLocal;
 
+    socket->writeReserved = 0;
+    socket->writeBatch    = false;
+    socket->readPeeked    = false;
+
     return ERROR_NONE;
 }
 
@@ -233,83 +278,169 @@ static void Socket__Signal(Socket *socket, uint8_t port)
     MBox_SW_Interrupt_Trigger(socket->mailbox, port);
 }
 
-// Helper function for Socket_Write. Writes data to the local ringbuffer,
-// and wraps around to start of buffer if required. Returns updated write position.
-static uint32_t Socket__Write_RB(
-    const Socket_Ringbuffer *rb, uint32_t startPos, const void *src, size_t size)
+// Returns the position size bytes on from pos, wrapping around the end of the buffer.
+static uint32_t Socket__Advance_RB(
+    const Socket_Ringbuffer *rb, uint32_t pos, uint32_t size)
+{
+    pos += size;
+    if (pos >= rb->capacity) {
+        pos -= rb->capacity;
+    }
+    return pos;
+}
+
+// Describes size bytes of the ring buffer from startPos, split in two if the
+// region wraps around the end of the buffer.
+static void Socket__Buffer_RB(
+    const Socket_Ringbuffer *rb, uint32_t startPos, uint32_t size, Socket_Buffer *buffer)
 {
     uint32_t spaceToEnd = rb->capacity - startPos;
 
-    uint32_t writeToEnd = size;
-    // If the new data would wrap around the end of the buffer then only write
-    // spaceToEnd bytes before subsequently writing to the start of the buffer.
+    buffer->seg[0]  = &(rb->sharedData->data[startPos]);
+    buffer->size[0] = size;
+    buffer->seg[1]  = &(rb->sharedData->data[0]);
+    buffer->size[1] = 0;
+
     if (size > spaceToEnd) {
-        writeToEnd = spaceToEnd;
+        buffer->size[0] = spaceToEnd;
+        buffer->size[1] = size - spaceToEnd;
     }
+}
+
+// Helper function for Socket_Write. Writes data to the local ringbuffer,
+// and wraps around to start of buffer if required. Returns updated write position.
+static uint32_t Socket__Write_RB(
+    const Socket_Ringbuffer *rb, uint32_t startPos, const void *src, size_t size)
+{
+    Socket_Buffer dest;
+    Socket__Buffer_RB(rb, startPos, size, &dest);
 
     const uint8_t *src8 = (const uint8_t *)src;
 
-    __builtin_memcpy(&(rb->sharedData->data[startPos]), src8, writeToEnd);
+    __builtin_memcpy(dest.seg[0], src8, dest.size[0]);
     // If not enough space to write all data before end of buffer, then write remainder at start.
-    __builtin_memcpy(&(rb->sharedData->data[0]), src8 + writeToEnd, size - writeToEnd);
+    __builtin_memcpy(dest.seg[1], src8 + dest.size[0], dest.size[1]);
 
-    uint32_t finalPos = startPos + size;
-    if (finalPos > rb->capacity) {
-        finalPos -= rb->capacity;
-    }
-    return finalPos;
+    return Socket__Advance_RB(rb, startPos, size);
 }
 
-int32_t Socket_Write(
-    Socket             *socket,
-    const Component_Id *recipient,
-    const void         *data,
-    uint32_t            size)
+// Size of the block size field and message header which precede each payload.
+#define RB_BLOCK_OVERHEAD (sizeof(uint32_t) + sizeof(Socket_Msg_Header))
+
+// Returns the position at which the next block will be written.
+static uint32_t Socket__Write_Position(const Socket *socket)
 {
-    if (!socket || !recipient || !data || (size == 0)) {
-        return ERROR_PARAMETER;
+    if (socket->writeBatch) {
+        return socket->writePending;
     }
+    return RB_WRITE_INDEX(socket->ringLocal);
+}
 
-    if (size > RB_MAX_PAYLOAD_LEN) {
-        return ERROR_SOCKET_INSUFFICIENT_SPACE;
-    }
+// Makes every block written up to writePosition visible to the HLApp.
+static void Socket__Write_Publish(Socket *socket, uint32_t writePosition)
+{
+    // Ensure write position update is seen after new content has been written.
+    // Corresponding acquire is on high-level core.
+    __atomic_store(
+        &(RB_WRITE_INDEX(socket->ringLocal)),
+        &writePosition, __ATOMIC_RELEASE);
+
+    Socket__Signal(socket, SOCKET_PORT_MSG_SENT);
+}
 
+// Returns the free space in bytes in the local ring buffer, or zero if the
+// read or write position is invalid.
+static uint32_t Socket__Write_Avail(const Socket *socket)
+{
     // Last position read by HLApp. Corresponding release occurs on
     // high-level core.
     uint32_t remoteReadPosition;
     __atomic_load(&(RB_READ_INDEX(socket->ringRemote)),
         &remoteReadPosition, __ATOMIC_ACQUIRE);
-    // Last position written to by RTApp.
-    uint32_t localWritePosition = RB_WRITE_INDEX(socket->ringLocal);
+    // Last position written to by RTApp, including any unpublished batch.
+    uint32_t localWritePosition = Socket__Write_Position(socket);
 
     // Sanity check read and write positions.
     if ((remoteReadPosition >= socket->ringLocal.capacity) ||
         ((remoteReadPosition % RB_ALIGNMENT) != 0) ||
         (localWritePosition >= socket->ringLocal.capacity) ||
         ((localWritePosition % RB_ALIGNMENT) != 0)) {
-        return ERROR_SOCKET_INSUFFICIENT_SPACE;
+        return 0;
     }
 
     // If the read pointer is behind the write pointer, then the free space
     // wraps around, and the used space doesn't.
-    uint32_t availSpace;
     if (remoteReadPosition <= localWritePosition) {
-        availSpace = remoteReadPosition - localWritePosition +
+        return remoteReadPosition - localWritePosition +
             socket->ringLocal.capacity;
-    } else {
-        availSpace = remoteReadPosition - localWritePosition;
+    }
+    return remoteReadPosition - localWritePosition;
+}
+
+uint32_t Socket_WriteSpace(Socket *socket)
+{
+    if (!socket) {
+        return 0;
+    }
+
+    // Inverse of the space check in Socket_WriteReserve.
+    uint32_t availSpace = Socket__Write_Avail(socket);
+    if (availSpace < (RB_BLOCK_OVERHEAD + RB_ALIGNMENT)) {
+        return 0;
     }
 
+    return availSpace - RB_BLOCK_OVERHEAD - RB_ALIGNMENT;
+}
+
+TCM_CODE int32_t Socket_WriteReserve(
+    Socket        *socket,
+    uint32_t       size,
+    Socket_Buffer *buffer)
+{
+    if (!socket || !buffer || (size == 0)) {
+        return ERROR_PARAMETER;
+    }
+
+    if (size > RB_MAX_PAYLOAD_LEN) {
+        return ERROR_SOCKET_INSUFFICIENT_SPACE;
+    }
+
+    uint32_t localWritePosition = Socket__Write_Position(socket);
+    uint32_t availSpace         = Socket__Write_Avail(socket);
+
     // Check whether there is enough space to enqueue the next block.
-    uint32_t reqBlockSize = sizeof(uint32_t) + sizeof(Socket_Msg_Header) + size;
+    uint32_t reqBlockSize = RB_BLOCK_OVERHEAD + size;
 
     if (availSpace < reqBlockSize + RB_ALIGNMENT) {
         return ERROR_SOCKET_INSUFFICIENT_SPACE;
     }
 
+    // The payload follows the block size field and header, which are only
+    // written on commit once the final size is known.
+    uint32_t payloadPosition = Socket__Advance_RB(
+        &(socket->ringLocal), localWritePosition, RB_BLOCK_OVERHEAD);
+    Socket__Buffer_RB(&(socket->ringLocal), payloadPosition, size, buffer);
+
+    socket->writeReserved = size;
+
+    return ERROR_NONE;
+}
+
+TCM_CODE int32_t Socket_WriteCommit(
+    Socket             *socket,
+    const Component_Id *recipient,
+    uint32_t            size)
+{
+    if (!socket || !recipient || (size == 0) ||
+        (size > socket->writeReserved)) {
+        return ERROR_PARAMETER;
+    }
+
+    uint32_t localWritePosition = Socket__Write_Position(socket);
+
     // The value in the block size field does not include the space taken by the
     // block size field itself.
-    uint32_t blockSizeExcSizeField = reqBlockSize - sizeof(uint32_t);
+    uint32_t blockSizeExcSizeField = sizeof(Socket_Msg_Header) + size;
     localWritePosition = Socket__Write_RB(
         &(socket->ringLocal), localWritePosition, &blockSizeExcSizeField,
         sizeof(blockSizeExcSizeField));
@@ -321,9 +452,9 @@ int32_t Socket_Write(
         &(socket->ringLocal), localWritePosition,
         &msg_header, sizeof(Socket_Msg_Header));
 
-    // Write data
-    localWritePosition = Socket__Write_RB(
-        &(socket->ringLocal), localWritePosition, data, size);
+    // Skip over the payload, which the caller has already written in place.
+    localWritePosition = Socket__Advance_RB(
+        &(socket->ringLocal), localWritePosition, size);
 
     // Advance write position to start of next possible block.
     localWritePosition = RoundUp(localWritePosition, RB_ALIGNMENT);
@@ -331,68 +462,144 @@ int32_t Socket_Write(
         localWritePosition -= socket->ringLocal.capacity;
     }
 
-    // Ensure write position update is seen after new content has been written.
-    // Corresponding acquire is on high-level core.
-    __atomic_store(
-        &(RB_WRITE_INDEX(socket->ringLocal)),
-        &localWritePosition, __ATOMIC_RELEASE);
+    socket->writeReserved = 0;
 
-    Socket__Signal(socket, SOCKET_PORT_MSG_SENT);
+    if (socket->writeBatch) {
+        socket->writePending = localWritePosition;
+    } else {
+        Socket__Write_Publish(socket, localWritePosition);
+    }
 
     return ERROR_NONE;
 }
 
+TCM_CODE int32_t Socket_Write(
+    Socket             *socket,
+    const Component_Id *recipient,
+    const void         *data,
+    uint32_t            size)
+{
+    PROFILE_SCOPE(Socket_Write);
+
+    if (!socket || !recipient || !data || (size == 0)) {
+        return ERROR_PARAMETER;
+    }
+
+    Socket_Buffer buffer;
+    int32_t error = Socket_WriteReserve(socket, size, &buffer);
+    if (error != ERROR_NONE) {
+        return error;
+    }
+
+    // Write data
+    const uint8_t *src8 = (const uint8_t *)data;
+    __builtin_memcpy(buffer.seg[0], src8, buffer.size[0]);
+    __builtin_memcpy(buffer.seg[1], src8 + buffer.size[0], buffer.size[1]);
+
+    return Socket_WriteCommit(socket, recipient, size);
+}
+
+int32_t Socket_WriteBegin(Socket *socket)
+{
+    if (!socket) {
+        return ERROR_PARAMETER;
+    }
+
+    if (socket->writeBatch) {
+        return ERROR_BUSY;
+    }
+
+    socket->writePending = RB_WRITE_INDEX(socket->ringLocal);
+    socket->writeBatch   = true;
+
+    return ERROR_NONE;
+}
+
+int32_t Socket_WriteFlush(Socket *socket)
+{
+    if (!socket || !socket->writeBatch) {
+        return ERROR_PARAMETER;
+    }
+
+    socket->writeBatch = false;
+
+    // Only interrupt the HLApp if the batch contained anything.
+    if (socket->writePending != RB_WRITE_INDEX(socket->ringLocal)) {
+        Socket__Write_Publish(socket, socket->writePending);
+    }
+
+    return ERROR_NONE;
+}
+
+int32_t Socket_WriteV(
+    Socket             *socket,
+    const Component_Id *recipient,
+    const Socket_IOVec *iov,
+    uint32_t            count)
+{
+    if (!socket || !recipient || !iov || (count == 0)) {
+        return ERROR_PARAMETER;
+    }
+
+    int32_t error = Socket_WriteBegin(socket);
+    if (error != ERROR_NONE) {
+        return error;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        error = Socket_Write(socket, recipient, iov[i].data, iov[i].size);
+        if (error != ERROR_NONE) {
+            // Nothing has been published yet, so the batch can simply be
+            // dropped.
+            socket->writeBatch = false;
+            return error;
+        }
+    }
+
+    return Socket_WriteFlush(socket);
+}
+
 // Helper function for Socket_Read. Reads data from the remote ring buffer,
 // and wraps around to start of buffer if required. Returns updated read position.
 static uint32_t Socket__Read_RB(
     const Socket_Ringbuffer *rb, uint32_t startPos, void *dest, size_t size)
 {
-    uint32_t availToEnd = rb->capacity - startPos;
-
-    uint32_t readFromEnd = size;
-    // If the available data wraps around the end of the buffer then only read
-    // availToEnd bytes before subsequently reading from the start of the buffer.
-    if (size > availToEnd) {
-        readFromEnd = availToEnd;
-    }
+    Socket_Buffer src;
+    Socket__Buffer_RB(rb, startPos, size, &src);
 
     uint8_t *dest8 = (uint8_t *)dest;
-    __builtin_memcpy(dest, &(rb->sharedData->data[startPos]), readFromEnd);
+    __builtin_memcpy(dest8, src.seg[0], src.size[0]);
 
     // If block wrapped around the end of the buffer, then read remainder from start.
-    __builtin_memcpy(dest8 + readFromEnd, &(rb->sharedData->data[0]), size - readFromEnd);
+    __builtin_memcpy(dest8 + src.size[0], src.seg[1], src.size[1]);
 
-    uint32_t finalPos = startPos + size;
-    if (finalPos > rb->capacity) {
-        finalPos -= rb->capacity;
-    }
-    return finalPos;
+    return Socket__Advance_RB(rb, startPos, size);
 }
 
-int32_t Socket_Read(
-    Socket       *socket,
-    Component_Id *sender,
-    void         *data,
-    uint32_t     *size)
+// Helper function for Socket_ReadPeek and Socket_ReadBatch. Parses the block
+// at readPosition, given the remote write position, and on success advances
+// readPosition to the start of the following block.
+static int32_t Socket__Peek_RB(
+    const Socket_Ringbuffer *rb,
+    uint32_t                 remoteWritePosition,
+    uint32_t                *readPosition,
+    Component_Id            *sender,
+    Socket_Buffer           *buffer)
 {
-    if (!socket || !sender || !data || !size) {
-        return ERROR_PARAMETER;
-    }
-    // Don't read message content until have seen that remote write position has been updated.
-    // Corresponding release occurs on high-level core.
-    uint32_t remoteWritePosition;
-    __atomic_load(&(RB_WRITE_INDEX(socket->ringRemote)), &remoteWritePosition, __ATOMIC_ACQUIRE);
-    // Last position read from by this RTApp.
-    uint32_t localReadPosition = RB_READ_INDEX(socket->ringLocal);
+    uint32_t localReadPosition = *readPosition;
 
     // Sanity check read and write positions.
-    if ((remoteWritePosition >= socket->ringRemote.capacity) ||
+    if ((remoteWritePosition >= rb->capacity) ||
         ((remoteWritePosition % RB_ALIGNMENT) != 0) ||
-        (localReadPosition >= socket->ringRemote.capacity) ||
+        (localReadPosition >= rb->capacity) ||
         ((localReadPosition % RB_ALIGNMENT) != 0)) {
         return ERROR_SOCKET_INSUFFICIENT_SPACE;
     }
 
+    if (remoteWritePosition == localReadPosition) {
+        return ERROR_SOCKET_EMPTY;
+    }
+
     // Get the maximum amount of available data. The actual block size may be
     // smaller than this.
 
@@ -403,14 +610,14 @@ int32_t Socket_Read(
     }
     // ...else data wraps around end and resumes at start of buffer
     else {
-        availData = remoteWritePosition - localReadPosition + socket->ringRemote.capacity;
+        availData = remoteWritePosition - localReadPosition + rb->capacity;
     }
 
     // The amount of available data must be at least enough to hold the block size.
     // If not, caller will assume that no message was available.
     const size_t blockSizeSize = sizeof(uint32_t);
     // The block size must be stored in four contiguous bytes before wraparound.
-    uint32_t dataToEnd = socket->ringRemote.capacity - localReadPosition;
+    uint32_t dataToEnd = rb->capacity - localReadPosition;
     if ((availData < blockSizeSize) || (blockSizeSize > dataToEnd)) {
         return ERROR_SOCKET_INSUFFICIENT_SPACE;
     }
@@ -418,7 +625,7 @@ int32_t Socket_Read(
     // The block size followed by the actual block can be no longer than the available data.
     uint32_t blockSize;
     localReadPosition = Socket__Read_RB(
-        &(socket->ringRemote), localReadPosition, &blockSize, sizeof(blockSize));
+        rb, localReadPosition, &blockSize, sizeof(blockSize));
     uint32_t totalBlockSize;
 
     totalBlockSize = blockSizeSize + blockSize;
@@ -430,41 +637,164 @@ int32_t Socket_Read(
         return ERROR_SOCKET_INSUFFICIENT_SPACE;
     }
 
-    // The caller-supplied buffer must be large enough to contain the
-    // payload in the buffer, excluding component ID and reserved word.
-    size_t senderPayloadSize = blockSize - sizeof(Socket_Msg_Header);
-    if (senderPayloadSize > *size) {
-        return ERROR_SOCKET_INSUFFICIENT_SPACE;
-    }
-
-    // Tell the caller the actual block size.
-    *size = senderPayloadSize;
-
     // Read the sender header. This may wraparound to the start of the buffer.
+    Socket_Msg_Header msg_header;
     localReadPosition = Socket__Read_RB(
-        &(socket->ringRemote), localReadPosition,
-        sender, sizeof(Socket_Msg_Header));
+        rb, localReadPosition, &msg_header, sizeof(Socket_Msg_Header));
+    *sender = msg_header.comp_id;
 
-    // Read data
-    localReadPosition = Socket__Read_RB(
-        &(socket->ringRemote),
-        localReadPosition, data, senderPayloadSize);
+    // The payload excludes the component ID and reserved word.
+    uint32_t senderPayloadSize = blockSize - sizeof(Socket_Msg_Header);
+    Socket__Buffer_RB(rb, localReadPosition, senderPayloadSize, buffer);
+    localReadPosition = Socket__Advance_RB(rb, localReadPosition, senderPayloadSize);
 
     // Align read position to next possible location for next buffer.
     // This may wrap around.
     localReadPosition = RoundUp(localReadPosition, RB_ALIGNMENT);
-    if (localReadPosition >= socket->ringRemote.capacity) {
-        localReadPosition -= socket->ringRemote.capacity;
+    if (localReadPosition >= rb->capacity) {
+        localReadPosition -= rb->capacity;
+    }
+
+    *readPosition = localReadPosition;
+
+    return ERROR_NONE;
+}
+
+int32_t Socket_ReadPeek(
+    Socket        *socket,
+    Component_Id  *sender,
+    Socket_Buffer *buffer)
+{
+    if (!socket || !sender || !buffer) {
+        return ERROR_PARAMETER;
+    }
+    // Don't read message content until have seen that remote write position has been updated.
+    // Corresponding release occurs on high-level core.
+    uint32_t remoteWritePosition;
+    __atomic_load(&(RB_WRITE_INDEX(socket->ringRemote)), &remoteWritePosition, __ATOMIC_ACQUIRE);
+    // Last position read from by this RTApp.
+    uint32_t localReadPosition = RB_READ_INDEX(socket->ringLocal);
+
+    int32_t error = Socket__Peek_RB(
+        &(socket->ringRemote), remoteWritePosition,
+        &localReadPosition, sender, buffer);
+    if (error != ERROR_NONE) {
+        return error;
     }
 
+    socket->readNext   = localReadPosition;
+    socket->readPeeked = true;
+
+    return ERROR_NONE;
+}
+
+int32_t Socket_ReadBatch(
+    Socket     *socket,
+    Socket_Msg *msgs,
+    uint32_t   *count)
+{
+    if (!socket || !msgs || !count || (*count == 0)) {
+        return ERROR_PARAMETER;
+    }
+    // Only messages published before this point are drained, anything
+    // arriving later is left for the next batch.
+    uint32_t remoteWritePosition;
+    __atomic_load(&(RB_WRITE_INDEX(socket->ringRemote)), &remoteWritePosition, __ATOMIC_ACQUIRE);
+    uint32_t localReadPosition = RB_READ_INDEX(socket->ringLocal);
+
+    uint32_t read;
+    int32_t  error = ERROR_NONE;
+    for (read = 0; read < *count; read++) {
+        error = Socket__Peek_RB(
+            &(socket->ringRemote), remoteWritePosition, &localReadPosition,
+            &(msgs[read].sender), &(msgs[read].buffer));
+        if (error != ERROR_NONE) {
+            break;
+        }
+    }
+
+    if (read == 0) {
+        return error;
+    }
+
+    *count = read;
+
+    socket->readNext   = localReadPosition;
+    socket->readPeeked = true;
+
+    return ERROR_NONE;
+}
+
+int32_t Socket_ReadRelease(Socket *socket)
+{
+    if (!socket || !socket->readPeeked) {
+        return ERROR_PARAMETER;
+    }
+
+    socket->readPeeked = false;
+
     // The message content must have been retrieved before the high-level core
     // sees the read position has been updated. Corresponding acquire occurs
     // on high-level core.
     __atomic_store(
         &(RB_READ_INDEX(socket->ringLocal)),
-        &localReadPosition, __ATOMIC_RELEASE);
+        &(socket->readNext), __ATOMIC_RELEASE);
 
     Socket__Signal(socket, SOCKET_PORT_MSG_RECV);
 
     return ERROR_NONE;
 }
+
+int32_t Socket_ReadDiscard(Socket *socket)
+{
+    if (!socket) {
+        return ERROR_PARAMETER;
+    }
+
+    uint32_t remoteWritePosition;
+    __atomic_load(&(RB_WRITE_INDEX(socket->ringRemote)), &remoteWritePosition, __ATOMIC_ACQUIRE);
+    // A write position which is itself bad can't be caught up to, only
+    // renegotiation recovers from that.
+    if ((remoteWritePosition >= socket->ringRemote.capacity) ||
+        ((remoteWritePosition % RB_ALIGNMENT) != 0)) {
+        return ERROR_SOCKET_INSUFFICIENT_SPACE;
+    }
+
+    socket->readNext   = remoteWritePosition;
+    socket->readPeeked = true;
+    return Socket_ReadRelease(socket);
+}
+
+int32_t Socket_Read(
+    Socket       *socket,
+    Component_Id *sender,
+    void         *data,
+    uint32_t     *size)
+{
+    if (!socket || !sender || !data || !size) {
+        return ERROR_PARAMETER;
+    }
+
+    Socket_Buffer buffer;
+    int32_t error = Socket_ReadPeek(socket, sender, &buffer);
+    if (error != ERROR_NONE) {
+        return error;
+    }
+
+    // The caller-supplied buffer must be large enough to contain the
+    // payload in the buffer, excluding component ID and reserved word.
+    uint32_t senderPayloadSize = buffer.size[0] + buffer.size[1];
+    if (senderPayloadSize > *size) {
+        return ERROR_SOCKET_INSUFFICIENT_SPACE;
+    }
+
+    // Tell the caller the actual block size.
+    *size = senderPayloadSize;
+
+    // Read data
+    uint8_t *dest8 = (uint8_t *)data;
+    __builtin_memcpy(dest8, buffer.seg[0], buffer.size[0]);
+    __builtin_memcpy(dest8 + buffer.size[0], buffer.seg[1], buffer.size[1]);
+
+    return Socket_ReadRelease(socket);
+}
@@ -29,6 +29,12 @@ extern "C" {
 /// Returned when negotiation fails.</summary>
 #define ERROR_SOCKET_NEGOTIATION        (ERROR_SPECIFIC - 2)
 
+/// Returned by reads when no message is waiting.</summary>
+#define ERROR_SOCKET_EMPTY              (ERROR_SPECIFIC - 5)
+
+/// Maximum payload size in bytes of a single message.
+#define SOCKET_MAX_PAYLOAD_LEN 1040
+
 typedef struct Socket Socket;
 
 /// When sending a message, this is the recipient HLApp's component ID.
@@ -44,6 +50,26 @@ typedef struct {
     uint8_t  seg_3_4[8];
 } Component_Id;
 
+/// A view of a message payload inside one of the shared ring buffers.
+/// When the payload wraps around the end of the ring it is split into two
+/// segments, otherwise size[1] is zero.
+typedef struct {
+    uint8_t  *seg[2];
+    uint32_t  size[2];
+} Socket_Buffer;
+
+/// A received message, as returned by Socket_ReadBatch.
+typedef struct {
+    Component_Id  sender;
+    Socket_Buffer buffer;
+} Socket_Msg;
+
+/// A single message payload for Socket_WriteV.
+typedef struct {
+    const void *data;
+    uint32_t    size;
+} Socket_IOVec;
+
 Socket* Socket_Open(void (*rx_cb)(Socket*));
 int32_t Socket_Close(Socket *socket);
 
@@ -63,6 +89,67 @@ int32_t Socket_Read(
     void         *data,
     uint32_t     *size);
 
+/// Zero-copy write. Socket_WriteReserve hands out space for a payload of up to
+/// size bytes directly in the local ring buffer; the message becomes visible to
+/// the HLApp once Socket_WriteCommit is called with the number of bytes
+/// actually written. Reserving again before committing discards the previous
+/// reservation.
+int32_t Socket_WriteReserve(
+    Socket        *socket,
+    uint32_t       size,
+    Socket_Buffer *buffer);
+int32_t Socket_WriteCommit(
+    Socket             *socket,
+    const Component_Id *recipient,
+    uint32_t            size);
+
+/// Payload space in bytes which is free for the next message in the local
+/// ring, or zero if the ring is full. A single message is still limited to
+/// SOCKET_MAX_PAYLOAD_LEN.
+uint32_t Socket_WriteSpace(Socket *socket);
+
+/// Zero-copy read. Socket_ReadPeek returns a view of the payload of the next
+/// message directly in the remote ring buffer; it stays valid until
+/// Socket_ReadRelease hands the space back to the HLApp.
+int32_t Socket_ReadPeek(
+    Socket        *socket,
+    Component_Id  *sender,
+    Socket_Buffer *buffer);
+int32_t Socket_ReadRelease(Socket *socket);
+
+/// Drains up to *count messages which are already available into msgs
+/// without copying, updating *count with the number returned. They are all
+/// handed back to the HLApp with a single Socket_ReadRelease.
+int32_t Socket_ReadBatch(
+    Socket     *socket,
+    Socket_Msg *msgs,
+    uint32_t   *count);
+
+/// Reads fail with ERROR_SOCKET_EMPTY once there's nothing left to read. Any
+/// other failure means the next block is malformed, and as it can't be
+/// stepped over on its own, Socket_ReadDiscard drops everything received so
+/// far instead, so the same block isn't read again.
+int32_t Socket_ReadDiscard(Socket *socket);
+
+/// Suppresses or restores calls to rx_cb. Muting notifications while
+/// draining with Socket_ReadBatch avoids a callback per message under
+/// sustained traffic; unmuting calls rx_cb if anything is still pending.
+void Socket_SetRxNotify(Socket *socket, bool enable);
+
+/// Batched write. Between Socket_WriteBegin and Socket_WriteFlush, messages
+/// written with Socket_Write or Socket_WriteCommit are queued in the ring but
+/// only published to the HLApp, with a single mailbox interrupt, on flush.
+int32_t Socket_WriteBegin(Socket *socket);
+int32_t Socket_WriteFlush(Socket *socket);
+
+/// Writes count messages to recipient as one batch. Either every message is
+/// published or, if they don't all fit, none are.
+int32_t Socket_WriteV(
+    Socket             *socket,
+    const Component_Id *recipient,
+    const Socket_IOVec *iov,
+    uint32_t            count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,336 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stddef.h>
+
+#include "SocketChannel.h"
+
+// Number of messages drained per Socket_ReadBatch.
+#define SOCKET_CHANNEL_RX_BATCH 8
+
+struct SocketChannel {
+    Socket                   *socket;
+    Component_Id              partner;
+    uint8_t                   priority;
+    SocketChannel_RxCallback  rx_cb;
+
+    // Transmit queue, a byte ring of messages each preceded by its size.
+    uint8_t                  *txQueue;
+    uint32_t                  txQueueSize;
+    uint32_t                  txHead;
+    uint32_t                  txTail;
+    uint32_t                  txUsed;
+};
+
+static SocketChannel SocketChannel_Handles[SOCKET_CHANNEL_MAX] = {0};
+
+static bool SocketChannel__Id_Equal(const Component_Id *a, const Component_Id *b)
+{
+    return (__builtin_memcmp(a, b, sizeof(Component_Id)) == 0);
+}
+
+// Fills order with the channels open on socket, highest priority first,
+// and returns how many there are. Channels of equal priority stay in
+// handle order.
+static unsigned SocketChannel__By_Priority(
+    const Socket *socket, SocketChannel *order[SOCKET_CHANNEL_MAX])
+{
+    unsigned count = 0;
+    for (unsigned h = 0; h < SOCKET_CHANNEL_MAX; h++) {
+        SocketChannel *channel = &SocketChannel_Handles[h];
+        if (channel->socket != socket) {
+            continue;
+        }
+
+        unsigned j = count++;
+        for (; (j > 0) && (order[j - 1]->priority < channel->priority); j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = channel;
+    }
+    return count;
+}
+
+static SocketChannel *SocketChannel__Find(const Socket *socket, const Component_Id *partner)
+{
+    for (unsigned h = 0; h < SOCKET_CHANNEL_MAX; h++) {
+        SocketChannel *channel = &SocketChannel_Handles[h];
+        if ((channel->socket == socket) &&
+            SocketChannel__Id_Equal(&(channel->partner), partner)) {
+            return channel;
+        }
+    }
+    return NULL;
+}
+
+// Headroom this channel must leave in the ring for higher priority ones.
+static uint32_t SocketChannel__Headroom(const SocketChannel *channel)
+{
+    for (unsigned h = 0; h < SOCKET_CHANNEL_MAX; h++) {
+        const SocketChannel *other = &SocketChannel_Handles[h];
+        if ((other->socket == channel->socket) &&
+            (other->priority > channel->priority)) {
+            return SOCKET_CHANNEL_HEADROOM;
+        }
+    }
+    return 0;
+}
+
+// Whether a higher priority channel is waiting to send, in which case this
+// one must not take the space it's waiting for.
+static bool SocketChannel__Blocked(const SocketChannel *channel)
+{
+    for (unsigned h = 0; h < SOCKET_CHANNEL_MAX; h++) {
+        const SocketChannel *other = &SocketChannel_Handles[h];
+        if ((other->socket == channel->socket) &&
+            (other->priority > channel->priority) &&
+            (other->txUsed != 0)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool SocketChannel__Fits(const SocketChannel *channel, uint32_t size)
+{
+    return (Socket_WriteSpace(channel->socket) >=
+        (size + SocketChannel__Headroom(channel)));
+}
+
+// Copies into the transmit queue at pos, wrapping around its end.
+// Returns the position following the data.
+static uint32_t SocketChannel__Queue_In(
+    SocketChannel *channel, uint32_t pos, const void *src, uint32_t size)
+{
+    const uint8_t *src8 = (const uint8_t *)src;
+
+    uint32_t head = channel->txQueueSize - pos;
+    if (head > size) {
+        head = size;
+    }
+    __builtin_memcpy(&(channel->txQueue[pos]), src8, head);
+    __builtin_memcpy(channel->txQueue, src8 + head, size - head);
+
+    pos += size;
+    if (pos >= channel->txQueueSize) {
+        pos -= channel->txQueueSize;
+    }
+    return pos;
+}
+
+// Copies out of the transmit queue at pos, wrapping around its end.
+// Returns the position following the data.
+static uint32_t SocketChannel__Queue_Out(
+    const SocketChannel *channel, uint32_t pos, void *dest, uint32_t size)
+{
+    uint8_t *dest8 = (uint8_t *)dest;
+
+    uint32_t head = channel->txQueueSize - pos;
+    if (head > size) {
+        head = size;
+    }
+    __builtin_memcpy(dest8, &(channel->txQueue[pos]), head);
+    __builtin_memcpy(dest8 + head, channel->txQueue, size - head);
+
+    pos += size;
+    if (pos >= channel->txQueueSize) {
+        pos -= channel->txQueueSize;
+    }
+    return pos;
+}
+
+// Moves queued messages into the ring for as long as they fit.
+static int32_t SocketChannel__Send_Queued(SocketChannel *channel)
+{
+    while (channel->txUsed != 0) {
+        uint32_t size;
+        uint32_t pos = SocketChannel__Queue_Out(
+            channel, channel->txTail, &size, sizeof(size));
+
+        if (!SocketChannel__Fits(channel, size)) {
+            return ERROR_SOCKET_INSUFFICIENT_SPACE;
+        }
+
+        Socket_Buffer buffer;
+        int32_t error = Socket_WriteReserve(channel->socket, size, &buffer);
+        if (error != ERROR_NONE) {
+            return error;
+        }
+
+        pos = SocketChannel__Queue_Out(channel, pos, buffer.seg[0], buffer.size[0]);
+        pos = SocketChannel__Queue_Out(channel, pos, buffer.seg[1], buffer.size[1]);
+
+        error = Socket_WriteCommit(channel->socket, &(channel->partner), size);
+        if (error != ERROR_NONE) {
+            return error;
+        }
+
+        channel->txTail  = pos;
+        channel->txUsed -= SOCKET_CHANNEL_QUEUE_SIZE(size);
+    }
+
+    return ERROR_NONE;
+}
+
+SocketChannel *SocketChannel_Open(
+    Socket                   *socket,
+    const Component_Id       *partner,
+    uint8_t                   priority,
+    void                     *txQueue,
+    uint32_t                  txQueueSize,
+    SocketChannel_RxCallback  rx_cb)
+{
+    if (!socket || !partner || !rx_cb) {
+        return NULL;
+    }
+
+    // Each partner can only be routed to one channel.
+    if (SocketChannel__Find(socket, partner)) {
+        return NULL;
+    }
+
+    SocketChannel *channel = NULL;
+    for (unsigned h = 0; h < SOCKET_CHANNEL_MAX; h++) {
+        if (!SocketChannel_Handles[h].socket) {
+            channel = &SocketChannel_Handles[h];
+            break;
+        }
+    }
+    if (!channel) {
+        return NULL;
+    }
+
+    *channel = (SocketChannel){
+        .socket      = socket,
+        .partner     = *partner,
+        .priority    = priority,
+        .rx_cb       = rx_cb,
+        .txQueue     = (uint8_t *)txQueue,
+        .txQueueSize = (txQueue ? txQueueSize : 0),
+    };
+
+    return channel;
+}
+
+void SocketChannel_Close(SocketChannel *channel)
+{
+    if (!channel) {
+        return;
+    }
+
+    channel->socket = NULL;
+    channel->txUsed = 0;
+}
+
+int32_t SocketChannel_Write(
+    SocketChannel *channel,
+    const void    *data,
+    uint32_t       size)
+{
+    if (!channel || !channel->socket || !data ||
+        (size == 0) || (size > SOCKET_MAX_PAYLOAD_LEN)) {
+        return ERROR_PARAMETER;
+    }
+
+    // Write straight to the ring unless that would overtake a message which
+    // is already waiting.
+    if ((channel->txUsed == 0) &&
+        !SocketChannel__Blocked(channel) &&
+        SocketChannel__Fits(channel, size)) {
+        int32_t error = Socket_Write(channel->socket, &(channel->partner), data, size);
+        if (error != ERROR_SOCKET_INSUFFICIENT_SPACE) {
+            return error;
+        }
+    }
+
+    if (SOCKET_CHANNEL_QUEUE_SIZE(size) > (channel->txQueueSize - channel->txUsed)) {
+        return ERROR_SOCKET_CHANNEL_QUEUE_FULL;
+    }
+
+    uint32_t pos = SocketChannel__Queue_In(channel, channel->txHead, &size, sizeof(size));
+    channel->txHead  = SocketChannel__Queue_In(channel, pos, data, size);
+    channel->txUsed += SOCKET_CHANNEL_QUEUE_SIZE(size);
+
+    return ERROR_NONE;
+}
+
+bool SocketChannel_WritePending(const SocketChannel *channel)
+{
+    return (channel && channel->socket && (channel->txUsed != 0));
+}
+
+int32_t SocketChannel_Flush(Socket *socket)
+{
+    if (!socket) {
+        return ERROR_PARAMETER;
+    }
+
+    SocketChannel *order[SOCKET_CHANNEL_MAX];
+    unsigned count = SocketChannel__By_Priority(socket, order);
+
+    // Everything which fits is published with a single doorbell.
+    int32_t error = Socket_WriteBegin(socket);
+    if (error != ERROR_NONE) {
+        return error;
+    }
+
+    for (unsigned i = 0; i < count; i++) {
+        error = SocketChannel__Send_Queued(order[i]);
+        // Lower priority channels wait until this one has caught up.
+        if ((error != ERROR_NONE) || (order[i]->txUsed != 0)) {
+            break;
+        }
+    }
+
+    Socket_WriteFlush(socket);
+
+    // A full ring isn't an error, the remaining messages go out on the
+    // next flush.
+    if (error == ERROR_SOCKET_INSUFFICIENT_SPACE) {
+        error = ERROR_NONE;
+    }
+
+    return error;
+}
+
+int32_t SocketChannel_Read(Socket *socket)
+{
+    if (!socket) {
+        return ERROR_PARAMETER;
+    }
+
+    SocketChannel *order[SOCKET_CHANNEL_MAX];
+    unsigned channels = SocketChannel__By_Priority(socket, order);
+
+    for (;;) {
+        Socket_Msg msgs[SOCKET_CHANNEL_RX_BATCH];
+        uint32_t   count = SOCKET_CHANNEL_RX_BATCH;
+
+        int32_t error = Socket_ReadBatch(socket, msgs, &count);
+        if (error == ERROR_SOCKET_EMPTY) {
+            break;
+        }
+        if (error != ERROR_NONE) {
+            // A bad block can't be stepped over, so it's dropped along with
+            // everything after it.
+            int32_t discardError = Socket_ReadDiscard(socket);
+            return (discardError != ERROR_NONE ? discardError : error);
+        }
+
+        // Hand out the whole batch one channel at a time, so high priority
+        // messages don't wait for the handling of bulk data ahead of them.
+        for (unsigned c = 0; c < channels; c++) {
+            SocketChannel *channel = order[c];
+            for (uint32_t i = 0; i < count; i++) {
+                if (channel->socket &&
+                    SocketChannel__Id_Equal(&(msgs[i].sender), &(channel->partner))) {
+                    channel->rx_cb(channel, &(msgs[i].buffer));
+                }
+            }
+        }
+
+        Socket_ReadRelease(socket);
+    }
+
+    return ERROR_NONE;
+}
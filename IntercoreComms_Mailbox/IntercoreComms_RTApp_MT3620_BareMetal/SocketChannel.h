@@ -0,0 +1,93 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef AZURE_SPHERE_SOCKET_CHANNEL_H_
+#define AZURE_SPHERE_SOCKET_CHANNEL_H_
+
+#include "Socket.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// This interface multiplexes several logical channels over the single
+// Socket, one per partner HLApp, each with its own priority and receive
+// callback. The wire format is unchanged, a channel is identified by the
+// partner's Component_Id.
+//
+// Channels of a lower priority never fill the local ring beyond
+// SOCKET_CHANNEL_HEADROOM bytes of free space while a higher priority
+// channel is open, so a high priority message can always be written
+// straight away rather than queueing behind bulk data. Messages which
+// can't be written yet are held in the channel's own transmit queue and
+// sent, highest priority first, by SocketChannel_Flush.
+//
+// On receive, each batch drained from the ring is dispatched to the
+// channels highest priority first.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Returned when a message can't be written yet and there is no room for it
+/// in the channel's transmit queue.
+#define ERROR_SOCKET_CHANNEL_QUEUE_FULL (ERROR_SPECIFIC - 4)
+
+/// Maximum number of channels open at once.
+#define SOCKET_CHANNEL_MAX 4
+
+/// Free payload space in bytes which lower priority channels leave in the
+/// local ring for higher priority ones.
+#define SOCKET_CHANNEL_HEADROOM 256
+
+/// Suggested priorities, higher values are serviced first.
+#define SOCKET_CHANNEL_PRIORITY_BULK    0
+#define SOCKET_CHANNEL_PRIORITY_CONTROL 1
+
+/// Bytes of transmit queue used by a queued message of size bytes.
+#define SOCKET_CHANNEL_QUEUE_SIZE(size) (sizeof(uint32_t) + (size))
+
+typedef struct SocketChannel SocketChannel;
+
+/// Called for every message received from the channel's partner, buffer
+/// points into the shared ring and is only valid during the call.
+typedef void (*SocketChannel_RxCallback)(
+    SocketChannel       *channel,
+    const Socket_Buffer *buffer);
+
+/// Opens a channel to partner on an open socket. txQueue holds messages
+/// which can't be written to the ring yet and may be NULL, in which case
+/// SocketChannel_Write fails rather than queueing.
+SocketChannel *SocketChannel_Open(
+    Socket                   *socket,
+    const Component_Id       *partner,
+    uint8_t                   priority,
+    void                     *txQueue,
+    uint32_t                  txQueueSize,
+    SocketChannel_RxCallback  rx_cb);
+/// Any messages still queued are discarded.
+void SocketChannel_Close(SocketChannel *channel);
+
+/// Writes a message to the channel's partner, or queues it if it can't be
+/// written yet.
+int32_t SocketChannel_Write(
+    SocketChannel *channel,
+    const void    *data,
+    uint32_t       size);
+/// Whether any messages are waiting in the channel's transmit queue.
+bool SocketChannel_WritePending(const SocketChannel *channel);
+
+/// Writes as many queued messages as fit, highest priority first, with a
+/// single mailbox interrupt. Call whenever the HLApp may have freed space.
+int32_t SocketChannel_Flush(Socket *socket);
+
+/// Drains all received messages, dispatching them to their channels.
+/// Messages from partners without an open channel are discarded. A
+/// malformed block is discarded along with everything after it, and its
+/// error returned.
+int32_t SocketChannel_Read(Socket *socket);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef AZURE_SPHERE_SOCKET_CHANNEL_H_
@@ -0,0 +1,320 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stddef.h>
+
+#include "SocketStream.h"
+
+#define SOCKET_STREAM_HANDLE_MAX 1
+
+// Number of fragments drained per Socket_ReadBatch.
+#define SOCKET_STREAM_RX_BATCH 8
+
+struct SocketStream {
+    Socket                  *socket;
+
+    // Message currently being sent.
+    Component_Id             txRecipient;
+    const uint8_t           *txData;
+    uint32_t                 txSize;
+    uint32_t                 txOffset;
+    uint16_t                 txSeq;
+
+    // Message currently being reassembled.
+    SocketStream_RxCallback  rx_cb;
+    uint8_t                 *rxBuffer;
+    uint32_t                 rxBufferSize;
+    Component_Id             rxSender;
+    uint32_t                 rxSize;
+    uint32_t                 rxOffset;
+    bool                     rxActive;
+    bool                     rxSeqValid;
+    uint16_t                 rxSeq;
+};
+
+static SocketStream SocketStream_Handles[SOCKET_STREAM_HANDLE_MAX] = {0};
+
+// Copies into a ring buffer view at offset, following it across the wrap.
+static void SocketStream__Copy_To(
+    const Socket_Buffer *buffer, uint32_t offset, const void *src, uint32_t size)
+{
+    const uint8_t *src8 = (const uint8_t *)src;
+
+    if (offset < buffer->size[0]) {
+        uint32_t head = buffer->size[0] - offset;
+        if (head > size) {
+            head = size;
+        }
+        __builtin_memcpy(&(buffer->seg[0][offset]), src8, head);
+        src8   += head;
+        size   -= head;
+        offset  = 0;
+    } else {
+        offset -= buffer->size[0];
+    }
+
+    __builtin_memcpy(&(buffer->seg[1][offset]), src8, size);
+}
+
+// Copies out of a ring buffer view at offset, following it across the wrap.
+static void SocketStream__Copy_From(
+    const Socket_Buffer *buffer, uint32_t offset, void *dest, uint32_t size)
+{
+    uint8_t *dest8 = (uint8_t *)dest;
+
+    if (offset < buffer->size[0]) {
+        uint32_t head = buffer->size[0] - offset;
+        if (head > size) {
+            head = size;
+        }
+        __builtin_memcpy(dest8, &(buffer->seg[0][offset]), head);
+        dest8  += head;
+        size   -= head;
+        offset  = 0;
+    } else {
+        offset -= buffer->size[0];
+    }
+
+    __builtin_memcpy(dest8, &(buffer->seg[1][offset]), size);
+}
+
+SocketStream *SocketStream_Open(
+    Socket                  *socket,
+    void                    *rxBuffer,
+    uint32_t                 rxBufferSize,
+    SocketStream_RxCallback  rx_cb)
+{
+    if (!socket || !rxBuffer || (rxBufferSize == 0) || !rx_cb) {
+        return NULL;
+    }
+
+    SocketStream *stream = NULL;
+    for (unsigned h = 0; h < SOCKET_STREAM_HANDLE_MAX; h++) {
+        if (!SocketStream_Handles[h].socket) {
+            stream = &SocketStream_Handles[h];
+            break;
+        }
+    }
+    if (!stream) {
+        return NULL;
+    }
+
+    *stream = (SocketStream){
+        .socket       = socket,
+        .rx_cb        = rx_cb,
+        .rxBuffer     = (uint8_t *)rxBuffer,
+        .rxBufferSize = rxBufferSize,
+    };
+
+    return stream;
+}
+
+void SocketStream_Close(SocketStream *stream)
+{
+    if (!stream) {
+        return;
+    }
+
+    stream->socket = NULL;
+}
+
+int32_t SocketStream_Write(
+    SocketStream       *stream,
+    const Component_Id *recipient,
+    const void         *data,
+    uint32_t            size)
+{
+    if (!stream || !recipient || !data || (size == 0)) {
+        return ERROR_PARAMETER;
+    }
+
+    if (stream->txData) {
+        return ERROR_BUSY;
+    }
+
+    stream->txRecipient = *recipient;
+    stream->txData      = (const uint8_t *)data;
+    stream->txSize      = size;
+    stream->txOffset    = 0;
+
+    return SocketStream_Flush(stream);
+}
+
+int32_t SocketStream_Flush(SocketStream *stream)
+{
+    if (!stream) {
+        return ERROR_PARAMETER;
+    }
+
+    if (!stream->txData) {
+        return ERROR_NONE;
+    }
+
+    // Every fragment which fits is published with a single doorbell.
+    int32_t error = Socket_WriteBegin(stream->socket);
+    if (error != ERROR_NONE) {
+        return error;
+    }
+
+    while (stream->txOffset < stream->txSize) {
+        uint32_t len = stream->txSize - stream->txOffset;
+        if (len > SOCKET_STREAM_FRAGMENT_LEN) {
+            len = SOCKET_STREAM_FRAGMENT_LEN;
+        }
+
+        Socket_Buffer buffer;
+        error = Socket_WriteReserve(
+            stream->socket, sizeof(SocketStream_Header) + len, &buffer);
+        if (error != ERROR_NONE) {
+            break;
+        }
+
+        SocketStream_Header header = {
+            .seq   = stream->txSeq,
+            .flags = 0,
+            .size  = stream->txSize,
+        };
+        if (stream->txOffset == 0) {
+            header.flags |= SOCKET_STREAM_FLAG_FIRST;
+        }
+        if ((stream->txOffset + len) == stream->txSize) {
+            header.flags |= SOCKET_STREAM_FLAG_LAST;
+        }
+
+        // Serialize straight into the ring, the payload is only copied once.
+        SocketStream__Copy_To(&buffer, 0, &header, sizeof(header));
+        SocketStream__Copy_To(&buffer, sizeof(header),
+            &(stream->txData[stream->txOffset]), len);
+
+        error = Socket_WriteCommit(
+            stream->socket, &(stream->txRecipient), sizeof(header) + len);
+        if (error != ERROR_NONE) {
+            break;
+        }
+
+        stream->txSeq++;
+        stream->txOffset += len;
+    }
+
+    Socket_WriteFlush(stream->socket);
+
+    if (stream->txOffset == stream->txSize) {
+        stream->txData = NULL;
+    }
+
+    // A full ring isn't an error, the remaining fragments go out on the
+    // next flush.
+    if (error == ERROR_SOCKET_INSUFFICIENT_SPACE) {
+        error = ERROR_NONE;
+    }
+
+    return error;
+}
+
+bool SocketStream_WritePending(const SocketStream *stream)
+{
+    return (stream && stream->txData);
+}
+
+// Handles a single received fragment, returns ERROR_NONE or
+// ERROR_SOCKET_STREAM_SEQUENCE if a message had to be dropped.
+static int32_t SocketStream__Rx_Fragment(SocketStream *stream, const Socket_Msg *msg)
+{
+    uint32_t fragmentSize = msg->buffer.size[0] + msg->buffer.size[1];
+    if (fragmentSize < sizeof(SocketStream_Header)) {
+        stream->rxActive = false;
+        return ERROR_SOCKET_STREAM_SEQUENCE;
+    }
+
+    SocketStream_Header header;
+    SocketStream__Copy_From(&(msg->buffer), 0, &header, sizeof(header));
+
+    int32_t error = ERROR_NONE;
+
+    // A gap in the sequence means a fragment of the current message is lost.
+    if (stream->rxSeqValid && (header.seq != stream->rxSeq)) {
+        if (stream->rxActive) {
+            error = ERROR_SOCKET_STREAM_SEQUENCE;
+        }
+        stream->rxActive = false;
+    }
+    stream->rxSeq      = header.seq + 1;
+    stream->rxSeqValid = true;
+
+    if (header.flags & SOCKET_STREAM_FLAG_FIRST) {
+        if (stream->rxActive) {
+            error = ERROR_SOCKET_STREAM_SEQUENCE;
+        }
+
+        stream->rxSender = msg->sender;
+        stream->rxSize   = header.size;
+        stream->rxOffset = 0;
+        stream->rxActive = (header.size <= stream->rxBufferSize);
+        if (!stream->rxActive) {
+            error = ERROR_SOCKET_INSUFFICIENT_SPACE;
+        }
+    }
+
+    // Skip the remainder of any message we've already given up on.
+    if (!stream->rxActive) {
+        return error;
+    }
+
+    uint32_t len = fragmentSize - sizeof(header);
+    if ((header.size != stream->rxSize) ||
+        (len > (stream->rxSize - stream->rxOffset))) {
+        stream->rxActive = false;
+        return ERROR_SOCKET_STREAM_SEQUENCE;
+    }
+
+    SocketStream__Copy_From(&(msg->buffer), sizeof(header),
+        &(stream->rxBuffer[stream->rxOffset]), len);
+    stream->rxOffset += len;
+
+    if (header.flags & SOCKET_STREAM_FLAG_LAST) {
+        stream->rxActive = false;
+        if (stream->rxOffset != stream->rxSize) {
+            return ERROR_SOCKET_STREAM_SEQUENCE;
+        }
+        stream->rx_cb(stream, &(stream->rxSender), stream->rxBuffer, stream->rxSize);
+    }
+
+    return error;
+}
+
+int32_t SocketStream_Read(SocketStream *stream)
+{
+    if (!stream) {
+        return ERROR_PARAMETER;
+    }
+
+    int32_t error = ERROR_NONE;
+
+    for (;;) {
+        Socket_Msg msgs[SOCKET_STREAM_RX_BATCH];
+        uint32_t   count = SOCKET_STREAM_RX_BATCH;
+
+        int32_t readError = Socket_ReadBatch(stream->socket, msgs, &count);
+        if (readError == ERROR_SOCKET_EMPTY) {
+            break;
+        }
+        if (readError != ERROR_NONE) {
+            // A bad block can't be stepped over, so it's dropped along with
+            // everything after it, and any message it was part of.
+            stream->rxActive = false;
+            int32_t discardError = Socket_ReadDiscard(stream->socket);
+            return (discardError != ERROR_NONE ? discardError : readError);
+        }
+
+        for (uint32_t i = 0; i < count; i++) {
+            int32_t fragError = SocketStream__Rx_Fragment(stream, &msgs[i]);
+            if (fragError != ERROR_NONE) {
+                error = fragError;
+            }
+        }
+
+        Socket_ReadRelease(stream->socket);
+    }
+
+    return error;
+}
@@ -0,0 +1,87 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef AZURE_SPHERE_SOCKET_STREAM_H_
+#define AZURE_SPHERE_SOCKET_STREAM_H_
+
+#include "Socket.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// This interface sends and receives messages of arbitrary size over a Socket
+// by splitting them into fragments of at most SOCKET_MAX_PAYLOAD_LEN bytes.
+// Each fragment carries a SocketStream_Header, the matching implementation
+// for the high-level app is intercore_stream.c in IntercoreComms_HighLevelApp.
+//
+// Fragments are written as long as there is space in the ring, so a large
+// message keeps the ring full rather than waiting for each fragment to be
+// read. Only one message is reassembled at a time, so messages from
+// different senders must not be interleaved.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Returned when a fragment is missing, out of sequence or malformed.
+#define ERROR_SOCKET_STREAM_SEQUENCE (ERROR_SPECIFIC - 3)
+
+/// Set on the first fragment of a message.
+#define SOCKET_STREAM_FLAG_FIRST 0x0001
+/// Set on the last fragment of a message.
+#define SOCKET_STREAM_FLAG_LAST  0x0002
+
+/// Prepended to the payload of every fragment.
+typedef struct __attribute__((__packed__)) {
+    /// Fragment sequence number, incremented for every fragment sent.
+    uint16_t seq;
+    uint16_t flags;
+    /// Size of the whole message in bytes.
+    uint32_t size;
+} SocketStream_Header;
+
+/// Largest amount of message data carried by a single fragment.
+#define SOCKET_STREAM_FRAGMENT_LEN \
+    (SOCKET_MAX_PAYLOAD_LEN - sizeof(SocketStream_Header))
+
+typedef struct SocketStream SocketStream;
+
+/// Called for every fully reassembled message, data points into the
+/// buffer passed to SocketStream_Open.
+typedef void (*SocketStream_RxCallback)(
+    SocketStream       *stream,
+    const Component_Id *sender,
+    void               *data,
+    uint32_t            size);
+
+/// Wraps an open socket, messages are reassembled into rxBuffer which
+/// limits the largest message that can be received.
+SocketStream *SocketStream_Open(
+    Socket                  *socket,
+    void                    *rxBuffer,
+    uint32_t                 rxBufferSize,
+    SocketStream_RxCallback  rx_cb);
+void SocketStream_Close(SocketStream *stream);
+
+/// Starts sending a message, writing as many fragments as currently fit.
+/// The data must stay valid until SocketStream_WritePending returns false.
+int32_t SocketStream_Write(
+    SocketStream       *stream,
+    const Component_Id *recipient,
+    const void         *data,
+    uint32_t            size);
+/// Writes as many outstanding fragments as fit, call whenever the HLApp
+/// may have freed space in the ring.
+int32_t SocketStream_Flush(SocketStream *stream);
+bool    SocketStream_WritePending(const SocketStream *stream);
+
+/// Drains all received fragments, calling rx_cb for each message completed.
+/// A malformed block is discarded along with everything after it, and its
+/// error returned.
+int32_t SocketStream_Read(SocketStream *stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef AZURE_SPHERE_SOCKET_STREAM_H_
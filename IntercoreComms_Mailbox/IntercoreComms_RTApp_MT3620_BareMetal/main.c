@@ -28,10 +28,19 @@
 #include "lib/GPT.h"
 
 #include "Socket.h"
+#include "Profile.h"
+#ifdef INTERCORE_BENCHMARK
+#include "Benchmark.h"
+#else
+#include "SocketChannel.h"
+#endif
 
 #define NUM_BUTTONS    2
 #define COUNTDOWN_INIT 5
 
+// Room to queue a few of the messages the sample sends while the ring is full.
+#define CHANNEL_QUEUE_SIZE (SOCKET_CHANNEL_QUEUE_SIZE(16) * 4)
+
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 
 typedef enum {
@@ -45,6 +54,11 @@ static UART   *debug              = NULL;
 static GPT    *timer[TIMER_COUNT] = {NULL};
 
 static Socket *socket             = NULL;
+#ifndef INTERCORE_BENCHMARK
+// The HLApp is the only partner, so it has the socket's one channel.
+static SocketChannel *channel     = NULL;
+static uint32_t channelQueue[CHANNEL_QUEUE_SIZE / 4];
+#endif
 
 static unsigned gpioOut[2] = {0, 1};
 
@@ -60,6 +74,14 @@ typedef struct CallbackNode {
 
 static void EnqueueCallback(CallbackNode *node);
 
+static const Component_Id A7ID =
+{
+    .seg_0   = 0x25025d2c,
+    .seg_1   = 0x66da,
+    .seg_2   = 0x4448,
+    .seg_3_4 = {0xba, 0xe1, 0xac, 0x26, 0xfc, 0xdd, 0x36, 0x27}
+};
+
 // Msg callbacks
 // Prints an array of bytes
 static void printBytes(const uint8_t *bytes, uintptr_t start, uintptr_t size)
@@ -81,13 +103,12 @@ static void printComponentId(const Component_Id *compId)
 
 static void handleSendMsgTimer(void* data)
 {
-    static const Component_Id A7ID =
-    {
-        .seg_0   = 0x25025d2c,
-        .seg_1   = 0x66da,
-        .seg_2   = 0x4448,
-        .seg_3_4 = {0xba, 0xe1, 0xac, 0x26, 0xfc, 0xdd, 0x36, 0x27}
-    };
+#ifdef INTERCORE_BENCHMARK
+    // Retry anything which didn't fit in the ring last time round.
+    Benchmark_Poll();
+#else
+    // Send anything still queued from last time first.
+    SocketChannel_Flush(socket);
 
     static char msg[]    = "count-00";
     static char reboot[] = "reboot!!";
@@ -100,12 +121,13 @@ static void handleSendMsgTimer(void* data)
     int32_t error = ERROR_NONE;
     if (countdown == 0) {
         UART_Printf(debug, "sending msg %s\r\n", reboot);
-        error = Socket_Write(socket, &A7ID, reboot, rebootLen);
+        error = SocketChannel_Write(channel, reboot, rebootLen);
         countdown = COUNTDOWN_INIT;
+        PROFILE_PRINT(debug, true);
     }
     else {
         UART_Printf(debug, "sending msg %s\r\n", msg);
-        error = Socket_Write(socket, &A7ID, msg, msgLen);
+        error = SocketChannel_Write(channel, msg, msgLen);
         /* Simulate reboot */
         Socket_Reset(socket);
     }
@@ -113,6 +135,7 @@ static void handleSendMsgTimer(void* data)
     if (error != ERROR_NONE) {
         UART_Printf(debug, "ERROR: sending msg %s - %ld\r\n", msg, error);
     }
+#endif
 }
 
 static void handleSendMsgTimerWrapper(GPT *timer)
@@ -123,13 +146,36 @@ static void handleSendMsgTimerWrapper(GPT *timer)
     EnqueueCallback(&cbn);
 }
 
-static void handleRecvMsg(void *handle)
+#ifndef INTERCORE_BENCHMARK
+static void printMsg(SocketChannel *rxChannel, const Socket_Buffer *buffer)
 {
-    Socket *socket = (Socket*)handle;
+    (void)rxChannel;
 
-    Component_Id senderId;
     static char msg[32];
-    uint32_t msg_size = sizeof(msg);
+
+    // Truncate to what we print.
+    uint32_t msg_size = buffer->size[0] + buffer->size[1];
+    if (msg_size >= sizeof(msg)) {
+        msg_size = sizeof(msg) - 1;
+    }
+
+    uint32_t head = buffer->size[0];
+    if (head > msg_size) {
+        head = msg_size;
+    }
+    __builtin_memcpy(msg, buffer->seg[0], head);
+    __builtin_memcpy(&msg[head], buffer->seg[1], msg_size - head);
+
+    // Only the HLApp's channel is open, so it's the sender.
+    msg[msg_size] = '\0';
+    UART_Printf(debug, "Message received: %s\r\nSender: ", msg);
+    printComponentId(&A7ID);
+}
+#endif
+
+static void handleRecvMsg(void *handle)
+{
+    Socket *socket = (Socket*)handle;
 
     if (Socket_NegotiationPending(socket)) {
         UART_Printf(debug, "Negotiation pending, attempting renegotiation\n");
@@ -140,15 +186,23 @@ static void handleRecvMsg(void *handle)
         }
     }
 
-    int32_t error = Socket_Read(socket, &senderId, msg, &msg_size);
-
+#ifdef INTERCORE_BENCHMARK
+    Benchmark_Recv();
+#else
+    // Drain everything which has arrived so far to the channel, and hand it
+    // back in one go. A bad block is dropped along with everything after it,
+    // as otherwise it would be read again straight away.
+    int32_t error = SocketChannel_Read(socket);
     if (error != ERROR_NONE) {
-        UART_Printf(debug, "ERROR: receiving msg %s - %ld\r\n", msg, error);
+        UART_Printf(debug, "ERROR: receiving msg - %ld, dropped received data\r\n", error);
     }
 
-    msg[msg_size] = '\0';
-    UART_Printf(debug, "Message received: %s\r\nSender: ", msg);
-    printComponentId(&senderId);
+    // The HLApp may have made room for anything still queued.
+    SocketChannel_Flush(socket);
+#endif
+
+    // This re-enqueues us if more messages are waiting.
+    Socket_SetRxNotify(socket, true);
 }
 
 static void handleRecvMsgWrapper(Socket *handle)
@@ -159,6 +213,8 @@ static void handleRecvMsgWrapper(Socket *handle)
         cbn.data = handle;
     }
 
+    // No need to be told about further messages until the drain has run.
+    Socket_SetRxNotify(handle, false);
     EnqueueCallback(&cbn);
 }
 
@@ -248,6 +304,7 @@ _Noreturn void RTCoreMain(void)
 {
     VectorTableInit();
     CPUFreq_Set(197600000);
+    PROFILE_INIT(NULL);
 
     debug = UART_Open(MT3620_UNIT_UART_DEBUG, 115200, UART_PARITY_NONE, 1, NULL);
     UART_Print(debug, "--------------------------------\r\n");
@@ -268,6 +325,13 @@ _Noreturn void RTCoreMain(void)
     if (!socket) {
         UART_Printf(debug, "ERROR: socket initialisation failed\r\n");
     }
+#ifndef INTERCORE_BENCHMARK
+    channel = SocketChannel_Open(socket, &A7ID, SOCKET_CHANNEL_PRIORITY_CONTROL,
+        channelQueue, sizeof(channelQueue), printMsg);
+    if (!channel) {
+        UART_Printf(debug, "ERROR: channel initialisation failed\r\n");
+    }
+#endif
 
     GPIO_ConfigurePinForInput(buttons[0].gpioPin);
     GPIO_ConfigurePinForInput(buttons[1].gpioPin);
@@ -285,12 +349,28 @@ _Noreturn void RTCoreMain(void)
         UART_Printf(debug, "ERROR: Button GPT_StartTimeout failed %ld\r\n", error);
     }
 
+#ifdef INTERCORE_BENCHMARK
+    // Free running microsecond clock for timestamping round trips.
+    GPT *benchClock = GPT_Open(MT3620_UNIT_GPT3, 1000000, GPT_MODE_NONE);
+    if (!benchClock || (GPT_Start_Freerun(benchClock) != ERROR_NONE)) {
+        UART_Printf(debug, "ERROR: Benchmark clock initialisation failed\r\n");
+    }
+    Benchmark_Init(socket, &A7ID, benchClock, debug);
+
+    // Poll quickly so a full ring doesn't stall the benchmark.
+    const uint32_t  sendPeriod      = 1;
+    const GPT_Units sendPeriodUnits = GPT_UNITS_MILLISEC;
+#else
+    const uint32_t  sendPeriod      = 1;
+    const GPT_Units sendPeriodUnits = GPT_UNITS_SECOND;
+#endif
+
     // Setup Msg out
     if ((error = GPT_SetMode(timer[TIMER_SEND_MSG], GPT_MODE_REPEAT)) != ERROR_NONE) {
         UART_Printf(debug, "ERROR: Msg GPT_SetMode failed %ld\r\n", error);
     }
     if ((error = GPT_StartTimeout(
-        timer[TIMER_SEND_MSG], 1, GPT_UNITS_SECOND,
+        timer[TIMER_SEND_MSG], sendPeriod, sendPeriodUnits,
         handleSendMsgTimerWrapper)) != ERROR_NONE) {
         UART_Printf(debug, "ERROR: Msg GPT_StartTimeout failed %ld\r\n", error);
     }
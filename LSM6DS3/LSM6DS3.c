@@ -0,0 +1,570 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "LSM6DS3.h"
+#include "Placement.h"
+#include <stddef.h>
+
+#define LSM6DS3_HANDLE_MAX 2
+
+// FIFO_MODE field of FIFO_CTRL5.
+#define LSM6DS3_FIFO_MODE_BYPASS     0x00
+#define LSM6DS3_FIFO_MODE_CONTINUOUS 0x06
+
+struct LSM6DS3 {
+    const LSM6DS3_Transport *transport;
+    void                    *context;
+
+    // Burst reads land here, as transfers of more than a few bytes must be in SYSRAM.
+    LSM6DS3_Data *buffer;
+
+    // Cached from CTRL1_XL and CTRL2_G whenever they're written.
+    int32_t scaleXL;
+    int32_t scaleG;
+};
+
+static LSM6DS3 LSM6DS3_Handles[LSM6DS3_HANDLE_MAX] = {0};
+static SYSRAM_DATA LSM6DS3_Data LSM6DS3_Buffer[LSM6DS3_HANDLE_MAX];
+
+
+static bool LSM6DS3_RegWrite(LSM6DS3 *handle, uint8_t addr, uint8_t value)
+{
+    const uint8_t cmd[] = { addr, value };
+    return handle->transport->write(handle->context, cmd, sizeof(cmd));
+}
+
+// Reads size consecutive registers from addr, relying on IF_INC.
+static bool LSM6DS3_RegReadBurst(LSM6DS3 *handle, uint8_t addr, void *value, uintptr_t size)
+{
+    return handle->transport->read(handle->context, addr, value, size);
+}
+
+// Writes size consecutive registers from addr, relying on IF_INC.
+static bool LSM6DS3_RegWriteBurst(LSM6DS3 *handle, uint8_t addr, const uint8_t *value, uintptr_t size)
+{
+    uint8_t *cmd = (uint8_t *)handle->buffer;
+    if (size >= sizeof(*handle->buffer)) {
+        return false;
+    }
+    cmd[0] = addr;
+    __builtin_memcpy(&cmd[1], value, size);
+    return handle->transport->write(handle->context, cmd, (size + 1));
+}
+
+static bool LSM6DS3_RegRead(LSM6DS3 *handle, uint8_t addr, uint8_t *value)
+{
+    uint8_t v;
+    bool status = LSM6DS3_RegReadBurst(handle, addr, &v, sizeof(v));
+    if (value) {
+        *value = v;
+    }
+    return status;
+}
+
+
+// Calculate fixed point fract for scale as between 0.061 and 0.488, applied as (raw * scale) >> 16.
+static int32_t LSM6DS3_ScaleXL(LSM6DS3_ctrl1_xl_t ctrl1_xl)
+{
+    static const uint8_t fs_xl_swiz[4] = { 0, 3, 1, 2 };
+    return (31982 >> (3 - fs_xl_swiz[ctrl1_xl.fs_xl]));
+}
+
+// Calculate fixed point fract for scale as between 4.375 and 70, applied as (raw * scale) >> 9.
+static int32_t LSM6DS3_ScaleG(LSM6DS3_ctrl2_g_t ctrl2_g)
+{
+    uint8_t fs_g = 0;
+    if (!ctrl2_g.fs_125) {
+        fs_g = (ctrl2_g.fs_g + 1);
+    }
+    return (35840 >> (4 - fs_g));
+}
+
+// Makes sure multiple byte reads walk through the registers and return a consistent sample.
+static bool LSM6DS3_SetupInterface(LSM6DS3 *handle)
+{
+    uint8_t ctrl3_c;
+    if (!LSM6DS3_RegRead(handle, LSM6DS3_REG_CTRL3_C, &ctrl3_c)) {
+        return false;
+    }
+
+    uint8_t setup = (ctrl3_c | LSM6DS3_CTRL3_C_IF_INC | LSM6DS3_CTRL3_C_BDU);
+    return ((setup == ctrl3_c) || LSM6DS3_RegWrite(handle, LSM6DS3_REG_CTRL3_C, setup));
+}
+
+// CTRL1_XL and CTRL2_G are adjacent, so are read together.
+static bool LSM6DS3_ReadScale(LSM6DS3 *handle)
+{
+    uint8_t ctrl[2];
+    if (!LSM6DS3_RegReadBurst(handle, LSM6DS3_REG_CTRL1_XL, handle->buffer, sizeof(ctrl))) {
+        return false;
+    }
+    __builtin_memcpy(ctrl, handle->buffer, sizeof(ctrl));
+
+    handle->scaleXL = LSM6DS3_ScaleXL((LSM6DS3_ctrl1_xl_t){ .mask = ctrl[0] });
+    handle->scaleG  = LSM6DS3_ScaleG((LSM6DS3_ctrl2_g_t){ .mask = ctrl[1] });
+    return true;
+}
+
+
+LSM6DS3 *LSM6DS3_Open(const LSM6DS3_Transport *transport, void *context)
+{
+    if (!transport || !transport->write || !transport->read || !context) {
+        return NULL;
+    }
+
+    LSM6DS3 *handle = NULL;
+    unsigned h;
+    for (h = 0; h < LSM6DS3_HANDLE_MAX; h++) {
+        if (!LSM6DS3_Handles[h].transport) {
+            handle = &LSM6DS3_Handles[h];
+            handle->buffer = &LSM6DS3_Buffer[h];
+            break;
+        }
+    }
+    if (!handle) {
+        return NULL;
+    }
+
+    handle->transport = transport;
+    handle->context   = context;
+    if (!LSM6DS3_SetupInterface(handle) || !LSM6DS3_ReadScale(handle)) {
+        handle->transport = NULL;
+        return NULL;
+    }
+    return handle;
+}
+
+void LSM6DS3_Close(LSM6DS3 *handle)
+{
+    if (!handle) {
+        return;
+    }
+    handle->transport = NULL;
+}
+
+bool LSM6DS3_Reset(LSM6DS3 *handle)
+{
+    if (!handle) {
+        return false;
+    }
+
+    if (!LSM6DS3_RegWrite(handle, LSM6DS3_REG_CTRL3_C, LSM6DS3_CTRL3_C_SW_RESET)) {
+        return false;
+    }
+
+    uint8_t status;
+    while (true) {
+        if (LSM6DS3_RegRead(handle, LSM6DS3_REG_CTRL3_C, &status)
+            && ((status & LSM6DS3_CTRL3_C_SW_RESET) == 0)) {
+            break;
+        }
+    }
+
+    return (LSM6DS3_SetupInterface(handle) && LSM6DS3_ReadScale(handle));
+}
+
+bool LSM6DS3_CheckWhoAmI(LSM6DS3 *handle)
+{
+    if (!handle) {
+        return false;
+    }
+
+    uint8_t ident;
+    return (LSM6DS3_RegRead(handle, LSM6DS3_REG_WHO_AM_I, &ident)
+        && (ident == LSM6DS3_WHO_AM_I));
+}
+
+bool LSM6DS3_ConfigXL(LSM6DS3 *handle, unsigned odr, unsigned fs, unsigned bw)
+{
+    if (!handle) {
+        return false;
+    }
+
+    LSM6DS3_ctrl1_xl_t ctrl1_xl;
+
+    if ((odr >> 4) != 0) {
+        return false;
+    }
+    ctrl1_xl.odr_xl = odr;
+
+    switch (fs) {
+    case  2:
+        ctrl1_xl.fs_xl = 0;
+        break;
+    case 16:
+        ctrl1_xl.fs_xl = 1;
+        break;
+    case  4:
+        ctrl1_xl.fs_xl = 2;
+        break;
+    case  8:
+        ctrl1_xl.fs_xl = 3;
+        break;
+    default:
+        return false;
+    }
+
+    switch (bw)
+    {
+    case  50:
+        ctrl1_xl.bw_xl = 3;
+        break;
+    case 100:
+        ctrl1_xl.bw_xl = 2;
+        break;
+    case 200:
+        ctrl1_xl.bw_xl = 1;
+        break;
+    case 400:
+        ctrl1_xl.bw_xl = 0;
+        break;
+    default:
+        return false;
+    }
+
+    if (!LSM6DS3_RegWrite(handle, LSM6DS3_REG_CTRL1_XL, ctrl1_xl.mask)) {
+        return false;
+    }
+    handle->scaleXL = LSM6DS3_ScaleXL(ctrl1_xl);
+    return true;
+}
+
+
+bool LSM6DS3_ConfigG(LSM6DS3 *handle, unsigned odr, unsigned fs)
+{
+    if (!handle) {
+        return false;
+    }
+
+    LSM6DS3_ctrl2_g_t ctrl2_g = { .mask = 0 };
+
+    if ((odr >> 4) != 0) {
+        return false;
+    }
+    ctrl2_g.odr_g = odr;
+
+    switch (fs) {
+    case  125:
+        ctrl2_g.fs_125 = true;
+        ctrl2_g.fs_g   = 0;
+        break;
+    case  250:
+        ctrl2_g.fs_125 = false;
+        ctrl2_g.fs_g   = 0;
+        break;
+    case  500:
+        ctrl2_g.fs_125 = false;
+        ctrl2_g.fs_g   = 1;
+        break;
+    case 1000:
+        ctrl2_g.fs_125 = false;
+        ctrl2_g.fs_g   = 2;
+        break;
+    case 2000:
+        ctrl2_g.fs_125 = false;
+        ctrl2_g.fs_g   = 3;
+        break;
+    default:
+        return false;
+    }
+
+    if (!LSM6DS3_RegWrite(handle, LSM6DS3_REG_CTRL2_G, ctrl2_g.mask)) {
+        return false;
+    }
+    handle->scaleG = LSM6DS3_ScaleG(ctrl2_g);
+    return true;
+}
+
+bool LSM6DS3_Status(LSM6DS3 *handle, bool *tda, bool *gda, bool *xlda)
+{
+    if (!handle) {
+        return false;
+    }
+
+    LSM6DS3_status_t status;
+    if (!LSM6DS3_RegRead(handle, LSM6DS3_REG_STATUS_REG, &status.mask)) {
+        return false;
+    }
+
+    if (tda) {
+        *tda = status.tda;
+    }
+    if (gda) {
+        *gda = status.gda;
+    }
+    if (xlda) {
+        *xlda = status.xlda;
+    }
+    return true;
+}
+
+bool LSM6DS3_ReadAll(LSM6DS3 *handle, LSM6DS3_Data *data)
+{
+    if (!handle) {
+        return false;
+    }
+
+    if (!LSM6DS3_RegReadBurst(handle, LSM6DS3_REG_OUT_TEMP_L, handle->buffer, sizeof(*handle->buffer))) {
+        return false;
+    }
+
+    // The device is little endian, like the M4, so the registers are already in order.
+    if (data) {
+        *data = *handle->buffer;
+    }
+    return true;
+}
+
+// Reads count outputs starting at addr, which are part of the burst read by LSM6DS3_ReadAll.
+static bool LSM6DS3_ReadOutputs(LSM6DS3 *handle, uint8_t addr, int16_t *out, unsigned count)
+{
+    if (!handle) {
+        return false;
+    }
+
+    if (!LSM6DS3_RegReadBurst(handle, addr, handle->buffer, (count * sizeof(int16_t)))) {
+        return false;
+    }
+    __builtin_memcpy(out, handle->buffer, (count * sizeof(int16_t)));
+    return true;
+}
+
+bool LSM6DS3_ReadTemp(LSM6DS3 *handle, int16_t *temp)
+{
+    int16_t t;
+    if (!LSM6DS3_ReadOutputs(handle, LSM6DS3_REG_OUT_TEMP_L, &t, 1)) {
+        return false;
+    }
+
+    if (temp) {
+        *temp = t;
+    }
+    return true;
+}
+
+static int32_t LSM6DS3_HumanTemp(int16_t th)
+{
+    return (25000 + ((th * 1000) >> 4));
+}
+
+bool LSM6DS3_ReadTempHuman(LSM6DS3 *handle, int16_t *t)
+{
+    int16_t th;
+    if (!LSM6DS3_ReadTemp(handle, &th)) {
+        return false;
+    }
+
+    if (t) *t = LSM6DS3_HumanTemp(th);
+    return true;
+}
+
+bool LSM6DS3_ReadG(LSM6DS3 *handle, int16_t *x, int16_t *y, int16_t *z)
+{
+    int16_t g[3];
+    if (!LSM6DS3_ReadOutputs(handle, LSM6DS3_REG_OUTX_L_G, g, 3)) {
+        return false;
+    }
+
+    if (x) {
+        *x = g[0];
+    }
+    if (y) {
+        *y = g[1];
+    }
+    if (z) {
+        *z = g[2];
+    }
+    return true;
+}
+
+bool LSM6DS3_ReadGHuman(LSM6DS3 *handle, int16_t *x, int16_t *y, int16_t *z)
+{
+    int16_t xh, yh, zh;
+    if (!LSM6DS3_ReadG(handle, &xh, &yh, &zh)) {
+        return false;
+    }
+
+    int32_t scale = handle->scaleG;
+    if (x) *x = (xh * scale) >> 9;
+    if (y) *y = (yh * scale) >> 9;
+    if (z) *z = (zh * scale) >> 9;
+    return true;
+}
+
+bool LSM6DS3_ReadXL(LSM6DS3 *handle, int16_t *x, int16_t *y, int16_t *z)
+{
+    int16_t xl[3];
+    if (!LSM6DS3_ReadOutputs(handle, LSM6DS3_REG_OUTX_L_XL, xl, 3)) {
+        return false;
+    }
+
+    if (x) {
+        *x = xl[0];
+    }
+    if (y) {
+        *y = xl[1];
+    }
+    if (z) {
+        *z = xl[2];
+    }
+    return true;
+}
+
+bool LSM6DS3_ReadXLHuman(LSM6DS3 *handle, int16_t *x, int16_t *y, int16_t *z)
+{
+    int16_t xh, yh, zh;
+    if (!LSM6DS3_ReadXL(handle, &xh, &yh, &zh)) {
+        return false;
+    }
+
+    int32_t scale = handle->scaleXL;
+    if (x) *x = (xh * scale) >> 16;
+    if (y) *y = (yh * scale) >> 16;
+    if (z) *z = (zh * scale) >> 16;
+    return true;
+}
+
+bool LSM6DS3_DataToHuman(LSM6DS3 *handle, const LSM6DS3_Data *raw, LSM6DS3_DataHuman *data)
+{
+    if (!handle || !raw) {
+        return false;
+    }
+
+    if (data) {
+        data->temp = LSM6DS3_HumanTemp(raw->temp);
+        unsigned i;
+        for (i = 0; i < 3; i++) {
+            data->g[i]  = ((raw->g[i]  * handle->scaleG)  >> 9);
+            data->xl[i] = ((raw->xl[i] * handle->scaleXL) >> 16);
+        }
+    }
+    return true;
+}
+
+bool LSM6DS3_ReadAllHuman(LSM6DS3 *handle, LSM6DS3_DataHuman *data)
+{
+    LSM6DS3_Data raw;
+    return (LSM6DS3_ReadAll(handle, &raw)
+        && LSM6DS3_DataToHuman(handle, &raw, data));
+}
+
+// Codes a decimation factor for FIFO_CTRL3.
+static bool LSM6DS3_FIFODecimation(unsigned factor, uint8_t *dec)
+{
+    switch (factor) {
+    case  0:
+        *dec = 0;
+        break;
+    case  1:
+    case  2:
+    case  3:
+    case  4:
+        *dec = factor;
+        break;
+    case  8:
+        *dec = 5;
+        break;
+    case 16:
+        *dec = 6;
+        break;
+    case 32:
+        *dec = 7;
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
+
+bool LSM6DS3_ConfigFIFO(LSM6DS3 *handle, unsigned odr, unsigned decXL, unsigned decG, uintptr_t threshold)
+{
+    if (!handle) {
+        return false;
+    }
+
+    uint8_t dec_xl, dec_g;
+    if (((odr >> 4) != 0) || (threshold >= LSM6DS3_FIFO_WORDS)
+        || !LSM6DS3_FIFODecimation(decXL, &dec_xl)
+        || !LSM6DS3_FIFODecimation(decG, &dec_g)) {
+        return false;
+    }
+
+    // Dropping to bypass mode empties the FIFO, so the new pattern starts cleanly.
+    if (!LSM6DS3_RegWrite(handle, LSM6DS3_REG_FIFO_CTRL5, LSM6DS3_FIFO_MODE_BYPASS)) {
+        return false;
+    }
+    if (odr == 0) {
+        return true;
+    }
+
+    // FIFO_CTRL1 to FIFO_CTRL5 are written together.
+    const uint8_t ctrl[] = {
+        (threshold & 0xFF),
+        ((threshold >> 8) & 0x0F),
+        (dec_xl | (dec_g << 3)),
+        0x00,
+        ((odr << 3) | LSM6DS3_FIFO_MODE_CONTINUOUS),
+    };
+    return LSM6DS3_RegWriteBurst(handle, LSM6DS3_REG_FIFO_CTRL1, ctrl, sizeof(ctrl));
+}
+
+bool LSM6DS3_ConfigINT1(LSM6DS3 *handle, uint8_t mask)
+{
+    if (!handle) {
+        return false;
+    }
+
+    return LSM6DS3_RegWrite(handle, LSM6DS3_REG_INT1_CTRL, mask);
+}
+
+bool LSM6DS3_ReadFIFOStatus(LSM6DS3 *handle, uintptr_t *unread, unsigned *pattern, uint8_t *status)
+{
+    if (!handle) {
+        return false;
+    }
+
+    // FIFO_STATUS1 to FIFO_STATUS4 are read together.
+    uint8_t fifo_status[4];
+    if (!LSM6DS3_RegReadBurst(handle, LSM6DS3_REG_FIFO_STATUS1, handle->buffer, sizeof(fifo_status))) {
+        return false;
+    }
+    __builtin_memcpy(fifo_status, handle->buffer, sizeof(fifo_status));
+
+    if (unread) {
+        *unread = (fifo_status[0] | ((fifo_status[1] & 0x0F) << 8));
+    }
+    if (pattern) {
+        *pattern = (fifo_status[2] | ((fifo_status[3] & 0x03) << 8));
+    }
+    if (status) {
+        *status = (fifo_status[1] & 0xF0);
+    }
+    return true;
+}
+
+bool LSM6DS3_ReadFIFO(LSM6DS3 *handle, int16_t *data, uintptr_t size, uintptr_t *count, unsigned *pattern, uint8_t *status)
+{
+    if (!handle || (!data && (size > 0))) {
+        return false;
+    }
+
+    uintptr_t unread;
+    if (!LSM6DS3_ReadFIFOStatus(handle, &unread, pattern, status)) {
+        return false;
+    }
+    if (unread > size) {
+        unread = size;
+    }
+
+    // The address rolls back from FIFO_DATA_OUT_H to FIFO_DATA_OUT_L, so a
+    // single burst walks through the FIFO a word at a time.
+    if ((unread > 0) && !LSM6DS3_RegReadBurst(
+        handle, LSM6DS3_REG_FIFO_DATA_OUT_L, data, (unread * sizeof(int16_t)))) {
+        return false;
+    }
+
+    if (count) {
+        *count = unread;
+    }
+    return true;
+}
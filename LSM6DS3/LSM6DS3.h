@@ -0,0 +1,438 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef LSM6DS3_H_
+#define LSM6DS3_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Variable names and comments come from the LSM6DS3 datasheet, which can be found here:
+// https://www.st.com/resource/en/datasheet/lsm6ds3.pdf
+//
+// The driver only deals with the device's registers, leaving the bus to a transport, so the
+// same driver serves the I2C, SPI and ThreadX samples. Transports for each of these are provided
+// alongside it, and a sample only builds the one it uses.
+
+/// <summary>This enum contains a set of registers that are used to control the behaviour of the LSM6DS3 device.</summary>
+typedef enum {
+    LSM6DS3_REG_FUNC_CFG_ACCESS        = 0x01,
+    LSM6DS3_REG_SENSOR_SYNC_TIME_FRAME = 0x04,
+    LSM6DS3_REG_FIFO_CTRL1             = 0x06,
+    LSM6DS3_REG_FIFO_CTRL2             = 0x07,
+    LSM6DS3_REG_FIFO_CTRL3             = 0x08,
+    LSM6DS3_REG_FIFO_CTRL4             = 0x09,
+    LSM6DS3_REG_FIFO_CTRL5             = 0x0A,
+    LSM6DS3_REG_ORIENT_CFG_G           = 0x0B,
+    LSM6DS3_REG_INT1_CTRL              = 0x0D,
+    LSM6DS3_REG_INT2_CTRL              = 0x0E,
+    LSM6DS3_REG_WHO_AM_I               = 0x0F,
+    LSM6DS3_REG_CTRL1_XL               = 0x10,
+    LSM6DS3_REG_CTRL2_G                = 0x11,
+    LSM6DS3_REG_CTRL3_C                = 0x12,
+    LSM6DS3_REG_CTRL4_C                = 0x13,
+    LSM6DS3_REG_CTRL5_C                = 0x14,
+    LSM6DS3_REG_CTRL6_C                = 0x15,
+    LSM6DS3_REG_CTRL7_G                = 0x16,
+    LSM6DS3_REG_CTRL8_XL               = 0x17,
+    LSM6DS3_REG_CTRL9_XL               = 0x18,
+    LSM6DS3_REG_CTRL10_C               = 0x19,
+    LSM6DS3_REG_MASTER_CONFIG          = 0x1A,
+    LSM6DS3_REG_WAKE_UP_SRC            = 0x1B,
+    LSM6DS3_REG_TAP_SRC                = 0x1C,
+    LSM6DS3_REG_D6D_SRC                = 0x1D,
+    LSM6DS3_REG_STATUS_REG             = 0x1E,
+    LSM6DS3_REG_OUT_TEMP_L             = 0x20,
+    LSM6DS3_REG_OUT_TEMP_H             = 0x21,
+    LSM6DS3_REG_OUTX_L_G               = 0x22,
+    LSM6DS3_REG_OUTX_H_G               = 0x23,
+    LSM6DS3_REG_OUTY_L_G               = 0x24,
+    LSM6DS3_REG_OUTY_H_G               = 0x25,
+    LSM6DS3_REG_OUTZ_L_G               = 0x26,
+    LSM6DS3_REG_OUTZ_H_G               = 0x27,
+    LSM6DS3_REG_OUTX_L_XL              = 0x28,
+    LSM6DS3_REG_OUTX_H_XL              = 0x29,
+    LSM6DS3_REG_OUTY_L_XL              = 0x2A,
+    LSM6DS3_REG_OUTY_H_XL              = 0x2B,
+    LSM6DS3_REG_OUTZ_L_XL              = 0x2C,
+    LSM6DS3_REG_OUTZ_H_XL              = 0x2D,
+    LSM6DS3_REG_FIFO_STATUS1           = 0x3A,
+    LSM6DS3_REG_FIFO_STATUS2           = 0x3B,
+    LSM6DS3_REG_FIFO_STATUS3           = 0x3C,
+    LSM6DS3_REG_FIFO_STATUS4           = 0x3D,
+    LSM6DS3_REG_FIFO_DATA_OUT_L        = 0x3E,
+    LSM6DS3_REG_FIFO_DATA_OUT_H        = 0x3F,
+} LSM6DS3_reg_e;
+
+/// <summary>Bit field description for register STATUS_REG.</summary>
+typedef union __attribute__((__packed__)) {
+    struct __attribute__((__packed__)) {
+        /// <summary>
+        /// <para>Accelerometer new data available. Default value: false.</para>
+        /// <para>false: no set of data available at accelerometer output</para>
+        /// <para>true: a new set of data is available at accelerometer output.</para>
+        /// </summary>
+        bool     xlda    : 1;
+        /// <summary>
+        /// <para>Gyroscope new data available. Default value: false.</para>
+        /// <para>false: no set of data available at gyroscope output</para>
+        /// <para>true: a new set of data is available at gyroscope output.</para>
+        /// </summary>
+        bool     gda     : 1;
+        /// <summary>
+        /// <para>Temperature new data available. Default: false.</para>
+        /// <para>false: no set of data is available at temperature sensor output</para>
+        /// <para>true: a new set of data is available at temperature sensor output.</para>
+        /// </summary>
+        bool     tda     : 1;
+        unsigned res_7_3 : 5;
+    };
+
+    uint8_t mask;
+} LSM6DS3_status_t;
+
+/// <summary>Bit field description for register CTRL1_XL.</summary>
+typedef union __attribute__((__packed__)) {
+    struct __attribute__((__packed__)) {
+        /// <summary>
+        /// <para>Anti-aliasing filter bandwidth selection. Default value: 00.</para>
+        /// <para>(00: 400 Hz; 01: 200 Hz; 10: 100 Hz; 11: 50 Hz).</para>
+        /// </summary>
+        unsigned bw_xl  : 2;
+        /// <summary>
+        /// <para>Accelerometer full-scale selection. Default value: 00.</para>
+        /// <para>(00: +/-2 g; 01: +/-16 g; 10: +/-4 g; 11: +/-8 g).</para>
+        /// </summary>
+        unsigned fs_xl  : 2;
+        /// <summary>Output data rate and power mode selection. Default value: 0000.</summary>
+        unsigned odr_xl : 4;
+    };
+
+    uint8_t mask;
+} LSM6DS3_ctrl1_xl_t;
+
+/// <summary>Bit field description for register CTRL1_XL.</summary>
+typedef union __attribute__((__packed__)) {
+    struct __attribute__((__packed__)) {
+        unsigned res_0  : 1;
+        /// <summary>
+        /// <para>Gyroscope full-scale at 125 dps. Default value: false</para>
+        /// <para>(false: disabled; true: enabled)</para>
+        /// </summary>
+        bool     fs_125 : 1;
+        /// <summary>
+        /// <para>Gyroscope full-scale selection. Default value: 00</para>
+        /// <para>(00: 250 dps; 01: 500 dps; 10: 1000 dps; 11: 2000 dps)</para>
+        ///</summary>
+        unsigned fs_g   : 2;
+        /// <summary>Gyroscope output data rate selection. Default value: 0000</summary>
+        unsigned odr_g  : 4;
+    };
+
+    uint8_t mask;
+} LSM6DS3_ctrl2_g_t;
+
+/// <summary>Bit description for register CTRL3_C.</summary>
+typedef enum {
+    /// <summary>Software reset, cleared once the reset is complete.</summary>
+    LSM6DS3_CTRL3_C_SW_RESET = 0x01,
+    /// <summary>Register address automatically incremented during a multiple byte access. Default value: true.</summary>
+    LSM6DS3_CTRL3_C_IF_INC   = 0x04,
+    /// <summary>Block data update, output registers aren't updated until both bytes of the last sample have been read.</summary>
+    LSM6DS3_CTRL3_C_BDU      = 0x40,
+} LSM6DS3_ctrl3_c_e;
+
+/// <summary>Bit description for register INT1_CTRL.</summary>
+typedef enum {
+    /// <summary>Accelerometer data ready on INT1.</summary>
+    LSM6DS3_INT1_CTRL_DRDY_XL       = 0x01,
+    /// <summary>Gyroscope data ready on INT1.</summary>
+    LSM6DS3_INT1_CTRL_DRDY_G        = 0x02,
+    /// <summary>Boot status available on INT1.</summary>
+    LSM6DS3_INT1_CTRL_BOOT          = 0x04,
+    /// <summary>FIFO threshold (watermark) reached on INT1.</summary>
+    LSM6DS3_INT1_CTRL_FTH           = 0x08,
+    /// <summary>FIFO overrun on INT1.</summary>
+    LSM6DS3_INT1_CTRL_FIFO_OVR      = 0x10,
+    /// <summary>FIFO full on INT1.</summary>
+    LSM6DS3_INT1_CTRL_FULL_FLAG     = 0x20,
+    /// <summary>Significant motion on INT1.</summary>
+    LSM6DS3_INT1_CTRL_SIGN_MOT      = 0x40,
+    /// <summary>Pedometer step recognition on INT1.</summary>
+    LSM6DS3_INT1_CTRL_STEP_DETECTOR = 0x80,
+} LSM6DS3_int1_ctrl_e;
+
+/// <summary>Bit description for register FIFO_STATUS2, above the top of DIFF_FIFO.</summary>
+typedef enum {
+    /// <summary>FIFO empty.</summary>
+    LSM6DS3_FIFO_STATUS2_EMPTY    = 0x10,
+    /// <summary>FIFO full, the next sample will overwrite the oldest.</summary>
+    LSM6DS3_FIFO_STATUS2_FULL     = 0x20,
+    /// <summary>FIFO overrun, at least one sample has been overwritten.</summary>
+    LSM6DS3_FIFO_STATUS2_OVER_RUN = 0x40,
+    /// <summary>FIFO filling is equal to or higher than the threshold level.</summary>
+    LSM6DS3_FIFO_STATUS2_FTH      = 0x80,
+} LSM6DS3_fifo_status2_e;
+
+/// <summary>
+/// <para>The output registers read in one burst from OUT_TEMP_L, as they're laid out on the device.</para>
+/// </summary>
+typedef struct __attribute__((__packed__)) {
+    int16_t temp;
+    int16_t g[3];
+    int16_t xl[3];
+} LSM6DS3_Data;
+
+/// <summary>The same outputs as LSM6DS3_Data in the units of the *Human functions.</summary>
+typedef struct {
+    /// <summary>Temperature in thousandths of a degree Celcius.</summary>
+    int32_t temp;
+    /// <summary>Angular rate for each axis in mdps.</summary>
+    int32_t g[3];
+    /// <summary>Linear acceleration for each axis, as LSM6DS3_ReadXLHuman.</summary>
+    int32_t xl[3];
+} LSM6DS3_DataHuman;
+
+typedef struct LSM6DS3 LSM6DS3;
+
+/// <summary>This is the size of the FIFO in 16-bit words, each being one axis of one sample.</summary>
+static const uintptr_t LSM6DS3_FIFO_WORDS = 4096;
+
+/// <summary>This is  from the WHO_AM_I register. Its value is fixed at 69h.</summary>
+static const uint8_t LSM6DS3_WHO_AM_I = 0x69;
+
+/// <summary>
+/// <para>This is a subordinate device Address. Its value is fixed at 6Ah.</para>
+/// <para>SDO is tied to ground so the least significant bit of the address is zero.</para>
+/// </summary>
+static const uint32_t LSM6DS3_ADDRESS = 0x6A;
+
+/// <summary>
+/// <para>The bus operations used by the driver, each of which blocks until the transfer completes.</para>
+/// <para>Transfers of more than a few bytes are passed buffers in SYSRAM, so transports may use DMA.</para>
+/// </summary>
+typedef struct {
+    /// <summary>Writes size bytes from data to the device, the first byte being the register address.</summary>
+    bool (*write)(void *context, const uint8_t *data, uintptr_t size);
+    /// <summary>Reads size bytes into data from consecutive registers starting at addr.</summary>
+    bool (*read)(void *context, uint8_t addr, void *data, uintptr_t size);
+} LSM6DS3_Transport;
+
+/// <summary>Transport for an I2CMaster, passed as the context.</summary>
+extern const LSM6DS3_Transport LSM6DS3_TransportI2C;
+/// <summary>Transport for an SPIMaster, passed as the context, with chip select already set up.</summary>
+extern const LSM6DS3_Transport LSM6DS3_TransportSPI;
+/// <summary>Transport for an i2c_rtos_handle_t, passed as the context, which sleeps the calling
+/// thread while the transfer runs rather than spinning.</summary>
+extern const LSM6DS3_Transport LSM6DS3_TransportI2CThreadX;
+
+/// <summary>
+/// <para>The application must call this function to get a handle for the device on a bus.</para>
+/// <para>The full-scale configuration is read from the device and cached, so the *Human functions
+/// don't need to read it back for each sample.</para>
+/// </summary>
+/// <param name="transport">Selects how the device is connected.</param>
+/// <param name="context">Selects the bus driver the transport uses.</param>
+/// <returns>Returns a handle on success and NULL on failure.</returns>
+LSM6DS3 *LSM6DS3_Open(const LSM6DS3_Transport *transport, void *context);
+
+/// <summary>
+/// <para>The application must call this function to release the handle.</para>
+/// </summary>
+/// <param name="handle">The handle to release.</param>
+void LSM6DS3_Close(LSM6DS3 *handle);
+
+/// <summary>
+/// <para>The application must call this function to implement a software reset.</para>
+/// <para>The interface is then set up for burst reads, with address auto-increment and block data update.</para>
+/// <para>This is a necessary function which will typically be used to reset the LSM6DS3 device.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_Reset(LSM6DS3 *handle);
+
+/// <summary>
+/// <para>The application must call this function to validate the device id.</para>
+/// <para>This is a testing function which will typically be used in the beginning of the communication of the master with the subordinate device.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_CheckWhoAmI(LSM6DS3 *handle);
+
+/// <summary>
+/// <para>The application must call this function to configure the linear acceleration sensor control register.</para>
+/// <para>This is a function which will typically be used to configure the accelerometer of the subordinate device.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="odr">Selects the output data rate and power mode.</param>
+/// <param name="fs">Selects the full-scale of the accelerometer.</param>
+/// <param name="bw">Selects the bandwidth of the anti-aliasing filter.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ConfigXL(LSM6DS3 *handle, unsigned odr, unsigned fs, unsigned bw);
+
+/// <summary>
+/// <para>The application must call this function to configure the gyroscope sensor control register.</para>
+/// <para>This is a function which will typically be used to configure the gyroscope of the subordinate device.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="odr">Selects the output data rate and power mode.</param>
+/// <param name="fs">Selects the full-scale of the gyroscope.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ConfigG(LSM6DS3 *handle, unsigned odr, unsigned fs);
+
+/// <summary>
+/// <para>The application must call this function to check if new data are available in the temperature, gyroscore and accelerometer sensors.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="tda">Reads temperature sensor for new data. false: no new data is available; true: a set of new data is available.</param>
+/// <param name="gda">Reads gyroscope for new data. false: no new data is available; true: a set of new data is available.</param>
+/// <param name="xlda">Reads accelerometer for new data. false: no new data is available; true: a set of new data is available.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_Status(LSM6DS3 *handle, bool *tda, bool *gda, bool *xlda);
+
+/// <summary>
+/// <para>The application must call this function to read the temperature sensor.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="temp">Reads temperature sensor data.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ReadTemp(LSM6DS3 *handle, int16_t *temp);
+
+/// <summary>
+/// <para>The application must call this function to read the temperature sensor.</para>
+/// <para>This function is a wrapper around <see cref="LSM6DS3_ReadTemp"/> which provides
+/// human readable output.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="temp">Reads temperature sensor data in thousandths of a degree Celcius.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ReadTempHuman(LSM6DS3 *handle, int16_t *temp);
+
+/// <summary>
+/// <para>The application must call this function to read the gyroscope.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="x">Reads angular rate for X axis.</param>
+/// <param name="y">Reads angular rate for Y axis.</param>
+/// <param name="z">Reads angular rate for Z axis.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ReadG(LSM6DS3 *handle, int16_t *x, int16_t *y, int16_t *z);
+
+/// <summary>
+/// <para>The application must call this function to read the gyroscope.</para>
+/// <para>This function is a wrapper around <see cref="LSM6DS3_ReadG"/> which provides
+/// human readable output.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="x">Reads angular rate for X axis in mdps.</param>
+/// <param name="y">Reads angular rate for Y axis in mdps.</param>
+/// <param name="z">Reads angular rate for Z axis in mdps.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ReadGHuman(LSM6DS3 *handle, int16_t *x, int16_t *y, int16_t *z);
+
+/// <summary>
+/// <para>The application must call this function to read the accelerometer.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="x">Reads linear acceleration for x axis.</param>
+/// <param name="y">Reads linear acceleration for Y axis.</param>
+/// <param name="z">Reads linear acceleration for Z axis.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ReadXL(LSM6DS3 *handle, int16_t *x, int16_t *y, int16_t *z);
+
+/// <summary>
+/// <para>The application must call this function to read the accelerometer.</para>
+/// <para>This function is a wrapper around <see cref="LSM6DS3_ReadXL"/> which provides
+/// human readable output.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="x">Reads linear acceleration for x axis in mm per second squared.</param>
+/// <param name="y">Reads linear acceleration for Y axis in mm per second squared.</param>
+/// <param name="z">Reads linear acceleration for Z axis in mm per second squared.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ReadXLHuman(LSM6DS3 *handle, int16_t *x, int16_t *y, int16_t *z);
+
+/// <summary>
+/// <para>The application must call this function to read the temperature sensor, gyroscope and
+/// accelerometer together.</para>
+/// <para>All 14 output bytes are read in a single bus transaction, so the outputs come from the
+/// same sample.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="data">Reads the sensor outputs.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ReadAll(LSM6DS3 *handle, LSM6DS3_Data *data);
+
+/// <summary>
+/// <para>The application must call this function to read the temperature sensor, gyroscope and
+/// accelerometer together.</para>
+/// <para>This function is a wrapper around <see cref="LSM6DS3_ReadAll"/> which provides
+/// human readable output.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="data">Reads the sensor outputs.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ReadAllHuman(LSM6DS3 *handle, LSM6DS3_DataHuman *data);
+
+/// <summary>
+/// <para>The application must call this function to convert outputs read from the device, e.g. those
+/// collected from the FIFO, to the units of the *Human functions.</para>
+/// <para>The full-scale configuration cached by the handle is used.</para>
+/// </summary>
+/// <param name="handle">Selects the device the outputs were read from.</param>
+/// <param name="raw">The sensor outputs as read from the device.</param>
+/// <param name="data">Returns the converted sensor outputs.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_DataToHuman(LSM6DS3 *handle, const LSM6DS3_Data *raw, LSM6DS3_DataHuman *data);
+
+/// <summary>
+/// <para>The application must call this function to configure the FIFO.</para>
+/// <para>The FIFO is run in continuous mode, where the oldest samples are overwritten once it's full.
+/// Each sample is stored as three words, gyroscope before accelerometer, their order being given by
+/// the pattern returned with the FIFO data.</para>
+/// <para>Reconfiguring the FIFO empties it.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="odr">Selects the FIFO output data rate, as coded for <see cref="LSM6DS3_ConfigXL"/>,
+/// with 0 disabling the FIFO. The sensors must run at least this fast.</param>
+/// <param name="decXL">Selects the accelerometer decimation factor: 1, 2, 3, 4, 8, 16 or 32,
+/// or 0 to leave it out of the FIFO.</param>
+/// <param name="decG">Selects the gyroscope decimation factor, as decXL.</param>
+/// <param name="threshold">Selects the watermark level in words, below <see cref="LSM6DS3_FIFO_WORDS"/>.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ConfigFIFO(LSM6DS3 *handle, unsigned odr, unsigned decXL, unsigned decG, uintptr_t threshold);
+
+/// <summary>
+/// <para>The application must call this function to select which events drive the INT1 pin.</para>
+/// <para>INT1 is active high and stays high for as long as any selected event is.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="mask">Selects the events from <see cref="LSM6DS3_int1_ctrl_e"/>.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ConfigINT1(LSM6DS3 *handle, uint8_t mask);
+
+/// <summary>
+/// <para>The application must call this function to check the FIFO fill level.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="unread">Reads the number of unread words in the FIFO.</param>
+/// <param name="pattern">Reads the position in the FIFO pattern of the next word to be read.</param>
+/// <param name="status">Reads the FIFO flags from <see cref="LSM6DS3_fifo_status2_e"/>.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ReadFIFOStatus(LSM6DS3 *handle, uintptr_t *unread, unsigned *pattern, uint8_t *status);
+
+/// <summary>
+/// <para>The application must call this function to drain the FIFO.</para>
+/// <para>All unread words, up to size, are read in a single bus transaction, so the device only needs
+/// servicing once per batch rather than once per sample.</para>
+/// </summary>
+/// <param name="handle">Selects the device to perform the transfer on.</param>
+/// <param name="data">Reads the FIFO words, it must be in SYSRAM as the transfer may be large.</param>
+/// <param name="size">Selects the maximum number of words to read.</param>
+/// <param name="count">Reads the number of words read, which is less than size once the FIFO is drained.</param>
+/// <param name="pattern">Reads the position in the FIFO pattern of the first word read.</param>
+/// <param name="status">Reads the FIFO flags from <see cref="LSM6DS3_fifo_status2_e"/> from before the words were read.</param>
+/// <returns>Returns true on success and false on failure.</returns>
+bool LSM6DS3_ReadFIFO(LSM6DS3 *handle, int16_t *data, uintptr_t size, uintptr_t *count, unsigned *pattern, uint8_t *status);
+
+#endif // #ifndef LSM6DS3_H_
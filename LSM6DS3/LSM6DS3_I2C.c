@@ -0,0 +1,22 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "LSM6DS3.h"
+#include "lib/I2CMaster.h"
+
+static bool LSM6DS3_I2C_Write(void *context, const uint8_t *data, uintptr_t size)
+{
+    return (I2CMaster_WriteSync(
+        (I2CMaster *)context, LSM6DS3_ADDRESS, data, size) == ERROR_NONE);
+}
+
+static bool LSM6DS3_I2C_Read(void *context, uint8_t addr, void *data, uintptr_t size)
+{
+    return (I2CMaster_WriteThenReadSync(
+        (I2CMaster *)context, LSM6DS3_ADDRESS, &addr, sizeof(addr), data, size) == ERROR_NONE);
+}
+
+const LSM6DS3_Transport LSM6DS3_TransportI2C = {
+    .write = LSM6DS3_I2C_Write,
+    .read  = LSM6DS3_I2C_Read,
+};
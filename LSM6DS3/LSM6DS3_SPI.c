@@ -0,0 +1,23 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "LSM6DS3.h"
+#include "lib/SPIMaster.h"
+
+static bool LSM6DS3_SPI_Write(void *context, const uint8_t *data, uintptr_t size)
+{
+    return (SPIMaster_WriteSync((SPIMaster *)context, data, size) == ERROR_NONE);
+}
+
+static bool LSM6DS3_SPI_Read(void *context, uint8_t addr, void *data, uintptr_t size)
+{
+    // The top bit of the address selects a read.
+    addr |= 0x80;
+    return (SPIMaster_WriteThenReadSync(
+        (SPIMaster *)context, &addr, sizeof(addr), data, size) == ERROR_NONE);
+}
+
+const LSM6DS3_Transport LSM6DS3_TransportSPI = {
+    .write = LSM6DS3_SPI_Write,
+    .read  = LSM6DS3_SPI_Read,
+};
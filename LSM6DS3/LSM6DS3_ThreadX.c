@@ -0,0 +1,42 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "LSM6DS3.h"
+#include "i2c_threadx.h"
+
+// Timeout for each transfer, in ThreadX ticks.
+#define LSM6DS3_THREADX_TIMEOUT 100
+
+static bool LSM6DS3_ThreadX_Write(void *context, const uint8_t *data, uintptr_t size)
+{
+    i2c_rtos_transfer_t xfer;
+
+    xfer.address = LSM6DS3_ADDRESS;
+    xfer.count = 1;
+    xfer.transfers[0] = (I2C_Transfer){
+        .writeData = data,
+        .readData = NULL,
+        .length = size,
+    };
+    xfer.timeout = LSM6DS3_THREADX_TIMEOUT;
+
+    return (I2CMaster_RTOS_Transfer((i2c_rtos_handle_t *)context, &xfer) == ERROR_NONE);
+}
+
+static bool LSM6DS3_ThreadX_Read(void *context, uint8_t addr, void *data, uintptr_t size)
+{
+    i2c_rtos_transfer_t xfer;
+
+    xfer.address = LSM6DS3_ADDRESS;
+    xfer.count = 2;
+    xfer.transfers[0] = (I2C_Transfer){ .writeData = &addr, .readData = NULL, .length = sizeof(addr) };
+    xfer.transfers[1] = (I2C_Transfer){ .writeData = NULL , .readData = data,  .length = size };
+    xfer.timeout = LSM6DS3_THREADX_TIMEOUT;
+
+    return (I2CMaster_RTOS_Transfer((i2c_rtos_handle_t *)context, &xfer) == ERROR_NONE);
+}
+
+const LSM6DS3_Transport LSM6DS3_TransportI2CThreadX = {
+    .write = LSM6DS3_ThreadX_Write,
+    .read  = LSM6DS3_ThreadX_Read,
+};
@@ -0,0 +1,337 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stdarg.h>
+#include <stddef.h>
+
+#include "Log.h"
+#include "lib/NVIC.h"
+
+#define LOG_MASK        (LOG_BUFFER_SIZE - 1)
+#define LOG_BINARY_MARK 0xFF
+
+#if (LOG_BUFFER_SIZE & LOG_MASK) != 0
+#error "LOG_BUFFER_SIZE must be a power of two"
+#endif
+
+static UART *uart = NULL;
+
+// Written at head by any context with interrupts blocked, and sent from tail
+// by the main loop.
+static uint8_t           buffer[LOG_BUFFER_SIZE];
+static volatile uint32_t head = 0;
+static volatile uint32_t tail = 0;
+
+static uint32_t messages = 0;
+static uint32_t dropped  = 0;
+
+// Drops which have been logged, and as of the last reset of the stats.
+static uint32_t droppedLogged = 0;
+static uint32_t droppedReset  = 0;
+
+bool Log_Init(UART *handle)
+{
+    if (!handle) {
+        return false;
+    }
+
+    uart          = handle;
+    head          = 0;
+    tail          = 0;
+    messages      = 0;
+    dropped       = 0;
+    droppedLogged = 0;
+    droppedReset  = 0;
+    return true;
+}
+
+static bool Log__Put(const void *data, uint32_t size)
+{
+    bool logged = false;
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if ((LOG_BUFFER_SIZE - (head - tail)) < size) {
+        dropped++;
+    } else {
+        uint32_t offset = (head & LOG_MASK);
+        uint32_t first  = (LOG_BUFFER_SIZE - offset);
+        if (first > size) {
+            first = size;
+        }
+        __builtin_memcpy(&buffer[offset], data, first);
+        __builtin_memcpy(buffer, &((const uint8_t *)data)[first], (size - first));
+
+        head += size;
+        messages++;
+        logged = true;
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+
+    return logged;
+}
+
+typedef struct {
+    char     *data;
+    uintptr_t size;
+    uintptr_t length;
+} Log_Line;
+
+static void Log__Char(Log_Line *line, char c)
+{
+    if (line->length < line->size) {
+        line->data[line->length] = c;
+    }
+    line->length++;
+}
+
+static void Log__Field(Log_Line *line, const char *s, uintptr_t length,
+                       unsigned width, bool left, char pad)
+{
+    uintptr_t fill = ((width > length) ? (width - length) : 0);
+
+    // A sign goes ahead of any zero padding.
+    if ((pad == '0') && (length > 0) && ((*s == '-') || (*s == '+'))) {
+        Log__Char(line, *s++);
+        length--;
+    }
+
+    if (!left) {
+        for (; fill > 0; fill--) {
+            Log__Char(line, pad);
+        }
+    }
+    for (; length > 0; length--) {
+        Log__Char(line, *s++);
+    }
+    for (; fill > 0; fill--) {
+        Log__Char(line, ' ');
+    }
+}
+
+static uintptr_t Log__Format(char *data, uintptr_t size, const char *format, va_list args)
+{
+    Log_Line line = { .data = data, .size = size, .length = 0 };
+
+    const char *p;
+    for (p = format; *p != '\0'; p++) {
+        if (*p != '%') {
+            Log__Char(&line, *p);
+            continue;
+        }
+        p++;
+
+        bool left = false;
+        bool plus = false;
+        char pad  = ' ';
+        for (; (*p == '-') || (*p == '+') || (*p == '0'); p++) {
+            if (*p == '-') {
+                left = true;
+            } else if (*p == '+') {
+                plus = true;
+            } else {
+                pad = '0';
+            }
+        }
+        if (left) {
+            pad = ' ';
+        }
+
+        unsigned width = 0;
+        if (*p == '*') {
+            width = va_arg(args, unsigned);
+            p++;
+        } else {
+            for (; (*p >= '0') && (*p <= '9'); p++) {
+                width = ((width * 10) + (*p - '0'));
+            }
+        }
+        for (; (*p == 'l') || (*p == 'h') || (*p == 'z'); p++);
+
+        // Digits are built backwards from the end, behind room for a sign.
+        char digits[12];
+        char *d = &digits[sizeof(digits)];
+        unsigned base = 10;
+        bool upper    = false;
+        bool negative = false;
+        uint32_t value;
+
+        switch (*p) {
+        case '\0':
+            p--;
+            continue;
+
+        case 'c':
+            digits[0] = (char)va_arg(args, int);
+            Log__Field(&line, digits, 1, width, left, ' ');
+            continue;
+
+        case 's': {
+            const char *s = va_arg(args, const char *);
+            if (!s) {
+                s = "(null)";
+            }
+            Log__Field(&line, s, __builtin_strlen(s), width, left, ' ');
+            continue;
+        }
+
+        case 'd':
+        case 'i': {
+            int32_t sv = va_arg(args, int32_t);
+            negative = (sv < 0);
+            value = (negative ? (0U - (uint32_t)sv) : (uint32_t)sv);
+            break;
+        }
+
+        case 'p':
+            value = (uint32_t)(uintptr_t)va_arg(args, void *);
+            base  = 16;
+            break;
+
+        case 'X':
+            upper = true;
+            // Fall through.
+        case 'x':
+            base = 16;
+            // Fall through.
+        case 'o':
+            if (base == 10) {
+                base = 8;
+            }
+            // Fall through.
+        case 'u':
+            value = va_arg(args, uint32_t);
+            break;
+
+        default:
+            Log__Char(&line, *p);
+            continue;
+        }
+
+        do {
+            unsigned digit = (value % base);
+            *--d = (char)((digit < 10) ? ('0' + digit) : ((upper ? 'A' : 'a') + digit - 10));
+            value /= base;
+        } while (value != 0);
+        if (negative) {
+            *--d = '-';
+        } else if (plus && ((*p == 'd') || (*p == 'i'))) {
+            *--d = '+';
+        }
+        Log__Field(&line, d, (uintptr_t)(&digits[sizeof(digits)] - d), width, left, pad);
+    }
+
+    return ((line.length < size) ? line.length : size);
+}
+
+bool Log_Write(const void *data, uintptr_t size)
+{
+    return Log__Put(data, size);
+}
+
+bool Log_Print(const char *msg)
+{
+    return Log__Put(msg, __builtin_strlen(msg));
+}
+
+bool Log_Printf(const char *format, ...)
+{
+    char line[LOG_LINE_MAX];
+
+    va_list args;
+    va_start(args, format);
+    uintptr_t length = Log__Format(line, sizeof(line), format, args);
+    va_end(args);
+
+    return Log__Put(line, length);
+}
+
+static uint8_t *Log__Put32(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)(value >>  0);
+    p[1] = (uint8_t)(value >>  8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+    return &p[4];
+}
+
+bool Log_Binary(const char *format, unsigned count, ...)
+{
+    if (count > LOG_BINARY_ARGS) {
+        return false;
+    }
+
+    uint8_t record[1 + 4 + 1 + (LOG_BINARY_ARGS * 4)];
+    uint8_t *p = record;
+    *p++ = LOG_BINARY_MARK;
+    p = Log__Put32(p, (uint32_t)(uintptr_t)format);
+    *p++ = (uint8_t)count;
+
+    va_list args;
+    va_start(args, count);
+    unsigned i;
+    for (i = 0; i < count; i++) {
+        p = Log__Put32(p, va_arg(args, uint32_t));
+    }
+    va_end(args);
+
+    return Log__Put(record, (uint32_t)(p - record));
+}
+
+void Log_Drain(void)
+{
+    if (!uart || !UART_IsWriteComplete(uart)) {
+        return;
+    }
+
+    // Only reported once there's room, so the report isn't dropped itself and
+    // counts every drop till then.
+    uint32_t drops = dropped;
+    if ((drops != droppedLogged) && ((LOG_BUFFER_SIZE - (head - tail)) >= LOG_LINE_MAX)) {
+        if (Log_Printf("[%lu log messages dropped]\r\n", (drops - droppedLogged))) {
+            droppedLogged = drops;
+        }
+    }
+
+    uint32_t start = tail;
+    uint32_t size  = (head - start);
+    if (size == 0) {
+        return;
+    }
+
+    uint32_t offset = (start & LOG_MASK);
+    if (size > (LOG_BUFFER_SIZE - offset)) {
+        size = (LOG_BUFFER_SIZE - offset);
+    }
+    if (size > LOG_CHUNK) {
+        size = LOG_CHUNK;
+    }
+
+    if (UART_Write(uart, &buffer[offset], size) == ERROR_NONE) {
+        tail = (start + size);
+    }
+}
+
+void Log_Flush(void)
+{
+    if (!uart) {
+        return;
+    }
+
+    while ((tail != head) || !UART_IsWriteComplete(uart)) {
+        Log_Drain();
+    }
+}
+
+void Log_GetStats(Log_Stats *stats, bool reset)
+{
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (stats) {
+        stats->messages = messages;
+        stats->dropped  = (dropped - droppedReset);
+    }
+    if (reset) {
+        messages     = 0;
+        droppedReset = dropped;
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
@@ -0,0 +1,88 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef LOG_H_
+#define LOG_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lib/UART.h"
+
+// Logging for the bare-metal samples which costs the caller microseconds, not
+// the milliseconds the debug UART takes to send a line.
+//
+// Messages are formatted into a ring buffer, and handed to the UART from the
+// main loop by Log_Drain() a chunk at a time, each once the driver has sent
+// the last, so UART_Write never waits for room. A message which doesn't fit is
+// dropped whole and counted, and the count is logged once there's room again.
+// Messages are copied in with interrupts blocked, so any context may log.
+//
+//     Log_Init(debug);
+//     Log_Printf("Block %lu is as expected\r\n", blockID);
+//
+//     for (;;) {
+//         __asm__("wfi");
+//         EventQueue_Dispatch();
+//         Log_Drain();
+//     }
+//
+// Log_Printf() understands %d, %i, %u, %x, %X, %o, %c, %s, %p and %%, with the
+// '-', '+' and '0' flags and a width. Every integer is 32 bits, so the l, h
+// and z modifiers are accepted and ignored.
+//
+// LOG_BINARY() goes further and doesn't format at all, logging only the
+// address of the format string and up to LOG_BINARY_ARGS integer arguments.
+// The host tool utils/log_decode.py looks the strings up in the application's
+// ELF file and formats them there, passing any text logged between them
+// through. Each record is a 0xFF byte, which text never contains, the format
+// address, a count of arguments, and the arguments, all little endian.
+
+// Must be a power of two.
+#ifndef LOG_BUFFER_SIZE
+#define LOG_BUFFER_SIZE 4096
+#endif
+
+// Longest message Log_Printf() formats, any more being cut off.
+#ifndef LOG_LINE_MAX
+#define LOG_LINE_MAX 128
+#endif
+
+// Most bytes handed to the UART at once.
+#ifndef LOG_CHUNK
+#define LOG_CHUNK 32
+#endif
+
+#define LOG_BINARY_ARGS 6
+
+typedef struct {
+    uint32_t messages;
+    uint32_t dropped;
+} Log_Stats;
+
+// Starts logging to uart, which should be opened first.
+bool Log_Init(UART *uart);
+
+// Return false if the message was dropped.
+bool Log_Write(const void *data, uintptr_t size);
+bool Log_Print(const char *msg);
+bool Log_Printf(const char *format, ...) __attribute__((format(printf, 1, 2)));
+bool Log_Binary(const char *format, unsigned count, ...);
+
+#define LOG_BINARY(format, ...) \
+    Log_Binary(format, LOG__COUNT(__VA_ARGS__), ##__VA_ARGS__)
+
+#define LOG__COUNT(...) LOG__COUNT_(0, ##__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+#define LOG__COUNT_(_0, _1, _2, _3, _4, _5, _6, count, ...) count
+
+// Hands the next chunk to the UART if it's done with the last. Called from the
+// main loop, which the UART interrupt wakes as each chunk is sent.
+void Log_Drain(void);
+
+// Waits until everything logged has been sent, such as before writing to the
+// UART directly.
+void Log_Flush(void);
+
+void Log_GetStats(Log_Stats *stats, bool reset);
+
+#endif // #ifndef LOG_H_
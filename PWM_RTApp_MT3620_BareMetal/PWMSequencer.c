@@ -0,0 +1,94 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "PWMSequencer.h"
+#include "lib/GPIO.h"
+#include "lib/NVIC.h"
+#include <stddef.h>
+
+// Registers of each PWM group, as laid out in the MT3620 datasheet. The PWM
+// driver only exposes PWM_ConfigurePin, which sets a channel's clock and
+// states up from scratch, so the state 0 parameter register, holding the on
+// and off times, is defined here to be written on its own each step.
+#define PWM_GROUP_BASE(group)     ((uintptr_t)0x38011000 + ((group) * 0x10000))
+#define PWM_GROUP_CHANNELS        4
+#define PWM_PARAM_S0(channel)     ((0x14 + ((channel) * 0x10)) / 4)
+#define PWM_PARAM_S0_ON_SHIFT     0
+#define PWM_PARAM_S0_OFF_SHIFT    16
+#define PWM_PARAM_S0_TIME_MAX     0xFFFF
+
+static const PWMSequencer_Channel *channels = NULL;
+static unsigned                    count    = 0;
+static uint32_t                    period;
+
+// Where each channel is in its table, its on time as last written, and its
+// parameter register.
+static uintptr_t          position[PWM_SEQUENCER_CHANNELS_MAX];
+static uint16_t           onTime[PWM_SEQUENCER_CHANNELS_MAX];
+static volatile uint32_t *param[PWM_SEQUENCER_CHANNELS_MAX];
+
+bool PWMSequencer_Init(
+    const PWMSequencer_Channel *newChannels, unsigned newCount,
+    uint32_t clockFrequency, uint32_t newPeriod)
+{
+    if ((!newChannels && (newCount > 0)) || (newCount > PWM_SEQUENCER_CHANNELS_MAX)
+        || (newPeriod == 0) || (newPeriod > PWM_PARAM_S0_TIME_MAX)) {
+        return false;
+    }
+
+    unsigned c;
+    for (c = 0; c < newCount; c++) {
+        const PWMSequencer_Channel *channel = &newChannels[c];
+        if (!channel->table || (channel->length == 0)
+            || (channel->pin >= PWM_SEQUENCER_CHANNELS_MAX)) {
+            return false;
+        }
+    }
+
+    bool success = true;
+
+    // The driver sets each channel up, after which only the on and off
+    // times are touched.
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    channels = newChannels;
+    count    = newCount;
+    period   = newPeriod;
+    for (c = 0; c < count; c++) {
+        uint32_t pin = channels[c].pin;
+        position[c] = (channels[c].phase % channels[c].length);
+        onTime[c]   = channels[c].table[position[c]];
+        param[c]    = &((volatile uint32_t *)PWM_GROUP_BASE(pin / PWM_GROUP_CHANNELS))
+            [PWM_PARAM_S0(pin % PWM_GROUP_CHANNELS)];
+        if (PWM_ConfigurePin(pin, clockFrequency, onTime[c], period) != ERROR_NONE) {
+            success = false;
+        }
+    }
+    // Nothing is stepped unless every channel was set up.
+    if (!success) {
+        count = 0;
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+
+    return success;
+}
+
+void PWMSequencer_Step(void)
+{
+    unsigned c;
+    for (c = 0; c < count; c++) {
+        const PWMSequencer_Channel *channel = &channels[c];
+
+        uintptr_t i = (position[c] + 1);
+        if (i >= channel->length) {
+            i = 0;
+        }
+        position[c] = i;
+
+        uint16_t on = channel->table[i];
+        if (on != onTime[c]) {
+            onTime[c] = on;
+            *param[c] = (((uint32_t)on << PWM_PARAM_S0_ON_SHIFT)
+                | ((period - on) << PWM_PARAM_S0_OFF_SHIFT));
+        }
+    }
+}
@@ -0,0 +1,42 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef PWM_SEQUENCER_H_
+#define PWM_SEQUENCER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Steps PWM outputs through tables of on times, such as gamma corrected fades
+// generated at build time by utils/pwm_table.py, all from one timer interrupt.
+//
+// Every channel moves one entry along its table on each step, wrapping at the
+// end, and starts at its own phase so that channels can share a table. The on
+// time is only written to the PWM when it changes from the last step's, which
+// in the dim end of a gamma corrected table is most steps. A step then writes
+// just the channel's on and off time register, as the driver has already set
+// the rest up, and nothing else is worked out per step.
+
+typedef struct {
+    uint32_t        pin;     // PWM pin, numbered as a GPIO.
+    const uint16_t *table;   // On times, in counts of the period.
+    uintptr_t       length;  // Entries in the table.
+    uintptr_t       phase;   // Entry the channel starts at.
+} PWMSequencer_Channel;
+
+// The most channels which can be sequenced, one per PWM output.
+#define PWM_SEQUENCER_CHANNELS_MAX 12
+
+// Sets every channel to the start of its table. Each PWM runs at
+// clockFrequency, with period counts to a cycle, at most 65535, and no on
+// time in a table may exceed period. channels is kept until the next call, so
+// must stay valid meanwhile. Returns false if a channel is invalid or a pin
+// can't be set up, in which case nothing is stepped.
+bool PWMSequencer_Init(
+    const PWMSequencer_Channel *channels, unsigned count,
+    uint32_t clockFrequency, uint32_t period);
+
+// Moves every channel on to its next entry, to be called from the timer.
+void PWMSequencer_Step(void);
+
+#endif // #ifndef PWM_SEQUENCER_H_
@@ -13,6 +13,8 @@
 #include "lib/UART.h"
 #include "lib/Print.h"
 
+#include "PWMSequencer.h"
+
 static UART* debug = NULL;
 
 #define LED_1_R 8
@@ -23,79 +25,43 @@ static UART* debug = NULL;
 #define TIMER_SPEED_HZ 32768
 #define TIMER_COUNT_MS 10
 
-#define PWM_BASE_COUNT 1024
-#define PWM_STEP_SIZE 4
-
 #define PWM_CLOCK_FREQUENCY 2000000
 
-static GPT *timer = NULL;
-
-static uint32_t pwmOnTime3 = 0;
-static bool pwmState3 = false;
-static uint32_t pwmRGB[3] = {};
-static uint32_t pwmState0 = 0;
+// The PWM period in counts, and the timer ticks each fade takes, are given by
+// CMakeLists.txt to match the tables it generates.
+#ifndef PWM_BASE_COUNT
+#define PWM_BASE_COUNT 1024
+#endif
+#ifndef PWM_FADE_STEPS
+#define PWM_FADE_STEPS 256
+#endif
 
-void pwmLed(uint32_t pin, uint32_t *pwmOnTime, uint32_t pwmStepSize, bool increment) {
-    *pwmOnTime = increment ? (*pwmOnTime + pwmStepSize) : (*pwmOnTime - pwmStepSize);
-    PWM_ConfigurePin(pin, PWM_CLOCK_FREQUENCY, *pwmOnTime, PWM_BASE_COUNT);
-}
+static GPT *timer = NULL;
 
-void pwmLedFade(uint32_t pin, uint32_t *pwmOnTime, bool *pwmState) {
-    if (*pwmOnTime > PWM_BASE_COUNT - PWM_STEP_SIZE) {
-        *pwmState = false;
-    }
-    else if (*pwmOnTime < PWM_STEP_SIZE) {
-        *pwmState = true;
-    }
-    pwmLed(pin, pwmOnTime, PWM_STEP_SIZE, *pwmState);
-}
+// Gamma corrected versions of the fades at PWM_BASE_COUNT.
+static const uint16_t hue[] = {
+    #include "hue.h"
+};
+static const uint16_t breathe[] = {
+    #include "breathe.h"
+};
+
+// LED 1 shares one channel of a colour wheel between its colours, each at a
+// different point of it, so it moves through red, yellow, green, cyan, blue
+// and magenta. LED 6 breathes on and off.
+#define HUE_LENGTH     (sizeof(hue) / sizeof(hue[0]))
+#define BREATHE_LENGTH (sizeof(breathe) / sizeof(breathe[0]))
+
+static const PWMSequencer_Channel channels[] = {
+    {.pin = LED_1_R, .table = hue,     .length = HUE_LENGTH,     .phase = 0                   },
+    {.pin = LED_1_G, .table = hue,     .length = HUE_LENGTH,     .phase = (4 * PWM_FADE_STEPS)},
+    {.pin = LED_1_B, .table = hue,     .length = HUE_LENGTH,     .phase = (2 * PWM_FADE_STEPS)},
+    {.pin = LED_6_B, .table = breathe, .length = BREATHE_LENGTH, .phase = 0                   },
+};
 
 void callback(GPT *handle) {
-    pwmLedFade(LED_6_B, &pwmOnTime3, &pwmState3);
-    switch (pwmState0) {
-        //Increment red - initial state used once
-        case 0:
-            pwmLed(LED_1_R, &pwmRGB[0], PWM_STEP_SIZE, 1);
-            if (pwmRGB[0]> PWM_BASE_COUNT)
-                pwmState0 = 1;
-            break;
-        //Increment green
-        case 1:
-            pwmLed(LED_1_G, &pwmRGB[1], PWM_STEP_SIZE, 1);
-            if (pwmRGB[1] > PWM_BASE_COUNT)
-                pwmState0 = 2;
-            break;
-        //Decrement red
-        case 2:
-            pwmLed(LED_1_R, &pwmRGB[0], PWM_STEP_SIZE, 0);
-            if (pwmRGB[0] == 0)
-                pwmState0 = 3;
-            break;
-        //Increment blue
-        case 3:
-            pwmLed(LED_1_B, &pwmRGB[2], PWM_STEP_SIZE, 1);
-            if (pwmRGB[2] > PWM_BASE_COUNT)
-                pwmState0 = 4;
-            break;
-        //Decrement green
-        case 4:
-            pwmLed(LED_1_G, &pwmRGB[1], PWM_STEP_SIZE, 0);
-            if (pwmRGB[1] == 0)
-                pwmState0 = 5;
-            break;
-        //Increment red
-        case 5:
-            pwmLed(LED_1_R, &pwmRGB[0], PWM_STEP_SIZE, 1);
-            if (pwmRGB[0] > PWM_BASE_COUNT)
-                pwmState0 = 6;
-            break;
-        //Decrement blue
-        case 6:
-            pwmLed(LED_1_B, &pwmRGB[2], PWM_STEP_SIZE, 0);
-            if (pwmRGB[2] == 0)
-                pwmState0 = 1;
-            break;
-    }
+    (void)handle;
+    PWMSequencer_Step();
 }
 
 
@@ -108,13 +74,8 @@ _Noreturn void RTCoreMain(void)
     UART_Print(debug, "PWM_RTApp_MT3620_BareMetal\r\n");
     UART_Print(debug, "App built on: " __DATE__ ", " __TIME__ "\r\n");
 
-    int32_t status = 0;
-    status += PWM_ConfigurePin(LED_1_R, PWM_CLOCK_FREQUENCY, 0, PWM_STEP_SIZE);
-    status += PWM_ConfigurePin(LED_1_G, PWM_CLOCK_FREQUENCY, 0, PWM_STEP_SIZE);
-    status += PWM_ConfigurePin(LED_1_B, PWM_CLOCK_FREQUENCY, 0, PWM_STEP_SIZE);
-    status += PWM_ConfigurePin(LED_6_B, PWM_CLOCK_FREQUENCY, 0, PWM_STEP_SIZE);
-
-    if (status != 0) {
+    if (!PWMSequencer_Init(channels, (sizeof(channels) / sizeof(channels[0])),
+        PWM_CLOCK_FREQUENCY, PWM_BASE_COUNT)) {
         UART_Print(debug, "ERROR: PWM initialisation failed\r\n");
     }
 
@@ -0,0 +1,47 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef PLACEMENT_H_
+#define PLACEMENT_H_
+
+// Pins hot code and the data it reads into TCM, whichever regions a sample's
+// linker script puts the rest of the image in.
+//
+// TCM is the M4's own zero wait state memory, where SYSRAM is shared with the
+// A7 and the flash is executed in place through a cache, so a miss in an
+// interrupt or a render loop costs wait states which aren't the same twice.
+// Functions marked TCM_CODE, tables marked TCM_RODATA, and variables marked
+// TCM_DATA are gathered into the .tcm section, which Placement.ld places in
+// TCM and which the loader copies there along with the rest of the image:
+//
+//     static TCM_RODATA const uint16_t table[] = {
+//         #include "table.h"
+//     };
+//
+//     TCM_CODE void Render(int16_t *data, uintptr_t frames)
+//     {
+//         ...
+//     }
+//
+// A sample using them must link with Placement.ld, by including it after the
+// drivers' script in its linker.ld:
+//
+//     INCLUDE lib/linker.ld
+//     INCLUDE Placement.ld
+//
+// with the Placement directory passed to the linker with -L, or the sections
+// are left for the linker to place wherever it sees fit.
+//
+// Calls between TCM and flash are too far for a BL, so the linker goes
+// through a veneer for them. Only what's hot is worth moving, and what it
+// calls should go with it, so a TCM_CODE function calling a flash one still
+// pays for the flash. utils/section_report.py shows what ended up where.
+
+#define TCM_CODE   __attribute__((section(".tcm_text")))
+#define TCM_RODATA __attribute__((section(".tcm_rodata")))
+#define TCM_DATA   __attribute__((section(".tcm_data")))
+
+// SYSRAM is the memory the M4's DMA can reach, so it's where DMA buffers go.
+#define SYSRAM_DATA __attribute__((section(".sysram")))
+
+#endif // #ifndef PLACEMENT_H_
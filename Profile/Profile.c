@@ -0,0 +1,202 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stddef.h>
+
+#include "Profile.h"
+#include "lib/CPUFreq.h"
+#include "lib/NVIC.h"
+#include "lib/Print.h"
+
+#define DEMCR       (*(volatile uint32_t *)0xE000EDFC)
+#define DWT_CTRL    (*(volatile uint32_t *)0xE0001000)
+
+#define DEMCR_TRCENA        (1U << 24)
+#define DWT_CTRL_CYCCNTENA  (1U << 0)
+#define DWT_CTRL_NOCYCCNT   (1U << 25)
+
+// Labels are cut short to this in dumps.
+#define PROFILE_LABEL_MAX   32
+
+#define PROFILE_HEADER_SIZE 16
+#define PROFILE_RECORD_SIZE (1 + PROFILE_LABEL_MAX + (3 * 4) + 8 + (PROFILE_BUCKETS * 4))
+
+// Empty measurements made to find the overhead of reading the clock.
+#define PROFILE_CALIBRATIONS 8
+
+GPT *Profile__Fallback = NULL;
+
+// Registered markers, most recently first.
+static Profile_Marker *markers = NULL;
+
+static uint32_t overhead = 0;
+
+bool Profile_Init(GPT *fallback)
+{
+    DEMCR |= DEMCR_TRCENA;
+    if ((DWT_CTRL & DWT_CTRL_NOCYCCNT) == 0) {
+        DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+        Profile__Fallback = NULL;
+    } else if (fallback) {
+        Profile__Fallback = fallback;
+    } else {
+        return false;
+    }
+
+    // The quickest of a few is what a read costs, without any interrupt.
+    overhead = UINT32_MAX;
+    unsigned i;
+    for (i = 0; i < PROFILE_CALIBRATIONS; i++) {
+        uint32_t start   = Profile_Now();
+        uint32_t elapsed = (Profile_Now() - start);
+        if (elapsed < overhead) {
+            overhead = elapsed;
+        }
+    }
+    return true;
+}
+
+static unsigned Profile__Bucket(uint32_t elapsed)
+{
+    unsigned bits   = (32 - __builtin_clz(elapsed | 1));
+    unsigned bucket = ((bits - 1) / 2);
+    return ((bucket < PROFILE_BUCKETS) ? bucket : (PROFILE_BUCKETS - 1));
+}
+
+void Profile_Record(Profile_Marker *marker, uint32_t elapsed)
+{
+    elapsed = ((elapsed > overhead) ? (elapsed - overhead) : 0);
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (!marker->registered) {
+        marker->registered = true;
+        marker->next = markers;
+        markers = marker;
+    }
+
+    marker->count++;
+    marker->total += elapsed;
+    if (elapsed < marker->min) {
+        marker->min = elapsed;
+    }
+    if (elapsed > marker->max) {
+        marker->max = elapsed;
+    }
+    marker->histogram[Profile__Bucket(elapsed)]++;
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+// Copies the marker's statistics all at once, so they're consistent while
+// they're written out.
+static void Profile__Snapshot(Profile_Marker *marker, Profile_Marker *copy, bool reset)
+{
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    *copy = *marker;
+    if (reset) {
+        marker->count = 0;
+        marker->total = 0;
+        marker->min   = UINT32_MAX;
+        marker->max   = 0;
+        __builtin_memset(marker->histogram, 0, sizeof(marker->histogram));
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+static uint32_t Profile__ClockHz(void)
+{
+    if (!Profile__Fallback) {
+        return CPUFreq_Get();
+    }
+
+    float speed;
+    if (GPT_GetSpeed(Profile__Fallback, &speed) != ERROR_NONE) {
+        return 0;
+    }
+    return (uint32_t)speed;
+}
+
+void Profile_Print(UART *debug, bool reset)
+{
+    UART_Printf(debug, "INFO: Profile clock %lu Hz, overhead %lu\r\n",
+                Profile__ClockHz(), overhead);
+
+    Profile_Marker *marker;
+    for (marker = markers; marker != NULL; marker = marker->next) {
+        Profile_Marker stats;
+        Profile__Snapshot(marker, &stats, reset);
+
+        uint32_t mean = (stats.count > 0 ? (uint32_t)(stats.total / stats.count) : 0);
+        UART_Printf(debug, "INFO: %-16s %8lu calls, min %8lu, mean %8lu, max %8lu\r\n",
+                    stats.label, stats.count, (stats.count > 0 ? stats.min : 0),
+                    mean, stats.max);
+    }
+}
+
+static uint8_t *Profile__Put(uint8_t *p, uint64_t value, unsigned size)
+{
+    unsigned i;
+    for (i = 0; i < size; i++) {
+        *p++ = (uint8_t)(value >> (i * 8));
+    }
+    return p;
+}
+
+bool Profile_Dump(Profile_Writer write, void *context, bool reset)
+{
+    if (!write) {
+        return false;
+    }
+
+    // Markers registered meanwhile go in front, so aren't counted or written.
+    Profile_Marker *first = markers;
+    Profile_Marker *marker;
+    unsigned count = 0;
+    for (marker = first; marker != NULL; marker = marker->next) {
+        count++;
+    }
+
+    uint8_t header[PROFILE_HEADER_SIZE];
+    uint8_t *p = header;
+    __builtin_memcpy(p, "PRF1", 4);
+    p = Profile__Put(&p[4], Profile__ClockHz(), 4);
+    p = Profile__Put(p, overhead, 4);
+    p = Profile__Put(p, count, 2);
+    p = Profile__Put(p, PROFILE_BUCKETS, 2);
+    if (!write(context, header, sizeof(header))) {
+        return false;
+    }
+
+    for (marker = first; marker != NULL; marker = marker->next) {
+        Profile_Marker stats;
+        Profile__Snapshot(marker, &stats, reset);
+
+        uint8_t record[PROFILE_RECORD_SIZE];
+        unsigned length = __builtin_strlen(stats.label);
+        if (length > PROFILE_LABEL_MAX) {
+            length = PROFILE_LABEL_MAX;
+        }
+
+        p = Profile__Put(record, length, 1);
+        __builtin_memcpy(p, stats.label, length);
+        p = Profile__Put(&p[length], stats.count, 4);
+        p = Profile__Put(p, (stats.count > 0 ? stats.min : 0), 4);
+        p = Profile__Put(p, stats.max, 4);
+        p = Profile__Put(p, stats.total, 8);
+
+        unsigned b;
+        for (b = 0; b < PROFILE_BUCKETS; b++) {
+            p = Profile__Put(p, stats.histogram[b], 4);
+        }
+
+        if (!write(context, record, (uintptr_t)(p - record))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Profile_WriteUART(void *context, const void *data, uintptr_t size)
+{
+    return (UART_Write((UART *)context, data, size) == ERROR_NONE);
+}
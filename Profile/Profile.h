@@ -0,0 +1,147 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lib/GPT.h"
+#include "lib/UART.h"
+
+// Cycle accurate timing of hot paths for the bare-metal samples.
+//
+// Each marker gathers how many times the code between its begin and end ran,
+// the shortest, longest and total time it took, and a histogram of the times.
+// Times are counted in cycles by the DWT cycle counter, or in ticks of a free
+// running GPT on a core without one. What reading the clock costs is measured
+// by Profile_Init() and taken off each time recorded, so a record costs the
+// code being timed nothing more than two reads of the counter.
+//
+// None of it is compiled in unless PROFILE_ENABLE is defined, as the PROFILE
+// CMake option of each sample using it does, so markers can be left in
+// drivers for good.
+//
+//     PROFILE_MARKER(SD_ReadBlocks);
+//
+//     bool SD_ReadBlocks(SDCard *card, uint32_t addr, uint32_t count, void *data)
+//     {
+//         PROFILE_SCOPE(SD_ReadBlocks);
+//         ...
+//     }
+//
+//     PROFILE_INIT(NULL);
+//     PROFILE_PRINT(debug, true);
+//
+// A marker may be recorded from one interrupt and the main loop, or from any
+// number of them, as each record is made with interrupts blocked. Markers are
+// registered the first time they're recorded, so only those which have run
+// are reported.
+//
+// Profile_Dump() writes the same statistics without any formatting, for a host
+// tool to read from the UART or the intercore socket. All fields are little
+// endian:
+//
+//     char     magic[4] = "PRF1"
+//     uint32_t clock       // Hz
+//     uint32_t overhead    // Ticks taken off each record.
+//     uint16_t markers
+//     uint16_t buckets
+//
+// followed by each marker:
+//
+//     uint8_t  length
+//     char     label[length]
+//     uint32_t count, min, max
+//     uint64_t total
+//     uint32_t histogram[buckets]
+
+// Bucket n of the histogram counts times from 4^n to 4^(n + 1) - 1 ticks,
+// except that the first starts at 0 and the last has no end.
+#define PROFILE_BUCKETS 16
+
+typedef struct Profile_Marker Profile_Marker;
+
+struct Profile_Marker {
+    const char     *label;
+    uint32_t        count;
+    uint32_t        min;
+    uint32_t        max;
+    uint64_t        total;
+    uint32_t        histogram[PROFILE_BUCKETS];
+    bool            registered;
+    Profile_Marker *next;
+};
+
+typedef struct {
+    Profile_Marker *marker;
+    uint32_t        start;
+} Profile_Scope;
+
+// Writes size bytes of a dump, returning false on failure.
+typedef bool (*Profile_Writer)(void *context, const void *data, uintptr_t size);
+
+// Starts the DWT cycle counter, or where the core has none times with
+// fallback, which must be a free running 32 bit GPT. Returns false if neither
+// can be used.
+bool Profile_Init(GPT *fallback);
+
+// Adds a time in ticks to the marker, before the clock's overhead is taken off.
+void Profile_Record(Profile_Marker *marker, uint32_t elapsed);
+
+// Prints the statistics of every marker recorded so far, and resets them if
+// reset.
+void Profile_Print(UART *debug, bool reset);
+
+// As Profile_Print() but in binary, through write. Returns false if a write
+// fails, after which no more markers are written or reset.
+bool Profile_Dump(Profile_Writer write, void *context, bool reset);
+
+// A writer for Profile_Dump() to a UART given as the context.
+bool Profile_WriteUART(void *context, const void *data, uintptr_t size);
+
+// The GPT being timed with, or NULL for the cycle counter.
+extern GPT *Profile__Fallback;
+
+static inline uint32_t Profile_Now(void)
+{
+    if (Profile__Fallback) {
+        return GPT_GetCount(Profile__Fallback);
+    }
+    return *(volatile uint32_t *)0xE0001004;
+}
+
+static inline void Profile__ScopeExit(Profile_Scope *scope)
+{
+    Profile_Record(scope->marker, (Profile_Now() - scope->start));
+}
+
+#ifdef PROFILE_ENABLE
+#define PROFILE_MARKER(name) \
+    static Profile_Marker profile__##name = { .label = #name, .min = UINT32_MAX }
+
+#define PROFILE_BEGIN(name) \
+    uint32_t profile__##name##_start = Profile_Now()
+#define PROFILE_END(name) \
+    Profile_Record(&profile__##name, (Profile_Now() - profile__##name##_start))
+
+// Times from here to the end of the enclosing block, however it's left.
+#define PROFILE_SCOPE(name) \
+    Profile_Scope profile__##name##_scope __attribute__((cleanup(Profile__ScopeExit))) \
+        = { .marker = &profile__##name, .start = Profile_Now() }
+
+#define PROFILE_INIT(fallback)              (void)Profile_Init(fallback)
+#define PROFILE_PRINT(debug, reset)         Profile_Print(debug, reset)
+#define PROFILE_DUMP(write, context, reset) (void)Profile_Dump(write, context, reset)
+#else
+#define PROFILE_MARKER(name)                struct profile__##name
+#define PROFILE_BEGIN(name)                 do {} while (0)
+#define PROFILE_END(name)                   do {} while (0)
+#define PROFILE_SCOPE(name)                 do {} while (0)
+#define PROFILE_INIT(fallback)              do {} while (0)
+#define PROFILE_PRINT(debug, reset)         do {} while (0)
+#define PROFILE_DUMP(write, context, reset) do {} while (0)
+#endif
+
+#endif // #ifndef PROFILE_H_
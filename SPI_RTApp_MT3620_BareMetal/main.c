@@ -9,126 +9,144 @@
 #include "lib/VectorTable.h"
 #include "lib/NVIC.h"
 #include "lib/GPIO.h"
-#include "lib/GPT.h"
 #include "lib/UART.h"
 #include "lib/Print.h"
 #include "lib/SPIMaster.h"
 
 #include "LSM6DS3.h"
+#include "EventQueue.h"
+#include "Input.h"
+#include "Placement.h"
+
+// Samples are taken at 1.66 kHz and collected by the FIFO, each being the
+// gyroscope then the accelerometer, three words for each.
+#define IMU_ODR            8
+#define IMU_FIFO_FRAME     6
+#define IMU_FIFO_THRESHOLD (64 * IMU_FIFO_FRAME)
+#define IMU_FIFO_DATA_SIZE (2 * IMU_FIFO_THRESHOLD)
 
 
 static const uint32_t buttonAGpio = 12;
-static const int buttonPressCheckPeriodMs = 10;
-static void HandleButtonTimerIrq(GPT *);
-static void HandleButtonTimerIrqDeferred(void);
+static void HandleButtonDeferred(void *payload);
+
+// INT1 of the LSM6DS3 is raised when the FIFO reaches its watermark.
+static const uint32_t imuInt1Gpio = 2;
+static void HandleFIFOWatermarkDeferred(void *payload);
+
+static SYSRAM_DATA int16_t fifoData[IMU_FIFO_DATA_SIZE];
+static int16_t  fifoFrame[IMU_FIFO_FRAME];
+static uint32_t fifoFrames   = 0;
+static uint32_t fifoBatches  = 0;
+static uint32_t fifoOverruns = 0;
 
 static SPIMaster *driver = NULL;
+static LSM6DS3   *imu    = NULL;
 static UART      *debug  = NULL;
-static GPT *buttonTimeout = NULL;
 
 static const uint32_t spiChipSelectGPIO = 0;
 
-typedef struct CallbackNode {
-    bool enqueued;
-    struct CallbackNode *next;
-    void (*cb)(void);
-} CallbackNode;
+// Each button press is passed to the main loop, while one pending watermark
+// covers any repeats, as the handler drains all there is.
+EVENT_QUEUE_DEFINE(buttonEvents, Input_Event, 4);
+EVENT_QUEUE_DEFINE_SIGNAL(fifoEvents, 1);
 
-static void EnqueueCallback(CallbackNode *node);
+static void HandleFIFOWatermarkDeferred(void *payload)
+{
+    (void)payload;
+
+    uintptr_t count;
+    do {
+        unsigned pattern;
+        uint8_t  status;
+        if (!LSM6DS3_ReadFIFO(imu, fifoData, IMU_FIFO_DATA_SIZE, &count, &pattern, &status)) {
+            UART_Print(debug, "ERROR: Failed to read LSM6DS3 FIFO.\r\n");
+            return;
+        }
+        if (status & LSM6DS3_FIFO_STATUS2_OVER_RUN) {
+            fifoOverruns++;
+        }
+
+        // Place each word by its position in the pattern, so a frame split
+        // between batches is still put together.
+        uintptr_t i;
+        for (i = 0; i < count; i++) {
+            unsigned slot = ((pattern + i) % IMU_FIFO_FRAME);
+            fifoFrame[slot] = fifoData[i];
+            if (slot == (IMU_FIFO_FRAME - 1)) {
+                fifoFrames++;
+            }
+        }
+        if (count > 0) {
+            fifoBatches++;
+        }
+    } while (count == IMU_FIFO_DATA_SIZE);
+}
 
-static void HandleButtonTimerIrq(GPT *handle)
+static void displayFIFO(void)
 {
-    (void)handle;
-    static CallbackNode cbn = {.enqueued = false, .cb = HandleButtonTimerIrqDeferred};
-    EnqueueCallback(&cbn);
+    LSM6DS3_Data raw = { .temp = 0 };
+    __builtin_memcpy(raw.g , &fifoFrame[0], sizeof(raw.g));
+    __builtin_memcpy(raw.xl, &fifoFrame[3], sizeof(raw.xl));
+
+    LSM6DS3_DataHuman data;
+    if (!LSM6DS3_DataToHuman(imu, &raw, &data)) {
+        return;
+    }
+
+    UART_Printf(debug, "INFO: FIFO: %lu frames in %lu batches, %lu overruns.\r\n",
+                fifoFrames, fifoBatches, fifoOverruns);
+    UART_Printf(debug, "INFO: FIFO acceleration: %.3f, %.3f, %.3f\r\n",
+                ((float)data.xl[0]) / 1000, ((float)data.xl[1]) / 1000, ((float)data.xl[2]) / 1000);
+    UART_Printf(debug, "INFO: FIFO gyroscope: %.3f, %.3f, %.3f\r\n",
+                ((float)data.g[0]) / 1000, ((float)data.g[1]) / 1000, ((float)data.g[2]) / 1000);
+    UART_Print(debug, "\r\n");
 }
 
 static void displaySensors()
 {
     bool hasXL = false, hasG = false, hasTemp = false;
-    if (!LSM6DS3_Status(driver, &hasTemp, &hasG, &hasXL)) {
+    if (!LSM6DS3_Status(imu, &hasTemp, &hasG, &hasXL)) {
         UART_Print(debug, "ERROR: Failed to read accelerometer status register.\r\n");
     } else {
-        int16_t x, y, z;
+        // Read every output in one burst so they come from the same sample.
+        LSM6DS3_DataHuman data;
+        if (!LSM6DS3_ReadAllHuman(imu, &data)) {
+            UART_Print(debug, "ERROR: Failed to read sensor data registers.\r\n");
+            return;
+        }
+
         if (!hasXL) {
             UART_Print(debug, "INFO: No accelerometer data.\r\n");
-        } else if (!LSM6DS3_ReadXLHuman(driver, &x, &y, &z)) {
-            UART_Print(debug, "ERROR: Failed to read accelerometer data register.\r\n");
         } else {
             UART_Printf(debug, "INFO: Acceleration: %.3f, %.3f, %.3f\r\n",
-                        ((float)x) / 1000, ((float)y) / 1000, ((float)z) / 1000);
+                        ((float)data.xl[0]) / 1000, ((float)data.xl[1]) / 1000, ((float)data.xl[2]) / 1000);
         }
 
         if (!hasG) {
             UART_Print(debug, "INFO: No gyroscope data.\r\n");
-        } else if (!LSM6DS3_ReadGHuman(driver, &x, &y, &z)) {
-            UART_Print(debug, "ERROR: Failed to read gyroscope data register.\r\n");
         } else {
             UART_Printf(debug, "INFO: Gyroscope: %.3f, %.3f, %.3f\r\n",
-                        ((float)x) / 1000, ((float)y) / 1000, ((float)z) / 1000);
+                        ((float)data.g[0]) / 1000, ((float)data.g[1]) / 1000, ((float)data.g[2]) / 1000);
         }
 
-        int16_t t;
         if (!hasTemp) {
             UART_Print(debug, "INFO: No temperature data.\r\n");
-        } else if (!LSM6DS3_ReadTempHuman(driver, &t)) {
-            UART_Print(debug, "ERROR: Failed to read temperature data register.\r\n");
         } else {
-            UART_Printf(debug, "INFO: Temperature: %.3f\r\n", ((float)t) / 1000);
+            UART_Printf(debug, "INFO: Temperature: %.3f\r\n", ((float)data.temp) / 1000);
         }
         UART_Print(debug, "\r\n");
     }
 }
 
-static void HandleButtonTimerIrqDeferred(void)
+static void HandleButtonDeferred(void *payload)
 {
-    // Assume initial state is high, i.e. button not pressed.
-    static bool prevState = true;
-    bool newState;
-    GPIO_Read(buttonAGpio, &newState);
-
-    if (newState != prevState) {
-        bool pressed = !newState;
-        if (pressed) {
-            displaySensors();
-        }
-
-        prevState = newState;
+    const Input_Event *event = payload;
+    if (event->pressed) {
+        displaySensors();
+        displayFIFO();
     }
 }
 
-static CallbackNode *volatile callbacks = NULL;
-
-static void EnqueueCallback(CallbackNode *node)
-{
-    uint32_t prevBasePri = NVIC_BlockIRQs();
-    if (!node->enqueued) {
-        CallbackNode *prevHead = callbacks;
-        node->enqueued = true;
-        callbacks = node;
-        node->next = prevHead;
-    }
-    NVIC_RestoreIRQs(prevBasePri);
-}
-
-static void InvokeCallbacks(void)
-{
-    CallbackNode *node;
-    do {
-        uint32_t prevBasePri = NVIC_BlockIRQs();
-        node = callbacks;
-        if (node) {
-            node->enqueued = false;
-            callbacks = node->next;
-        }
-        NVIC_RestoreIRQs(prevBasePri);
-
-        if (node) {
-            (*node->cb)();
-        }
-    } while (node);
-}
-
 static void gpioSPIChipSelect(SPIMaster *handle, bool select)
 {
     if (!handle) {
@@ -150,6 +168,10 @@ _Noreturn void RTCoreMain(void)
     UART_Print(debug, "SPI_RTApp_MT3620_BareMetal\r\n");
     UART_Print(debug, "App built on: " __DATE__ " " __TIME__ "\r\n");
 
+    // The FIFO is drained before button presses are handled.
+    EventQueue_Init(&fifoEvents, 0, HandleFIFOWatermarkDeferred);
+    EventQueue_Init(&buttonEvents, 1, HandleButtonDeferred);
+
     driver = SPIMaster_Open(MT3620_UNIT_ISU1);
 
     if (!driver) {
@@ -172,47 +194,60 @@ _Noreturn void RTCoreMain(void)
     // Configure SPI Master to 2 MHz.
     SPIMaster_Configure(driver, 0, 0, 2000000);
 
-    if (!LSM6DS3_CheckWhoAmI(driver)) {
+    if (!(imu = LSM6DS3_Open(&LSM6DS3_TransportSPI, driver))) {
+        UART_Print(debug,
+            "ERROR: Open Failed for LSM6DS3.\r\n");
+    }
+
+    if (!LSM6DS3_CheckWhoAmI(imu)) {
         UART_Print(debug,
             "ERROR: CheckWhoAmI Failed for LSM6DS3.\r\n");
     }
 
-    if (!LSM6DS3_Reset(driver)) {
+    if (!LSM6DS3_Reset(imu)) {
         UART_Print(debug,
             "ERROR: Reset Failed for LSM6DS3.\r\n");
     }
 
-    if (!LSM6DS3_ConfigXL(driver, 1, 4, 400)) {
+    if (!LSM6DS3_ConfigXL(imu, IMU_ODR, 4, 400)) {
         UART_Print(debug,
             "ERROR: Failed to configure LSM6DS3 accelerometer.\r\n");
     }
 
-    if (!LSM6DS3_ConfigG(driver, 1, 500)) {
+    if (!LSM6DS3_ConfigG(imu, IMU_ODR, 500)) {
         UART_Print(debug,
             "ERROR: Failed to configure LSM6DS3 accelerometer.\r\n");
     }
 
+    // INT1 is high while the FIFO is over the watermark. Taking both edges
+    // doesn't depend on the EINT polarity, and the drain as it falls finds
+    // little to read.
+    if (!Input_Open(imuInt1Gpio, INPUT_EDGE_BOTH, &fifoEvents)) {
+        UART_Print(debug,
+            "ERROR: Failed to configure LSM6DS3 INT1 interrupt.\r\n");
+    }
+
+    if (!LSM6DS3_ConfigFIFO(imu, IMU_ODR, 1, 1, IMU_FIFO_THRESHOLD)
+        || !LSM6DS3_ConfigINT1(imu, LSM6DS3_INT1_CTRL_FTH)) {
+        UART_Print(debug,
+            "ERROR: Failed to configure LSM6DS3 FIFO.\r\n");
+    }
+
     UART_Print(debug,
         "Connect LSM6DS3, and press button A to read accelerometer.\r\n");
 
-    GPIO_ConfigurePinForInput(buttonAGpio);
-
     // Self test
     displaySensors();
 
-    // Setup GPT1 to poll for button press
-    if (!(buttonTimeout = GPT_Open(MT3620_UNIT_GPT1, 1000, GPT_MODE_REPEAT))) {
-        UART_Print(debug, "ERROR: Opening timer\r\n");
+    if (!Input_Open(buttonAGpio, INPUT_EDGE_PRESS, &buttonEvents)) {
+        UART_Print(debug, "ERROR: Configuring button interrupt\r\n");
     }
-    int32_t error;
 
-    if ((error = GPT_StartTimeout(buttonTimeout, buttonPressCheckPeriodMs,
-                                  GPT_UNITS_MILLISEC, &HandleButtonTimerIrq)) != ERROR_NONE) {
-        UART_Printf(debug, "ERROR: Starting timer (%ld)\r\n", error);
-    }
+    // Drain anything which reached the watermark before INT1 was enabled.
+    HandleFIFOWatermarkDeferred(NULL);
 
     for (;;) {
         __asm__("wfi");
-        InvokeCallbacks();
+        EventQueue_Dispatch();
     }
 }
@@ -0,0 +1,674 @@
+#include "FATLog.h"
+#include "Placement.h"
+
+// This is the maximum number of logs which can be open at once.
+#define FAT_LOG_MAX            2
+#define FAT_SECTOR_LEN         512
+#define FAT_SECTOR_NONE        0xFFFFFFFF
+#define FAT_ENTRIES_PER_SECTOR (FAT_SECTOR_LEN / 4)
+// The top 4 bits of a FAT32 entry are reserved.
+#define FAT_ENTRY_MASK         0x0FFFFFFF
+#define FAT_ENTRY_EOC          0x0FFFFFFF
+#define FAT_DIR_ENTRY_LEN      32
+#define FAT_NAME_LEN           11
+#define FAT_ATTR_VOLUME_ID     0x08
+#define FAT_ATTR_ARCHIVE       0x20
+#define FAT_ATTR_LONG_NAME     0x0F
+// There's no clock, so files are dated 2021-01-01.
+#define FAT_DATE               (((2021 - 1980) << 9) | (1 << 5) | 1)
+
+struct FATLog {
+    SDCard   *card;
+
+    // Volume layout, in blocks from the start of the card.
+    uint32_t  fatStart;
+    uint32_t  fatSize;
+    uint32_t  numFATs;
+    uint32_t  sectorsPerCluster;
+    uint32_t  dataStart;
+    uint32_t  clusterMax;
+    uint32_t  rootCluster;
+
+    // Directory entry of the file.
+    uint32_t  dirSector;
+    uint32_t  dirOffset;
+    uint32_t  firstCluster;
+
+    // Clusters reserved for the file, [extentStart, extentEnd), holding the
+    // data from file offset extentBase.
+    uint32_t  extentStart;
+    uint32_t  extentEnd;
+    uint32_t  extentBase;
+    uint32_t  preallocClusters;
+    // Last cluster of the extent chained in the FAT, or 0 if none yet.
+    uint32_t  fatTail;
+    // Last cluster of the previous extent, which is yet to be linked to this one.
+    uint32_t  pendingLink;
+
+    // Data not yet on the card, starting from the block aligned file
+    // offset bufferPos.
+    uint8_t  *buffer;
+    uint32_t  bufferSize;
+    uint32_t  bufferUsed;
+    uint32_t  bufferPos;
+    uint32_t  size;
+
+    // Used for FAT, directory and boot sectors, holding scratchSector.
+    uint8_t  *scratch;
+    uint32_t  scratchSector;
+};
+
+static FATLog FATLog_Handles[FAT_LOG_MAX] = {0};
+static SYSRAM_DATA uint8_t FATLog_Scratch[FAT_LOG_MAX][FAT_SECTOR_LEN];
+
+static uint16_t FATLog__Get16(const uint8_t *p)
+{
+    return (p[0] | (p[1] << 8));
+}
+
+static uint32_t FATLog__Get32(const uint8_t *p)
+{
+    return (p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+static void FATLog__Put16(uint8_t *p, uint16_t value)
+{
+    p[0] = (value & 0xFF);
+    p[1] = (value >> 8);
+}
+
+static void FATLog__Put32(uint8_t *p, uint32_t value)
+{
+    FATLog__Put16(&p[0], (value & 0xFFFF));
+    FATLog__Put16(&p[2], (value >> 16));
+}
+
+static bool FATLog__Read(FATLog *log, uint32_t sector)
+{
+    if (log->scratchSector == sector) {
+        return true;
+    }
+
+    log->scratchSector = FAT_SECTOR_NONE;
+    if (!SD_ReadBlock(log->card, sector, log->scratch)) {
+        return false;
+    }
+
+    log->scratchSector = sector;
+    return true;
+}
+
+static bool FATLog__Write(FATLog *log, uint32_t sector)
+{
+    // Another log on the card holding this sector would write its stale
+    // copy back over this one.
+    unsigned h;
+    for (h = 0; h < FAT_LOG_MAX; h++) {
+        FATLog *other = &FATLog_Handles[h];
+        if ((other != log) && (other->card == log->card)
+            && (other->scratchSector == sector)) {
+            other->scratchSector = FAT_SECTOR_NONE;
+        }
+    }
+
+    if (!SD_WriteBlock(log->card, sector, log->scratch)) {
+        log->scratchSector = FAT_SECTOR_NONE;
+        return false;
+    }
+
+    log->scratchSector = sector;
+    return true;
+}
+
+static uint32_t FATLog__Cluster_Bytes(const FATLog *log)
+{
+    return (log->sectorsPerCluster * FAT_SECTOR_LEN);
+}
+
+static uint32_t FATLog__Cluster_Sector(const FATLog *log, uint32_t cluster)
+{
+    return (log->dataStart + ((cluster - 2) * log->sectorsPerCluster));
+}
+
+// Cluster of the current extent holding the byte before file offset end.
+static uint32_t FATLog__Last_Cluster(const FATLog *log, uint32_t end)
+{
+    return (log->extentStart + ((end - log->extentBase - 1) / FATLog__Cluster_Bytes(log)));
+}
+
+static bool FATLog__Get_Entry(FATLog *log, uint32_t cluster, uint32_t *value)
+{
+    if (!FATLog__Read(log, (log->fatStart + (cluster / FAT_ENTRIES_PER_SECTOR)))) {
+        return false;
+    }
+
+    *value = (FATLog__Get32(&log->scratch[(cluster % FAT_ENTRIES_PER_SECTOR) * 4]) & FAT_ENTRY_MASK);
+    return true;
+}
+
+// Chains count clusters from first, with the last pointing to last. Each
+// FAT sector is written once, to every copy of the FAT.
+static bool FATLog__Set_Entries(FATLog *log, uint32_t first, uint32_t count, uint32_t last)
+{
+    uint32_t end = (first + count);
+    uint32_t cluster = first;
+    while (cluster < end) {
+        uint32_t sector = (cluster / FAT_ENTRIES_PER_SECTOR);
+        uint32_t stop = ((sector + 1) * FAT_ENTRIES_PER_SECTOR);
+        if (stop > end) {
+            stop = end;
+        }
+
+        if (!FATLog__Read(log, (log->fatStart + sector))) {
+            return false;
+        }
+
+        for (; cluster < stop; cluster++) {
+            uint8_t *entry = &log->scratch[(cluster % FAT_ENTRIES_PER_SECTOR) * 4];
+            uint32_t value = (((cluster + 1) < end) ? (cluster + 1) : last);
+            FATLog__Put32(entry, ((FATLog__Get32(entry) & ~FAT_ENTRY_MASK) | value));
+        }
+
+        uint32_t f;
+        for (f = 0; f < log->numFATs; f++) {
+            if (!FATLog__Write(log, (log->fatStart + (f * log->fatSize) + sector))) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Claims the clusters of the current extent up to last in the FAT. New
+// clusters are chained before being linked from the previous extent, so the
+// file is never left pointing at a free cluster.
+static bool FATLog__Commit_Chain(FATLog *log, uint32_t last)
+{
+    if (log->fatTail == last) {
+        return true;
+    }
+
+    uint32_t first = (log->fatTail ? log->fatTail : log->extentStart);
+    if (!FATLog__Set_Entries(log, first, (last - first + 1), FAT_ENTRY_EOC)) {
+        return false;
+    }
+    log->fatTail = last;
+
+    if (log->pendingLink != 0) {
+        if (!FATLog__Set_Entries(log, log->pendingLink, 1, log->extentStart)) {
+            return false;
+        }
+        log->pendingLink = 0;
+    }
+
+    return true;
+}
+
+// Whether another log on the card has reserved cluster, without having
+// claimed it in the FAT yet.
+static bool FATLog__Reserved(const FATLog *log, uint32_t cluster)
+{
+    unsigned h;
+    for (h = 0; h < FAT_LOG_MAX; h++) {
+        const FATLog *other = &FATLog_Handles[h];
+        if ((other == log) || (other->card != log->card)) {
+            continue;
+        }
+
+        uint32_t start = (other->fatTail ? (other->fatTail + 1) : other->extentStart);
+        if ((cluster >= start) && (cluster < other->extentEnd)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Reserves the first run of preallocClusters free clusters at or after hint,
+// wrapping around to the start of the volume, or failing that the longest
+// run there is, skipping those other logs have reserved. Nothing is written
+// to the card.
+static bool FATLog__Allocate(FATLog *log, uint32_t hint)
+{
+    if ((hint < 2) || (hint >= log->clusterMax)) {
+        hint = 2;
+    }
+
+    uint32_t bestStart = 0, bestLen = 0;
+    uint32_t runStart  = 0, runLen  = 0;
+    uint32_t i;
+    for (i = 0; (i < (log->clusterMax - 2)) && (bestLen < log->preallocClusters); i++) {
+        uint32_t cluster = (hint + i);
+        if (cluster >= log->clusterMax) {
+            cluster -= (log->clusterMax - 2);
+        }
+        if (cluster == 2) {
+            // Runs don't wrap around.
+            runLen = 0;
+        }
+
+        uint32_t value;
+        if (!FATLog__Get_Entry(log, cluster, &value)) {
+            return false;
+        }
+
+        if ((value != 0) || FATLog__Reserved(log, cluster)) {
+            runLen = 0;
+            continue;
+        }
+
+        if (runLen++ == 0) {
+            runStart = cluster;
+        }
+        if (runLen > bestLen) {
+            bestStart = runStart;
+            bestLen   = runLen;
+        }
+    }
+
+    // The volume is full.
+    if (bestLen == 0) {
+        return false;
+    }
+
+    log->extentStart = bestStart;
+    log->extentEnd   = (bestStart + bestLen);
+    return true;
+}
+
+// Moves on from a full extent, which is committed to the FAT first so its
+// clusters aren't found free again.
+static bool FATLog__Next_Extent(FATLog *log)
+{
+    uint32_t last = (log->extentEnd - 1);
+    if (!FATLog__Commit_Chain(log, last)) {
+        return false;
+    }
+
+    uint32_t base = log->extentBase
+        + ((log->extentEnd - log->extentStart) * FATLog__Cluster_Bytes(log));
+    if (!FATLog__Allocate(log, log->extentEnd)) {
+        return false;
+    }
+
+    log->extentBase  = base;
+    log->fatTail     = 0;
+    log->pendingLink = last;
+    return true;
+}
+
+// Writes blocks from the start of the buffer, as few multi-block writes as
+// the extents allow.
+static bool FATLog__Write_Blocks(FATLog *log, uint32_t blocks)
+{
+    const uint8_t *data = log->buffer;
+    uint32_t pos = log->bufferPos;
+    while (blocks > 0) {
+        uint32_t extentBlocks = ((log->extentEnd - log->extentStart) * log->sectorsPerCluster);
+        uint32_t offset = ((pos - log->extentBase) / FAT_SECTOR_LEN);
+        if (offset >= extentBlocks) {
+            if (!FATLog__Next_Extent(log)) {
+                return false;
+            }
+            continue;
+        }
+
+        uint32_t count = (extentBlocks - offset);
+        if (count > blocks) {
+            count = blocks;
+        }
+
+        if (!SD_WriteBlocks(log->card,
+            (FATLog__Cluster_Sector(log, log->extentStart) + offset), count, data)) {
+            return false;
+        }
+
+        blocks -= count;
+        data   += (count * FAT_SECTOR_LEN);
+        pos    += (count * FAT_SECTOR_LEN);
+    }
+
+    return true;
+}
+
+// Writes the buffer out. A partial last block stays buffered, to be
+// completed by the next append and written again.
+static bool FATLog__Write_Buffer(FATLog *log)
+{
+    uint32_t blocks = ((log->bufferUsed + (FAT_SECTOR_LEN - 1)) / FAT_SECTOR_LEN);
+    if (blocks == 0) {
+        return true;
+    }
+
+    if (!FATLog__Write_Blocks(log, blocks)) {
+        return false;
+    }
+
+    uint32_t full = (log->bufferUsed / FAT_SECTOR_LEN);
+    uint32_t tail = (log->bufferUsed % FAT_SECTOR_LEN);
+    if (full > 0) {
+        __builtin_memmove(log->buffer, &log->buffer[full * FAT_SECTOR_LEN], tail);
+        log->bufferPos += (full * FAT_SECTOR_LEN);
+        log->bufferUsed = tail;
+    }
+
+    return true;
+}
+
+// Converts name to the space padded, upper case form used in directory entries.
+static bool FATLog__Name(const char *name, uint8_t fatName[FAT_NAME_LEN])
+{
+    __builtin_memset(fatName, ' ', FAT_NAME_LEN);
+
+    unsigned i = 0, len = 0, max = 8;
+    for (; *name != '\0'; name++) {
+        char c = *name;
+        if (c == '.') {
+            if ((max != 8) || (len == 0)) {
+                return false;
+            }
+            i   = 8;
+            len = 0;
+            max = 3;
+            continue;
+        }
+
+        if ((c <= ' ') || (c == 0x7F) || __builtin_strchr("\"*+,/:;<=>?[\\]|", c)
+            || (len >= max)) {
+            return false;
+        }
+        if ((c >= 'a') && (c <= 'z')) {
+            c -= ('a' - 'A');
+        }
+        fatName[i++] = c;
+        len++;
+    }
+
+    return (fatName[0] != ' ');
+}
+
+// Adds an empty file to the root directory, which must already have a free entry.
+static bool FATLog__Create(FATLog *log, const uint8_t name[FAT_NAME_LEN])
+{
+    uint32_t freeSector = FAT_SECTOR_NONE, freeOffset = 0;
+    uint32_t cluster = log->rootCluster;
+    uint32_t c;
+    bool end = false;
+    for (c = 0; !end && (c < log->clusterMax) && (cluster >= 2) && (cluster < log->clusterMax); c++) {
+        uint32_t s;
+        for (s = 0; !end && (s < log->sectorsPerCluster); s++) {
+            uint32_t sector = (FATLog__Cluster_Sector(log, cluster) + s);
+            if (!FATLog__Read(log, sector)) {
+                return false;
+            }
+
+            uint32_t offset;
+            for (offset = 0; offset < FAT_SECTOR_LEN; offset += FAT_DIR_ENTRY_LEN) {
+                const uint8_t *entry = &log->scratch[offset];
+                if ((entry[0] == 0x00) || (entry[0] == 0xE5)) {
+                    if (freeSector == FAT_SECTOR_NONE) {
+                        freeSector = sector;
+                        freeOffset = offset;
+                    }
+                    // Nothing follows the first never used entry.
+                    if (entry[0] == 0x00) {
+                        end = true;
+                        break;
+                    }
+                    continue;
+                }
+
+                if (((entry[11] & FAT_ATTR_LONG_NAME) != FAT_ATTR_LONG_NAME)
+                    && ((entry[11] & FAT_ATTR_VOLUME_ID) == 0)
+                    && (__builtin_memcmp(entry, name, FAT_NAME_LEN) == 0)) {
+                    return false;
+                }
+            }
+        }
+
+        if (!end && !FATLog__Get_Entry(log, cluster, &cluster)) {
+            return false;
+        }
+    }
+
+    if ((freeSector == FAT_SECTOR_NONE) || !FATLog__Read(log, freeSector)) {
+        return false;
+    }
+
+    uint8_t *entry = &log->scratch[freeOffset];
+    __builtin_memset(entry, 0, FAT_DIR_ENTRY_LEN);
+    __builtin_memcpy(entry, name, FAT_NAME_LEN);
+    entry[11] = FAT_ATTR_ARCHIVE;
+    FATLog__Put16(&entry[16], FAT_DATE);
+    FATLog__Put16(&entry[18], FAT_DATE);
+    FATLog__Put16(&entry[24], FAT_DATE);
+
+    if (!FATLog__Write(log, freeSector)) {
+        return false;
+    }
+
+    log->dirSector = freeSector;
+    log->dirOffset = freeOffset;
+    return true;
+}
+
+static bool FATLog__Boot_Sector(const uint8_t *b)
+{
+    return (((b[0] == 0xEB) || (b[0] == 0xE9))
+        && (FATLog__Get16(&b[11]) == FAT_SECTOR_LEN)
+        && (b[16] != 0));
+}
+
+static bool FATLog__Mount(FATLog *log)
+{
+    const uint8_t *b = log->scratch;
+    if (!FATLog__Read(log, 0) || (FATLog__Get16(&b[510]) != 0xAA55)) {
+        return false;
+    }
+
+    // Without a boot sector at block 0 use the first partition, which
+    // must be FAT32 (CHS or LBA).
+    uint32_t volume = 0;
+    if (!FATLog__Boot_Sector(b)) {
+        const uint8_t *partition = &b[446];
+        if ((partition[4] != 0x0B) && (partition[4] != 0x0C)) {
+            return false;
+        }
+        volume = FATLog__Get32(&partition[8]);
+        if (!FATLog__Read(log, volume)
+            || (FATLog__Get16(&b[510]) != 0xAA55)
+            || !FATLog__Boot_Sector(b)) {
+            return false;
+        }
+    }
+
+    uint32_t spc        = b[13];
+    uint32_t reserved   = FATLog__Get16(&b[14]);
+    uint32_t numFATs    = b[16];
+    uint32_t rootEntCnt = FATLog__Get16(&b[17]);
+    uint32_t totSec     = FATLog__Get16(&b[19]);
+    uint32_t fatSz16    = FATLog__Get16(&b[22]);
+    uint32_t fatSz32    = FATLog__Get32(&b[36]);
+    uint32_t rootClus   = FATLog__Get32(&b[44]);
+    uint32_t fsInfo     = FATLog__Get16(&b[48]);
+    if (totSec == 0) {
+        totSec = FATLog__Get32(&b[32]);
+    }
+
+    // Only FAT32 has no fixed root directory or 16 bit FAT size.
+    if ((spc == 0) || ((spc & (spc - 1)) != 0) || (reserved == 0)
+        || (rootEntCnt != 0) || (fatSz16 != 0) || (fatSz32 == 0)
+        || (totSec <= (reserved + (numFATs * fatSz32)))) {
+        return false;
+    }
+
+    log->sectorsPerCluster = spc;
+    log->numFATs    = numFATs;
+    log->fatSize    = fatSz32;
+    log->fatStart   = (volume + reserved);
+    log->dataStart  = (log->fatStart + (numFATs * fatSz32));
+    log->clusterMax = (2 + ((totSec - (reserved + (numFATs * fatSz32))) / spc));
+    if (log->clusterMax > (fatSz32 * FAT_ENTRIES_PER_SECTOR)) {
+        log->clusterMax = (fatSz32 * FAT_ENTRIES_PER_SECTOR);
+    }
+
+    log->rootCluster = rootClus;
+    if ((rootClus < 2) || (rootClus >= log->clusterMax)) {
+        return false;
+    }
+
+    // The free cluster count and hint in FSInfo aren't maintained, so mark
+    // them unknown for the PC to work out again.
+    if ((fsInfo != 0) && (fsInfo != 0xFFFF)
+        && FATLog__Read(log, (volume + fsInfo))
+        && (FATLog__Get32(&b[0])   == 0x41615252)
+        && (FATLog__Get32(&b[484]) == 0x61417272)) {
+        FATLog__Put32(&log->scratch[488], 0xFFFFFFFF);
+        FATLog__Put32(&log->scratch[492], 0xFFFFFFFF);
+        if (!FATLog__Write(log, (volume + fsInfo))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+FATLog *FATLog_Open(SDCard *card, const char *name, uint32_t preallocate,
+                    void *buffer, uint32_t bufferSize)
+{
+    uint8_t fatName[FAT_NAME_LEN];
+    if (!card || !name || !buffer
+        || (bufferSize < FAT_SECTOR_LEN) || ((bufferSize % FAT_SECTOR_LEN) != 0)
+        || (SD_GetBlockLen(card) != FAT_SECTOR_LEN)
+        || !FATLog__Name(name, fatName)) {
+        return NULL;
+    }
+
+    FATLog *log = NULL;
+    unsigned h;
+    for (h = 0; h < FAT_LOG_MAX; h++) {
+        if (!FATLog_Handles[h].card) {
+            log = &FATLog_Handles[h];
+            break;
+        }
+    }
+    if (!log) {
+        return NULL;
+    }
+
+    *log = (FATLog){
+        .card          = card,
+        .buffer        = buffer,
+        .bufferSize    = bufferSize,
+        .scratch       = FATLog_Scratch[h],
+        .scratchSector = FAT_SECTOR_NONE,
+    };
+
+    if (!FATLog__Mount(log)) {
+        log->card = NULL;
+        return NULL;
+    }
+
+    uint32_t clusterBytes = FATLog__Cluster_Bytes(log);
+    log->preallocClusters = ((preallocate + (clusterBytes - 1)) / clusterBytes);
+    if (log->preallocClusters == 0) {
+        log->preallocClusters = 1;
+    }
+
+    // Nothing is claimed until data is written, so space is found before
+    // the file is created, to avoid leaving an empty file behind.
+    if (!FATLog__Allocate(log, 2) || !FATLog__Create(log, fatName)) {
+        log->card = NULL;
+        return NULL;
+    }
+    log->firstCluster = log->extentStart;
+
+    return log;
+}
+
+bool FATLog_Close(FATLog *log)
+{
+    if (!FATLog_Flush(log)) {
+        return false;
+    }
+
+    log->card = NULL;
+    return true;
+}
+
+bool FATLog_Append(FATLog *log, const void *data, uint32_t size)
+{
+    if (!log || !log->card || (!data && (size != 0))) {
+        return false;
+    }
+
+    // FAT32 files are limited to 4 GiB - 1.
+    if (size > (0xFFFFFFFF - log->size)) {
+        return false;
+    }
+
+    const uint8_t *data_byte = data;
+    while (size > 0) {
+        uint32_t copy = (log->bufferSize - log->bufferUsed);
+        if (copy > size) {
+            copy = size;
+        }
+
+        __builtin_memcpy(&log->buffer[log->bufferUsed], data_byte, copy);
+        log->bufferUsed += copy;
+        log->size       += copy;
+        data_byte       += copy;
+        size            -= copy;
+
+        if (log->bufferUsed < log->bufferSize) {
+            break;
+        }
+
+        if (!FATLog__Write_Buffer(log)) {
+            return false;
+        }
+
+        // Claim clusters in the FAT a whole sector's worth at a time.
+        uint32_t last  = FATLog__Last_Cluster(log, log->bufferPos);
+        uint32_t first = (log->fatTail ? log->fatTail : log->extentStart);
+        if (((last - first) >= FAT_ENTRIES_PER_SECTOR)
+            && !FATLog__Commit_Chain(log, last)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool FATLog_Flush(FATLog *log)
+{
+    if (!log || !log->card) {
+        return false;
+    }
+
+    if (!FATLog__Write_Buffer(log)) {
+        return false;
+    }
+
+    if ((log->size > log->extentBase)
+        && !FATLog__Commit_Chain(log, FATLog__Last_Cluster(log, log->size))) {
+        return false;
+    }
+
+    if (!FATLog__Read(log, log->dirSector)) {
+        return false;
+    }
+
+    uint8_t *entry = &log->scratch[log->dirOffset];
+    uint32_t first = (log->size ? log->firstCluster : 0);
+    FATLog__Put16(&entry[20], (first >> 16));
+    FATLog__Put16(&entry[26], (first & 0xFFFF));
+    FATLog__Put32(&entry[28], log->size);
+
+    return FATLog__Write(log, log->dirSector);
+}
+
+uint32_t FATLog_GetSize(const FATLog *log)
+{
+    return (log ? log->size : 0);
+}
@@ -0,0 +1,38 @@
+#ifndef FAT_LOG_H_
+#define FAT_LOG_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SD.h"
+
+// An append-only log file in the root directory of a FAT32 card, so logs
+// can be read on a PC without custom tooling. The volume may either start
+// at block 0 or be the first MBR partition, and must use 512 byte sectors.
+//
+// Space is reserved as runs of contiguous clusters, preallocate bytes at a
+// time, so data goes to the card as multi-block writes of the caller's
+// buffer. Only clusters holding data are claimed in the FAT, which is
+// updated a sector at a time as they fill, and the directory entry is only
+// updated on FATLog_Flush, so the file's size on the card is that of the
+// last flush.
+
+typedef struct FATLog FATLog;
+
+// Creates the file name ("8.3" form, e.g. "LOG0001.TXT"), which must not
+// exist yet. buffer holds data waiting to be written, a whole number of
+// 512 byte blocks which should be in SYSRAM so it can be transferred by DMA
+// without staging.
+FATLog  *FATLog_Open(SDCard *card, const char *name, uint32_t preallocate,
+                     void *buffer, uint32_t bufferSize);
+// Flushes the log, the handle and buffer may be reused once this returns true.
+bool     FATLog_Close(FATLog *log);
+
+bool     FATLog_Append(FATLog *log, const void *data, uint32_t size);
+// Writes buffered data and commits the file's size to the card.
+bool     FATLog_Flush(FATLog *log);
+
+// Bytes appended so far, including any not yet flushed.
+uint32_t FATLog_GetSize(const FATLog *log);
+
+#endif // #ifndef FAT_LOG_H_
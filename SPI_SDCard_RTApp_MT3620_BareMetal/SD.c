@@ -1,14 +1,29 @@
-#include "lib/mt3620/gpt.h"
+#include "lib/NVIC.h"
 
 #include "SD.h"
+#include "EventQueue.h"
+#include "Scheduler.h"
+#include "Profile.h"
+#include "Placement.h"
 
 // This is the maximum number of SD cards which can be opened at once.
 #define SD_CARD_MAX       4
 #define SPI_SD_TIMEOUT    200 // [ms]
+// Time allowed for the card to program a block, SDHC cards take up to 250ms.
+#define SPI_SD_BUSY_TIMEOUT 500 // [ms]
 #define NUM_RETRIES       65536
 #define NUM_WRITE_RETRIES 3
+// Initialisation must run at or below 400 kHz, after which the bus is raised
+// to the card's TRAN_SPEED, capped at the fastest the SPI master can clock.
+#define SPI_SD_SPEED_INIT 400000
+#define SPI_SD_SPEED_MAX  40000000
+// Largest block length supported by SD_SetBlockLen.
+#define SD_MAX_BLOCK_LEN  1024
 
-static GPT *timer = NULL;
+// Bounds every transfer, on the scheduler rather than a GPT of its own.
+static Scheduler_Timer timer = { 0 };
+
+PROFILE_MARKER(SD_ReadBlocks);
 
 typedef enum {
     GO_IDLE_STATE        =  0,
@@ -112,6 +127,7 @@ struct SDCard {
     uint32_t   blockLen;
     uint32_t   tranSpeed;
     uint32_t   maxTranSpeed;
+    bool       crc;
 };
 
 typedef struct {
@@ -140,95 +156,258 @@ static void transferStateReset()
     transferState.count  = 0;
 }
 
+typedef enum {
+    SD_ASYNC_IDLE,
+    SD_ASYNC_COMMAND,
+    SD_ASYNC_RESPONSE,
+    SD_ASYNC_BURST,
+    SD_ASYNC_READ_TOKEN,
+    SD_ASYNC_READ_DATA,
+    SD_ASYNC_WRITE_DATA,
+    SD_ASYNC_WRITE_RESPONSE,
+    SD_ASYNC_BUSY,
+    SD_ASYNC_STOP_TRAN,
+} SD_AsyncState;
+
+// Asynchronous requests share the SPI completion callback and the timer, so
+// they are run one at a time across all cards, in the order submitted.
+static struct {
+    SD_Request    *active;
+    SD_Request    *head;
+    SD_Request    *tail;
+
+    SD_AsyncState  state;
+    SD_CMD         cmd;
+    void         (*next)(void);
+    uint32_t       block;
+    unsigned       polls;
+    uint32_t       busyStart;
+    bool           staged;
+    bool           success;
+    // Counts the steps started with a timeout, so one which has already
+    // completed isn't timed out after all.
+    uint32_t       step;
+    // Picks the completion callback, which changes on every cancel so a
+    // completion the cancelled transfer had already raised is told apart.
+    unsigned       epoch;
+} SD_Async = {
+    .active = NULL,
+    .head   = NULL,
+    .tail   = NULL,
+    .state  = SD_ASYNC_IDLE,
+};
+
+// Steps are timed out from the main loop rather than the timer interrupt, so
+// the SPI completion interrupt is the only one to drive a request, and the
+// only one to call its callback unless the main loop does so with interrupts
+// blocked.
+EVENT_QUEUE_DEFINE(SD_TimeoutEvents, uint32_t, 2);
+static void SD__Async_Timeout(void *payload);
+
+// CRC7 of each byte value, as 7 bits with the input byte already folded in.
+static const uint8_t SD_Crc7Table[256] = {
+    0x00, 0x09, 0x12, 0x1B, 0x24, 0x2D, 0x36, 0x3F, 0x48, 0x41, 0x5A, 0x53, 0x6C, 0x65, 0x7E, 0x77,
+    0x19, 0x10, 0x0B, 0x02, 0x3D, 0x34, 0x2F, 0x26, 0x51, 0x58, 0x43, 0x4A, 0x75, 0x7C, 0x67, 0x6E,
+    0x32, 0x3B, 0x20, 0x29, 0x16, 0x1F, 0x04, 0x0D, 0x7A, 0x73, 0x68, 0x61, 0x5E, 0x57, 0x4C, 0x45,
+    0x2B, 0x22, 0x39, 0x30, 0x0F, 0x06, 0x1D, 0x14, 0x63, 0x6A, 0x71, 0x78, 0x47, 0x4E, 0x55, 0x5C,
+    0x64, 0x6D, 0x76, 0x7F, 0x40, 0x49, 0x52, 0x5B, 0x2C, 0x25, 0x3E, 0x37, 0x08, 0x01, 0x1A, 0x13,
+    0x7D, 0x74, 0x6F, 0x66, 0x59, 0x50, 0x4B, 0x42, 0x35, 0x3C, 0x27, 0x2E, 0x11, 0x18, 0x03, 0x0A,
+    0x56, 0x5F, 0x44, 0x4D, 0x72, 0x7B, 0x60, 0x69, 0x1E, 0x17, 0x0C, 0x05, 0x3A, 0x33, 0x28, 0x21,
+    0x4F, 0x46, 0x5D, 0x54, 0x6B, 0x62, 0x79, 0x70, 0x07, 0x0E, 0x15, 0x1C, 0x23, 0x2A, 0x31, 0x38,
+    0x41, 0x48, 0x53, 0x5A, 0x65, 0x6C, 0x77, 0x7E, 0x09, 0x00, 0x1B, 0x12, 0x2D, 0x24, 0x3F, 0x36,
+    0x58, 0x51, 0x4A, 0x43, 0x7C, 0x75, 0x6E, 0x67, 0x10, 0x19, 0x02, 0x0B, 0x34, 0x3D, 0x26, 0x2F,
+    0x73, 0x7A, 0x61, 0x68, 0x57, 0x5E, 0x45, 0x4C, 0x3B, 0x32, 0x29, 0x20, 0x1F, 0x16, 0x0D, 0x04,
+    0x6A, 0x63, 0x78, 0x71, 0x4E, 0x47, 0x5C, 0x55, 0x22, 0x2B, 0x30, 0x39, 0x06, 0x0F, 0x14, 0x1D,
+    0x25, 0x2C, 0x37, 0x3E, 0x01, 0x08, 0x13, 0x1A, 0x6D, 0x64, 0x7F, 0x76, 0x49, 0x40, 0x5B, 0x52,
+    0x3C, 0x35, 0x2E, 0x27, 0x18, 0x11, 0x0A, 0x03, 0x74, 0x7D, 0x66, 0x6F, 0x50, 0x59, 0x42, 0x4B,
+    0x17, 0x1E, 0x05, 0x0C, 0x33, 0x3A, 0x21, 0x28, 0x5F, 0x56, 0x4D, 0x44, 0x7B, 0x72, 0x69, 0x60,
+    0x0E, 0x07, 0x1C, 0x15, 0x2A, 0x23, 0x38, 0x31, 0x46, 0x4F, 0x54, 0x5D, 0x62, 0x6B, 0x70, 0x79,
+};
+
 static uint8_t SD_Crc7(void *data, uintptr_t size)
 {
     uint8_t* data_byte = data;
     uint8_t crc = 0x00;
     uintptr_t byte;
     for (byte = 0; byte < size; byte++) {
-        uint8_t c = data_byte[byte];
-        unsigned bit;
-        for (bit = 0; bit < 8; bit++) {
-            crc <<= 1;
-            if ((c ^ crc) & 0x80) {
-                crc ^= 0x09;
-            }
-            c <<= 1;
-        }
-        crc &= 0x7F;
+        crc = SD_Crc7Table[(crc << 1) ^ data_byte[byte]];
     }
 
     return (crc << 1) | 0x01;
 }
 
+// CRC16-CCITT (polynomial 0x1021) of each byte value.
+static const uint16_t SD_Crc16Table[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+// Pass 0 as crc to start, or a previous result to continue over more data.
+static uint16_t SD_Crc16(uint16_t crc, const void *data, uintptr_t size)
+{
+    const uint8_t* data_byte = data;
+    uintptr_t byte;
+    for (byte = 0; byte < size; byte++) {
+        crc = (crc << 8) ^ SD_Crc16Table[(crc >> 8) ^ data_byte[byte]];
+    }
+
+    return crc;
+}
+
+// Data packet CRCs go on the wire most significant byte first.
+static bool SD__Crc16_Check(const void *data, uintptr_t size, const uint8_t *crc)
+{
+    return (SD_Crc16(0, data, size) == ((crc[0] << 8) | crc[1]));
+}
+
+static void SD__Crc16_Put(const void *data, uintptr_t size, uint8_t *crc, bool enable)
+{
+    uint16_t value = (enable ? SD_Crc16(0, data, size) : 0xFFFF);
+    crc[0] = (value >> 8);
+    crc[1] = (value & 0xFF);
+}
+
 typedef enum {
     SPI_READ  = 0,
     SPI_WRITE = 1
 } SPI_TRANSFER_TYPE;
 
+// The SPI DMA can only reach SYSRAM, so anything which doesn't already live
+// there is staged in these buffers. A data packet is laid out as it goes on
+// the wire: token, payload, then CRC.
+#define SD_SYSRAM_BASE  0x22000000
+#define SD_SYSRAM_SIZE  (64 * 1024)
+#define SD_SCRATCH_LEN  32
+#define SD_PACKET_TOKEN 0
+#define SD_PACKET_DATA  1
+
+static SYSRAM_DATA uint8_t SD_Scratch[SD_SCRATCH_LEN];
+static SYSRAM_DATA uint8_t SD_Packet[1 + SD_MAX_BLOCK_LEN + 2];
+
+static bool SD__InSysRAM(const void *data, uintptr_t length)
+{
+    uintptr_t addr = (uintptr_t)data;
+    return ((addr >= SD_SYSRAM_BASE)
+        && ((addr + length) <= (SD_SYSRAM_BASE + SD_SYSRAM_SIZE)));
+}
+
+// Runs a list of transfers as a single request, with one timeout for the lot.
+static bool SPITransfer__SyncTimeoutV(
+    SPIMaster   *interface,
+    SPITransfer *transfer,
+    uint32_t     count)
+{
+    // The bus belongs to the asynchronous requests until they're all done.
+    if (!interface || SD_Async.active) {
+        return false;
+    }
+
+    int32_t status = SPIMaster_TransferSequentialAsync(
+        interface, transfer, count, transferDoneCallback);
+    if (status != ERROR_NONE) {
+        return false;
+    }
+
+    if (!Scheduler_TimerCall(&timer, NULL, (SPI_SD_TIMEOUT * 1000), 0)) {
+        SPIMaster_TransferCancel(interface);
+        transferStateReset();
+        return false;
+    }
+
+    while (!transferState.done) {
+        __asm__("wfi");
+        if (!Scheduler_TimerActive(&timer)) {
+            // Timed out, so cancel
+            SPIMaster_TransferCancel(interface);
+            transferState.status = ERROR_TIMEOUT;
+            break;
+        }
+    }
+    Scheduler_TimerStop(&timer);
+
+    status = transferState.status;
+    transferStateReset();
+
+    if (status != ERROR_NONE) {
+        return false;
+    }
+
+    return true;
+}
+
+// Use for commands, responses and other short transfers, which are copied
+// through SYSRAM when needed.
 static bool SPITransfer__SyncTimeout(
     SPIMaster         *interface,
     void              *data,
     uintptr_t          length,
     SPI_TRANSFER_TYPE  transferType)
 {
-    if (!interface) {
+    bool direct = SD__InSysRAM(data, length);
+    if (!direct && (length > SD_SCRATCH_LEN)) {
         return false;
     }
 
+    uint8_t *buffer = (direct ? data : SD_Scratch);
+
     SPITransfer transfer = {
         .writeData = NULL,
         .readData  = NULL,
         .length    = length,
     };
 
-    int32_t status;
     switch (transferType) {
     case SPI_READ:
-        transfer.readData = data;
-        status = SPIMaster_TransferSequentialAsync(interface, &transfer, 1, transferDoneCallback);
+        transfer.readData = buffer;
         break;
 
     case SPI_WRITE:
-        transfer.writeData = data;
-        status = SPIMaster_TransferSequentialAsync(interface, &transfer, 1, transferDoneCallback);
+        if (!direct) {
+            __builtin_memcpy(buffer, data, length);
+        }
+        transfer.writeData = buffer;
         break;
 
     default:
         return false;
     }
 
-    if (status != ERROR_NONE) {
-        return false;
-    }
-
-    if (GPT_IsEnabled(timer)) {
-        GPT_Stop(timer);
-    }
-    unsigned retries = NUM_RETRIES;
-    while ((retries-- > 0) && (GPT_StartTimeout(
-        timer, SPI_SD_TIMEOUT, GPT_UNITS_MILLISEC, NULL) == ERROR_NONE))
-        ;
-    if (retries == 0) {
-        transferStateReset();
+    if (!SPITransfer__SyncTimeoutV(interface, &transfer, 1)) {
         return false;
     }
 
-    while (!transferState.done) {
-        __asm__("wfi");
-        if (!GPT_IsEnabled(timer)) {
-            // Timed out, so cancel
-            SPIMaster_TransferCancel(interface);
-            transferState.status = ERROR_TIMEOUT;
-            break;
-        }
-    }
-
-    status = transferState.status;
-    transferStateReset();
-
-    if (status != ERROR_NONE) {
-        return false;
+    if ((transferType == SPI_READ) && !direct) {
+        __builtin_memcpy(data, buffer, length);
     }
 
     return true;
@@ -332,7 +511,47 @@ static bool SD_Command(SPIMaster *interface, SD_CMD cmd, uint32_t argument,
     return true;
 }
 
-static bool SD_ReadDataPacket(const SDCard *card, uintptr_t size, void *data)
+// Time taken by the card to program written data, only measured once a
+// clock has been given to SD_SetBusyClock.
+static GPT          *SD_BusyClock = NULL;
+static SD_BusyStats  SD_BusyTotals = {0};
+
+static uint32_t SD__Busy_Start(void)
+{
+    return (SD_BusyClock ? GPT_GetCount(SD_BusyClock) : 0);
+}
+
+static void SD__Busy_Record(uint32_t start)
+{
+    if (!SD_BusyClock) {
+        return;
+    }
+
+    uint32_t elapsed = (GPT_GetCount(SD_BusyClock) - start);
+    SD_BusyTotals.count++;
+    SD_BusyTotals.total += elapsed;
+    if (elapsed > SD_BusyTotals.max) {
+        SD_BusyTotals.max = elapsed;
+    }
+}
+
+static bool SD_AwaitNotBusy(SPIMaster *interface, unsigned retries)
+{
+    // Wait while card holds MISO low (busy)
+    uint8_t byte = 0x00;
+    unsigned i;
+    for (i = 0; (i < retries) && (byte == 0x00); i++) {
+        if (!SPITransfer__SyncTimeout(interface, &byte, 1, SPI_READ)) {
+            return false;
+        }
+    }
+
+    return (byte != 0x00);
+}
+
+// The card is only given recovery clocks after the last packet of a
+// transfer, within a multi-block read the next token follows directly.
+static bool SD_ReadDataPacket(const SDCard *card, uintptr_t size, void *data, bool last)
 {
     unsigned retries = NUM_RETRIES;
     uint8_t byte = 0xFF;
@@ -346,65 +565,80 @@ static bool SD_ReadDataPacket(const SDCard *card, uintptr_t size, void *data)
         return false;
     }
 
-    uint8_t *data_byte = data;
-    uintptr_t packet = 16;
-    uintptr_t remain = size;
-    for (remain = size; remain; remain -= packet, data_byte += packet) {
-        if (packet > remain) {
-            packet = remain;
-        }
+    if (size > SD_MAX_BLOCK_LEN) {
+        return false;
+    }
 
-        if (!SPITransfer__SyncTimeout(card->interface, data_byte, packet, SPI_READ)) {
-            return false;
-        }
+    // Payload and CRC are read in one go, straight into the caller's buffer
+    // if the DMA can reach it.
+    SPITransfer transfer[2];
+    uint32_t count;
+    bool direct = SD__InSysRAM(data, size);
+    if (direct) {
+        transfer[0] = (SPITransfer){ .readData = data, .length = size };
+        transfer[1] = (SPITransfer){ .readData = &SD_Packet[SD_PACKET_DATA], .length = 2 };
+        count = 2;
+    } else {
+        transfer[0] = (SPITransfer){ .readData = &SD_Packet[SD_PACKET_DATA], .length = size + 2 };
+        count = 1;
     }
 
-    uint16_t crc;
-    if (!SPITransfer__SyncTimeout(card->interface, &crc, sizeof(crc), SPI_READ)) {
+    if (!SPITransfer__SyncTimeoutV(card->interface, transfer, count)) {
         return false;
     }
 
-    // TODO: Verify the CRC.
+    const uint8_t *crc = &SD_Packet[SD_PACKET_DATA + (direct ? 0 : size)];
+    if (card->crc && !SD__Crc16_Check((direct ? data : &SD_Packet[SD_PACKET_DATA]), size, crc)) {
+        return false;
+    }
 
-    // Clock burst is required here to give the card time to recover?
-    SD_ClockBurst(card->interface, 32, false);
+    if (!direct) {
+        __builtin_memcpy(data, &SD_Packet[SD_PACKET_DATA], size);
+    }
+
+    if (last) {
+        // Clock burst is required here to give the card time to recover?
+        SD_ClockBurst(card->interface, 32, false);
+    }
 
     return true;
 }
 
-static bool SD_WriteDataPacket(SDCard *card, uintptr_t size, const void *data)
+static bool SD_WriteDataPacket(SDCard *card, uintptr_t size, const void *data, SD_DATA_TOKEN token)
 {
     // Clock burst for >= 1 byte
     SD_ClockBurst(card->interface, 16, false);
 
-    // Write data token
-    static uint8_t write_token = DATA_TOKEN_WRITE_SINGLE;
-    if (!SPITransfer__SyncTimeout(card->interface, &write_token, 1, SPI_WRITE)) {
+    if (size > SD_MAX_BLOCK_LEN) {
         return false;
     }
 
-    // Write data
-    uint8_t *data_byte = (uint8_t*)data;
-    uintptr_t packet = 16;
-    uintptr_t remain = size;
-    for (remain = size; remain; remain -= packet, data_byte += packet) {
-        if (packet > remain) {
-            packet = remain;
-        }
-
-        if (!SPITransfer__SyncTimeout(
-            card->interface, data_byte, packet, SPI_WRITE))
-        {
-            return false;
-        }
+    // Token, payload and CRC go out as a single request, using the caller's
+    // buffer directly if the DMA can reach it. The card ignores the CRC
+    // unless checking has been turned on.
+    SD_Packet[SD_PACKET_TOKEN] = token;
+
+    SPITransfer transfer[3];
+    uint32_t count;
+    if (SD__InSysRAM(data, size)) {
+        // The CRC is staged straight after the token instead.
+        uint8_t *crc = &SD_Packet[SD_PACKET_DATA];
+        SD__Crc16_Put(data, size, crc, card->crc);
+
+        transfer[0] = (SPITransfer){ .writeData = SD_Packet, .length = 1 };
+        transfer[1] = (SPITransfer){ .writeData = data,      .length = size };
+        transfer[2] = (SPITransfer){ .writeData = crc,       .length = 2 };
+        count = 3;
+    } else {
+        uint8_t *crc = &SD_Packet[SD_PACKET_DATA + size];
+        __builtin_memcpy(&SD_Packet[SD_PACKET_DATA], data, size);
+        SD__Crc16_Put(data, size, crc, card->crc);
+
+        transfer[0] = (SPITransfer){ .writeData = SD_Packet, .length = 1 + size + 2 };
+        count = 1;
     }
 
-    // Write crc
-    // TODO: implement 16 bit crc calc (SPI mode SD cards ignore CRC)
-    static uint16_t blank_crc = 0xFFFF;
-    if (!SPITransfer__SyncTimeout(
-        card->interface, &blank_crc, sizeof(blank_crc), SPI_WRITE))
-    {
+    if (!SPITransfer__SyncTimeoutV(card->interface, transfer, count)) {
         return false;
     }
 
@@ -421,19 +655,32 @@ static bool SD_WriteDataPacket(SDCard *card, uintptr_t size, const void *data)
         return false;
     }
 
-    // Wait while card holds MISO low (busy)
-    unsigned busy_waits = NUM_RETRIES;
-    byte = 0x00;
-    for (i = 0; (i < busy_waits) && (byte == 0x00); i++) {
-        if (!SPITransfer__SyncTimeout(card->interface, &byte, 1, SPI_READ)) {
-            return false;
-        }
+    uint32_t start = SD__Busy_Start();
+    if (!SD_AwaitNotBusy(card->interface, NUM_RETRIES)) {
+        return false;
+    }
+    SD__Busy_Record(start);
+    return true;
+}
+
+// Ends a multi-block write, the card is busy while it programs the last block.
+static bool SD_WriteStopTran(SDCard *card)
+{
+    static uint8_t stop_token = DATA_TOKEN_WRITE_MULT_STOP;
+    if (!SPITransfer__SyncTimeout(card->interface, &stop_token, 1, SPI_WRITE)) {
+        return false;
     }
 
-    if (byte == 0x00) {
+    // The card needs one byte before it signals busy.
+    if (!SD_ClockBurst(card->interface, 8, true)) {
         return false;
     }
 
+    uint32_t start = SD__Busy_Start();
+    if (!SD_AwaitNotBusy(card->interface, NUM_RETRIES)) {
+        return false;
+    }
+    SD__Busy_Record(start);
     return true;
 }
 
@@ -448,7 +695,7 @@ static bool SD_ReadCSD(SDCard *card)
     }
 
     uint8_t csd[16];
-    if (!SD_ReadDataPacket(card, sizeof(csd), csd)) {
+    if (!SD_ReadDataPacket(card, sizeof(csd), csd, true)) {
         return false;
     }
 
@@ -552,6 +799,51 @@ static bool SD_Initialize(SPIMaster *interface)
 }
 
 
+static bool SD__SetSpeed(SDCard *card, uint32_t speed)
+{
+    if (SPIMaster_Configure(card->interface, 0, 0, speed) != ERROR_NONE) {
+        return false;
+    }
+
+    card->tranSpeed = speed;
+    return true;
+}
+
+// Halves the bus speed after a failure, returns false if it can't go any lower.
+static bool SD__StepDown(SDCard *card)
+{
+    if (card->tranSpeed <= SPI_SD_SPEED_INIT) {
+        return false;
+    }
+
+    uint32_t speed = (card->tranSpeed / 2);
+    if (speed < SPI_SD_SPEED_INIT) {
+        speed = SPI_SD_SPEED_INIT;
+    }
+    return SD__SetSpeed(card, speed);
+}
+
+// Raises the bus to the card's TRAN_SPEED, then reads the CSD back to check
+// that it works, stepping down until it does. This is only meaningful with
+// CRC checking on, otherwise corrupt data isn't noticed.
+static void SD__Negotiate(SDCard *card)
+{
+    uint32_t speed = card->maxTranSpeed;
+    if (speed > SPI_SD_SPEED_MAX) {
+        speed = SPI_SD_SPEED_MAX;
+    }
+
+    if ((speed <= card->tranSpeed) || !SD__SetSpeed(card, speed)) {
+        return;
+    }
+
+    while (!SD_ReadCSD(card)) {
+        if (!SD__StepDown(card)) {
+            break;
+        }
+    }
+}
+
 SDCard *SD_Open(SPIMaster *interface)
 {
     static SDCard SD_Cards[SD_CARD_MAX] = {0};
@@ -567,14 +859,12 @@ SDCard *SD_Open(SPIMaster *interface)
         return NULL;
     }
 
-    if (!(timer = GPT_Open(
-        MT3620_UNIT_GPT3, MT3620_GPT_3_LOW_SPEED, GPT_MODE_ONE_SHOT))) {
-        return NULL;
-    }
-
+    // Registered by the first card opened, and urgent so a stalled request
+    // is abandoned ahead of other work.
+    EventQueue_Init(&SD_TimeoutEvents, 0, SD__Async_Timeout);
 
     // Configure SPI Master to 400 kHz.
-    SPIMaster_Configure(interface, 0, 0, 400000);
+    SPIMaster_Configure(interface, 0, 0, SPI_SD_SPEED_INIT);
 
     unsigned retries = 5;
     unsigned i;
@@ -589,13 +879,15 @@ SDCard *SD_Open(SPIMaster *interface)
 
     card->interface    = interface;
     card->blockLen     = 512;
-    card->maxTranSpeed = 400000;
-    card->tranSpeed    = 400000;
+    card->maxTranSpeed = SPI_SD_SPEED_INIT;
+    card->tranSpeed    = SPI_SD_SPEED_INIT;
+    card->crc          = false;
 
-    if (SD_ReadCSD(card) && (card->maxTranSpeed != card->tranSpeed)) {
-        if (SPIMaster_Configure(card->interface, 0, 0, card->maxTranSpeed) == ERROR_NONE) {
-            card->tranSpeed = card->maxTranSpeed;
-        }
+    // Checking is optional in SPI mode, carry on without it if need be.
+    SD_SetCRC(card, true);
+
+    if (SD_ReadCSD(card)) {
+        SD__Negotiate(card);
     }
 
     return card;
@@ -605,7 +897,53 @@ SDCard *SD_Open(SPIMaster *interface)
 void SD_Close(SDCard *card)
 {
     card->interface = NULL;
-    GPT_Close(timer);
+    Scheduler_TimerStop(&timer);
+}
+
+
+bool SD_SetCRC(SDCard *card, bool enable)
+{
+    if (!card) {
+        return false;
+    }
+
+    SD_R1 response;
+    if (!SD_Command(card->interface, CRC_ON_OFF, (enable ? 1 : 0), sizeof(response), &response)) {
+        return false;
+    }
+
+    if (response.mask != 0x00) {
+        return false;
+    }
+
+    card->crc = enable;
+    return true;
+}
+
+
+void SD_SetBusyClock(GPT *clock)
+{
+    SD_BusyClock = clock;
+    SD_GetBusyStats(NULL, true);
+}
+
+
+void SD_GetBusyStats(SD_BusyStats *stats, bool reset)
+{
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (stats) {
+        *stats = SD_BusyTotals;
+    }
+    if (reset) {
+        SD_BusyTotals = (SD_BusyStats){0};
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+
+uint32_t SD_GetSpeed(const SDCard *card)
+{
+    return (card ? card->tranSpeed : 0);
 }
 
 
@@ -617,7 +955,8 @@ uint32_t SD_GetBlockLen(const SDCard *card)
 
 bool SD_SetBlockLen(SDCard *card, uint32_t len)
 {
-    if (!card || (len == 0)) {
+    // Blocks are staged for DMA in a fixed size buffer.
+    if (!card || (len == 0) || (len > SD_MAX_BLOCK_LEN)) {
         return false;
     }
 
@@ -635,22 +974,107 @@ bool SD_SetBlockLen(SDCard *card, uint32_t len)
 }
 
 
-bool SD_ReadBlock(const SDCard *card, uint32_t addr, void *data)
+// How a read went, so that only failures a slower bus might fix are retried.
+typedef enum {
+    SD_READ_OK,
+    // Lost or corrupted on the bus, or the card didn't send the data.
+    SD_READ_FAILED,
+    // The card refused the command as given, such as an address past its end.
+    SD_READ_REJECTED,
+} SD_ReadResult;
+
+static SD_ReadResult SD__ReadResponse(SD_R1 response)
 {
-    if (!card || !data) {
-        return false;
+    if (response.illegalCommand || response.addressError || response.parameterError) {
+        return SD_READ_REJECTED;
     }
+    return ((response.mask == 0x00) ? SD_READ_OK : SD_READ_FAILED);
+}
 
+static SD_ReadResult SD__ReadBlock(const SDCard *card, uint32_t addr, void *data)
+{
     SD_R1 response;
     if (!SD_CommandIncomplete(card->interface, READ_SINGLE_BLOCK, addr, sizeof(response), &response)) {
-        return false;
+        return SD_READ_FAILED;
     }
 
-    if (response.mask != 0x00) {
+    SD_ReadResult result = SD__ReadResponse(response);
+    if (result != SD_READ_OK) {
+        return result;
+    }
+
+    return (SD_ReadDataPacket(card, card->blockLen, data, true) ? SD_READ_OK : SD_READ_FAILED);
+}
+
+
+static SD_ReadResult SD__ReadBlocks(const SDCard *card, uint32_t addr, uint32_t count, void *data)
+{
+    if (count == 1) {
+        return SD__ReadBlock(card, addr, data);
+    }
+
+    SD_R1 response;
+    if (!SD_CommandIncomplete(card->interface, READ_MULTIPLE_BLOCK, addr, sizeof(response), &response)) {
+        return SD_READ_FAILED;
+    }
+
+    SD_ReadResult result = SD__ReadResponse(response);
+    if (result != SD_READ_OK) {
+        return result;
+    }
+
+    // Reading stops at the first block which fails, but the card streams
+    // blocks until told to stop, so STOP_TRANSMISSION is still sent to leave
+    // it in a known state.
+    uint8_t *data_byte = data;
+    bool success = true;
+    uint32_t block;
+    for (block = 0; success && (block < count); block++, data_byte += card->blockLen) {
+        success = SD_ReadDataPacket(card, card->blockLen, data_byte, false);
+    }
+
+    // The byte following STOP_TRANSMISSION is a stuff byte, which
+    // SD_CommandIncomplete already skips.
+    if (!SD_CommandIncomplete(card->interface, STOP_TRANSMISSION, 0, sizeof(response), &response)
+        || !SD_AwaitNotBusy(card->interface, NUM_RETRIES)
+        || !SD_ClockBurst(card->interface, 32, false)) {
+        return SD_READ_FAILED;
+    }
+
+    // Reading on past the end of the card is reported in response to the stop.
+    result = SD__ReadResponse(response);
+    if (result != SD_READ_OK) {
+        return result;
+    }
+    return (success ? SD_READ_OK : SD_READ_FAILED);
+}
+
+
+// A read which fails on the bus is retried at successively lower bus speeds,
+// in case the card or wiring can't keep up. The lower speed is kept from then
+// on. A read the card refuses, such as of an address it doesn't have, fails
+// straight away at the speed it was tried at.
+bool SD_ReadBlock(SDCard *card, uint32_t addr, void *data)
+{
+    return SD_ReadBlocks(card, addr, 1, data);
+}
+
+
+bool SD_ReadBlocks(SDCard *card, uint32_t addr, uint32_t count, void *data)
+{
+    PROFILE_SCOPE(SD_ReadBlocks);
+    if (!card || !data || (count == 0) || SD_Async.active) {
         return false;
     }
 
-    return SD_ReadDataPacket(card, card->blockLen, data);
+    SD_ReadResult result;
+    while ((result = SD__ReadBlocks(card, addr, count, data)) == SD_READ_FAILED) {
+        if (!SD__StepDown(card)) {
+            return false;
+        }
+    }
+
+    return (result == SD_READ_OK);
 }
 
 
@@ -671,7 +1095,7 @@ bool SD_WriteBlock(SDCard *card, uint32_t addr, const void *data)
         return false;
     }
 
-    if (!SD_WriteDataPacket(card, card->blockLen, data)) {
+    if (!SD_WriteDataPacket(card, card->blockLen, data, DATA_TOKEN_WRITE_SINGLE)) {
         if (num_retries > 0) {
             num_retries--;
             return SD_WriteBlock(card, addr, data);
@@ -685,3 +1109,550 @@ bool SD_WriteBlock(SDCard *card, uint32_t addr, const void *data)
         return true;
     }
 }
+
+
+// Blocks come either from one contiguous buffer or, when blocks isn't NULL,
+// from a separate buffer each.
+static bool SD__WriteBlocks(SDCard *card, uint32_t addr, uint32_t count,
+                            const void *data, const void *const *blocks)
+{
+    if (!card || (!data && !blocks) || (count == 0)) {
+        return false;
+    }
+
+    if (count == 1) {
+        return SD_WriteBlock(card, addr, (blocks ? blocks[0] : data));
+    }
+
+    // Let the card pre-erase the whole range, which speeds up the write.
+    // This is only a hint, so carry on if the card doesn't support it.
+    SD_R1 response;
+    if (SD_Command(card->interface, APP_CMD, 0, sizeof(response), &response)
+        && ((response.mask & ~0x01) == 0x00)) {
+        SD_Command(card->interface, APP_SET_WR_BLK_ERASE_COUNT,
+            (count & 0x007FFFFF), sizeof(response), &response);
+    }
+
+    if (!SD_CommandIncomplete(card->interface, WRITE_MULTIPLE_BLOCK, addr, sizeof(response), &response)) {
+        return false;
+    }
+
+    if (response.mask != 0x00) {
+        return false;
+    }
+
+    const uint8_t *data_byte = data;
+    bool success = true;
+    uint32_t block;
+    for (block = 0; success && (block < count); block++, data_byte += card->blockLen) {
+        success = SD_WriteDataPacket(card, card->blockLen,
+            (blocks ? blocks[block] : data_byte), DATA_TOKEN_WRITE_MULT);
+    }
+
+    // Writing stops at the first block which fails, but the stop token is
+    // still needed to end the transfer.
+    if (!SD_WriteStopTran(card)) {
+        return false;
+    }
+
+    return success;
+}
+
+
+bool SD_WriteBlocks(SDCard *card, uint32_t addr, uint32_t count, const void *data)
+{
+    return SD__WriteBlocks(card, addr, count, data, NULL);
+}
+
+
+bool SD_WriteBlocksV(SDCard *card, uint32_t addr, uint32_t count, const void *const *blocks)
+{
+    return SD__WriteBlocks(card, addr, count, NULL, blocks);
+}
+
+
+// Asynchronous requests run the same sequences as the functions above, with
+// each step started from the completion interrupt of the one before. Polls
+// for a response or token are single bytes, as bytes following them belong
+// to the next step, busy polls read several at a time. The timer bounds each
+// step rather than each poll.
+#define SD_ASYNC_FRAME    0
+#define SD_ASYNC_STUFF    6
+#define SD_ASYNC_POLL     8
+#define SD_ASYNC_BUSY_LEN 8
+#define SD_ASYNC_STOP     (SD_ASYNC_POLL + SD_ASYNC_BUSY_LEN)
+
+static void SD__Async_Begin(void);
+static void SD__Async_Done0(int32_t status, uintptr_t dataCount);
+static void SD__Async_Done1(int32_t status, uintptr_t dataCount);
+
+static void SD__Async_Finish(bool success)
+{
+    Scheduler_TimerStop(&timer);
+
+    SD_Request *request = SD_Async.active;
+    SPIMaster_SelectEnable(request->card->interface, true);
+    SD_Async.state = SD_ASYNC_IDLE;
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    SD_Request *next = SD_Async.head;
+    if (next) {
+        SD_Async.head = next->next;
+        if (!SD_Async.head) {
+            SD_Async.tail = NULL;
+        }
+    }
+    SD_Async.active = next;
+    request->queued = false;
+    NVIC_RestoreIRQs(prevBasePri);
+
+    request->callback(request, success);
+
+    if (next) {
+        SD__Async_Begin();
+    }
+}
+
+static void SD__Async_Timeout(void *payload)
+{
+    uint32_t step = *(const uint32_t *)payload;
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    // The step may have completed while the event waited, and the request
+    // moved on or finished.
+    if ((SD_Async.state != SD_ASYNC_IDLE) && (SD_Async.step == step)) {
+        SD_Async.state = SD_ASYNC_IDLE;
+        SPIMaster_TransferCancel(SD_Async.active->card->interface);
+        SD_Async.epoch ^= 1;
+        SD__Async_Finish(false);
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+// Starts a step in state, restarting the timeout when timeout is non-zero.
+static void SD__Async_Transfer(
+    SD_AsyncState  state,
+    SPITransfer   *transfer,
+    uint32_t       count,
+    uint32_t       timeout)
+{
+    SD_Async.state = state;
+
+    if (timeout != 0) {
+        // The timer posts the step as it is when it expires.
+        SD_Async.step++;
+        if (!Scheduler_TimerStart(&timer, &SD_TimeoutEvents, &SD_Async.step, (timeout * 1000), 0)) {
+            SD__Async_Finish(false);
+            return;
+        }
+    }
+
+    if (SPIMaster_TransferSequentialAsync(SD_Async.active->card->interface,
+        transfer, count, (SD_Async.epoch ? SD__Async_Done1 : SD__Async_Done0)) != ERROR_NONE) {
+        SD__Async_Finish(false);
+    }
+}
+
+static void SD__Async_Poll(SD_AsyncState state, uintptr_t length, bool first)
+{
+    if (first) {
+        SD_Async.polls = 0;
+    }
+
+    SPITransfer transfer = { .readData = &SD_Scratch[SD_ASYNC_POLL], .length = length };
+    SD__Async_Transfer(state, &transfer, 1,
+        (first ? ((state == SD_ASYNC_BUSY) ? SPI_SD_BUSY_TIMEOUT : SPI_SD_TIMEOUT) : 0));
+}
+
+static void SD__Async_Command(SD_CMD cmd, uint32_t argument)
+{
+    SD_CommandFrame frame;
+    frame.index    = (0b01 << 6) | cmd;
+    frame.argument = __builtin_bswap32(argument);
+    frame.crc      = SD_Crc7(&frame, (sizeof(frame.index) + sizeof(frame.argument)));
+    __builtin_memcpy(&SD_Scratch[SD_ASYNC_FRAME], &frame, sizeof(frame));
+
+    SD_Async.cmd = cmd;
+
+    // The first byte of the response is ignored.
+    SPITransfer transfer[2] = {
+        { .writeData = &SD_Scratch[SD_ASYNC_FRAME], .length = sizeof(frame) },
+        { .readData  = &SD_Scratch[SD_ASYNC_STUFF], .length = 1 },
+    };
+    SD__Async_Transfer(SD_ASYNC_COMMAND, transfer, 2, SPI_SD_TIMEOUT);
+}
+
+// Clock bursts with the card deselected, as in SD_ClockBurst.
+static void SD__Async_Burst(unsigned cycles, void (*next)(void))
+{
+    SD_Async.next = next;
+    if (SPIMaster_SelectEnable(SD_Async.active->card->interface, false) != ERROR_NONE) {
+        SD__Async_Finish(false);
+        return;
+    }
+
+    SPITransfer transfer = { .readData = &SD_Scratch[SD_ASYNC_POLL], .length = ((cycles + 7) / 8) };
+    SD__Async_Transfer(SD_ASYNC_BURST, &transfer, 1, SPI_SD_TIMEOUT);
+}
+
+static void SD__Async_Busy(void (*next)(void))
+{
+    SD_Async.next      = next;
+    SD_Async.busyStart = SD__Busy_Start();
+    SD__Async_Poll(SD_ASYNC_BUSY, SD_ASYNC_BUSY_LEN, true);
+}
+
+static uint8_t *SD__Async_BlockData(void)
+{
+    const SD_Request *request = SD_Async.active;
+    return &((uint8_t *)request->data)[SD_Async.block * request->card->blockLen];
+}
+
+static void SD__Async_Complete(void)
+{
+    SD__Async_Finish(SD_Async.success);
+}
+
+static void SD__Async_Recover(void)
+{
+    SD__Async_Burst(32, SD__Async_Complete);
+}
+
+static void SD__Async_Read_Packet(void)
+{
+    uint32_t size = SD_Async.active->card->blockLen;
+    uint8_t *data = SD__Async_BlockData();
+
+    SPITransfer transfer[2];
+    uint32_t count;
+    SD_Async.staged = !SD__InSysRAM(data, size);
+    if (!SD_Async.staged) {
+        transfer[0] = (SPITransfer){ .readData = data, .length = size };
+        transfer[1] = (SPITransfer){ .readData = &SD_Packet[SD_PACKET_DATA], .length = 2 };
+        count = 2;
+    } else {
+        transfer[0] = (SPITransfer){ .readData = &SD_Packet[SD_PACKET_DATA], .length = size + 2 };
+        count = 1;
+    }
+
+    SD__Async_Transfer(SD_ASYNC_READ_DATA, transfer, count, SPI_SD_TIMEOUT);
+}
+
+static void SD__Async_Read_End(void)
+{
+    if (SD_Async.active->count > 1) {
+        SD__Async_Command(STOP_TRANSMISSION, 0);
+    } else {
+        SD__Async_Recover();
+    }
+}
+
+static void SD__Async_Write_Packet(void)
+{
+    uint32_t size = SD_Async.active->card->blockLen;
+    const uint8_t *data = SD__Async_BlockData();
+
+    bool crcEnable = SD_Async.active->card->crc;
+    SD_Packet[SD_PACKET_TOKEN] = ((SD_Async.active->count > 1)
+        ? DATA_TOKEN_WRITE_MULT : DATA_TOKEN_WRITE_SINGLE);
+
+    SPITransfer transfer[3];
+    uint32_t count;
+    if (SD__InSysRAM(data, size)) {
+        uint8_t *crc = &SD_Packet[SD_PACKET_DATA];
+        SD__Crc16_Put(data, size, crc, crcEnable);
+
+        transfer[0] = (SPITransfer){ .writeData = SD_Packet, .length = 1 };
+        transfer[1] = (SPITransfer){ .writeData = data,      .length = size };
+        transfer[2] = (SPITransfer){ .writeData = crc,       .length = 2 };
+        count = 3;
+    } else {
+        uint8_t *crc = &SD_Packet[SD_PACKET_DATA + size];
+        __builtin_memcpy(&SD_Packet[SD_PACKET_DATA], data, size);
+        SD__Crc16_Put(data, size, crc, crcEnable);
+
+        transfer[0] = (SPITransfer){ .writeData = SD_Packet, .length = 1 + size + 2 };
+        count = 1;
+    }
+
+    SD__Async_Transfer(SD_ASYNC_WRITE_DATA, transfer, count, SPI_SD_TIMEOUT);
+}
+
+static void SD__Async_Write_Packet_Gap(void)
+{
+    // Clock burst for >= 1 byte
+    SD__Async_Burst(16, SD__Async_Write_Packet);
+}
+
+static void SD__Async_Write_End(void)
+{
+    if (SD_Async.active->count == 1) {
+        SD__Async_Finish(SD_Async.success);
+        return;
+    }
+
+    // The stop token is needed even after an error to end the transfer,
+    // and the card needs one byte before it signals busy.
+    SD_Scratch[SD_ASYNC_STOP] = DATA_TOKEN_WRITE_MULT_STOP;
+    SPITransfer transfer[2] = {
+        { .writeData = &SD_Scratch[SD_ASYNC_STOP],     .length = 1 },
+        { .readData  = &SD_Scratch[SD_ASYNC_STOP + 1], .length = 1 },
+    };
+    SD__Async_Transfer(SD_ASYNC_STOP_TRAN, transfer, 2, SPI_SD_TIMEOUT);
+}
+
+static void SD__Async_Write_Next(void)
+{
+    SD_Async.block++;
+    if (SD_Async.success && (SD_Async.block < SD_Async.active->count)) {
+        SD__Async_Write_Packet_Gap();
+    } else {
+        SD__Async_Write_End();
+    }
+}
+
+static void SD__Async_Send_EraseCount(void)
+{
+    SD__Async_Command(APP_SET_WR_BLK_ERASE_COUNT, (SD_Async.active->count & 0x007FFFFF));
+}
+
+static void SD__Async_Send_WriteMultiple(void)
+{
+    SD__Async_Command(WRITE_MULTIPLE_BLOCK, SD_Async.active->addr);
+}
+
+static void SD__Async_Response(uint8_t byte)
+{
+    switch (SD_Async.cmd) {
+    // Pre-erase hint, carry on if the card doesn't support it.
+    case APP_CMD:
+        SD__Async_Burst(32, (((byte & ~0x01) == 0x00)
+            ? SD__Async_Send_EraseCount : SD__Async_Send_WriteMultiple));
+        break;
+
+    case APP_SET_WR_BLK_ERASE_COUNT:
+        SD__Async_Burst(32, SD__Async_Send_WriteMultiple);
+        break;
+
+    case READ_SINGLE_BLOCK:
+    case READ_MULTIPLE_BLOCK:
+        if (byte != 0x00) {
+            SD__Async_Finish(false);
+        } else {
+            SD__Async_Poll(SD_ASYNC_READ_TOKEN, 1, true);
+        }
+        break;
+
+    case WRITE_BLOCK:
+    case WRITE_MULTIPLE_BLOCK:
+        if (byte != 0x00) {
+            SD__Async_Finish(false);
+        } else {
+            SD__Async_Write_Packet_Gap();
+        }
+        break;
+
+    case STOP_TRANSMISSION:
+        if (byte != 0x00) {
+            SD_Async.success = false;
+        }
+        SD__Async_Busy(SD__Async_Recover);
+        break;
+
+    default:
+        SD__Async_Finish(false);
+        break;
+    }
+}
+
+static void SD__Async_Done(unsigned epoch, int32_t status)
+{
+    if ((SD_Async.state == SD_ASYNC_IDLE) || (epoch != SD_Async.epoch)) {
+        return;
+    }
+
+    if (status != ERROR_NONE) {
+        SD__Async_Finish(false);
+        return;
+    }
+
+    uint8_t byte = SD_Scratch[SD_ASYNC_POLL];
+    switch (SD_Async.state) {
+    case SD_ASYNC_COMMAND:
+        SD__Async_Poll(SD_ASYNC_RESPONSE, 1, true);
+        break;
+
+    case SD_ASYNC_RESPONSE:
+        if (byte != 0xFF) {
+            SD__Async_Response(byte);
+        } else if (++SD_Async.polls < 32) {
+            SD__Async_Poll(SD_ASYNC_RESPONSE, 1, false);
+        } else {
+            SD__Async_Finish(false);
+        }
+        break;
+
+    case SD_ASYNC_BURST:
+        if (SPIMaster_SelectEnable(SD_Async.active->card->interface, true) != ERROR_NONE) {
+            SD__Async_Finish(false);
+        } else {
+            SD_Async.next();
+        }
+        break;
+
+    case SD_ASYNC_READ_TOKEN:
+        if (byte == DATA_TOKEN_READ_SINGLE) {
+            SD__Async_Read_Packet();
+        } else if ((byte == 0xFF) && (++SD_Async.polls < NUM_RETRIES)) {
+            SD__Async_Poll(SD_ASYNC_READ_TOKEN, 1, false);
+        } else {
+            // The card streams blocks until told to stop.
+            SD_Async.success = false;
+            SD__Async_Read_End();
+        }
+        break;
+
+    case SD_ASYNC_READ_DATA:
+        {
+            uint32_t size = SD_Async.active->card->blockLen;
+            const uint8_t *packet = (SD_Async.staged
+                ? &SD_Packet[SD_PACKET_DATA] : SD__Async_BlockData());
+            const uint8_t *crc = &SD_Packet[SD_PACKET_DATA + (SD_Async.staged ? size : 0)];
+            if (SD_Async.active->card->crc && !SD__Crc16_Check(packet, size, crc)) {
+                SD_Async.success = false;
+            }
+            if (SD_Async.staged) {
+                __builtin_memcpy(SD__Async_BlockData(), packet, size);
+            }
+        }
+        if (SD_Async.success && (++SD_Async.block < SD_Async.active->count)) {
+            SD__Async_Poll(SD_ASYNC_READ_TOKEN, 1, true);
+        } else {
+            SD__Async_Read_End();
+        }
+        break;
+
+    case SD_ASYNC_WRITE_DATA:
+        SD__Async_Poll(SD_ASYNC_WRITE_RESPONSE, 1, true);
+        break;
+
+    case SD_ASYNC_WRITE_RESPONSE:
+        if (byte == 0xFF) {
+            if (++SD_Async.polls < NUM_RETRIES) {
+                SD__Async_Poll(SD_ASYNC_WRITE_RESPONSE, 1, false);
+            } else {
+                SD__Async_Finish(false);
+            }
+        } else if ((byte & 0xF) != DATA_RESP_ACCEPTED) {
+            SD_Async.success = false;
+            SD__Async_Write_End();
+        } else {
+            SD__Async_Busy(SD__Async_Write_Next);
+        }
+        break;
+
+    case SD_ASYNC_STOP_TRAN:
+        SD__Async_Busy(SD__Async_Complete);
+        break;
+
+    case SD_ASYNC_BUSY:
+        // Wait while card holds MISO low (busy)
+        if (SD_Scratch[SD_ASYNC_POLL + SD_ASYNC_BUSY_LEN - 1] != 0x00) {
+            if (SD_Async.active->write) {
+                SD__Busy_Record(SD_Async.busyStart);
+            }
+            SD_Async.next();
+        } else if (++SD_Async.polls < NUM_RETRIES) {
+            SD__Async_Poll(SD_ASYNC_BUSY, SD_ASYNC_BUSY_LEN, false);
+        } else {
+            SD__Async_Finish(false);
+        }
+        break;
+
+    default:
+        SD__Async_Finish(false);
+        break;
+    }
+}
+
+static void SD__Async_Done0(int32_t status, uintptr_t dataCount)
+{
+    (void)dataCount;
+    SD__Async_Done(0, status);
+}
+
+static void SD__Async_Done1(int32_t status, uintptr_t dataCount)
+{
+    (void)dataCount;
+    SD__Async_Done(1, status);
+}
+
+static void SD__Async_Begin(void)
+{
+    const SD_Request *request = SD_Async.active;
+    SD_Async.block   = 0;
+    SD_Async.success = true;
+
+    if (!request->write) {
+        SD__Async_Command((request->count > 1)
+            ? READ_MULTIPLE_BLOCK : READ_SINGLE_BLOCK, request->addr);
+    } else if (request->count == 1) {
+        SD__Async_Command(WRITE_BLOCK, request->addr);
+    } else {
+        // Let the card pre-erase the whole range, as in SD_WriteBlocks.
+        SD__Async_Command(APP_CMD, 0);
+    }
+}
+
+static bool SD__Async_Submit(SDCard *card, SD_Request *request, bool write)
+{
+    if (!card || !card->interface || !request || !request->data ||
+        !request->callback || (request->count == 0) || request->queued) {
+        return false;
+    }
+
+    request->card   = card;
+    request->write  = write;
+    request->next   = NULL;
+    request->queued = true;
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    bool start = !SD_Async.active;
+    if (start) {
+        SD_Async.active = request;
+    } else if (SD_Async.tail) {
+        SD_Async.tail->next = request;
+        SD_Async.tail       = request;
+    } else {
+        SD_Async.head = request;
+        SD_Async.tail = request;
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+
+    if (start) {
+        SD__Async_Begin();
+    }
+
+    return true;
+}
+
+bool SD_SubmitRead(SDCard *card, SD_Request *request)
+{
+    return SD__Async_Submit(card, request, false);
+}
+
+bool SD_SubmitWrite(SDCard *card, SD_Request *request)
+{
+    return SD__Async_Submit(card, request, true);
+}
+
+bool SD_Busy(const SDCard *card)
+{
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    bool busy = (SD_Async.active && (SD_Async.active->card == card));
+    for (const SD_Request *r = SD_Async.head; !busy && r; r = r->next) {
+        busy = (r->card == card);
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+    return busy;
+}
@@ -10,13 +10,77 @@
 
 typedef struct SDCard SDCard;
 
+// Transfers are timed out by a scheduler timer, so Scheduler_Init() must have
+// been called before a card is opened. Asynchronous requests which time out
+// are abandoned from an event queue the driver registers, so the main loop
+// must be dispatching events while any are outstanding.
 SDCard  *SD_Open(SPIMaster *interface);
 void     SD_Close(SDCard *card);
 
+// Turn CRC checking of commands and data on or off (CMD59), SD_Open turns it
+// on. While on, data CRCs are sent and received blocks are verified.
+bool     SD_SetCRC(SDCard *card, bool enable);
+
+// Current SPI bus speed in Hz. SD_Open runs the bus as fast as the card
+// allows, and reads step it down if they start failing.
+uint32_t SD_GetSpeed(const SDCard *card);
+
+// Time the card spends busy programming written blocks, in ticks of the
+// clock given to SD_SetBusyClock, which must be free running. For profiling,
+// nothing is measured until a clock is set.
+typedef struct {
+    uint32_t count;
+    uint64_t total;
+    uint32_t max;
+} SD_BusyStats;
+
+void     SD_SetBusyClock(GPT *clock);
+void     SD_GetBusyStats(SD_BusyStats *stats, bool reset);
+
 uint32_t SD_GetBlockLen(const SDCard *card);
 bool     SD_SetBlockLen(SDCard *card, uint32_t len);
 
-bool     SD_ReadBlock (const SDCard *card, uint32_t addr, void *data);
+bool     SD_ReadBlock (SDCard *card, uint32_t addr, void *data);
 bool     SD_WriteBlock(SDCard *card, uint32_t addr, const void *data);
 
+// Transfer count consecutive blocks starting at addr with a single command,
+// data must hold count * SD_GetBlockLen(card) bytes.
+bool     SD_ReadBlocks (SDCard *card, uint32_t addr, uint32_t count, void *data);
+bool     SD_WriteBlocks(SDCard *card, uint32_t addr, uint32_t count, const void *data);
+// As SD_WriteBlocks, with the data for each block in its own buffer.
+bool     SD_WriteBlocksV(SDCard *card, uint32_t addr, uint32_t count, const void *const *blocks);
+
+typedef struct SD_Request SD_Request;
+
+// Called from the SPI interrupt once a request completes, so anything more
+// than noting the result should be deferred to the main loop. A request which
+// timed out is completed from the main loop with interrupts blocked, so an
+// event queue posted to here still only ever has one producer at a time.
+typedef void (*SD_RequestCallback)(SD_Request *request, bool success);
+
+// An asynchronous transfer of count blocks starting at addr, the storage
+// for the request and its data belongs to the caller and must stay valid
+// until the callback. Set the first five fields before submitting.
+struct SD_Request {
+    uint32_t            addr;
+    uint32_t            count;
+    void               *data;
+    SD_RequestCallback  callback;
+    void               *userData;
+
+    // Private, managed by the driver.
+    SDCard             *card;
+    bool                write;
+    bool                queued;
+    SD_Request         *next;
+};
+
+// Queue a request and return immediately, requests run one at a time in
+// the order submitted. The synchronous functions above fail while any
+// request is outstanding.
+bool     SD_SubmitRead (SDCard *card, SD_Request *request);
+bool     SD_SubmitWrite(SDCard *card, SD_Request *request);
+// Whether any requests submitted for card haven't completed yet.
+bool     SD_Busy(const SDCard *card);
+
 #endif // #ifndef SD_H_
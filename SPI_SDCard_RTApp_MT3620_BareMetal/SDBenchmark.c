@@ -0,0 +1,214 @@
+#include "SDBenchmark.h"
+
+#include "lib/Print.h"
+
+#define SD_BENCHMARK_BLOCK_LEN 512
+// Every test stays within this many blocks from SD_BENCHMARK_BASE, set from
+// CMake so the benchmark can be kept clear of a filesystem.
+#define SD_BENCHMARK_SPAN      16384
+#ifndef SD_BENCHMARK_BASE
+#define SD_BENCHMARK_BASE      0
+#endif
+// Time given to reset the board before a filesystem is overwritten.
+#define SD_BENCHMARK_GRACE     10 // [s]
+
+typedef struct {
+    const char *name;
+    // Blocks per operation, 0 for as many as fit in the buffer.
+    uint32_t    blocks;
+    uint32_t    ops;
+    bool        random;
+    bool        write;
+} SDBenchmark_Test;
+
+static const SDBenchmark_Test SDBenchmark_Tests[] = {
+    {"seq-write",  1, 256, false, true },
+    {"seq-read",   1, 256, false, false},
+    {"rand-write", 1, 256, true,  true },
+    {"rand-read",  1, 256, true,  false},
+    {"seq-write",  8, 128, false, true },
+    {"seq-read",   8, 128, false, false},
+    {"rand-write", 8, 128, true,  true },
+    {"rand-read",  8, 128, true,  false},
+    {"seq-write",  0,  16, false, true },
+    {"seq-read",   0,  16, false, false},
+    {"rand-write", 0,  16, true,  true },
+    {"rand-read",  0,  16, true,  false},
+};
+
+#define SD_BENCHMARK_TESTS (sizeof(SDBenchmark_Tests) / sizeof(SDBenchmark_Tests[0]))
+
+static uint32_t SDBenchmark__Random(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static uint32_t SDBenchmark__Micros(uint64_t ticks, uint32_t speed)
+{
+    return (uint32_t)((ticks * 1000000) / (speed ? speed : 1));
+}
+
+static bool SDBenchmark__Op(SDCard *card, const SDBenchmark_Test *test,
+                            uint32_t addr, uint32_t blocks, void *buffer)
+{
+    if (blocks == 1) {
+        return (test->write ? SD_WriteBlock(card, addr, buffer)
+            : SD_ReadBlock(card, addr, buffer));
+    }
+    return (test->write ? SD_WriteBlocks(card, addr, blocks, buffer)
+        : SD_ReadBlocks(card, addr, blocks, buffer));
+}
+
+static bool SDBenchmark__Run_Test(
+    SDCard *card, GPT *clock, UART *debug, uint32_t speed,
+    const SDBenchmark_Test *test, void *buffer, uint32_t blocks)
+{
+    // Fixed seed so every run touches the same blocks.
+    uint32_t seed   = 0x2545F491;
+    uint32_t slots  = (SD_BENCHMARK_SPAN / blocks);
+    uint64_t total  = 0;
+    uint32_t worst  = 0;
+
+    SD_GetBusyStats(NULL, true);
+
+    // Nothing is printed until the test ends so the UART doesn't skew timing.
+    for (uint32_t op = 0; op < test->ops; op++) {
+        uint32_t slot = (test->random ? (SDBenchmark__Random(&seed) % slots)
+            : (op % slots));
+        uint32_t addr = (SD_BENCHMARK_BASE + (slot * blocks));
+
+        uint32_t start = GPT_GetCount(clock);
+        bool success = SDBenchmark__Op(card, test, addr, blocks, buffer);
+        uint32_t elapsed = (GPT_GetCount(clock) - start);
+
+        if (!success) {
+            UART_Printf(debug,
+                "ERROR: Benchmark %s failed at block %lu\r\n", test->name, addr);
+            return false;
+        }
+
+        total += elapsed;
+        if (elapsed > worst) {
+            worst = elapsed;
+        }
+    }
+
+    SD_BusyStats busy;
+    SD_GetBusyStats(&busy, true);
+
+    uint32_t time  = SDBenchmark__Micros(total, speed);
+    uint64_t bytes = ((uint64_t)test->ops * blocks * SD_BENCHMARK_BLOCK_LEN);
+    uint32_t us    = (time ? time : 1);
+    uint32_t iops  = (uint32_t)(((uint64_t)test->ops * 1000000) / us);
+    // Bytes per microsecond is MB/s, kept to two decimal places.
+    uint32_t rate  = (uint32_t)((bytes * 100) / us);
+
+    UART_Printf(debug,
+        "BENCH %s size=%lu ops=%lu time=%luus iops=%lu throughput=%lu.%02luMB/s"
+        " max=%luus busy-max=%luus\r\n",
+        test->name, (blocks * SD_BENCHMARK_BLOCK_LEN), test->ops, time, iops,
+        (rate / 100), (rate % 100), SDBenchmark__Micros(worst, speed),
+        SDBenchmark__Micros(busy.max, speed));
+    return true;
+}
+
+// Whether the blocks benchmarked hold the MBR, a volume at block 0 or any of
+// a partition, going by block 0 read into buffer.
+static bool SDBenchmark__Overlaps_Filesystem(SDCard *card, uint8_t *buffer)
+{
+    if (!SD_ReadBlock(card, 0, buffer)
+        || (buffer[510] != 0x55) || (buffer[511] != 0xAA)) {
+        return false;
+    }
+
+    uint32_t end = (SD_BENCHMARK_BASE + SD_BENCHMARK_SPAN);
+    if ((SD_BENCHMARK_BASE == 0) || (buffer[0] == 0xEB) || (buffer[0] == 0xE9)) {
+        return true;
+    }
+
+    unsigned p;
+    for (p = 0; p < 4; p++) {
+        const uint8_t *partition = &buffer[446 + (p * 16)];
+        uint32_t start = (partition[8] | (partition[9] << 8)
+            | (partition[10] << 16) | ((uint32_t)partition[11] << 24));
+        uint32_t count = (partition[12] | (partition[13] << 8)
+            | (partition[14] << 16) | ((uint32_t)partition[15] << 24));
+        if ((partition[4] != 0) && (count != 0)
+            && (start < end) && (SD_BENCHMARK_BASE < (start + count))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SDBenchmark_Run(SDCard *card, GPT *clock, UART *debug,
+                     void *buffer, uint32_t bufferSize)
+{
+    uint32_t maxBlocks = (bufferSize / SD_BENCHMARK_BLOCK_LEN);
+    if (!card || !clock || !buffer || (maxBlocks == 0)) {
+        return false;
+    }
+
+    float speedHz;
+    if (GPT_GetSpeed(clock, &speedHz) != ERROR_NONE) {
+        return false;
+    }
+    uint32_t speed = (uint32_t)speedHz;
+
+    if (!SD_SetBlockLen(card, SD_BENCHMARK_BLOCK_LEN)) {
+        UART_Print(debug, "ERROR: Benchmark failed to set block length\r\n");
+        return false;
+    }
+
+    UART_Printf(debug, "WARNING: The benchmark overwrites blocks %lu to %lu of the card.\r\n",
+                (uint32_t)SD_BENCHMARK_BASE, (uint32_t)(SD_BENCHMARK_BASE + SD_BENCHMARK_SPAN - 1));
+    if (SDBenchmark__Overlaps_Filesystem(card, buffer)) {
+        UART_Printf(debug,
+            "WARNING: ********************************************************\r\n"
+            "WARNING: This DESTROYS the filesystem on the card, including any\r\n"
+            "WARNING: logs. Reset the board within %u seconds to keep it, or\r\n"
+            "WARNING: set SD_BENCHMARK_BASE past the end of the partition.\r\n"
+            "WARNING: ********************************************************\r\n",
+            SD_BENCHMARK_GRACE);
+        uint32_t start = GPT_GetCount(clock);
+        while ((GPT_GetCount(clock) - start) < (SD_BENCHMARK_GRACE * speed));
+    }
+
+    uint8_t *buffer_byte = buffer;
+    for (uint32_t i = 0; i < (maxBlocks * SD_BENCHMARK_BLOCK_LEN); i++) {
+        buffer_byte[i] = (uint8_t)i;
+    }
+
+    UART_Printf(debug, "Benchmarking SD card at %lu Hz\r\n", SD_GetSpeed(card));
+
+    SD_SetBusyClock(clock);
+
+    bool success = true;
+    for (unsigned t = 0; (t < SD_BENCHMARK_TESTS) && success; t++) {
+        const SDBenchmark_Test *test = &SDBenchmark_Tests[t];
+
+        uint32_t blocks = (test->blocks ? test->blocks : maxBlocks);
+        if (blocks > maxBlocks) {
+            continue;
+        }
+        // Multi-block tests which would repeat the 4KB ones are skipped.
+        if ((test->blocks == 0) && (maxBlocks <= 8)) {
+            continue;
+        }
+
+        success = SDBenchmark__Run_Test(
+            card, clock, debug, speed, test, buffer, blocks);
+    }
+
+    SD_SetBusyClock(NULL);
+
+    if (success) {
+        UART_Print(debug, "Benchmark complete\r\n");
+    }
+    return success;
+}
@@ -0,0 +1,28 @@
+#ifndef SD_BENCHMARK_H_
+#define SD_BENCHMARK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lib/GPT.h"
+#include "lib/UART.h"
+
+#include "SD.h"
+
+// SD card throughput/latency benchmark. Sequential and random reads and
+// writes are timed for single 512 byte blocks, 4KB transfers and multi-block
+// transfers of the whole buffer, and for each test the IOPS, throughput,
+// worst operation and worst time the card spent busy programming a write are
+// printed on the debug UART.
+//
+// Raw blocks are overwritten, 16384 of them from SD_BENCHMARK_BASE, which is
+// 0 unless set from CMake. When those hold the MBR or any of a partition, a
+// warning is printed and the benchmark waits 10 seconds before destroying the
+// filesystem, to give the chance to reset the board.
+
+// clock must be free running, and buffer should be in SYSRAM so it can be
+// transferred by DMA without staging. The block length is set to 512.
+bool SDBenchmark_Run(SDCard *card, GPT *clock, UART *debug,
+                     void *buffer, uint32_t bufferSize);
+
+#endif // #ifndef SD_BENCHMARK_H_
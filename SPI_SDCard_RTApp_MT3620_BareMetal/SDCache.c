@@ -0,0 +1,229 @@
+#include "SDCache.h"
+
+// Longest run of dirty blocks written by a single command.
+#define SD_CACHE_RUN_MAX 16
+
+typedef struct {
+    uint32_t addr;
+    uint32_t lastUse;
+    bool     valid;
+    bool     dirty;
+} SDCache_Entry;
+
+struct SDCache {
+    SDCard        *card;
+    SDCache_Entry *entries;
+    uint8_t       *blocks;
+    uint32_t       blockLen;
+    uint32_t       count;
+    uint32_t       clock;
+};
+
+_Static_assert(sizeof(SDCache) <= SD_CACHE_HEADER_SIZE,
+    "SD_CACHE_HEADER_SIZE is too small");
+_Static_assert(sizeof(SDCache_Entry) <= SD_CACHE_ENTRY_SIZE,
+    "SD_CACHE_ENTRY_SIZE is too small");
+
+static uint8_t *SDCache__Data(const SDCache *cache, const SDCache_Entry *entry)
+{
+    return &cache->blocks[(entry - cache->entries) * cache->blockLen];
+}
+
+static SDCache_Entry *SDCache__Find(const SDCache *cache, uint32_t addr)
+{
+    for (uint32_t e = 0; e < cache->count; e++) {
+        SDCache_Entry *entry = &cache->entries[e];
+        if (entry->valid && (entry->addr == addr)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static SDCache_Entry *SDCache__Find_Dirty(const SDCache *cache, uint32_t addr)
+{
+    SDCache_Entry *entry = SDCache__Find(cache, addr);
+    return ((entry && entry->dirty) ? entry : NULL);
+}
+
+// Writes the run of consecutive dirty blocks starting at first.
+static bool SDCache__Write_Run(SDCache *cache, SDCache_Entry *first)
+{
+    SDCache_Entry *run[SD_CACHE_RUN_MAX];
+    const void    *blocks[SD_CACHE_RUN_MAX];
+
+    uint32_t count = 0;
+    for (SDCache_Entry *entry = first; entry && (count < SD_CACHE_RUN_MAX);
+         entry = SDCache__Find_Dirty(cache, first->addr + count)) {
+        run[count]    = entry;
+        blocks[count] = SDCache__Data(cache, entry);
+        count++;
+    }
+
+    if (!SD_WriteBlocksV(cache->card, first->addr, count, blocks)) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        run[i]->dirty = false;
+    }
+    return true;
+}
+
+// Writes back a dirty entry along with its dirty neighbours, which are
+// likely to be evicted soon anyway.
+static bool SDCache__Write_Back(SDCache *cache, SDCache_Entry *entry)
+{
+    SDCache_Entry *first = entry;
+    for (unsigned i = 1; i < SD_CACHE_RUN_MAX; i++) {
+        if (first->addr == 0) {
+            break;
+        }
+        SDCache_Entry *prev = SDCache__Find_Dirty(cache, first->addr - 1);
+        if (!prev) {
+            break;
+        }
+        first = prev;
+    }
+
+    return SDCache__Write_Run(cache, first);
+}
+
+// Returns the entry holding addr, evicting the least recently used entry if
+// needed. The block is only read from the card when fill is set.
+static SDCache_Entry *SDCache__Get(SDCache *cache, uint32_t addr, bool fill)
+{
+    SDCache_Entry *entry = SDCache__Find(cache, addr);
+    if (entry) {
+        entry->lastUse = ++cache->clock;
+        return entry;
+    }
+
+    entry = &cache->entries[0];
+    for (uint32_t e = 0; (e < cache->count) && entry->valid; e++) {
+        SDCache_Entry *other = &cache->entries[e];
+        if (!other->valid || ((cache->clock - other->lastUse) > (cache->clock - entry->lastUse))) {
+            entry = other;
+        }
+    }
+
+    if (entry->valid && entry->dirty) {
+        if (!SDCache__Write_Back(cache, entry)) {
+            return NULL;
+        }
+    }
+
+    entry->valid = false;
+    if (fill && !SD_ReadBlock(cache->card, addr, SDCache__Data(cache, entry))) {
+        return NULL;
+    }
+
+    entry->addr    = addr;
+    entry->lastUse = ++cache->clock;
+    entry->valid   = true;
+    entry->dirty   = false;
+    return entry;
+}
+
+SDCache *SD_CacheOpen(SDCard *card, void *arena, uint32_t arenaSize)
+{
+    uint32_t blockLen = SD_GetBlockLen(card);
+    if (!card || !arena || (((uintptr_t)arena % 4) != 0)
+        || (blockLen == 0) || ((blockLen % 4) != 0)
+        || (arenaSize < SD_CACHE_ARENA_SIZE(1, blockLen))) {
+        return NULL;
+    }
+
+    uint32_t count = (arenaSize - SD_CACHE_HEADER_SIZE) / (SD_CACHE_ENTRY_SIZE + blockLen);
+
+    uint8_t *arena_byte = arena;
+    SDCache *cache = (SDCache *)arena_byte;
+    cache->card     = card;
+    cache->entries  = (SDCache_Entry *)&arena_byte[SD_CACHE_HEADER_SIZE];
+    cache->blocks   = &arena_byte[SD_CACHE_HEADER_SIZE + (count * SD_CACHE_ENTRY_SIZE)];
+    cache->blockLen = blockLen;
+    cache->count    = count;
+    cache->clock    = 0;
+
+    for (uint32_t e = 0; e < count; e++) {
+        cache->entries[e].valid = false;
+        cache->entries[e].dirty = false;
+    }
+
+    return cache;
+}
+
+bool SD_CacheClose(SDCache *cache)
+{
+    if (!cache) {
+        return false;
+    }
+
+    if (!SD_Flush(cache)) {
+        return false;
+    }
+
+    cache->card = NULL;
+    return true;
+}
+
+bool SD_CacheRead(SDCache *cache, uint32_t addr, uint32_t offset, uint32_t size, void *data)
+{
+    if (!cache || !cache->card || !data
+        || (offset > cache->blockLen) || (size > (cache->blockLen - offset))) {
+        return false;
+    }
+
+    SDCache_Entry *entry = SDCache__Get(cache, addr, true);
+    if (!entry) {
+        return false;
+    }
+
+    __builtin_memcpy(data, &SDCache__Data(cache, entry)[offset], size);
+    return true;
+}
+
+bool SD_CacheWrite(SDCache *cache, uint32_t addr, uint32_t offset, uint32_t size, const void *data)
+{
+    if (!cache || !cache->card || !data
+        || (offset > cache->blockLen) || (size > (cache->blockLen - offset))) {
+        return false;
+    }
+
+    bool whole = ((offset == 0) && (size == cache->blockLen));
+    SDCache_Entry *entry = SDCache__Get(cache, addr, !whole);
+    if (!entry) {
+        return false;
+    }
+
+    __builtin_memcpy(&SDCache__Data(cache, entry)[offset], data, size);
+    entry->dirty = true;
+    return true;
+}
+
+bool SD_Flush(SDCache *cache)
+{
+    if (!cache || !cache->card) {
+        return false;
+    }
+
+    // Lowest address first, so each run is written from its start.
+    for (;;) {
+        SDCache_Entry *first = NULL;
+        for (uint32_t e = 0; e < cache->count; e++) {
+            SDCache_Entry *entry = &cache->entries[e];
+            if (entry->valid && entry->dirty
+                && (!first || (entry->addr < first->addr))) {
+                first = entry;
+            }
+        }
+
+        if (!first) {
+            return true;
+        }
+
+        if (!SDCache__Write_Run(cache, first)) {
+            return false;
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef SD_CACHE_H_
+#define SD_CACHE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SD.h"
+
+// A write-back cache of blocks on an open SDCard, kept in an arena supplied
+// by the caller so it can be placed in TCM or SYSRAM (SYSRAM lets blocks be
+// transferred without staging). Writes only update the cache, and dirty
+// blocks go to the card when evicted or on SD_Flush, with adjacent dirty
+// blocks written by a single multi-block command. The least recently used
+// block is evicted first.
+//
+// The block length is fixed when the cache is opened, and anything else
+// which accesses the card directly must flush the cache first.
+
+typedef struct SDCache SDCache;
+
+// Arena bytes taken by the cache itself and by each entry, excluding the
+// block data.
+#define SD_CACHE_HEADER_SIZE 24
+#define SD_CACHE_ENTRY_SIZE  12
+
+// Arena size in bytes needed for a cache of entries blocks.
+#define SD_CACHE_ARENA_SIZE(entries, blockLen) \
+    (SD_CACHE_HEADER_SIZE + ((entries) * (SD_CACHE_ENTRY_SIZE + (blockLen))))
+
+// The arena must be 4 byte aligned and hold at least one entry, as many
+// entries as fit are used.
+SDCache *SD_CacheOpen(SDCard *card, void *arena, uint32_t arenaSize);
+// Flushes the cache, the arena may be reused once this returns true.
+bool     SD_CacheClose(SDCache *cache);
+
+// Copy size bytes at offset within block addr, size + offset must not
+// exceed the block length. Whole blocks written at offset 0 aren't read in
+// from the card first.
+bool     SD_CacheRead (SDCache *cache, uint32_t addr, uint32_t offset, uint32_t size, void *data);
+bool     SD_CacheWrite(SDCache *cache, uint32_t addr, uint32_t offset, uint32_t size, const void *data);
+
+// Write all dirty blocks to the card.
+bool     SD_Flush(SDCache *cache);
+
+#endif // #ifndef SD_CACHE_H_
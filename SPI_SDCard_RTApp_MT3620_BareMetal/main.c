@@ -13,10 +13,19 @@
 #include "lib/GPIO.h"
 #include "lib/GPT.h"
 #include "lib/UART.h"
-#include "lib/Print.h"
 #include "lib/SPIMaster.h"
 
 #include "SD.h"
+#ifdef SD_BENCHMARK
+#include "SDBenchmark.h"
+#endif
+#include "EventQueue.h"
+#include "Input.h"
+#include "Log.h"
+#include "Scheduler.h"
+#include "Profile.h"
+#include "Governor.h"
+#include "Placement.h"
 
 /* Set below to control # of blocks read and written */
 //#define NUM_BLOCKS_WRITE 8388608 // 4GB
@@ -25,8 +34,9 @@
 #define NUM_BUTTONS         2
 #define MAX_WRITE_BLOCK_LEN 1024
 #define NUM_BLOCKS_RW_DELTA 1000UL
+// Blocks moved per multi-block command
+#define BLOCKS_PER_TRANSFER 8
 
-static GPT       *buttonTimeout = NULL;
 static UART      *debug         = NULL;
 static SPIMaster *driver        = NULL;
 static SDCard    *card          = NULL;
@@ -35,232 +45,320 @@ static uint8_t  dataMultiplier = 1;
 static uint32_t numBlocksWrite = NUM_BLOCKS_WRITE;
 static uint32_t numBlocksRead  = NUM_BLOCKS_WRITE - NUM_BLOCKS_RW_DELTA;
 
-// Callbacks
-typedef struct CallbackNode {
-    bool enqueued;
-    struct CallbackNode *next;
-    void (*cb)(void);
-} CallbackNode;
-
-static void EnqueueCallback(CallbackNode *node);
-
 static void printSDBlock(uint8_t *buff, uintptr_t blocklen, unsigned blockID)
 {
-    UART_Printf(debug, "SD Card Data (block %u):\r\n", blockID);
-    uintptr_t i;
+    static const char hex[] = "0123456789ABCDEF";
+
+    Log_Printf("SD Card Data (block %u):\r\n", blockID);
+
+    // A row of 16 bytes is logged at a time, rather than a message per byte.
+    char row[(16 * 3) + 2];
+    uintptr_t i, n = 0;
     for (i = 0; i < blocklen; i++) {
-        UART_PrintHexWidth(debug, buff[i], 2);
-        UART_Print(debug, ((i % 16) == 15 ? "\r\n" : " "));
-    }
-    if ((blocklen % 16) != 0) {
-        UART_Print(debug, "\r\n");
+        row[n++] = hex[buff[i] >> 4];
+        row[n++] = hex[buff[i] & 0xF];
+        if (((i % 16) == 15) || (i == (blocklen - 1))) {
+            row[n++] = '\r';
+            row[n++] = '\n';
+            Log_Write(row, n);
+            n = 0;
+        } else {
+            row[n++] = ' ';
+        }
     }
-    UART_Print(debug, "\r\n");
+    Log_Print("\r\n");
 }
 
+// In SYSRAM so the SD driver can DMA straight to and from it.
+static SYSRAM_DATA uint8_t transferBuff[MAX_WRITE_BLOCK_LEN * BLOCKS_PER_TRANSFER];
+
 // Read Block
 static void buttonA(void)
 {
-    UART_Print(debug, "Reading card:\r\n");
+    if (SD_Busy(card)) {
+        Log_Print("Write in progress, try again once it completes\r\n");
+        return;
+    }
+
+    Log_Print("Reading card:\r\n");
     uintptr_t blocklen = SD_GetBlockLen(card);
-    uint8_t buff[blocklen];
 
     bool success = true;
 
     for (uint32_t blockID = 0; blockID < numBlocksRead; blockID++) {
-        if (!SD_ReadBlock(card, blockID, buff)) {
-            UART_Printf(debug,
-                "ERROR: Failed to read block %lu of SD card\r\n", blockID);
-            success = false;
-        }
-        else {
-            uintptr_t i;
-            if ((blockID % 128) == 0) {
-                UART_Printf(debug, "Block %lu:\r\n", blockID);
-                printSDBlock(buff, blocklen, blockID);
-            }
-            for (i = 0; i < blocklen; i++) {
-                if (buff[i] != (uint8_t)((i * (dataMultiplier - 1) * blockID) % 255)) {
-                    success = false;
-                    break;
-                }
+        uint32_t index = (blockID % BLOCKS_PER_TRANSFER);
+        uint8_t *buff  = &transferBuff[index * blocklen];
+
+        if (index == 0) {
+            uint32_t count = numBlocksRead - blockID;
+            if (count > BLOCKS_PER_TRANSFER) {
+                count = BLOCKS_PER_TRANSFER;
             }
-            if (success) {
-                UART_Printf(
-                   debug, "Block %lu is as expected\r\n", blockID);
+            if (!SD_ReadBlocks(card, blockID, count, transferBuff)) {
+                Log_Printf("ERROR: Failed to read blocks %lu-%lu of SD card\r\n",
+                    blockID, (blockID + count - 1));
+                success = false;
+                break;
             }
-            else {
-                UART_Printf(
-                    debug, "ERROR: unexpected data (%u != %lu) in block %lu\r\n",
-                    buff[i], ((i * (dataMultiplier - 1) * blockID) % 255), blockID);
+        }
+
+        uintptr_t i;
+        if ((blockID % 128) == 0) {
+            Log_Printf("Block %lu:\r\n", blockID);
+            printSDBlock(buff, blocklen, blockID);
+        }
+        for (i = 0; i < blocklen; i++) {
+            if (buff[i] != (uint8_t)((i * (dataMultiplier - 1) * blockID) % 255)) {
+                success = false;
+                break;
             }
         }
+        if (success) {
+            Log_Printf("Block %lu is as expected\r\n", blockID);
+        }
+        else {
+            Log_Printf("ERROR: unexpected data (%u != %lu) in block %lu\r\n",
+                buff[i], ((i * (dataMultiplier - 1) * blockID) % 255), blockID);
+        }
         if (!success) {
             break;
         }
+
+        // Keeps the log moving through a long read, so fewer lines are dropped.
+        Log_Drain();
     }
 
     if (success) {
-        UART_Printf(
-            debug, "%lu blocks read and are consistent\r\n",
-            numBlocksRead);
+        Log_Printf("%lu blocks read and are consistent\r\n", numBlocksRead);
     }
 }
 
 // Write Block
-static void buttonB(void)
+// Writes are submitted asynchronously, each chunk being queued from the
+// completion of the one before, so the main loop stays free meanwhile.
+static SD_Request writeRequest = {0};
+static bool       writeActive  = false;
+
+// Each chunk's result is passed back to the main loop, only one being in
+// flight at a time.
+EVENT_QUEUE_DEFINE(writeEvents, bool, 2);
+
+static void writeDone(SD_Request *request, bool success)
 {
-    UART_Print(debug, "Writing to card:\r\n");
+    (void)request;
+    EventQueue_Post(&writeEvents, &success);
+}
 
-    static uint8_t buff[MAX_WRITE_BLOCK_LEN] = {0};
+static bool writeSubmit(uint32_t blockID)
+{
     uintptr_t blocklen = SD_GetBlockLen(card);
 
-    bool success = true;
+    uint32_t count = numBlocksWrite - blockID;
+    if (count > BLOCKS_PER_TRANSFER) {
+        count = BLOCKS_PER_TRANSFER;
+    }
 
     // update buffers
-    for (uint32_t blockID = 0; blockID < numBlocksWrite; blockID++) {
+    for (uint32_t b = 0; b < count; b++) {
+        uint8_t *buff = &transferBuff[b * blocklen];
         for (uintptr_t i = 0; i < blocklen; i++) {
-            buff[i] = (uint8_t)((i * dataMultiplier * blockID) % 255);
-        }
-        if (!SD_WriteBlock(card, blockID, buff)) {
-            UART_Printf(debug,
-                "ERROR: Failed to write block %lu of SD card\r\n",
-                blockID);
-            success = false;
-            break;
-        }
-        else if ((blockID % 256) == 0) {
-            UART_Printf(
-                debug, "Wrote block %lu successfully (multiplier = %u)\r\n",
-                blockID, dataMultiplier);
+            buff[i] = (uint8_t)((i * dataMultiplier * (blockID + b)) % 255);
         }
     }
 
+    writeRequest.addr     = blockID;
+    writeRequest.count    = count;
+    writeRequest.data     = transferBuff;
+    writeRequest.callback = writeDone;
+    return SD_SubmitWrite(card, &writeRequest);
+}
+
+static void writeFinish(bool success)
+{
     if (success) {
-        UART_Printf(
-            debug, "%lu blocks written successfully\r\n", numBlocksWrite);
+        Log_Printf("%lu blocks written successfully\r\n", numBlocksWrite);
     }
 
     numBlocksWrite += NUM_BLOCKS_RW_DELTA;
     numBlocksRead  += NUM_BLOCKS_RW_DELTA;
     dataMultiplier++;
+    writeActive = false;
+}
+
+static void writeDoneCallback(void *payload)
+{
+    bool *success = payload;
+    uint32_t blockID = writeRequest.addr;
+    if (!*success) {
+        Log_Printf("ERROR: Failed to write blocks %lu-%lu of SD card\r\n",
+            blockID, (blockID + writeRequest.count - 1));
+        writeFinish(false);
+        return;
+    }
+
+    if ((blockID % 256) == 0) {
+        Log_Printf("Wrote block %lu successfully (multiplier = %u)\r\n",
+            blockID, dataMultiplier);
+    }
+
+    blockID += writeRequest.count;
+    if (blockID >= numBlocksWrite) {
+        writeFinish(true);
+        return;
+    }
+
+    Governor_Begin();
+    bool submitted = writeSubmit(blockID);
+    Governor_End();
+    if (!submitted) {
+        Log_Print("ERROR: Failed to submit SD card write\r\n");
+        writeFinish(false);
+    }
+}
+
+static void buttonB(void)
+{
+    if (writeActive) {
+        Log_Print("Write already in progress\r\n");
+        return;
+    }
+
+    Log_Print("Writing to card:\r\n");
+
+    writeActive = true;
+    if (!writeSubmit(0)) {
+        Log_Print("ERROR: Failed to submit SD card write\r\n");
+        writeFinish(false);
+    }
 }
 
 typedef struct ButtonState {
-    bool         prevState;
-    CallbackNode cbn;
+    void       (*cb)(void);
     uint32_t     gpioPin;
 } ButtonState;
 
 static ButtonState buttons[NUM_BUTTONS] = {
-    {.prevState = true,
-     .cbn = {.enqueued = false, .cb = buttonA},
+    {.cb        = buttonA,
      .gpioPin   = 12},
-    {.prevState = true,
-     .cbn = {.enqueued = false, .cb = buttonB},
+    {.cb        = buttonB,
      .gpioPin   = 13}
 };
 
-static void handleButtonCallback(GPT *handle)
+// Presses are handled in the order they happened.
+EVENT_QUEUE_DEFINE(buttonEvents, Input_Event, 4);
+
+static void handleButtonDeferred(void *payload)
 {
-    (void)(handle);
-    // Assume initial state is high, i.e. button not pressed.
-    bool newState, pressed;
+    const Input_Event *event = payload;
+    if (!event->pressed) {
+        return;
+    }
 
+    // Checking what was read and filling the next blocks to write are the
+    // work worth running the core at full speed for.
+    Governor_Begin();
     for (unsigned i = 0; i < NUM_BUTTONS; i++) {
-        GPIO_Read(buttons[i].gpioPin, &newState);
-        if (newState != buttons[i].prevState) {
-            pressed = !newState;
-            if (pressed) {
-                EnqueueCallback(&buttons[i].cbn);
-            }
+        if (buttons[i].gpioPin == event->pin) {
+            buttons[i].cb();
         }
-        buttons[i].prevState = newState;
     }
+    Governor_End();
+#ifdef PROFILE_ENABLE
+    // The profiler prints straight to the UART.
+    Log_Flush();
+#endif
+    PROFILE_PRINT(debug, false);
 }
 
-static CallbackNode *volatile callbacks = NULL;
-
-static void EnqueueCallback(CallbackNode *node)
+static void idle(void)
 {
-    uint32_t prevBasePri = NVIC_BlockIRQs();
-    if (!node->enqueued) {
-        CallbackNode *prevHead = callbacks;
-        node->enqueued = true;
-        callbacks = node;
-        node->next = prevHead;
-    }
-    NVIC_RestoreIRQs(prevBasePri);
+    Log_Drain();
+    Governor_Idle();
 }
 
-static void InvokeCallbacks(void)
-{
-    CallbackNode *node;
-    do {
-        uint32_t prevBasePri = NVIC_BlockIRQs();
-        node = callbacks;
-        if (node) {
-            node->enqueued = false;
-            callbacks = node->next;
-        }
-        NVIC_RestoreIRQs(prevBasePri);
-
-        if (node) {
-            (*node->cb)();
-        }
-    } while (node);
-}
+// The scheduler's deadlines are converted again each time the clock changes.
+static Governor_Listener schedulerListener = {
+    .handler = Scheduler_ClockChanged,
+};
 
 _Noreturn void RTCoreMain(void)
 {
     VectorTableInit();
-    CPUFreq_Set(197600000);
+    // The core idles at 26 MHz, and is raised to 197.6 MHz for reads and writes.
+    bool governed = Governor_Init(26000000, 197600000);
+    if (!governed) {
+        CPUFreq_Set(197600000);
+    }
+    Governor_AddListener(&schedulerListener);
+    PROFILE_INIT(NULL);
 
     debug = UART_Open(MT3620_UNIT_UART_DEBUG, 115200, UART_PARITY_NONE, 1, NULL);
-    UART_Print(debug, "--------------------------------\r\n");
-    UART_Print(debug, "SPI_SDCard_RTApp_MT3620_BareMetal\r\n");
-    UART_Print(debug, "App built on: " __DATE__ " " __TIME__ "\r\n");
+    Log_Init(debug);
+    Log_Print("--------------------------------\r\n");
+    Log_Print("SPI_SDCard_RTApp_MT3620_BareMetal\r\n");
+    Log_Print("App built on: " __DATE__ " " __TIME__ "\r\n");
+    if (!governed) {
+        Log_Print("ERROR: Failed to set up the clock governor\r\n");
+    }
+
+    // Write chunks are chained before button presses are handled.
+    EventQueue_Init(&writeEvents, 0, writeDoneCallback);
+    EventQueue_Init(&buttonEvents, 1, handleButtonDeferred);
+
+    // The driver's timeouts run on the scheduler's timers.
+    if (!Scheduler_Init(MT3620_UNIT_GPT3, MT3620_GPT_3_LOW_SPEED)) {
+        Log_Print("ERROR: Scheduler initialisation failed\r\n");
+    }
 
     driver = SPIMaster_Open(MT3620_UNIT_ISU1);
     if (!driver) {
-        UART_Print(debug,
-            "ERROR: SPI initialisation failed\r\n");
+        Log_Print("ERROR: SPI initialisation failed\r\n");
     }
-    SPIMaster_DMAEnable(driver, false);
+    // Move whole SD data packets per transfer rather than a FIFO at a time.
+    SPIMaster_DMAEnable(driver, true);
 
     // Use CSB for chip select.
     SPIMaster_Select(driver, 1);
 
     card = SD_Open(driver);
     if (!card) {
-        UART_Print(debug,
-            "ERROR: Failed to open SD card.\r\n");
+        Log_Print("ERROR: Failed to open SD card.\r\n");
+    } else {
+        Log_Printf("SD card bus speed: %lu Hz\r\n", SD_GetSpeed(card));
     }
 
-	UART_Print(debug,
-        "Press button A to read block, and B to write block.\r\n"
-        "Note that with every press of B, the multiplier on each\r\n"
-        "byte is incremented.\r\n\r\n");
-
-    GPIO_ConfigurePinForInput(buttons[0].gpioPin);
-    GPIO_ConfigurePinForInput(buttons[1].gpioPin);
-
-    // Setup GPT0 to poll for button press
-    if (!(buttonTimeout = GPT_Open(
-        MT3620_UNIT_GPT0, MT3620_GPT_012_LOW_SPEED, GPT_MODE_REPEAT))) {
-        UART_Print(debug, "ERROR: Opening timer\r\n");
+#ifdef SD_BENCHMARK
+    // The benchmark prints straight to the UART.
+    Log_Flush();
+
+    // The benchmark is timed at full speed throughout, so its results don't
+    // depend on when the clock is raised.
+    Governor_Begin();
+
+    // Free running clock for timing each operation, GPT3 runs the scheduler.
+    GPT *benchClock = GPT_Open(MT3620_UNIT_GPT4, MT3620_GPT_4_LOW_SPEED, GPT_MODE_NONE);
+    if (!benchClock || (GPT_Start_Freerun(benchClock) != ERROR_NONE)) {
+        Log_Print("ERROR: Benchmark clock initialisation failed\r\n");
+    } else if (card && !SDBenchmark_Run(
+        card, benchClock, debug, transferBuff, sizeof(transferBuff))) {
+        Log_Print("ERROR: SD card benchmark failed\r\n");
     }
-    int32_t error;
+    GPT_Close(benchClock);
+    Governor_End();
+#endif
 
-    if ((error = GPT_StartTimeout(
-        buttonTimeout, 100, GPT_UNITS_MILLISEC, handleButtonCallback)) != ERROR_NONE) {
-        UART_Printf(debug, "ERROR: Starting timer (%ld)\r\n", error);
-    }
+    Log_Print("Press button A to read block, and B to write block.\r\n"
+        "Note that with every press of B, the multiplier on each\r\n"
+        "byte is incremented.\r\n\r\n");
 
-    for (;;) {
-        __asm__("wfi");
-        InvokeCallbacks();
+    for (unsigned i = 0; i < NUM_BUTTONS; i++) {
+        if (!Input_Open(buttons[i].gpioPin, INPUT_EDGE_PRESS, &buttonEvents)) {
+            Log_Printf("ERROR: Configuring button %u interrupt\r\n", i);
+        }
     }
 
-    SD_Close(card);
+    // The log is written out and the clock dropped whenever the queues are
+    // empty, just before the scheduler sleeps.
+    Scheduler_SetIdle(idle);
+    Scheduler_Run();
 }
@@ -4,7 +4,10 @@
 #include "SSD1331.h"
 #include "lib/GPIO.h"
 #include "lib/GPT.h"
+#include "lib/NVIC.h"
 #include "lib/Platform.h"
+#include "Profile.h"
+#include "Placement.h"
 
 
 
@@ -19,6 +22,40 @@ static SSD1331 SSD1331_Handle[SSD1331_HANDLE_COUNT] = {0};
 
 static GPT *timer = NULL;
 
+PROFILE_MARKER(SSD1331_Upload);
+
+// Transfers queued at once by an asynchronous upload, each covering a row, or
+// as many rows of a contiguous window as fit in SSD1331_ASYNC_CHUNK bytes.
+#define SSD1331_ASYNC_TRANSFERS 16
+#define SSD1331_ASYNC_CHUNK     1024
+
+// The SPI DMA can only reach SYSRAM.
+#define SSD1331_SYSRAM_BASE 0x22000000
+#define SSD1331_SYSRAM_SIZE (64 * 1024)
+
+// Only one asynchronous upload runs at a time.
+static struct {
+    SSD1331              *handle;
+    const SSD1331_Window *windows;
+    unsigned              count;
+    unsigned              window;
+    unsigned              row;
+    bool                  addressed;
+    SPITransfer           transfer[SSD1331_ASYNC_TRANSFERS];
+    void                (*callback)(SSD1331 *handle, bool success);
+} SSD1331_Async = {0};
+
+static SYSRAM_DATA uint8_t SSD1331_AsyncCommand[6];
+
+// Commands can't be sent while an asynchronous upload holds the bus.
+static int32_t SSD1331__Write(SSD1331 *handle, const void *data, uintptr_t size)
+{
+    if (SSD1331_Async.handle) {
+        return ERROR_BUSY;
+    }
+    return SPIMaster_WriteSync(handle->interface, data, size);
+}
+
 typedef enum {
     SSD1331_CMD_SET_COLUMN_ADDRESS                                 = 0x15,
     SSD1331_CMD_DRAW_LINE                                          = 0x21,
@@ -69,7 +106,7 @@ static bool SSD1331_SendCommandArg(SSD1331 *handle, uint8_t addr, uint8_t value)
     }
 
     const uint8_t cmd[] = { addr, value };
-    return (SPIMaster_WriteSync(handle->interface, cmd, sizeof(cmd)) == ERROR_NONE);
+    return (SSD1331__Write(handle, cmd, sizeof(cmd)) == ERROR_NONE);
 }
 
 static bool SSD1331_SendCommand(SSD1331 *handle, const uint8_t addr)
@@ -79,7 +116,7 @@ static bool SSD1331_SendCommand(SSD1331 *handle, const uint8_t addr)
     }
 
     const uint8_t cmd[] = { addr };
-    return (SPIMaster_WriteSync(handle->interface, cmd, sizeof(cmd)) == ERROR_NONE);
+    return (SSD1331__Write(handle, cmd, sizeof(cmd)) == ERROR_NONE);
 }
 
 
@@ -95,7 +132,7 @@ bool SSD1331_SetColAddress(SSD1331 *handle, uint8_t start, uint8_t end)
     }
 
     const uint8_t cmd[] = { SSD1331_CMD_SET_COLUMN_ADDRESS , start, end };
-    return (SPIMaster_WriteSync(handle->interface, cmd, sizeof(cmd)) == ERROR_NONE);
+    return (SSD1331__Write(handle, cmd, sizeof(cmd)) == ERROR_NONE);
 }
 
 bool SSD1331_SetRowAddress(SSD1331 *handle, uint8_t start, uint8_t end)
@@ -109,7 +146,7 @@ bool SSD1331_SetRowAddress(SSD1331 *handle, uint8_t start, uint8_t end)
   }
 
   const uint8_t cmd[] = {SSD1331_CMD_SET_ROW_ADDRESS, start, end};
-  return (SPIMaster_WriteSync(handle->interface, cmd, sizeof(cmd)) == ERROR_NONE);
+  return (SSD1331__Write(handle, cmd, sizeof(cmd)) == ERROR_NONE);
 }
 
 bool SSD1331_SetCommandLock(SSD1331 *handle, bool lock)
@@ -237,10 +274,21 @@ bool SSD1331_ClearWindow(SSD1331 *handle)
     }
 
     const uint8_t cmd[] = { SSD1331_CMD_CLEAR_WINDOW, 0, 0, (SSD1331_WIDTH - 1), (SSD1331_HEIGHT - 1) };
-    return (SPIMaster_WriteSync(handle->interface, cmd, sizeof(cmd)) == ERROR_NONE);
+    return (SSD1331__Write(handle, cmd, sizeof(cmd)) == ERROR_NONE);
 }
 
 
+// The controller ignores further commands while a drawing command runs, the
+// times allowed for each are conservative as the datasheet gives none.
+#define SSD1331_DRAW_LINE_US      1000
+#define SSD1331_DRAW_RECTANGLE_US 3000
+#define SSD1331_COPY_US           3000
+
+static bool SSD1331__Wait_Drawing(uint32_t us)
+{
+    return (GPT_WaitTimer_Blocking(timer, us, GPT_UNITS_MICROSEC) == ERROR_NONE);
+}
+
 bool SSD1331_DrawLine(SSD1331 *handle, uint8_t columnStart, uint8_t rowStart, uint8_t columnEnd, uint8_t rowEnd, uint8_t colorC, uint8_t colorB, uint8_t colorA)
 {
     if (!handle) {
@@ -248,12 +296,54 @@ bool SSD1331_DrawLine(SSD1331 *handle, uint8_t columnStart, uint8_t rowStart, ui
     }
 
     uint8_t data[] = { SSD1331_CMD_DRAW_LINE, columnStart, rowStart, columnEnd , rowEnd, colorC, colorB, colorA };
-    return (SPIMaster_WriteSync(handle->interface, data, sizeof(data)) == ERROR_NONE);
+    if (SSD1331__Write(handle, data, sizeof(data)) != ERROR_NONE) {
+        return false;
+    }
+    return SSD1331__Wait_Drawing(SSD1331_DRAW_LINE_US);
+}
+
+bool SSD1331_SetFill(SSD1331 *handle, bool fill, bool reverseCopy)
+{
+    const uint8_t value = (fill ? 0x01 : 0x00) | (reverseCopy ? 0x10 : 0x00);
+    return SSD1331_SendCommandArg(handle, SSD1331_CMD_FILL_ENABLE_DISABLE, value);
 }
 
+bool SSD1331_DrawRectangle(SSD1331 *handle, uint8_t columnStart, uint8_t rowStart, uint8_t columnEnd, uint8_t rowEnd,
+                           uint8_t lineC, uint8_t lineB, uint8_t lineA, uint8_t fillC, uint8_t fillB, uint8_t fillA)
+{
+    if (!handle) {
+        return false;
+    }
 
-bool SSD1331_Upload(SSD1331 *handle, const void *data, uintptr_t size)
+    uint8_t data[] = { SSD1331_CMD_DRAW_RECTANGLE, columnStart, rowStart, columnEnd, rowEnd,
+                       lineC, lineB, lineA, fillC, fillB, fillA };
+    if (SSD1331__Write(handle, data, sizeof(data)) != ERROR_NONE) {
+        return false;
+    }
+    return SSD1331__Wait_Drawing(SSD1331_DRAW_RECTANGLE_US);
+}
+
+bool SSD1331_Copy(SSD1331 *handle, uint8_t columnStart, uint8_t rowStart, uint8_t columnEnd, uint8_t rowEnd,
+                  uint8_t columnNew, uint8_t rowNew)
 {
+    if (!handle) {
+        return false;
+    }
+
+    uint8_t data[] = { SSD1331_CMD_COPY, columnStart, rowStart, columnEnd, rowEnd, columnNew, rowNew };
+    if (SSD1331__Write(handle, data, sizeof(data)) != ERROR_NONE) {
+        return false;
+    }
+    return SSD1331__Wait_Drawing(SSD1331_COPY_US);
+}
+
+
+bool SSD1331_WriteData(SSD1331 *handle, const void *data, uintptr_t size)
+{
+    if (!handle || SSD1331_Async.handle) {
+        return false;
+    }
+
     GPIO_Write(handle->pinDataCmd, true);
 
     static const unsigned spiMaxPacket = 20;
@@ -274,6 +364,14 @@ bool SSD1331_Upload(SSD1331 *handle, const void *data, uintptr_t size)
     }
 
     GPIO_Write(handle->pinDataCmd, false);
+    return success;
+}
+
+bool SSD1331_Upload(SSD1331 *handle, const void *data, uintptr_t size)
+{
+    PROFILE_SCOPE(SSD1331_Upload);
+    bool success = SSD1331_WriteData(handle, data, size);
+
     // wait at least 10 msec
     if (GPT_WaitTimer_Blocking(timer, 1000, GPT_UNITS_MICROSEC) != ERROR_NONE) {
         return NULL;
@@ -282,6 +380,164 @@ bool SSD1331_Upload(SSD1331 *handle, const void *data, uintptr_t size)
 }
 
 
+static bool SSD1331__InSysRAM(const void *data, uintptr_t length)
+{
+    uintptr_t addr = (uintptr_t)data;
+    return ((addr >= SSD1331_SYSRAM_BASE)
+        && ((addr + length) <= (SSD1331_SYSRAM_BASE + SSD1331_SYSRAM_SIZE)));
+}
+
+static void SSD1331__Async_Finish(bool success)
+{
+    SSD1331 *handle = SSD1331_Async.handle;
+    void (*callback)(SSD1331 *, bool) = SSD1331_Async.callback;
+
+    GPIO_Write(handle->pinDataCmd, false);
+    SSD1331_Async.handle = NULL;
+
+    if (callback) {
+        callback(handle, success);
+    }
+}
+
+static void SSD1331__Async_Done(int32_t status, uintptr_t dataCount);
+
+// Queues the next transfers of the upload, returning false once all are sent.
+static bool SSD1331__Async_Queue(int32_t *status)
+{
+    SSD1331 *handle = SSD1331_Async.handle;
+
+    while (SSD1331_Async.window < SSD1331_Async.count) {
+        const SSD1331_Window *w = &SSD1331_Async.windows[SSD1331_Async.window];
+
+        // Each window starts by setting the address range to fill.
+        if (!SSD1331_Async.addressed) {
+            SSD1331_AsyncCommand[0] = SSD1331_CMD_SET_COLUMN_ADDRESS;
+            SSD1331_AsyncCommand[1] = w->columnStart;
+            SSD1331_AsyncCommand[2] = w->columnEnd;
+            SSD1331_AsyncCommand[3] = SSD1331_CMD_SET_ROW_ADDRESS;
+            SSD1331_AsyncCommand[4] = w->rowStart;
+            SSD1331_AsyncCommand[5] = w->rowEnd;
+
+            SSD1331_Async.transfer[0] = (SPITransfer){
+                .writeData = SSD1331_AsyncCommand,
+                .readData  = NULL,
+                .length    = sizeof(SSD1331_AsyncCommand),
+            };
+            SSD1331_Async.addressed = true;
+            SSD1331_Async.row       = w->rowStart;
+
+            GPIO_Write(handle->pinDataCmd, false);
+            *status = SPIMaster_TransferSequentialAsync(
+                handle->interface, SSD1331_Async.transfer, 1, SSD1331__Async_Done);
+            return true;
+        }
+
+        if (SSD1331_Async.row <= w->rowEnd) {
+            uintptr_t rowBytes = (w->columnEnd - w->columnStart + 1) * 2;
+            unsigned  rowsPer  = 1;
+            if (w->stride == rowBytes) {
+                rowsPer = (SSD1331_ASYNC_CHUNK / rowBytes);
+            }
+
+            unsigned count = 0;
+            while ((count < SSD1331_ASYNC_TRANSFERS) && (SSD1331_Async.row <= w->rowEnd)) {
+                unsigned rows = (w->rowEnd - SSD1331_Async.row + 1);
+                if (rows > rowsPer) {
+                    rows = rowsPer;
+                }
+
+                const uint8_t *data = w->data;
+                SSD1331_Async.transfer[count++] = (SPITransfer){
+                    .writeData = &data[(SSD1331_Async.row - w->rowStart) * w->stride],
+                    .readData  = NULL,
+                    .length    = (rows * rowBytes),
+                };
+                SSD1331_Async.row += rows;
+            }
+
+            GPIO_Write(handle->pinDataCmd, true);
+            *status = SPIMaster_TransferSequentialAsync(
+                handle->interface, SSD1331_Async.transfer, count, SSD1331__Async_Done);
+            return true;
+        }
+
+        SSD1331_Async.window++;
+        SSD1331_Async.addressed = false;
+    }
+
+    return false;
+}
+
+static void SSD1331__Async_Done(int32_t status, uintptr_t dataCount)
+{
+    (void)dataCount;
+
+    if (status != ERROR_NONE) {
+        SSD1331__Async_Finish(false);
+        return;
+    }
+
+    if (!SSD1331__Async_Queue(&status)) {
+        SSD1331__Async_Finish(true);
+    } else if (status != ERROR_NONE) {
+        SSD1331__Async_Finish(false);
+    }
+}
+
+bool SSD1331_UploadAsync(SSD1331 *handle, const SSD1331_Window *windows, unsigned count,
+                         void (*callback)(SSD1331 *handle, bool success))
+{
+    if (!handle || !handle->interface || !windows || (count == 0)) {
+        return false;
+    }
+
+    for (unsigned i = 0; i < count; i++) {
+        const SSD1331_Window *w = &windows[i];
+        if ((w->columnEnd < w->columnStart) || (w->columnEnd > (SSD1331_WIDTH  - 1))
+            || (w->rowEnd < w->rowStart) || (w->rowEnd > (SSD1331_HEIGHT - 1))) {
+            return false;
+        }
+
+        uintptr_t rowBytes = (w->columnEnd - w->columnStart + 1) * 2;
+        uintptr_t size     = ((w->rowEnd - w->rowStart) * w->stride) + rowBytes;
+        if (!w->data || (w->stride < rowBytes) || !SSD1331__InSysRAM(w->data, size)) {
+            return false;
+        }
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    bool busy = (SSD1331_Async.handle != NULL);
+    if (!busy) {
+        SSD1331_Async.handle = handle;
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+    if (busy) {
+        return false;
+    }
+
+    SSD1331_Async.windows   = windows;
+    SSD1331_Async.count     = count;
+    SSD1331_Async.window    = 0;
+    SSD1331_Async.addressed = false;
+    SSD1331_Async.callback  = callback;
+
+    int32_t status = ERROR_NONE;
+    SSD1331__Async_Queue(&status);
+    if (status != ERROR_NONE) {
+        GPIO_Write(handle->pinDataCmd, false);
+        SSD1331_Async.handle = NULL;
+        return false;
+    }
+    return true;
+}
+
+bool SSD1331_Busy(const SSD1331 *handle)
+{
+    return (handle && (SSD1331_Async.handle == handle));
+}
+
+
 SSD1331 *SSD1331_Open(SPIMaster *interface, int pinDataCmd, int pinReset, int pinVccEn, int pinPModEn)
 {
     if (!interface) {
@@ -451,6 +707,18 @@ void SSD1331_Close(SSD1331 *handle)
         return;
     }
 
+    // An upload still running is cancelled and its callback told it failed,
+    // so whoever started it isn't left waiting for it.
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    bool busy = SSD1331_Busy(handle);
+    if (busy) {
+        SPIMaster_TransferCancel(handle->interface);
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+    if (busy) {
+        SSD1331__Async_Finish(false);
+    }
+
     SSD1331_SetDisplayOff(handle);
     SSD1331_SetCommandLock(handle, true);
     GPIO_Write(handle->pinVccEn , false);
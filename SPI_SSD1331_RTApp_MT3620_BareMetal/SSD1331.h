@@ -58,10 +58,35 @@ bool SSD1331_DeactivateScrolling(SSD1331 *handle);
 bool SSD1331_ClearWindow(SSD1331 *handle);
 
 bool SSD1331_Upload(SSD1331 *handle, const void *data, uintptr_t size);
+// As SSD1331_Upload without the delay after, for streaming a window a row at a time.
+bool SSD1331_WriteData(SSD1331 *handle, const void *data, uintptr_t size);
 
+// Drawing commands wait for the controller to finish before returning.
 bool SSD1331_DrawLine(SSD1331 *handle, uint8_t columnStart, uint8_t rowStart, uint8_t columnEnd, uint8_t rowEnd, uint8_t colorC, uint8_t colorB, uint8_t colorA);
+bool SSD1331_SetFill(SSD1331 *handle, bool fill, bool reverseCopy);
+bool SSD1331_DrawRectangle(SSD1331 *handle, uint8_t columnStart, uint8_t rowStart, uint8_t columnEnd, uint8_t rowEnd,
+                           uint8_t lineC, uint8_t lineB, uint8_t lineA, uint8_t fillC, uint8_t fillB, uint8_t fillA);
+bool SSD1331_Copy(SSD1331 *handle, uint8_t columnStart, uint8_t rowStart, uint8_t columnEnd, uint8_t rowEnd,
+                  uint8_t columnNew, uint8_t rowNew);
+
+// A window of the display's memory and the rows of pixel data to fill it,
+// stride bytes apart.
+typedef struct {
+    uint8_t     columnStart, rowStart, columnEnd, rowEnd;
+    const void *data;
+    uintptr_t   stride;
+} SSD1331_Window;
+
+// Uploads each window in turn by DMA, returning straight away. The data must
+// be in SYSRAM, and it and windows must be left alone until callback is
+// called, in interrupt context. Other calls on the display fail until then,
+// and only one upload may run at a time.
+bool SSD1331_UploadAsync(SSD1331 *handle, const SSD1331_Window *windows, unsigned count,
+                         void (*callback)(SSD1331 *handle, bool success));
+bool SSD1331_Busy(const SSD1331 *handle);
 
 SSD1331 *SSD1331_Open(SPIMaster *interface, int pinDataCmd, int pinReset, int pinVccEn, int pinPModEn);
+// Cancels any upload in progress, calling its callback with success false.
 void     SSD1331_Close(SSD1331 *handle);
 
 #endif // #ifndef SSD1331_H_
@@ -0,0 +1,573 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "SSD1331Frame.h"
+
+// Changed areas tracked before they have to be merged.
+#define SSD1331_FRAME_DIRTY_MAX 4
+
+// Pixel data a drawing command must replace for it to be worth using, as the
+// controller takes milliseconds to draw while uploads take a few microseconds
+// per byte.
+#define SSD1331_FRAME_HW_MIN_BYTES 2048
+
+// Inclusive bounds, as taken by the controller's commands.
+typedef struct {
+    uint8_t x0, y0, x1, y1;
+} SSD1331Frame_Rect;
+
+struct SSD1331_Frame {
+    SSD1331           *display;
+    uint16_t          *pixels;
+    // Matches the panel outside the dirty areas, when double buffered.
+    uint16_t          *back;
+    unsigned           dirtyCount;
+    SSD1331Frame_Rect  dirty[SSD1331_FRAME_DIRTY_MAX];
+
+    // The last asynchronous upload, sent again if it fails.
+    volatile bool         busy;
+    bool                  failed;
+    unsigned              windowCount;
+    SSD1331_Window        windows[SSD1331_FRAME_DIRTY_MAX];
+    SSD1331_FrameCallback callback;
+};
+
+#define SSD1331_FRAME_COUNT 2
+static SSD1331_Frame SSD1331_Frames[SSD1331_FRAME_COUNT] = {0};
+
+static const SSD1331Frame_Rect SSD1331Frame_Full = {
+    0, 0, (SSD1331_WIDTH - 1), (SSD1331_HEIGHT - 1) };
+
+
+static uint32_t SSD1331Frame__Area(const SSD1331Frame_Rect *rect)
+{
+    return ((rect->x1 - rect->x0 + 1) * (rect->y1 - rect->y0 + 1));
+}
+
+static SSD1331Frame_Rect SSD1331Frame__Union(const SSD1331Frame_Rect *a, const SSD1331Frame_Rect *b)
+{
+    SSD1331Frame_Rect u = {
+        (a->x0 < b->x0 ? a->x0 : b->x0), (a->y0 < b->y0 ? a->y0 : b->y0),
+        (a->x1 > b->x1 ? a->x1 : b->x1), (a->y1 > b->y1 ? a->y1 : b->y1) };
+    return u;
+}
+
+static bool SSD1331Frame__Intersects(const SSD1331Frame_Rect *a, const SSD1331Frame_Rect *b)
+{
+    return ((a->x0 <= b->x1) && (b->x0 <= a->x1)
+        && (a->y0 <= b->y1) && (b->y0 <= a->y1));
+}
+
+// Clips a rectangle to the panel, returning false if nothing is left.
+static bool SSD1331Frame__Clip(int x, int y, int w, int h, SSD1331Frame_Rect *rect)
+{
+    if ((w <= 0) || (h <= 0)) {
+        return false;
+    }
+
+    int x1 = x + w - 1;
+    int y1 = y + h - 1;
+    if (x  < 0) x  = 0;
+    if (y  < 0) y  = 0;
+    if (x1 > (SSD1331_WIDTH  - 1)) x1 = (SSD1331_WIDTH  - 1);
+    if (y1 > (SSD1331_HEIGHT - 1)) y1 = (SSD1331_HEIGHT - 1);
+    if ((x > x1) || (y > y1)) {
+        return false;
+    }
+
+    rect->x0 = x;
+    rect->y0 = y;
+    rect->x1 = x1;
+    rect->y1 = y1;
+    return true;
+}
+
+static void SSD1331Frame__Dirty(SSD1331_Frame *frame, SSD1331Frame_Rect rect)
+{
+    // Absorb areas which don't waste more than they overlap when merged.
+    for (unsigned i = 0; i < frame->dirtyCount; ) {
+        SSD1331Frame_Rect u = SSD1331Frame__Union(&frame->dirty[i], &rect);
+        if (SSD1331Frame__Area(&u) <= (SSD1331Frame__Area(&frame->dirty[i]) + SSD1331Frame__Area(&rect))) {
+            rect = u;
+            frame->dirty[i] = frame->dirty[--frame->dirtyCount];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    if (frame->dirtyCount < SSD1331_FRAME_DIRTY_MAX) {
+        frame->dirty[frame->dirtyCount++] = rect;
+        return;
+    }
+
+    // Out of space, merge with whichever area grows least.
+    unsigned best       = 0;
+    uint32_t bestGrowth = UINT32_MAX;
+    for (unsigned i = 0; i < frame->dirtyCount; i++) {
+        SSD1331Frame_Rect u = SSD1331Frame__Union(&frame->dirty[i], &rect);
+        uint32_t growth = SSD1331Frame__Area(&u) - SSD1331Frame__Area(&frame->dirty[i]);
+        if (growth < bestGrowth) {
+            best       = i;
+            bestGrowth = growth;
+        }
+    }
+
+    SSD1331Frame_Rect merged = SSD1331Frame__Union(&frame->dirty[best], &rect);
+    frame->dirty[best] = frame->dirty[--frame->dirtyCount];
+    SSD1331Frame__Dirty(frame, merged);
+}
+
+static bool SSD1331Frame__Is_Clean(const SSD1331_Frame *frame, const SSD1331Frame_Rect *rect)
+{
+    for (unsigned i = 0; i < frame->dirtyCount; i++) {
+        if (SSD1331Frame__Intersects(&frame->dirty[i], rect)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Drawing commands wait for any upload in progress to finish first.
+static bool SSD1331Frame__Use_Hardware(const SSD1331_Frame *frame, const SSD1331Frame_Rect *rect)
+{
+    return (!SSD1331_Busy(frame->display)
+        && ((SSD1331Frame__Area(rect) * 2) >= SSD1331_FRAME_HW_MIN_BYTES));
+}
+
+static void SSD1331Frame__Copy_Rect(uint16_t *dst, const uint16_t *src, const SSD1331Frame_Rect *rect)
+{
+    uint32_t rowBytes = (rect->x1 - rect->x0 + 1) * 2;
+    for (unsigned row = rect->y0; row <= rect->y1; row++) {
+        unsigned offset = (row * SSD1331_WIDTH) + rect->x0;
+        __builtin_memcpy(&dst[offset], &src[offset], rowBytes);
+    }
+}
+
+static void SSD1331Frame__Fill_Pixels(uint16_t *pixels, const SSD1331Frame_Rect *rect, uint16_t value)
+{
+    for (unsigned row = rect->y0; row <= rect->y1; row++) {
+        uint16_t *dst = &pixels[row * SSD1331_WIDTH];
+        for (unsigned col = rect->x0; col <= rect->x1; col++) {
+            dst[col] = value;
+        }
+    }
+}
+
+static void SSD1331Frame__Line_Pixels(uint16_t *pixels, int x0, int y0, int x1, int y1, uint16_t value)
+{
+    int dx = (x1 > x0 ? x1 - x0 : x0 - x1);
+    int dy = (y1 > y0 ? y1 - y0 : y0 - y1);
+    int sx = (x0 < x1 ? 1 : -1);
+    int sy = (y0 < y1 ? 1 : -1);
+    int err = dx - dy;
+
+    for (int x = x0, y = y0; ; ) {
+        if ((x >= 0) && (x < SSD1331_WIDTH) && (y >= 0) && (y < SSD1331_HEIGHT)) {
+            pixels[(y * SSD1331_WIDTH) + x] = value;
+        }
+        if ((x == x1) && (y == y1)) {
+            break;
+        }
+        int e2 = 2 * err;
+        if (e2 > -dy) {
+            err -= dy;
+            x += sx;
+        }
+        if (e2 < dx) {
+            err += dx;
+            y += sy;
+        }
+    }
+}
+
+// Rows are copied in the order which doesn't overwrite unread source rows.
+static void SSD1331Frame__Copy_Pixels(uint16_t *pixels, const SSD1331Frame_Rect *src, const SSD1331Frame_Rect *dst)
+{
+    uint32_t rowBytes = (dst->x1 - dst->x0 + 1) * 2;
+    unsigned rows     = (dst->y1 - dst->y0 + 1);
+    for (unsigned i = 0; i < rows; i++) {
+        unsigned r = (dst->y0 > src->y0 ? (rows - 1 - i) : i);
+        __builtin_memmove(
+            &pixels[((dst->y0 + r) * SSD1331_WIDTH) + dst->x0],
+            &pixels[((src->y0 + r) * SSD1331_WIDTH) + src->x0],
+            rowBytes);
+    }
+}
+
+// Marks the areas of a failed upload to be sent again, called before the
+// dirty areas are used so interrupts never touch them.
+static void SSD1331Frame__Recover(SSD1331_Frame *frame)
+{
+    if (!frame->failed) {
+        return;
+    }
+
+    for (unsigned i = 0; i < frame->windowCount; i++) {
+        const SSD1331_Window *w = &frame->windows[i];
+        SSD1331Frame_Rect rect = { w->columnStart, w->rowStart, w->columnEnd, w->rowEnd };
+        SSD1331Frame__Dirty(frame, rect);
+    }
+    frame->failed = false;
+}
+
+static void SSD1331Frame__Color(SSD1331_Color color, uint8_t *c, uint8_t *b, uint8_t *a)
+{
+    // Drawing commands take 6 bits per channel.
+    *c = (uint8_t)((color >> 11) << 1);
+    *b = (uint8_t)((color >> 5) & 0x3F);
+    *a = (uint8_t)((color & 0x1F) << 1);
+}
+
+
+static SSD1331_Frame *SSD1331Frame__Open(SSD1331 *display, void *pixels, void *back)
+{
+    if (!display || !pixels || (((uintptr_t)pixels % 4) != 0)
+        || (back && (((uintptr_t)back % 4) != 0))) {
+        return NULL;
+    }
+
+    SSD1331_Frame *frame = NULL;
+    for (unsigned i = 0; i < SSD1331_FRAME_COUNT; i++) {
+        if (!SSD1331_Frames[i].display) {
+            frame = &SSD1331_Frames[i];
+            break;
+        }
+    }
+    if (!frame) {
+        return NULL;
+    }
+
+    if (!SSD1331_SetFill(display, true, false)) {
+        return NULL;
+    }
+
+    frame->display     = display;
+    frame->pixels      = pixels;
+    frame->back        = back;
+    frame->dirtyCount  = 1;
+    frame->dirty[0]    = SSD1331Frame_Full;
+    frame->busy        = false;
+    frame->failed      = false;
+    frame->windowCount = 0;
+    frame->callback    = NULL;
+    return frame;
+}
+
+SSD1331_Frame *SSD1331_FrameOpen(SSD1331 *display, void *pixels)
+{
+    return SSD1331Frame__Open(display, pixels, NULL);
+}
+
+SSD1331_Frame *SSD1331_FrameOpenDouble(SSD1331 *display, void *pixels, void *back)
+{
+    if (!back) {
+        return NULL;
+    }
+    return SSD1331Frame__Open(display, pixels, back);
+}
+
+void SSD1331_FrameClose(SSD1331_Frame *frame)
+{
+    if (!frame || frame->busy) {
+        return;
+    }
+
+    frame->display = NULL;
+}
+
+uint16_t *SSD1331_FramePixels(SSD1331_Frame *frame)
+{
+    return (frame ? frame->pixels : NULL);
+}
+
+void SSD1331_FrameInvalidate(SSD1331_Frame *frame, int x, int y, int w, int h)
+{
+    SSD1331Frame_Rect rect;
+    if (!frame || !SSD1331Frame__Clip(x, y, w, h, &rect)) {
+        return;
+    }
+
+    SSD1331Frame__Dirty(frame, rect);
+}
+
+void SSD1331_FrameLoad(SSD1331_Frame *frame, int x, int y, int w, int h, const void *image)
+{
+    SSD1331Frame_Rect rect;
+    if (!frame || !image || !SSD1331Frame__Clip(x, y, w, h, &rect)) {
+        return;
+    }
+
+    const uint8_t *src = image;
+    src += (((rect.y0 - y) * w) + (rect.x0 - x)) * 2;
+
+    SSD1331Frame_Rect changed   = {SSD1331_WIDTH, SSD1331_HEIGHT, 0, 0};
+    bool              anyChange = false;
+
+    for (unsigned row = rect.y0; row <= rect.y1; row++) {
+        uint16_t *dst = &frame->pixels[(row * SSD1331_WIDTH) + rect.x0];
+        for (unsigned col = rect.x0; col <= rect.x1; col++, dst++) {
+            uint16_t value;
+            __builtin_memcpy(&value, &src[(col - rect.x0) * 2], sizeof(value));
+            if (*dst == value) {
+                continue;
+            }
+
+            *dst = value;
+            if (col < changed.x0) changed.x0 = col;
+            if (col > changed.x1) changed.x1 = col;
+            if (row < changed.y0) changed.y0 = row;
+            changed.y1 = row;
+            anyChange = true;
+        }
+        src += (w * 2);
+    }
+
+    if (anyChange) {
+        SSD1331Frame__Dirty(frame, changed);
+    }
+}
+
+bool SSD1331_FrameFill(SSD1331_Frame *frame, int x, int y, int w, int h, SSD1331_Color color)
+{
+    if (!frame || !frame->display) {
+        return false;
+    }
+
+    SSD1331Frame_Rect rect;
+    if (!SSD1331Frame__Clip(x, y, w, h, &rect)) {
+        return true;
+    }
+
+    uint16_t value = __builtin_bswap16(color);
+    SSD1331Frame__Fill_Pixels(frame->pixels, &rect, value);
+
+    if (!SSD1331Frame__Use_Hardware(frame, &rect)) {
+        SSD1331Frame__Dirty(frame, rect);
+        return true;
+    }
+
+    uint8_t c, b, a;
+    SSD1331Frame__Color(color, &c, &b, &a);
+    if (!SSD1331_DrawRectangle(frame->display, rect.x0, rect.y0, rect.x1, rect.y1, c, b, a, c, b, a)) {
+        SSD1331Frame__Dirty(frame, rect);
+        return false;
+    }
+
+    // The back buffer follows anything drawn straight to the panel.
+    if (frame->back) {
+        SSD1331Frame__Fill_Pixels(frame->back, &rect, value);
+    }
+    return true;
+}
+
+bool SSD1331_FrameLine(SSD1331_Frame *frame, int x0, int y0, int x1, int y1, SSD1331_Color color)
+{
+    if (!frame || !frame->display) {
+        return false;
+    }
+
+    // Straight lines are fills, which are too small to send to the controller.
+    if ((x0 == x1) || (y0 == y1)) {
+        int x = (x0 < x1 ? x0 : x1);
+        int y = (y0 < y1 ? y0 : y1);
+        return SSD1331_FrameFill(frame, x, y,
+            ((x0 < x1 ? x1 - x0 : x0 - x1) + 1), ((y0 < y1 ? y1 - y0 : y0 - y1) + 1), color);
+    }
+
+    uint16_t value = __builtin_bswap16(color);
+    int dx = (x1 > x0 ? x1 - x0 : x0 - x1);
+    int dy = (y1 > y0 ? y1 - y0 : y0 - y1);
+
+    SSD1331Frame_Rect bounds;
+    bool onPanel = SSD1331Frame__Clip(
+        (x0 < x1 ? x0 : x1), (y0 < y1 ? y0 : y1), (dx + 1), (dy + 1), &bounds);
+    if (!onPanel) {
+        return true;
+    }
+    bool whole = (SSD1331Frame__Area(&bounds) == (uint32_t)((dx + 1) * (dy + 1)));
+
+    SSD1331Frame__Line_Pixels(frame->pixels, x0, y0, x1, y1, value);
+
+    // The line is always marked as changed, as the controller may not pick
+    // exactly the same pixels, so neither the panel nor the back buffer can
+    // be taken to match the frame until the area is next uploaded. Drawing
+    // it on the controller as well shows it straight away. The controller
+    // can only draw lines which are entirely on the panel.
+    SSD1331Frame__Dirty(frame, bounds);
+    if (!whole || !SSD1331Frame__Use_Hardware(frame, &bounds)) {
+        return true;
+    }
+
+    uint8_t c, b, a;
+    SSD1331Frame__Color(color, &c, &b, &a);
+    return SSD1331_DrawLine(frame->display, x0, y0, x1, y1, c, b, a);
+}
+
+bool SSD1331_FrameCopy(SSD1331_Frame *frame, int x, int y, int w, int h, int dstX, int dstY)
+{
+    if (!frame || !frame->display) {
+        return false;
+    }
+
+    // Clip the source then the destination, keeping them the same size.
+    SSD1331Frame_Rect src, dst;
+    if (!SSD1331Frame__Clip(x, y, w, h, &src)) {
+        return true;
+    }
+    int dx = dstX - x;
+    int dy = dstY - y;
+    if (!SSD1331Frame__Clip((src.x0 + dx), (src.y0 + dy),
+        (src.x1 - src.x0 + 1), (src.y1 - src.y0 + 1), &dst)) {
+        return true;
+    }
+    src.x0 = dst.x0 - dx;
+    src.y0 = dst.y0 - dy;
+    src.x1 = dst.x1 - dx;
+    src.y1 = dst.y1 - dy;
+
+    SSD1331Frame__Copy_Pixels(frame->pixels, &src, &dst);
+
+    // The controller copies from what is on the panel, which must be current
+    // and shouldn't be overwritten part way through.
+    SSD1331Frame__Recover(frame);
+    if (!SSD1331Frame__Use_Hardware(frame, &dst)
+        || SSD1331Frame__Intersects(&src, &dst)
+        || !SSD1331Frame__Is_Clean(frame, &src)) {
+        SSD1331Frame__Dirty(frame, dst);
+        return true;
+    }
+
+    if (!SSD1331_Copy(frame->display, src.x0, src.y0, src.x1, src.y1, dst.x0, dst.y0)) {
+        SSD1331Frame__Dirty(frame, dst);
+        return false;
+    }
+
+    if (frame->back) {
+        SSD1331Frame__Copy_Pixels(frame->back, &src, &dst);
+    }
+    return true;
+}
+
+static bool SSD1331Frame__Upload(SSD1331_Frame *frame, const SSD1331Frame_Rect *rect)
+{
+    if (!SSD1331_SetColAddress(frame->display, rect->x0, rect->x1)
+        || !SSD1331_SetRowAddress(frame->display, rect->y0, rect->y1)) {
+        return false;
+    }
+
+    uint32_t width = (rect->x1 - rect->x0 + 1);
+    const uint16_t *src = &frame->pixels[(rect->y0 * SSD1331_WIDTH) + rect->x0];
+
+    // Full width windows are contiguous in the frame.
+    if (width == SSD1331_WIDTH) {
+        return SSD1331_WriteData(frame->display, src,
+            ((rect->y1 - rect->y0 + 1) * width * 2));
+    }
+
+    for (unsigned row = rect->y0; row <= rect->y1; row++, src += SSD1331_WIDTH) {
+        if (!SSD1331_WriteData(frame->display, src, (width * 2))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SSD1331_FrameUpdate(SSD1331_Frame *frame)
+{
+    if (!frame || !frame->display || frame->busy) {
+        return false;
+    }
+
+    SSD1331Frame__Recover(frame);
+    while (frame->dirtyCount > 0) {
+        const SSD1331Frame_Rect *rect = &frame->dirty[frame->dirtyCount - 1];
+        if (!SSD1331Frame__Upload(frame, rect)) {
+            return false;
+        }
+        if (frame->back) {
+            SSD1331Frame__Copy_Rect(frame->back, frame->pixels, rect);
+        }
+        frame->dirtyCount--;
+    }
+
+    // Leave the window covering the panel, as SSD1331_Upload expects.
+    return (SSD1331_SetColAddress(frame->display, 0, (SSD1331_WIDTH - 1))
+        && SSD1331_SetRowAddress(frame->display, 0, (SSD1331_HEIGHT - 1)));
+}
+
+static void SSD1331Frame__Presented(SSD1331 *display, bool success)
+{
+    for (unsigned i = 0; i < SSD1331_FRAME_COUNT; i++) {
+        SSD1331_Frame *frame = &SSD1331_Frames[i];
+        if ((frame->display != display) || !frame->busy) {
+            continue;
+        }
+
+        frame->failed = !success;
+        frame->busy   = false;
+        if (frame->callback) {
+            frame->callback(frame, success);
+        }
+        return;
+    }
+}
+
+bool SSD1331_FramePresent(SSD1331_Frame *frame, SSD1331_FrameCallback callback)
+{
+    if (!frame || !frame->display || frame->busy) {
+        return false;
+    }
+
+    SSD1331Frame__Recover(frame);
+    if (frame->dirtyCount == 0) {
+        if (callback) {
+            callback(frame, true);
+        }
+        return true;
+    }
+
+    uint16_t *shown = frame->pixels;
+    for (unsigned i = 0; i < frame->dirtyCount; i++) {
+        const SSD1331Frame_Rect *rect = &frame->dirty[i];
+        frame->windows[i] = (SSD1331_Window){
+            .columnStart = rect->x0,
+            .rowStart    = rect->y0,
+            .columnEnd   = rect->x1,
+            .rowEnd      = rect->y1,
+            .data        = &shown[(rect->y0 * SSD1331_WIDTH) + rect->x0],
+            .stride      = (SSD1331_WIDTH * 2),
+        };
+    }
+    frame->windowCount = frame->dirtyCount;
+    frame->callback    = callback;
+
+    // Drawing carries on in the back buffer, brought up to date with the
+    // areas being sent. The buffer being sent is only read meanwhile.
+    if (frame->back) {
+        for (unsigned i = 0; i < frame->dirtyCount; i++) {
+            SSD1331Frame__Copy_Rect(frame->back, shown, &frame->dirty[i]);
+        }
+        frame->pixels = frame->back;
+        frame->back   = shown;
+    }
+
+    frame->busy = true;
+    if (!SSD1331_UploadAsync(frame->display, frame->windows, frame->windowCount,
+                             SSD1331Frame__Presented)) {
+        frame->busy = false;
+        if (frame->back) {
+            frame->back   = frame->pixels;
+            frame->pixels = shown;
+        }
+        return false;
+    }
+
+    frame->dirtyCount = 0;
+    return true;
+}
+
+bool SSD1331_FrameBusy(const SSD1331_Frame *frame)
+{
+    return (frame && frame->busy);
+}
@@ -0,0 +1,74 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef SSD1331_FRAME_H_
+#define SSD1331_FRAME_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SSD1331.h"
+
+// A framebuffer for an open SSD1331 which tracks what has changed, so
+// SSD1331_FrameUpdate only uploads the windows covering changed pixels
+// rather than the whole panel. Large fills and copies are drawn by the
+// controller's own commands where that is cheaper than sending the pixel
+// data. Large diagonal lines are drawn by it too, so they show straight
+// away, but are still uploaded by the next update as the controller may
+// pick different pixels.
+//
+// The framebuffer is the reference copy of the panel, in the 65k colour
+// format set up by SSD1331_Open: rows of SSD1331_WIDTH pixels, each two
+// bytes sent high byte first. The fill mode is enabled on open, and must be
+// left enabled for the frame's fills to be drawn correctly.
+
+typedef struct SSD1331_Frame SSD1331_Frame;
+
+// Pixel colour as RGB565, with red in the top bits.
+typedef uint16_t SSD1331_Color;
+
+#define SSD1331_RGB(r, g, b) ((SSD1331_Color)( \
+    (((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | (((b) & 0xF8) >> 3)))
+
+// Bytes needed for the pixels of a frame.
+#define SSD1331_FRAME_SIZE (SSD1331_WIDTH * SSD1331_HEIGHT * 2)
+
+typedef void (*SSD1331_FrameCallback)(SSD1331_Frame *frame, bool success);
+
+// pixels holds SSD1331_FRAME_SIZE bytes and must be 4 byte aligned. Its
+// contents are taken as the new image, so the first update sends them all.
+SSD1331_Frame *SSD1331_FrameOpen(SSD1331 *display, void *pixels);
+// As SSD1331_FrameOpen with a second buffer of the same size, so the next
+// image can be drawn while SSD1331_FramePresent sends the last.
+SSD1331_Frame *SSD1331_FrameOpenDouble(SSD1331 *display, void *pixels, void *back);
+void           SSD1331_FrameClose(SSD1331_Frame *frame);
+
+// Direct access to the pixels being drawn, call SSD1331_FrameInvalidate on
+// any area written this way. This moves to the other buffer on each
+// SSD1331_FramePresent of a double buffered frame.
+uint16_t *SSD1331_FramePixels(SSD1331_Frame *frame);
+void      SSD1331_FrameInvalidate(SSD1331_Frame *frame, int x, int y, int w, int h);
+
+// Copies a w x h image in the panel's format (e.g. wheel.h) to x, y, only
+// marking the pixels which differ as changed.
+void SSD1331_FrameLoad(SSD1331_Frame *frame, int x, int y, int w, int h, const void *image);
+
+// Drawing is clipped to the panel. Commands sent to the controller straight
+// away return false if they fail, the area is then uploaded on the next update.
+bool SSD1331_FrameFill(SSD1331_Frame *frame, int x, int y, int w, int h, SSD1331_Color color);
+bool SSD1331_FrameLine(SSD1331_Frame *frame, int x0, int y0, int x1, int y1, SSD1331_Color color);
+bool SSD1331_FrameCopy(SSD1331_Frame *frame, int x, int y, int w, int h, int dstX, int dstY);
+
+// Upload changed areas to the panel.
+bool SSD1331_FrameUpdate(SSD1331_Frame *frame);
+
+// Starts uploading the changed areas by DMA, so the buffers must be in SYSRAM.
+// callback is called in interrupt context once they're sent, or straight away
+// if nothing changed. A double buffered frame can be drawn to meanwhile, but
+// a single buffered one shouldn't be until then. Drawing commands aren't
+// sent to the controller during an upload, and areas of a failed upload are
+// sent again with the next.
+bool SSD1331_FramePresent(SSD1331_Frame *frame, SSD1331_FrameCallback callback);
+bool SSD1331_FrameBusy(const SSD1331_Frame *frame);
+
+#endif // #ifndef SSD1331_FRAME_H_
@@ -0,0 +1,396 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "SSD1331Render.h"
+
+// Two pixels, which may alias the frame's 16-bit pixels.
+typedef uint32_t __attribute__((__may_alias__)) SSD1331Render_Pair;
+
+#define SSD1331_FONT_FIRST  0x20
+#define SSD1331_FONT_LAST   0x7E
+#define SSD1331_FONT_GLYPH  5
+
+// Columns of each glyph from the left, least significant bit at the top.
+static const uint8_t SSD1331Render_Font[][SSD1331_FONT_GLYPH] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, // ' ' '!'
+    {0x00, 0x07, 0x00, 0x07, 0x00}, {0x14, 0x7F, 0x14, 0x7F, 0x14}, // '"' '#'
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62}, // '$' '%'
+    {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00}, // '&' '''
+    {0x00, 0x1C, 0x22, 0x41, 0x00}, {0x00, 0x41, 0x22, 0x1C, 0x00}, // '(' ')'
+    {0x08, 0x2A, 0x1C, 0x2A, 0x08}, {0x08, 0x08, 0x3E, 0x08, 0x08}, // '*' '+'
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, // ',' '-'
+    {0x00, 0x60, 0x60, 0x00, 0x00}, {0x20, 0x10, 0x08, 0x04, 0x02}, // '.' '/'
+    {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00}, // '0' '1'
+    {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31}, // '2' '3'
+    {0x18, 0x14, 0x12, 0x7F, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39}, // '4' '5'
+    {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03}, // '6' '7'
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E}, // '8' '9'
+    {0x00, 0x36, 0x36, 0x00, 0x00}, {0x00, 0x56, 0x36, 0x00, 0x00}, // ':' ';'
+    {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14}, // '<' '='
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06}, // '>' '?'
+    {0x32, 0x49, 0x79, 0x41, 0x3E}, {0x7E, 0x11, 0x11, 0x11, 0x7E}, // '@' 'A'
+    {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22}, // 'B' 'C'
+    {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, // 'D' 'E'
+    {0x7F, 0x09, 0x09, 0x09, 0x01}, {0x3E, 0x41, 0x49, 0x49, 0x7A}, // 'F' 'G'
+    {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00}, // 'H' 'I'
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, // 'J' 'K'
+    {0x7F, 0x40, 0x40, 0x40, 0x40}, {0x7F, 0x02, 0x0C, 0x02, 0x7F}, // 'L' 'M'
+    {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E}, // 'N' 'O'
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, // 'P' 'Q'
+    {0x7F, 0x09, 0x19, 0x29, 0x46}, {0x46, 0x49, 0x49, 0x49, 0x31}, // 'R' 'S'
+    {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F}, // 'T' 'U'
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, // 'V' 'W'
+    {0x63, 0x14, 0x08, 0x14, 0x63}, {0x07, 0x08, 0x70, 0x08, 0x07}, // 'X' 'Y'
+    {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00}, // 'Z' '['
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00}, // '\' ']'
+    {0x04, 0x02, 0x01, 0x02, 0x04}, {0x40, 0x40, 0x40, 0x40, 0x40}, // '^' '_'
+    {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78}, // '`' 'a'
+    {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20}, // 'b' 'c'
+    {0x38, 0x44, 0x44, 0x48, 0x7F}, {0x38, 0x54, 0x54, 0x54, 0x18}, // 'd' 'e'
+    {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x0C, 0x52, 0x52, 0x52, 0x3E}, // 'f' 'g'
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, // 'h' 'i'
+    {0x20, 0x40, 0x44, 0x3D, 0x00}, {0x7F, 0x10, 0x28, 0x44, 0x00}, // 'j' 'k'
+    {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78}, // 'l' 'm'
+    {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, // 'n' 'o'
+    {0x7C, 0x14, 0x14, 0x14, 0x08}, {0x08, 0x14, 0x14, 0x18, 0x7C}, // 'p' 'q'
+    {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20}, // 'r' 's'
+    {0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, // 't' 'u'
+    {0x1C, 0x20, 0x40, 0x20, 0x1C}, {0x3C, 0x40, 0x30, 0x40, 0x3C}, // 'v' 'w'
+    {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C}, // 'x' 'y'
+    {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, // 'z' '{'
+    {0x00, 0x00, 0x7F, 0x00, 0x00}, {0x00, 0x41, 0x36, 0x08, 0x00}, // '|' '}'
+    {0x08, 0x04, 0x08, 0x10, 0x08},                                 // '~'
+};
+
+_Static_assert((sizeof(SSD1331Render_Font) / sizeof(SSD1331Render_Font[0]))
+    == (SSD1331_FONT_LAST - SSD1331_FONT_FIRST + 1), "Font is incomplete");
+
+
+static uint16_t SSD1331Render__Value(SSD1331_Color color)
+{
+    return __builtin_bswap16(color);
+}
+
+// Stores count copies of value from dst, two pixels per store once aligned.
+static void SSD1331Render__Span(uint16_t *dst, unsigned count, uint16_t value)
+{
+    if ((((uintptr_t)dst & 2) != 0) && (count > 0)) {
+        *dst++ = value;
+        count--;
+    }
+
+    uint32_t            pair  = ((uint32_t)value << 16) | value;
+    SSD1331Render_Pair *word  = (SSD1331Render_Pair *)dst;
+    unsigned            words = (count / 2);
+
+    for (; words >= 4; words -= 4, word += 4) {
+        word[0] = pair;
+        word[1] = pair;
+        word[2] = pair;
+        word[3] = pair;
+    }
+    for (; words > 0; words--) {
+        *word++ = pair;
+    }
+
+    if ((count & 1) != 0) {
+        *(uint16_t *)word = value;
+    }
+}
+
+// A horizontal run of pixels, clipped but not marked as changed.
+static void SSD1331Render__HSpan(uint16_t *pixels, int x, int y, int len, uint16_t value)
+{
+    if ((y < 0) || (y >= SSD1331_HEIGHT)) {
+        return;
+    }
+    if (x < 0) {
+        len += x;
+        x = 0;
+    }
+    if ((x + len) > SSD1331_WIDTH) {
+        len = SSD1331_WIDTH - x;
+    }
+    if (len <= 0) {
+        return;
+    }
+
+    SSD1331Render__Span(&pixels[(y * SSD1331_WIDTH) + x], len, value);
+}
+
+// Clips an area to the panel, returning false if nothing is left.
+static bool SSD1331Render__Clip(int *x, int *y, int *w, int *h)
+{
+    if (*x < 0) {
+        *w += *x;
+        *x  = 0;
+    }
+    if (*y < 0) {
+        *h += *y;
+        *y  = 0;
+    }
+    if ((*x + *w) > SSD1331_WIDTH) {
+        *w = SSD1331_WIDTH - *x;
+    }
+    if ((*y + *h) > SSD1331_HEIGHT) {
+        *h = SSD1331_HEIGHT - *y;
+    }
+    return ((*w > 0) && (*h > 0));
+}
+
+
+void SSD1331_RenderFill(SSD1331_Frame *frame, int x, int y, int w, int h, SSD1331_Color color)
+{
+    uint16_t *pixels = SSD1331_FramePixels(frame);
+    if (!pixels || !SSD1331Render__Clip(&x, &y, &w, &h)) {
+        return;
+    }
+
+    uint16_t value = SSD1331Render__Value(color);
+    uint16_t *row  = &pixels[(y * SSD1331_WIDTH) + x];
+    for (int r = 0; r < h; r++, row += SSD1331_WIDTH) {
+        SSD1331Render__Span(row, w, value);
+    }
+
+    SSD1331_FrameInvalidate(frame, x, y, w, h);
+}
+
+void SSD1331_RenderRect(SSD1331_Frame *frame, int x, int y, int w, int h, SSD1331_Color color)
+{
+    if ((w <= 0) || (h <= 0)) {
+        return;
+    }
+
+    // Marked as four edges, so the inside isn't uploaded.
+    SSD1331_RenderFill(frame, x, y, w, 1, color);
+    if (h > 1) {
+        SSD1331_RenderFill(frame, x, (y + h - 1), w, 1, color);
+    }
+    if (h > 2) {
+        SSD1331_RenderFill(frame, x, (y + 1), 1, (h - 2), color);
+        if (w > 1) {
+            SSD1331_RenderFill(frame, (x + w - 1), (y + 1), 1, (h - 2), color);
+        }
+    }
+}
+
+void SSD1331_RenderLine(SSD1331_Frame *frame, int x0, int y0, int x1, int y1, SSD1331_Color color)
+{
+    uint16_t *pixels = SSD1331_FramePixels(frame);
+    if (!pixels) {
+        return;
+    }
+
+    // Always step downwards, so each row's pixels form a single span.
+    if (y1 < y0) {
+        int t;
+        t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+
+    int bx = (x0 < x1 ? x0 : x1);
+    int bw = (x0 < x1 ? x1 - x0 : x0 - x1) + 1;
+    int bh = (y1 - y0) + 1;
+    int by = y0;
+    if (!SSD1331Render__Clip(&bx, &by, &bw, &bh)) {
+        return;
+    }
+
+    uint16_t value = SSD1331Render__Value(color);
+    int dx  = (x0 < x1 ? x1 - x0 : x0 - x1);
+    int dy  = (y1 - y0);
+    int sx  = (x0 < x1 ? 1 : -1);
+    int err = dx - dy;
+
+    // Runs of pixels on the same row are stored as spans.
+    int x = x0, runStart = x0;
+    for (int y = y0; ; ) {
+        bool last = ((x == x1) && (y == y1));
+        int  e2   = 2 * err;
+        bool stepX = !last && (e2 > -dy);
+        bool stepY = !last && (e2 < dx);
+
+        if (last || stepY) {
+            int start = (sx > 0 ? runStart : x);
+            int len   = (sx > 0 ? x - runStart : runStart - x) + 1;
+            SSD1331Render__HSpan(pixels, start, y, len, value);
+        }
+        if (last) {
+            break;
+        }
+
+        if (stepX) {
+            err -= dy;
+            x += sx;
+        }
+        if (stepY) {
+            err += dx;
+            y++;
+            runStart = x;
+        }
+    }
+
+    SSD1331_FrameInvalidate(frame, bx, by, bw, bh);
+}
+
+static SSD1331_Color SSD1331Render__Blend(SSD1331_Color from, SSD1331_Color to, int step, int steps)
+{
+    int r0 = (from >> 11), g0 = ((from >> 5) & 0x3F), b0 = (from & 0x1F);
+    int r1 = (to   >> 11), g1 = ((to   >> 5) & 0x3F), b1 = (to   & 0x1F);
+
+    int r = r0 + (((r1 - r0) * step) / steps);
+    int g = g0 + (((g1 - g0) * step) / steps);
+    int b = b0 + (((b1 - b0) * step) / steps);
+    return (SSD1331_Color)((r << 11) | (g << 5) | b);
+}
+
+void SSD1331_RenderGradient(SSD1331_Frame *frame, int x, int y, int w, int h,
+                            SSD1331_Color from, SSD1331_Color to, bool vertical)
+{
+    uint16_t *pixels = SSD1331_FramePixels(frame);
+    if (!pixels || (w <= 0) || (h <= 0)) {
+        return;
+    }
+
+    // Colours are picked along the whole area, then it is clipped.
+    int steps = (vertical ? h : w) - 1;
+    if (steps <= 0) {
+        steps = 1;
+    }
+    int ox = x, oy = y;
+    if (!SSD1331Render__Clip(&x, &y, &w, &h)) {
+        return;
+    }
+
+    uint16_t *row = &pixels[(y * SSD1331_WIDTH) + x];
+    if (vertical) {
+        for (int r = 0; r < h; r++, row += SSD1331_WIDTH) {
+            SSD1331Render__Span(row, w, SSD1331Render__Value(
+                SSD1331Render__Blend(from, to, (y - oy + r), steps)));
+        }
+    } else {
+        // Every row matches the first.
+        for (int c = 0; c < w; c++) {
+            row[c] = SSD1331Render__Value(SSD1331Render__Blend(from, to, (x - ox + c), steps));
+        }
+        for (int r = 1; r < h; r++) {
+            __builtin_memcpy(&row[r * SSD1331_WIDTH], row, (w * 2));
+        }
+    }
+
+    SSD1331_FrameInvalidate(frame, x, y, w, h);
+}
+
+// Copies count pixels skipping key, checking two at a time when both the
+// source and destination are word aligned.
+static void SSD1331Render__Keyed_Span(uint16_t *dst, const uint8_t *src, unsigned count, uint16_t key)
+{
+    if (((((uintptr_t)dst ^ (uintptr_t)src) & 3) == 0) && (((uintptr_t)src & 1) == 0)) {
+        if ((((uintptr_t)dst & 2) != 0) && (count > 0)) {
+            uint16_t value = *(const uint16_t *)src;
+            if (value != key) {
+                *dst = value;
+            }
+            dst++;
+            src += 2;
+            count--;
+        }
+
+        SSD1331Render_Pair       *dw   = (SSD1331Render_Pair *)dst;
+        const SSD1331Render_Pair *sw   = (const SSD1331Render_Pair *)src;
+        uint32_t                  keys = ((uint32_t)key << 16) | key;
+        for (unsigned words = (count / 2); words > 0; words--, dw++, sw++) {
+            uint32_t pair = *sw;
+            uint32_t diff = pair ^ keys;
+            if (((diff & 0xFFFF) != 0) && ((diff >> 16) != 0)) {
+                *dw = pair;
+            } else if ((diff & 0xFFFF) != 0) {
+                *(uint16_t *)dw = (uint16_t)pair;
+            } else if ((diff >> 16) != 0) {
+                ((uint16_t *)dw)[1] = (uint16_t)(pair >> 16);
+            }
+        }
+
+        dst   = (uint16_t *)dw;
+        src   = (const uint8_t *)sw;
+        count = (count & 1);
+    }
+
+    for (; count > 0; count--, dst++, src += 2) {
+        uint16_t value;
+        __builtin_memcpy(&value, src, sizeof(value));
+        if (value != key) {
+            *dst = value;
+        }
+    }
+}
+
+void SSD1331_RenderBlit(SSD1331_Frame *frame, int x, int y, int w, int h,
+                        const void *image, const SSD1331_Color *key)
+{
+    uint16_t *pixels = SSD1331_FramePixels(frame);
+    int stride = w * 2;
+    int ox = x, oy = y;
+    if (!pixels || !image || !SSD1331Render__Clip(&x, &y, &w, &h)) {
+        return;
+    }
+
+    const uint8_t *src = image;
+    src += ((y - oy) * stride) + ((x - ox) * 2);
+    uint16_t *row = &pixels[(y * SSD1331_WIDTH) + x];
+
+    for (int r = 0; r < h; r++, row += SSD1331_WIDTH, src += stride) {
+        if (key) {
+            SSD1331Render__Keyed_Span(row, src, w, SSD1331Render__Value(*key));
+        } else {
+            __builtin_memcpy(row, src, (w * 2));
+        }
+    }
+
+    SSD1331_FrameInvalidate(frame, x, y, w, h);
+}
+
+int SSD1331_RenderText(SSD1331_Frame *frame, int x, int y, const char *text,
+                       SSD1331_Color color, const SSD1331_Color *background)
+{
+    uint16_t *pixels = SSD1331_FramePixels(frame);
+    if (!pixels || !text) {
+        return x;
+    }
+
+    uint16_t fg = SSD1331Render__Value(color);
+    uint16_t bg = (background ? SSD1331Render__Value(*background) : 0);
+    int start = x;
+
+    for (; *text != '\0'; text++, x += SSD1331_FONT_WIDTH) {
+        unsigned ch = (uint8_t)*text;
+        if ((ch < SSD1331_FONT_FIRST) || (ch > SSD1331_FONT_LAST)) {
+            ch = '?';
+        }
+        const uint8_t *glyph = SSD1331Render_Font[ch - SSD1331_FONT_FIRST];
+
+        for (int c = 0; c < SSD1331_FONT_WIDTH; c++) {
+            int px = x + c;
+            if ((px < 0) || (px >= SSD1331_WIDTH)) {
+                continue;
+            }
+
+            // The last column and row of each cell are spacing.
+            uint8_t bits = (c < SSD1331_FONT_GLYPH ? glyph[c] : 0);
+            for (int r = 0; r < SSD1331_FONT_HEIGHT; r++, bits >>= 1) {
+                int py = y + r;
+                if ((py < 0) || (py >= SSD1331_HEIGHT)) {
+                    continue;
+                }
+                if ((bits & 1) != 0) {
+                    pixels[(py * SSD1331_WIDTH) + px] = fg;
+                } else if (background) {
+                    pixels[(py * SSD1331_WIDTH) + px] = bg;
+                }
+            }
+        }
+    }
+
+    SSD1331_FrameInvalidate(frame, start, y, (x - start), SSD1331_FONT_HEIGHT);
+    return x;
+}
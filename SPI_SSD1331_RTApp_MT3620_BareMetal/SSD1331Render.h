@@ -0,0 +1,42 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef SSD1331_RENDER_H_
+#define SSD1331_RENDER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SSD1331Frame.h"
+
+// Software drawing into an SSD1331_Frame, so user interfaces can be drawn at
+// runtime rather than from precomputed images. Everything is clipped to the
+// panel and marks the area it touches as changed, ready for
+// SSD1331_FrameUpdate or SSD1331_FramePresent. Colours are converted to the
+// panel's byte order once per call, so inner loops only store pixels, two at
+// a time with 32-bit stores wherever the alignment allows.
+
+// Character cell of the built in 5x7 font, including spacing.
+#define SSD1331_FONT_WIDTH  6
+#define SSD1331_FONT_HEIGHT 8
+
+void SSD1331_RenderFill(SSD1331_Frame *frame, int x, int y, int w, int h, SSD1331_Color color);
+// Outline one pixel wide.
+void SSD1331_RenderRect(SSD1331_Frame *frame, int x, int y, int w, int h, SSD1331_Color color);
+void SSD1331_RenderLine(SSD1331_Frame *frame, int x0, int y0, int x1, int y1, SSD1331_Color color);
+// Blends from one colour to the other down the area if vertical, else across it.
+void SSD1331_RenderGradient(SSD1331_Frame *frame, int x, int y, int w, int h,
+                            SSD1331_Color from, SSD1331_Color to, bool vertical);
+
+// Draws a w x h image in the panel's format (e.g. wheel.h), skipping pixels
+// of the colour key points to, if given.
+void SSD1331_RenderBlit(SSD1331_Frame *frame, int x, int y, int w, int h,
+                        const void *image, const SSD1331_Color *key);
+
+// Draws printable ASCII with the top left of the first cell at x, y,
+// filling the rest of each cell with the colour background points to, if
+// given. Returns the x position following the text.
+int SSD1331_RenderText(SSD1331_Frame *frame, int x, int y, const char *text,
+                       SSD1331_Color color, const SSD1331_Color *background);
+
+#endif // #ifndef SSD1331_RENDER_H_
@@ -1,769 +0,0 @@
-// https://ccsearch.creativecommons.org/photos/39ce96b2-d4d6-4219-920f-e8c5684d45d3
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x02, 0xE0, 0x03, 0xE0, 0x04, 0x20,
-0x04, 0xA0, 0x04, 0xE0, 0x04, 0xA0, 0x03, 0xA0, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x80, 0x00, 0xA0,
-0x00, 0xA0, 0x00, 0xA0, 0x00, 0xC0, 0x08, 0xE0, 0x11, 0x20, 0x21, 0x40, 0x29, 0x60, 0x10, 0xA0,
-0x10, 0xE6, 0x3B, 0x52, 0x5C, 0xB8, 0x75, 0x9C, 0x86, 0x1D, 0x96, 0x7E, 0x9E, 0xBF, 0xA6, 0xDF,
-0xA6, 0xDF, 0x9E, 0xBF, 0x9E, 0x9F, 0x96, 0x3E, 0x53, 0x2D, 0x19, 0x00, 0x08, 0x60, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
-0x08, 0x20, 0x01, 0xC0, 0x03, 0xE0, 0x05, 0x00, 0x1D, 0xE2, 0x1E, 0x42, 0x2E, 0xC4, 0x1E, 0xC2,
-0x26, 0xE3, 0x27, 0x03, 0x0E, 0xA1, 0x1E, 0x21, 0x7B, 0xE0, 0xAA, 0xA0, 0xAA, 0x80, 0xAA, 0x80,
-0xAA, 0x80, 0xAA, 0x80, 0xB2, 0x80, 0xB2, 0x80, 0xAA, 0x80, 0xAA, 0x80, 0xAA, 0x60, 0xA2, 0x20,
-0x68, 0xE0, 0x28, 0x00, 0x38, 0x00, 0x58, 0x00, 0x60, 0x00, 0x48, 0x25, 0x40, 0xEE, 0x40, 0xAF,
-0x48, 0x6E, 0x60, 0x49, 0x78, 0x02, 0x78, 0x00, 0x78, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
-0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x40, 0x03, 0xC0, 0x04, 0x60, 0x04, 0xE0,
-0x05, 0x42, 0x05, 0x63, 0x05, 0x41, 0x05, 0x00, 0x03, 0x00, 0x00, 0xA0, 0x00, 0x80, 0x00, 0x80,
-0x00, 0xA0, 0x00, 0xA0, 0x08, 0xC0, 0x08, 0xE0, 0x11, 0x20, 0x21, 0x40, 0x21, 0x60, 0x08, 0x60,
-0x11, 0x47, 0x43, 0x73, 0x5C, 0xB8, 0x7D, 0xBC, 0x8E, 0x3D, 0x9E, 0x9E, 0xA6, 0xBF, 0xA6, 0xFF,
-0xA6, 0xDF, 0x9E, 0xDF, 0x9E, 0x9F, 0x96, 0x5E, 0x6C, 0x34, 0x19, 0x01, 0x08, 0x60, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
-0x00, 0x40, 0x02, 0x60, 0x04, 0x40, 0x15, 0x41, 0x1D, 0xC2, 0x1E, 0x22, 0x1E, 0x62, 0x16, 0x81,
-0x37, 0x06, 0x26, 0xE4, 0x2E, 0xE4, 0x26, 0x41, 0x6C, 0x40, 0xB2, 0xA0, 0xB2, 0xA0, 0xB2, 0xA0,
-0xB2, 0xA0, 0xB2, 0x80, 0xB2, 0xA0, 0xB2, 0xA0, 0xB2, 0x80, 0xAA, 0x80, 0xAA, 0x80, 0xA2, 0x60,
-0x9A, 0x20, 0x58, 0xC0, 0x18, 0x00, 0x28, 0x00, 0x20, 0x2A, 0x29, 0x72, 0x39, 0x32, 0x30, 0xB1,
-0x20, 0x92, 0x3A, 0x36, 0x59, 0x93, 0x78, 0x03, 0x78, 0x00, 0x78, 0x00, 0x80, 0x00, 0x80, 0x00,
-0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x90, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x03, 0xE0, 0x04, 0xA0, 0x05, 0x44,
-0x0D, 0xA8, 0x15, 0xEB, 0x05, 0xC7, 0x05, 0x41, 0x04, 0xC0, 0x01, 0xE0, 0x00, 0x80, 0x00, 0x80,
-0x00, 0xA0, 0x00, 0xA0, 0x08, 0xC0, 0x08, 0xE0, 0x11, 0x00, 0x19, 0x20, 0x19, 0x20, 0x00, 0x20,
-0x11, 0x89, 0x43, 0xB4, 0x64, 0xD9, 0x7D, 0xBC, 0x86, 0x1D, 0x96, 0x7E, 0xA6, 0xDF, 0xAE, 0xFF,
-0xA6, 0xDF, 0x9E, 0xBF, 0x9E, 0x9F, 0x96, 0x7E, 0x85, 0x7A, 0x19, 0x02, 0x08, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xC0, 0x03, 0x00, 0x0C, 0x81, 0x15, 0x41, 0x1D, 0xE3, 0x26, 0x22, 0x1E, 0x41, 0x1E, 0xA2,
-0x26, 0xA2, 0x2E, 0xE4, 0x16, 0xA3, 0x0E, 0x20, 0x64, 0xC2, 0xB2, 0xC0, 0xB2, 0xC0, 0xB2, 0xC0,
-0xB2, 0xC0, 0xB2, 0xA0, 0xB2, 0xA0, 0xB2, 0xA0, 0xB2, 0xA0, 0xB2, 0xA0, 0xB2, 0xA0, 0xAA, 0x80,
-0xAA, 0x60, 0x9A, 0x00, 0x40, 0x80, 0x00, 0x04, 0x10, 0x4E, 0x20, 0xF1, 0x31, 0xF6, 0x31, 0xB5,
-0x3A, 0x36, 0x53, 0x38, 0x53, 0x7A, 0x61, 0x92, 0x78, 0x01, 0x78, 0x00, 0x78, 0x00, 0x80, 0x00,
-0x80, 0x00, 0x88, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x90, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0xA0, 0x03, 0xE0, 0x04, 0xC0, 0x0D, 0x88,
-0x66, 0xD4, 0x97, 0x38, 0x15, 0xE9, 0x05, 0x62, 0x05, 0x21, 0x03, 0xA0, 0x00, 0x80, 0x00, 0x80,
-0x00, 0xA0, 0x00, 0xA0, 0x08, 0xC0, 0x11, 0x00, 0x19, 0x00, 0x19, 0x20, 0x10, 0xE0, 0x00, 0x00,
-0x11, 0xAA, 0x4B, 0xD4, 0x64, 0xF9, 0x75, 0x9B, 0x86, 0x1D, 0x96, 0x5E, 0x9E, 0x9E, 0xA6, 0xBF,
-0xA6, 0xDF, 0x9E, 0xDF, 0x9E, 0xBF, 0x96, 0x9E, 0x8D, 0xFD, 0x29, 0xE7, 0x08, 0x60, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x40, 0x03, 0x60, 0x0C, 0xC0, 0x1D, 0x81, 0x25, 0xE2, 0x26, 0x43, 0x16, 0x41, 0x1E, 0x81,
-0x26, 0xC3, 0x2F, 0x05, 0x16, 0x81, 0x16, 0x41, 0x4D, 0x01, 0xB2, 0xC0, 0xB2, 0xC0, 0xB2, 0xC0,
-0xB2, 0xC0, 0xB2, 0xC0, 0xB2, 0xC0, 0xB2, 0xC0, 0xB2, 0xC0, 0xB2, 0xA0, 0xB2, 0xA0, 0xB2, 0x80,
-0xAA, 0x80, 0xA2, 0x60, 0x20, 0x61, 0x00, 0x09, 0x10, 0x4F, 0x29, 0x53, 0x4A, 0xB7, 0x5B, 0xB9,
-0x63, 0xBA, 0x63, 0xBB, 0x53, 0x38, 0x52, 0x97, 0x70, 0x45, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00,
-0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x03, 0xE0, 0x04, 0xA0, 0x0D, 0x67,
-0x4E, 0x6F, 0x8F, 0x17, 0x0D, 0xC9, 0x05, 0x84, 0x05, 0x40, 0x04, 0xA0, 0x01, 0x20, 0x00, 0x80,
-0x00, 0x80, 0x08, 0xA0, 0x11, 0x00, 0x19, 0x40, 0x19, 0x20, 0x19, 0x00, 0x08, 0xA0, 0x00, 0x01,
-0x1A, 0x0C, 0x4B, 0xF4, 0x64, 0xF9, 0x75, 0x9B, 0x85, 0xFD, 0x8E, 0x5E, 0x9E, 0x9F, 0xA6, 0xBF,
-0xA6, 0xDF, 0x9E, 0xBF, 0x9E, 0xBF, 0x9E, 0x9F, 0x8E, 0x3E, 0x4A, 0xEE, 0x08, 0x60, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-0x02, 0x00, 0x03, 0xE0, 0x15, 0x01, 0x15, 0x80, 0x25, 0xE1, 0x26, 0x22, 0x1E, 0x61, 0x1E, 0x81,
-0x26, 0xE4, 0x1E, 0xC2, 0x06, 0x60, 0x06, 0x20, 0x45, 0x63, 0xB2, 0xE0, 0xB2, 0xE0, 0x92, 0xC3,
-0x9A, 0xC3, 0xB2, 0xE0, 0xB2, 0xE0, 0xB2, 0xC0, 0xBA, 0xC0, 0xBA, 0xC0, 0xB2, 0xC0, 0xB2, 0xC0,
-0xB2, 0xA0, 0x61, 0x81, 0x00, 0x04, 0x00, 0x2B, 0x10, 0xB1, 0x21, 0x52, 0x4A, 0xF7, 0x74, 0x5A,
-0x85, 0x1C, 0x64, 0x1B, 0x42, 0xD8, 0x31, 0xF6, 0x60, 0xAA, 0x70, 0x00, 0x78, 0x00, 0x78, 0x00,
-0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0xE0, 0x04, 0x20, 0x04, 0xA0, 0x0D, 0x65,
-0x15, 0xCA, 0x4E, 0x90, 0x1E, 0x0B, 0x05, 0x83, 0x05, 0x40, 0x04, 0xE0, 0x02, 0xC0, 0x00, 0x80,
-0x08, 0xA0, 0x10, 0xC0, 0x19, 0x20, 0x19, 0x40, 0x19, 0x20, 0x19, 0x00, 0x08, 0x60, 0x00, 0x21,
-0x22, 0x6E, 0x4B, 0xF5, 0x6C, 0xF9, 0x75, 0x9B, 0x85, 0xFD, 0x8E, 0x3E, 0x96, 0x7E, 0x9E, 0xBF,
-0x9E, 0xBF, 0x9E, 0xDF, 0x9E, 0xBF, 0x9E, 0x9F, 0x96, 0x3E, 0x64, 0x34, 0x08, 0x61, 0x00, 0x00,
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-0x02, 0x80, 0x04, 0x40, 0x0D, 0x00, 0x15, 0x60, 0x1D, 0xC1, 0x1E, 0x21, 0x1E, 0x61, 0x1E, 0x81,
-0x26, 0xE4, 0x26, 0xC3, 0x16, 0x81, 0x06, 0x20, 0x3D, 0x82, 0xAB, 0x20, 0xB2, 0xE0, 0xA2, 0xE2,
-0xA2, 0xE2, 0xB2, 0xE0, 0xBA, 0xE0, 0xBA, 0xE0, 0xBA, 0xC0, 0xBA, 0xE0, 0xBA, 0xE0, 0xBA, 0xE0,
-0xB2, 0xC0, 0x18, 0x40, 0x00, 0x06, 0x08, 0x6D, 0x10, 0xB0, 0x29, 0x93, 0x4A, 0xF6, 0xB5, 0xDC,
-0xCE, 0xFE, 0x63, 0xFA, 0x42, 0xB8, 0x3A, 0x36, 0x59, 0x2F, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00,
-0x78, 0x00, 0x78, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x02, 0x60, 0x03, 0xA0, 0x04, 0x60, 0x04, 0xE1,
-0x05, 0x44, 0x05, 0x86, 0x0D, 0xC8, 0x05, 0x63, 0x05, 0x20, 0x05, 0x00, 0x04, 0x42, 0x08, 0xC0,
-0x10, 0xA0, 0x18, 0xC0, 0x21, 0x20, 0x21, 0x20, 0x19, 0x00, 0x18, 0xE0, 0x00, 0x40, 0x08, 0x63,
-0x2A, 0xCF, 0x4C, 0x16, 0x65, 0x19, 0x75, 0x9B, 0x85, 0xFD, 0x96, 0x5E, 0x9E, 0x7E, 0x9E, 0xBF,
-0xA6, 0xDF, 0xA6, 0xBF, 0x9E, 0xBF, 0x96, 0x9E, 0x8E, 0x3E, 0x7D, 0x5B, 0x11, 0xF2, 0x00, 0x67,
-0x08, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-0x03, 0x20, 0x04, 0x60, 0x0C, 0xE0, 0x15, 0x81, 0x1D, 0xC1, 0x1E, 0x21, 0x26, 0x62, 0x1E, 0xA2,
-0x1E, 0xC3, 0x26, 0xC3, 0x1E, 0xA2, 0x06, 0x20, 0x35, 0xE4, 0x8B, 0x44, 0x6A, 0xAC, 0x9A, 0xC7,
-0x72, 0x8B, 0xA2, 0xC5, 0x8A, 0xA9, 0xAA, 0xE3, 0xA2, 0xC6, 0xBB, 0x02, 0xB3, 0x03, 0xBB, 0x01,
-0x69, 0xC1, 0x00, 0x01, 0x00, 0x07, 0x08, 0x6E, 0x10, 0xB0, 0x29, 0xD4, 0x42, 0xB6, 0x63, 0x98,
-0x6B, 0xDA, 0x42, 0xD7, 0x3A, 0x16, 0x29, 0x94, 0x51, 0x50, 0x68, 0x00, 0x70, 0x00, 0x70, 0x00,
-0x78, 0x00, 0x78, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x04, 0x21, 0x0C, 0x64, 0x0C, 0xE5, 0x04, 0xA1,
-0x04, 0xE0, 0x05, 0x42, 0x05, 0x42, 0x05, 0x20, 0x05, 0x00, 0x05, 0x00, 0x04, 0xE2, 0x12, 0x22,
-0x08, 0x80, 0x10, 0xA0, 0x18, 0xC0, 0x18, 0xC0, 0x10, 0xA0, 0x10, 0x80, 0x00, 0x00, 0x08, 0xC5,
-0x2A, 0xF0, 0x4C, 0x36, 0x65, 0x19, 0x75, 0x9B, 0x85, 0xFD, 0x8E, 0x3E, 0x96, 0x7E, 0x9E, 0x9F,
-0x9E, 0xBF, 0x9E, 0xBF, 0x9E, 0xBF, 0x9E, 0x9F, 0x96, 0x5E, 0x85, 0xBC, 0x43, 0x97, 0x08, 0xEC,
-0x19, 0x6F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0xC0,
-0x03, 0xA1, 0x04, 0xA1, 0x05, 0x00, 0x1D, 0x81, 0x25, 0xE1, 0x1E, 0x21, 0x1E, 0x62, 0x1E, 0xA2,
-0x26, 0xC3, 0x26, 0xC3, 0x16, 0x82, 0x0E, 0x40, 0x2E, 0x04, 0x7B, 0x66, 0x4B, 0xB6, 0x7A, 0xCC,
-0x4B, 0x97, 0x72, 0x8B, 0x53, 0x97, 0x72, 0x8A, 0x3B, 0x36, 0x7A, 0x8A, 0x42, 0x94, 0x82, 0x69,
-0x10, 0x63, 0x00, 0x01, 0x00, 0x07, 0x08, 0x2D, 0x19, 0x11, 0x29, 0xD3, 0x3A, 0x75, 0x53, 0x37,
-0x53, 0x58, 0x3A, 0x96, 0x29, 0x54, 0x29, 0x74, 0x59, 0xD2, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0xC0, 0x03, 0xE0, 0x0C, 0xE2, 0x04, 0x80,
-0x04, 0xC0, 0x05, 0x01, 0x05, 0x01, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x01, 0x03, 0x62,
-0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x11, 0x27,
-0x33, 0x11, 0x54, 0x56, 0x64, 0xF9, 0x75, 0x9B, 0x85, 0xFD, 0x8E, 0x3E, 0x96, 0x5E, 0x9E, 0x9E,
-0x9E, 0x9F, 0x9E, 0xBF, 0x9E, 0x9F, 0x9E, 0x9F, 0x96, 0x7E, 0x85, 0xFD, 0x3B, 0xD9, 0x1A, 0xF8,
-0x09, 0x91, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x40,
-0x0C, 0x01, 0x14, 0xE2, 0x05, 0x00, 0x1D, 0x81, 0x26, 0x02, 0x1E, 0x21, 0x26, 0x62, 0x1E, 0xA3,
-0x26, 0xC3, 0x2E, 0xC4, 0x1E, 0xA3, 0x06, 0x20, 0x26, 0x24, 0x44, 0x2C, 0x1B, 0x14, 0x53, 0x51,
-0x2B, 0x56, 0x52, 0xF1, 0x43, 0x77, 0x5B, 0x32, 0x4B, 0xB7, 0x5A, 0xAF, 0x6B, 0xD6, 0x51, 0xA7,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x08, 0x2C, 0x21, 0x30, 0x29, 0x92, 0x31, 0xF4, 0x3A, 0x55,
-0x42, 0xB6, 0x32, 0x16, 0x29, 0xB5, 0x21, 0x96, 0x51, 0xB1, 0x68, 0x00, 0x70, 0x00, 0x70, 0x00,
-0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x60, 0x03, 0x60, 0x04, 0x00, 0x04, 0x40,
-0x04, 0xA0, 0x04, 0xE0, 0x05, 0x01, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x01, 0x04, 0xA3,
-0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x69,
-0x33, 0x31, 0x54, 0x56, 0x64, 0xF9, 0x75, 0x9B, 0x85, 0xFD, 0x8E, 0x3D, 0x96, 0x5E, 0x9E, 0x7E,
-0x9E, 0x9F, 0x9E, 0x9F, 0x9E, 0x9F, 0x9E, 0x9F, 0x96, 0x7E, 0x8E, 0x1D, 0x5C, 0x98, 0x22, 0xD4,
-0x09, 0xAF, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x02, 0xE0,
-0x0C, 0x41, 0x14, 0xE1, 0x15, 0x40, 0x1D, 0xA1, 0x26, 0x01, 0x26, 0x22, 0x26, 0xA5, 0x26, 0xA3,
-0x26, 0xA3, 0x26, 0xC3, 0x16, 0x81, 0x06, 0x20, 0x0E, 0x02, 0x0C, 0xCA, 0x1C, 0x30, 0x0B, 0x6D,
-0x0B, 0x4B, 0x13, 0x70, 0x1B, 0xB3, 0x1B, 0xD4, 0x1B, 0xB3, 0x1B, 0x97, 0x34, 0x3C, 0x10, 0xC6,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x08, 0x6C, 0x10, 0xB0, 0x20, 0xF1, 0x29, 0x73, 0x29, 0xF4,
-0x29, 0xB4, 0x32, 0x57, 0x32, 0x57, 0x2A, 0x58, 0x41, 0xB1, 0x28, 0xAB, 0x40, 0xCF, 0x50, 0x46,
-0x60, 0x47, 0x70, 0x00, 0x78, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0A, 0xE1, 0x03, 0x20, 0x03, 0xE0, 0x04, 0x40,
-0x04, 0xA0, 0x04, 0xE0, 0x05, 0x01, 0x05, 0x00, 0x05, 0x00, 0x05, 0x20, 0x05, 0x21, 0x04, 0xE2,
-0x02, 0x42, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xCA,
-0x33, 0x72, 0x54, 0x57, 0x65, 0x19, 0x75, 0x9B, 0x85, 0xDC, 0x8E, 0x3D, 0x96, 0x5E, 0x9E, 0x7E,
-0x9E, 0x9F, 0x9E, 0x9F, 0x9E, 0x9F, 0x9E, 0x9F, 0x96, 0x7E, 0x8E, 0x3D, 0x6D, 0x3B, 0x22, 0xF6,
-0x01, 0x6F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0xC0, 0x03, 0x40,
-0x04, 0x40, 0x0C, 0xE1, 0x1D, 0x60, 0x1D, 0xA1, 0x26, 0x01, 0x1E, 0x21, 0x16, 0xA5, 0x1E, 0xA4,
-0x1E, 0xA2, 0x1E, 0xA2, 0x16, 0xA2, 0x06, 0x20, 0x05, 0xE1, 0x0D, 0x0B, 0x24, 0x38, 0x24, 0x38,
-0x0B, 0x54, 0x02, 0x0F, 0x0A, 0x73, 0x1B, 0x36, 0x13, 0x16, 0x0A, 0xD4, 0x12, 0x53, 0x00, 0x00,
-0x00, 0x01, 0x00, 0x05, 0x00, 0x29, 0x10, 0x8F, 0x18, 0xD0, 0x29, 0x52, 0x29, 0x73, 0x29, 0xD3,
-0x29, 0xF4, 0x32, 0x15, 0x32, 0x15, 0x29, 0xD4, 0x32, 0x13, 0x2B, 0x17, 0x49, 0xD0, 0x3A, 0x11,
-0x41, 0x6F, 0x38, 0xAB, 0x48, 0xAE, 0x60, 0x24, 0x70, 0x46, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x60, 0x03, 0x21, 0x03, 0xC0, 0x04, 0x60,
-0x04, 0x80, 0x04, 0xC0, 0x05, 0x01, 0x05, 0x00, 0x05, 0x41, 0x05, 0x62, 0x05, 0x20, 0x05, 0x01,
-0x03, 0xC3, 0x00, 0xA6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x1A, 0x0C,
-0x3B, 0x72, 0x54, 0x57, 0x65, 0x19, 0x75, 0x7B, 0x85, 0xDC, 0x8E, 0x1D, 0xAD, 0x99, 0xCD, 0x13,
-0xD5, 0x11, 0xC5, 0xB5, 0xAE, 0x7D, 0x9E, 0x9F, 0x96, 0x7E, 0x8E, 0x3E, 0x7D, 0x9C, 0x1A, 0x73,
-0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x02, 0x20, 0x03, 0x60,
-0x1C, 0xC6, 0x14, 0xE1, 0x1D, 0x61, 0x25, 0xC2, 0x26, 0x02, 0x26, 0x63, 0x1E, 0x84, 0x26, 0x83,
-0x26, 0xA3, 0x1E, 0xA2, 0x26, 0x84, 0x05, 0xA0, 0x05, 0x60, 0x04, 0xE8, 0x02, 0xB2, 0x01, 0xD1,
-0x01, 0x0D, 0x00, 0x26, 0x00, 0x02, 0x00, 0x48, 0x09, 0xB1, 0x0A, 0x75, 0x00, 0xA7, 0x00, 0x00,
-0x00, 0x03, 0x00, 0x06, 0x08, 0x4B, 0x10, 0xD0, 0x18, 0xD0, 0x21, 0x32, 0x21, 0x93, 0x29, 0xD4,
-0x32, 0x97, 0x29, 0xD5, 0x29, 0xD5, 0x21, 0xB4, 0x2A, 0x55, 0x1B, 0x3B, 0x23, 0x5C, 0x2B, 0xDC,
-0x3B, 0x5A, 0x33, 0x79, 0x51, 0x90, 0x3A, 0x11, 0x41, 0x0E, 0x50, 0x67, 0x60, 0x8A, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x03, 0x20, 0x03, 0xA0, 0x04, 0x20,
-0x04, 0x80, 0x04, 0xC0, 0x05, 0x01, 0x05, 0x00, 0x05, 0x21, 0x05, 0x20, 0x05, 0x00, 0x05, 0x01,
-0x04, 0xA2, 0x1A, 0xCF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1A, 0x4D,
-0x3B, 0x92, 0x5C, 0x77, 0x6D, 0x1A, 0x75, 0x7B, 0x85, 0x9B, 0xC5, 0xDA, 0xF3, 0xC4, 0xFC, 0x00,
-0xFC, 0x60, 0xFC, 0xC1, 0xF4, 0xA6, 0xC5, 0xD6, 0x9E, 0x7E, 0x96, 0x5E, 0x85, 0xDC, 0x3B, 0x34,
-0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0x02, 0x80, 0x03, 0x80,
-0x1C, 0x82, 0x0C, 0xC0, 0x25, 0x61, 0x25, 0xC1, 0x1E, 0x01, 0x2E, 0x84, 0x26, 0x83, 0x26, 0xA3,
-0x1E, 0x23, 0x0C, 0x01, 0x03, 0x22, 0x03, 0x44, 0x03, 0x65, 0x03, 0x65, 0x02, 0x6B, 0x00, 0xAB,
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xAA, 0x00, 0x20, 0x00, 0x01,
-0x00, 0x05, 0x00, 0x08, 0x00, 0x4C, 0x11, 0x10, 0x21, 0x11, 0x21, 0x32, 0x21, 0xB4, 0x2A, 0x14,
-0x29, 0xF4, 0x29, 0xF5, 0x31, 0xF5, 0x21, 0xB4, 0x22, 0x14, 0x1B, 0xDE, 0x0B, 0x5C, 0x13, 0x9C,
-0x13, 0x1B, 0x0A, 0xB9, 0x12, 0x36, 0x12, 0x34, 0x31, 0x70, 0x42, 0x52, 0x50, 0xEB, 0x40, 0xAA,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x02, 0xA0, 0x03, 0x00, 0x03, 0xC0, 0x04, 0x00,
-0x04, 0x80, 0x04, 0xC0, 0x04, 0xE0, 0x05, 0x01, 0x05, 0x00, 0x05, 0x00, 0x05, 0x20, 0x05, 0x00,
-0x04, 0xC2, 0x03, 0x28, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x86, 0x22, 0x6E,
-0x43, 0x93, 0x5C, 0x77, 0x6D, 0x1A, 0x7D, 0x5A, 0xB4, 0x73, 0xF4, 0x6A, 0xFC, 0x20, 0xFC, 0xA0,
-0xFD, 0x00, 0xFD, 0x62, 0xFD, 0x84, 0xFD, 0x04, 0xBD, 0xD7, 0x96, 0x5E, 0x85, 0xFD, 0x7D, 0x9B,
-0x3A, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x01, 0xE2, 0x02, 0xE0, 0x03, 0xA0,
-0x04, 0x80, 0x0C, 0xE0, 0x25, 0x61, 0x25, 0xA1, 0x2E, 0x02, 0x2E, 0x84, 0x26, 0x83, 0x1D, 0x83,
-0x02, 0x61, 0x02, 0xA2, 0x03, 0x24, 0x03, 0x65, 0x03, 0xA6, 0x03, 0xA6, 0x03, 0xC7, 0x01, 0xA4,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x06, 0x00, 0x09, 0x08, 0x6D, 0x10, 0xAF, 0x21, 0x52, 0x19, 0x32, 0x2A, 0x15, 0x21, 0xB4,
-0x2A, 0x35, 0x2A, 0x35, 0x29, 0x94, 0x18, 0xF2, 0x11, 0xF4, 0x34, 0xDE, 0x0B, 0x1B, 0x0A, 0xDB,
-0x02, 0x78, 0x01, 0x73, 0x00, 0x29, 0x00, 0x05, 0x00, 0x25, 0x00, 0x8B, 0x18, 0xEE, 0x21, 0x71,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x02, 0x40, 0x03, 0x60, 0x03, 0xE0, 0x04, 0x20,
-0x04, 0x60, 0x04, 0xA0, 0x04, 0xE0, 0x05, 0x01, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00,
-0x04, 0xE2, 0x04, 0x44, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xA7, 0x22, 0x8F,
-0x43, 0xB4, 0x5C, 0x77, 0x6D, 0x1A, 0x84, 0x13, 0xE3, 0x25, 0xFC, 0x00, 0xFC, 0xC2, 0xFD, 0x43,
-0xFD, 0xA6, 0xFD, 0xE6, 0xFD, 0xC5, 0xFD, 0x84, 0xF4, 0xE6, 0xA6, 0x3B, 0x8E, 0x1D, 0x85, 0xBB,
-0x8E, 0x1D, 0x11, 0x25, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x62, 0x03, 0x40, 0x04, 0x20,
-0x0C, 0xA0, 0x1D, 0x20, 0x25, 0x82, 0x2D, 0xC1, 0x2E, 0x22, 0x2E, 0x64, 0x1D, 0xE3, 0x02, 0x02,
-0x02, 0x62, 0x03, 0x45, 0x14, 0x09, 0x03, 0xE9, 0x24, 0x8D, 0x1C, 0x6C, 0x04, 0x2A, 0x03, 0xA8,
-0x00, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03,
-0x00, 0x08, 0x00, 0x0A, 0x08, 0x8E, 0x10, 0x8F, 0x19, 0x11, 0x19, 0x32, 0x21, 0xB3, 0x29, 0xF4,
-0x32, 0xB6, 0x29, 0xF4, 0x21, 0x33, 0x18, 0xD2, 0x1A, 0x14, 0x13, 0x5B, 0x1B, 0x5A, 0x01, 0xF6,
-0x01, 0x32, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x6A, 0x20, 0x6A,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x02, 0xE0, 0x03, 0x80, 0x03, 0xE0,
-0x04, 0x60, 0x04, 0xA0, 0x04, 0xC0, 0x05, 0x01, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00,
-0x05, 0x01, 0x04, 0xA3, 0x01, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x08, 0x22, 0xD0,
-0x43, 0xD4, 0x5C, 0x97, 0x6C, 0xB7, 0x91, 0x02, 0xFA, 0xE0, 0xFC, 0x21, 0xFD, 0x03, 0xFD, 0x86,
-0xFE, 0x09, 0xFE, 0x2A, 0xFE, 0x28, 0xFD, 0xE5, 0xFD, 0x43, 0xCD, 0x50, 0x8E, 0x3D, 0x85, 0xBC,
-0x9E, 0x5E, 0x43, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE5, 0x02, 0xA2, 0x03, 0x80, 0x04, 0x40,
-0x0C, 0xC0, 0x25, 0x41, 0x25, 0x61, 0x2D, 0xC2, 0x2E, 0x22, 0x1E, 0x22, 0x0A, 0xE3, 0x01, 0x83,
-0x02, 0x83, 0x03, 0x66, 0x14, 0x2B, 0x24, 0x8D, 0x3C, 0xEF, 0x3C, 0xF0, 0x2C, 0xCF, 0x04, 0x09,
-0x02, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x04,
-0x00, 0x08, 0x00, 0x0B, 0x10, 0xAF, 0x10, 0x90, 0x18, 0xF1, 0x19, 0x52, 0x21, 0x93, 0x19, 0x52,
-0x29, 0xD4, 0x21, 0x53, 0x18, 0xB2, 0x18, 0xB2, 0x11, 0xB2, 0x02, 0x36, 0x01, 0x74, 0x00, 0xF0,
-0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x06, 0x38, 0x09,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x02, 0xE0, 0x03, 0x80, 0x04, 0x00,
-0x04, 0x40, 0x04, 0x80, 0x04, 0xE0, 0x04, 0xE1, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00,
-0x04, 0xE0, 0x04, 0xC2, 0x03, 0x22, 0x00, 0x42, 0x00, 0x21, 0x00, 0x04, 0x01, 0x29, 0x2A, 0xD0,
-0x43, 0xD4, 0x5C, 0x77, 0x63, 0x72, 0xB9, 0x00, 0xFA, 0xE0, 0xFC, 0x01, 0xFD, 0x03, 0xFD, 0x86,
-0xFE, 0x4C, 0xFE, 0x6C, 0xFE, 0x28, 0xFE, 0x06, 0xFD, 0x84, 0xF4, 0xE7, 0x9E, 0x3D, 0x8D, 0xFC,
-0x96, 0x5D, 0x6C, 0xD7, 0x00, 0x80, 0x00, 0x80, 0x02, 0x65, 0x02, 0xE1, 0x03, 0xC1, 0x0C, 0x60,
-0x1C, 0xE0, 0x25, 0x41, 0x25, 0x60, 0x1D, 0x60, 0x1D, 0xE1, 0x1D, 0x62, 0x01, 0x03, 0x01, 0xA1,
-0x02, 0xA3, 0x03, 0x46, 0x24, 0x6D, 0x5D, 0x93, 0x86, 0x57, 0x86, 0x58, 0x3D, 0x10, 0x04, 0x2B,
-0x03, 0x88, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x03, 0x00, 0x05,
-0x00, 0x08, 0x00, 0x2C, 0x08, 0x6F, 0x10, 0xB0, 0x19, 0x32, 0x19, 0x53, 0x19, 0x73, 0x11, 0x12,
-0x29, 0x93, 0x29, 0x94, 0x18, 0xF3, 0x10, 0xB1, 0x11, 0x72, 0x01, 0xD4, 0x00, 0xCF, 0x00, 0x28,
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x28, 0x09, 0x70, 0xAE,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x01, 0xC0, 0x02, 0xC0, 0x03, 0x60, 0x03, 0xE0,
-0x04, 0x40, 0x04, 0x80, 0x04, 0xC0, 0x04, 0xE0, 0x04, 0xE1, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00,
-0x05, 0x00, 0x04, 0xE1, 0x04, 0x83, 0x22, 0x28, 0x21, 0xCA, 0x00, 0x45, 0x09, 0x6A, 0x2A, 0xF0,
-0x43, 0xD4, 0x5C, 0x97, 0x62, 0x4C, 0xD1, 0x40, 0xFA, 0xC0, 0xFB, 0xC0, 0xFC, 0xE3, 0xFD, 0x65,
-0xFD, 0xE8, 0xFE, 0x08, 0xFE, 0x07, 0xFD, 0xE5, 0xFD, 0xA4, 0xFC, 0xC3, 0xB5, 0xF8, 0x96, 0x3D,
-0x9E, 0x7E, 0x7D, 0xB9, 0x0A, 0x81, 0x01, 0x20, 0x02, 0xA2, 0x03, 0x21, 0x04, 0x01, 0x14, 0xA1,
-0x2D, 0x01, 0x2D, 0x62, 0x25, 0x40, 0x1D, 0x80, 0x15, 0xE0, 0x13, 0x63, 0x01, 0x02, 0x01, 0xC2,
-0x02, 0x83, 0x0B, 0x46, 0x24, 0x0C, 0x75, 0xB4, 0x8E, 0x57, 0x86, 0x37, 0x1C, 0x8D, 0x14, 0x4C,
-0x03, 0xA8, 0x01, 0x23, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07,
-0x00, 0x0A, 0x00, 0x0C, 0x18, 0xD0, 0x10, 0xB0, 0x19, 0x11, 0x19, 0x32, 0x19, 0x33, 0x19, 0x53,
-0x21, 0x93, 0x21, 0x33, 0x20, 0xF2, 0x21, 0x32, 0x19, 0xB2, 0x01, 0x0F, 0x00, 0x28, 0x00, 0x43,
-0x01, 0x87, 0x0A, 0x8B, 0x0A, 0x8C, 0x01, 0x27, 0x00, 0x02, 0x18, 0x07, 0x50, 0x4C, 0x91, 0x73,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x01, 0xE0, 0x02, 0xC0, 0x03, 0x60, 0x03, 0xE0,
-0x04, 0x20, 0x04, 0x60, 0x04, 0xA0, 0x04, 0xE1, 0x04, 0xE0, 0x04, 0xE0, 0x05, 0x00, 0x04, 0xE0,
-0x04, 0xE0, 0x04, 0xE0, 0x04, 0xC3, 0x34, 0x4C, 0x5C, 0x55, 0x01, 0x08, 0x09, 0xAB, 0x2A, 0xF0,
-0x43, 0x93, 0x4B, 0xD4, 0x59, 0x26, 0xC9, 0x40, 0xFA, 0xC0, 0xFB, 0xA0, 0xFC, 0xC3, 0xFD, 0x24,
-0xFD, 0xA6, 0xFD, 0xE8, 0xFD, 0xE6, 0xFD, 0xC4, 0xFD, 0x63, 0xFC, 0xE3, 0xD5, 0x50, 0x96, 0x5D,
-0x9E, 0x9E, 0x7E, 0x17, 0x1C, 0x42, 0x01, 0xC0, 0x02, 0xE1, 0x03, 0x81, 0x0C, 0x42, 0x24, 0xA1,
-0x25, 0x01, 0x24, 0xE0, 0x14, 0xC0, 0x0C, 0x80, 0x15, 0x00, 0x01, 0x63, 0x08, 0xC1, 0x01, 0xA1,
-0x02, 0x83, 0x03, 0x46, 0x13, 0xCA, 0x4C, 0xF0, 0x45, 0x10, 0x34, 0xAE, 0x04, 0x0A, 0x04, 0x0A,
-0x03, 0xA8, 0x0A, 0x26, 0x00, 0x00, 0x00, 0x60, 0x00, 0x20, 0x00, 0x01, 0x00, 0x05, 0x00, 0x07,
-0x00, 0x0B, 0x00, 0x4D, 0x10, 0x6F, 0x10, 0xD1, 0x10, 0xD1, 0x10, 0xD1, 0x19, 0x12, 0x19, 0x53,
-0x18, 0xF3, 0x20, 0xF2, 0x18, 0xB2, 0x18, 0xB1, 0x11, 0x50, 0x00, 0xAD, 0x13, 0x70, 0x2E, 0xD9,
-0x47, 0xFD, 0x67, 0xFF, 0x67, 0xFF, 0x4F, 0xBE, 0x2D, 0x17, 0x39, 0x2F, 0x71, 0x0F, 0xAA, 0x15,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x02, 0x20, 0x02, 0xC0, 0x03, 0x60, 0x03, 0xC0,
-0x04, 0x20, 0x04, 0xA0, 0x04, 0xA0, 0x04, 0xE1, 0x04, 0xE0, 0x05, 0x01, 0x04, 0xE0, 0x04, 0xE0,
-0x04, 0xE0, 0x04, 0xE0, 0x04, 0xE1, 0x24, 0x86, 0x7D, 0x99, 0x32, 0xCF, 0x09, 0x89, 0x09, 0x47,
-0x08, 0xA4, 0x08, 0x83, 0x48, 0x20, 0xC0, 0xC0, 0xFA, 0x80, 0xFB, 0x80, 0xFC, 0x82, 0xFD, 0x03,
-0xFD, 0x64, 0xFD, 0xA5, 0xFD, 0xC5, 0xFD, 0xA3, 0xFD, 0x21, 0xFC, 0xE2, 0xEC, 0xEA, 0xA6, 0x7E,
-0xA6, 0xDF, 0x5D, 0x93, 0x1D, 0x61, 0x03, 0x00, 0x03, 0x21, 0x03, 0xC2, 0x0C, 0x41, 0x24, 0x81,
-0x1C, 0x00, 0x02, 0x60, 0x00, 0xC0, 0x00, 0x60, 0x00, 0xE0, 0x08, 0x83, 0x10, 0x80, 0x01, 0x81,
-0x02, 0x43, 0x03, 0x26, 0x0B, 0xA8, 0x2C, 0x6D, 0x3C, 0xEF, 0x0C, 0x2A, 0x0C, 0x2A, 0x14, 0x4B,
-0x03, 0x68, 0x09, 0xE5, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x08,
-0x00, 0x0B, 0x00, 0x4E, 0x10, 0xAF, 0x10, 0x90, 0x10, 0xD0, 0x11, 0x11, 0x19, 0x12, 0x18, 0xF2,
-0x18, 0xD1, 0x20, 0xD2, 0x18, 0xB2, 0x18, 0xB1, 0x11, 0x6F, 0x24, 0xF4, 0x37, 0xBB, 0x57, 0xFE,
-0x6F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x77, 0xFF, 0x7F, 0xFF, 0x66, 0x9C, 0x8A, 0x55, 0xBA, 0x57,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x02, 0xA0, 0x03, 0x60, 0x03, 0xC0,
-0x04, 0x20, 0x04, 0xC1, 0x04, 0xE1, 0x04, 0xC0, 0x04, 0xE0, 0x04, 0xE0, 0x05, 0x01, 0x04, 0xE0,
-0x04, 0xE0, 0x04, 0xE0, 0x04, 0xC0, 0x04, 0x21, 0x4C, 0x51, 0x3A, 0xCF, 0x00, 0x21, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0xB8, 0xA0, 0xF2, 0x20, 0xFB, 0x20, 0xFC, 0x01, 0xFC, 0xA2,
-0xFD, 0x03, 0xFD, 0x64, 0xFD, 0x64, 0xFD, 0x43, 0xFD, 0x22, 0xFD, 0x02, 0xFC, 0x84, 0xB6, 0x9D,
-0xA6, 0xBE, 0x3B, 0xCD, 0x25, 0xA2, 0x0C, 0x01, 0x03, 0x61, 0x03, 0xA0, 0x13, 0xE1, 0x0B, 0x00,
-0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x83, 0x10, 0x21, 0x18, 0xA1, 0x09, 0x61,
-0x02, 0x02, 0x02, 0xC5, 0x0B, 0x47, 0x0B, 0xC9, 0x0B, 0xE9, 0x1C, 0x4B, 0x14, 0x8C, 0x14, 0x2B,
-0x03, 0x67, 0x02, 0x25, 0x00, 0xA0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x09,
-0x00, 0x0B, 0x00, 0x2D, 0x08, 0x4E, 0x10, 0xB0, 0x10, 0xD0, 0x11, 0x11, 0x08, 0xF1, 0x10, 0xD1,
-0x18, 0xB2, 0x20, 0xF2, 0x18, 0x91, 0x10, 0xB0, 0x0B, 0x0E, 0x3F, 0x7A, 0x4F, 0xFE, 0x6F, 0xFF,
-0x7F, 0xFF, 0x87, 0xFF, 0x87, 0xFF, 0x8F, 0xFF, 0x8F, 0xFF, 0x87, 0xFF, 0x9D, 0x1B, 0xC2, 0xB9,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xE0, 0x02, 0xA0, 0x03, 0x60, 0x03, 0xA0,
-0x04, 0x00, 0x04, 0x40, 0x04, 0x80, 0x04, 0xC0, 0x04, 0xE0, 0x04, 0xE0, 0x04, 0xE0, 0x05, 0x00,
-0x04, 0xE0, 0x04, 0xE0, 0x04, 0xC0, 0x04, 0x20, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x08, 0x00, 0x58, 0x00, 0xC0, 0xE0, 0xF2, 0x00, 0xFA, 0xE0, 0xFB, 0x80, 0xFC, 0x41,
-0xFC, 0xA2, 0xFD, 0x03, 0xFD, 0x23, 0xFD, 0x23, 0xFD, 0x22, 0xFD, 0x24, 0xFC, 0x82, 0xCD, 0xF6,
-0x85, 0xBA, 0x2A, 0x4A, 0x1C, 0x81, 0x15, 0x21, 0x03, 0xA0, 0x02, 0xE0, 0x02, 0x40, 0x00, 0xE0,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xA4, 0x18, 0x20, 0x21, 0x43, 0x01, 0x41,
-0x01, 0xC2, 0x02, 0x84, 0x02, 0xC5, 0x0B, 0xA8, 0x0B, 0xEA, 0x14, 0x2A, 0x03, 0xE8, 0x03, 0x87,
-0x03, 0x47, 0x02, 0xA6, 0x00, 0xA0, 0x00, 0x20, 0x00, 0x01, 0x00, 0x05, 0x00, 0x08, 0x00, 0x0B,
-0x00, 0x2C, 0x08, 0x2D, 0x08, 0x6F, 0x10, 0x8F, 0x10, 0xD1, 0x10, 0xF1, 0x10, 0xF2, 0x10, 0xB2,
-0x18, 0x91, 0x20, 0xB2, 0x18, 0x91, 0x09, 0xAC, 0x1E, 0x15, 0x37, 0x9B, 0x5F, 0xFE, 0x77, 0xFF,
-0x8F, 0xFF, 0x9F, 0xFF, 0xA7, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x97, 0xFF, 0x97, 0x3E, 0xCB, 0x3B,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x01, 0xC0, 0x02, 0x80, 0x03, 0x40, 0x03, 0x80,
-0x04, 0x00, 0x04, 0x40, 0x04, 0x80, 0x04, 0xA0, 0x04, 0xE1, 0x05, 0x02, 0x04, 0xE0, 0x04, 0xE0,
-0x04, 0xE0, 0x04, 0xE0, 0x04, 0xC0, 0x04, 0x20, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x10, 0x00, 0x68, 0x00, 0xC9, 0x00, 0xF2, 0x20, 0xFA, 0xE0, 0xFB, 0x60, 0xFC, 0x00,
-0xFC, 0x82, 0xFC, 0xE2, 0xFD, 0x23, 0xFD, 0x43, 0xFD, 0x23, 0xFD, 0x03, 0xFC, 0xA2, 0xDC, 0x8B,
-0x6C, 0xD7, 0x21, 0x88, 0x02, 0x40, 0x15, 0x00, 0x03, 0xC0, 0x02, 0x40, 0x00, 0xE0, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0x62, 0x20, 0x20, 0x18, 0xA0, 0x01, 0x41,
-0x01, 0xE2, 0x02, 0x63, 0x02, 0xE5, 0x0B, 0x46, 0x0C, 0x08, 0x03, 0x86, 0x03, 0x86, 0x03, 0x45,
-0x03, 0x46, 0x0B, 0x49, 0x00, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
-0x00, 0x0D, 0x00, 0x2D, 0x08, 0x6F, 0x10, 0x8F, 0x10, 0xB1, 0x10, 0xB0, 0x10, 0xD1, 0x08, 0x71,
-0x21, 0x12, 0x20, 0xF2, 0x10, 0xCE, 0x0B, 0xCD, 0x1E, 0xD8, 0x3F, 0xDC, 0x5F, 0xFF, 0x77, 0xFF,
-0x97, 0xFF, 0xB7, 0xFF, 0xC7, 0xFF, 0xBF, 0xFF, 0x9F, 0xFF, 0x8F, 0xFF, 0x87, 0xDF, 0xCC, 0x1C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x01, 0xC0, 0x02, 0x80, 0x03, 0x20, 0x03, 0x80,
-0x03, 0xE0, 0x04, 0x20, 0x04, 0x80, 0x04, 0xA0, 0x04, 0xE2, 0x05, 0x02, 0x04, 0xE0, 0x04, 0xE0,
-0x04, 0xE0, 0x04, 0xC0, 0x04, 0xC0, 0x04, 0x20, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x20, 0x00, 0x70, 0x00, 0xC9, 0x20, 0xF2, 0x20, 0xFA, 0xE0, 0xFB, 0x60, 0xFB, 0xE0,
-0xFC, 0x82, 0xFC, 0xE3, 0xFD, 0x23, 0xFD, 0x24, 0xFD, 0x23, 0xFD, 0x02, 0xFC, 0xE2, 0xEC, 0x24,
-0x74, 0x95, 0x19, 0x26, 0x01, 0x00, 0x02, 0xE0, 0x03, 0x60, 0x01, 0x40, 0x00, 0x20, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x62, 0x18, 0x20, 0x20, 0x40, 0x10, 0xC0, 0x01, 0x61,
-0x01, 0xE2, 0x02, 0x63, 0x02, 0xC4, 0x03, 0x05, 0x03, 0x66, 0x03, 0x86, 0x03, 0x65, 0x03, 0x66,
-0x03, 0x66, 0x03, 0x28, 0x00, 0x81, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x00, 0x07, 0x00, 0x0A,
-0x00, 0x0C, 0x08, 0x4D, 0x10, 0x6F, 0x08, 0x4F, 0x08, 0x90, 0x08, 0xB0, 0x10, 0xD1, 0x10, 0x70,
-0x21, 0x33, 0x18, 0xF1, 0x01, 0x47, 0x15, 0x52, 0x2F, 0x5A, 0x3F, 0xFD, 0x57, 0xFE, 0x77, 0xFF,
-0x97, 0xFF, 0xBF, 0xFF, 0xCF, 0xFF, 0xC7, 0xFF, 0x9F, 0xFF, 0x8F, 0xFF, 0x77, 0xFF, 0xC5, 0x1D,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x01, 0xC0, 0x02, 0xA0, 0x03, 0x20, 0x03, 0x80,
-0x03, 0xC1, 0x04, 0x06, 0x04, 0x48, 0x04, 0x86, 0x04, 0xC1, 0x04, 0xE1, 0x04, 0xC0, 0x04, 0xE0,
-0x04, 0xE0, 0x04, 0xC0, 0x04, 0xA0, 0x04, 0x40, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x28, 0x00, 0x80, 0x00, 0xD1, 0x40, 0xFA, 0x40, 0xFA, 0xC0, 0xFB, 0x60, 0xFC, 0x00,
-0xFC, 0x62, 0xFC, 0xC2, 0xFD, 0x03, 0xFD, 0x23, 0xFD, 0x24, 0xFD, 0x03, 0xFC, 0xE2, 0xFC, 0x22,
-0x8B, 0xF0, 0x10, 0xC5, 0x00, 0xA0, 0x01, 0x00, 0x01, 0xA0, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x20, 0x00, 0x28, 0x60, 0x10, 0xE0, 0x01, 0x81,
-0x02, 0x02, 0x02, 0x64, 0x02, 0xC4, 0x02, 0xE4, 0x02, 0xE4, 0x03, 0x46, 0x03, 0x66, 0x03, 0x66,
-0x03, 0x46, 0x0B, 0x89, 0x00, 0xA2, 0x00, 0x02, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0B,
-0x00, 0x0C, 0x00, 0x2D, 0x08, 0x2D, 0x08, 0x6F, 0x08, 0x90, 0x08, 0x6F, 0x08, 0x90, 0x10, 0x50,
-0x21, 0x12, 0x11, 0x0C, 0x02, 0x66, 0x0D, 0x52, 0x2F, 0x5A, 0x3F, 0xFD, 0x57, 0xFE, 0x6F, 0xFF,
-0x87, 0xFF, 0x9F, 0xFF, 0xA7, 0xFF, 0x9F, 0xFF, 0x97, 0xFF, 0x87, 0xFF, 0x77, 0xFF, 0xC5, 0x7E,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x01, 0xC0, 0x02, 0xA0, 0x03, 0x00, 0x03, 0x0A,
-0x12, 0xF8, 0x2B, 0x5E, 0x3B, 0x9F, 0x3B, 0xDE, 0x2B, 0xF9, 0x1C, 0xCC, 0x04, 0xC1, 0x04, 0xE0,
-0x04, 0xE0, 0x04, 0xE0, 0x04, 0xC0, 0x04, 0x60, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x38, 0x00, 0x90, 0x20, 0xD1, 0x20, 0xFA, 0x40, 0xFA, 0xE0, 0xFB, 0x60, 0xFC, 0x01,
-0xFC, 0x62, 0xFC, 0xC2, 0xFD, 0x03, 0xFD, 0x23, 0xFD, 0x24, 0xFD, 0x23, 0xFC, 0xE3, 0xFC, 0x62,
-0xB3, 0x69, 0x10, 0xA4, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x18, 0x21, 0x28, 0x00, 0x20, 0x80, 0x09, 0x20, 0x01, 0xA1,
-0x02, 0x43, 0x02, 0x63, 0x02, 0xA4, 0x02, 0xE5, 0x03, 0x04, 0x03, 0x45, 0x03, 0x66, 0x03, 0x86,
-0x03, 0x47, 0x02, 0xE7, 0x00, 0xA2, 0x00, 0x03, 0x00, 0x05, 0x00, 0x07, 0x00, 0x09, 0x00, 0x0B,
-0x08, 0x2D, 0x08, 0x4E, 0x08, 0x8E, 0x08, 0x6E, 0x08, 0x2D, 0x00, 0x2A, 0x00, 0x08, 0x08, 0x0A,
-0x18, 0xAD, 0x01, 0x85, 0x03, 0xCC, 0x15, 0x93, 0x2F, 0x39, 0x47, 0xFD, 0x67, 0xFF, 0x6F, 0xFF,
-0x87, 0xFF, 0x8F, 0xFF, 0x8F, 0xFF, 0x97, 0xFF, 0x8F, 0xFF, 0x7F, 0xFF, 0x6F, 0xFF, 0xCD, 0x3D,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x01, 0xC0, 0x02, 0x80, 0x0A, 0x6D, 0x2A, 0xDB,
-0x33, 0x5F, 0x3B, 0xBF, 0x4B, 0xFF, 0x4C, 0x5F, 0x4C, 0x3F, 0x54, 0x5F, 0x1C, 0x8E, 0x04, 0xE1,
-0x04, 0xE0, 0x04, 0xE0, 0x04, 0xC0, 0x04, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x08, 0x00, 0x48, 0x00, 0x98, 0x40, 0xD9, 0x60, 0xF2, 0x20, 0xFA, 0xE0, 0xFB, 0x60, 0xFB, 0xE0,
-0xFC, 0x62, 0xFC, 0xA2, 0xFC, 0xE3, 0xFD, 0x03, 0xFD, 0x23, 0xFD, 0x23, 0xFC, 0xE3, 0xFC, 0xA2,
-0xDB, 0x84, 0x18, 0x62, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x10, 0x42, 0x20, 0x00, 0x28, 0x20, 0x20, 0xA0, 0x01, 0x40, 0x01, 0x81,
-0x02, 0x43, 0x02, 0x84, 0x02, 0xC4, 0x02, 0xE5, 0x03, 0x25, 0x03, 0x45, 0x03, 0x66, 0x03, 0x87,
-0x0B, 0xE9, 0x03, 0x07, 0x00, 0xE4, 0x00, 0x04, 0x00, 0x06, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B,
-0x08, 0x2D, 0x08, 0x2D, 0x00, 0x2C, 0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xC3, 0x0B, 0x29, 0x0C, 0xD0, 0x1D, 0xF5, 0x2F, 0x19, 0x3F, 0xDC, 0x57, 0xFE, 0x67, 0xFF,
-0x77, 0xFF, 0x87, 0xFF, 0x87, 0xFF, 0x8F, 0xFF, 0x87, 0xFF, 0x6F, 0xFF, 0x67, 0xFF, 0xD5, 0x1E,
-0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0xA0, 0x01, 0xC5, 0x22, 0x79, 0x33, 0x3E,
-0x3B, 0x9F, 0x4C, 0x5F, 0x54, 0x9F, 0x54, 0x9F, 0x5C, 0xBF, 0x54, 0x9F, 0x54, 0x3F, 0x14, 0x8B,
-0x04, 0xE1, 0x04, 0xE0, 0x04, 0xC0, 0x04, 0x80, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x10, 0x00, 0x58, 0x00, 0xA8, 0x80, 0xE1, 0x80, 0xFA, 0x40, 0xFA, 0xE0, 0xFB, 0x60, 0xFB, 0xC0,
-0xFC, 0x41, 0xFC, 0xA2, 0xFC, 0xE3, 0xFD, 0x03, 0xFD, 0x23, 0xFD, 0x23, 0xFC, 0xE3, 0xFC, 0xA2,
-0xFB, 0xE1, 0x30, 0x60, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x18, 0x42, 0x30, 0x20, 0x28, 0x20, 0x18, 0xC0, 0x01, 0x61, 0x01, 0xA1,
-0x02, 0x23, 0x02, 0x84, 0x02, 0xC4, 0x03, 0x05, 0x03, 0x05, 0x03, 0x45, 0x03, 0x66, 0x0B, 0xE9,
-0x0C, 0x2B, 0x03, 0x27, 0x01, 0x46, 0x00, 0x07, 0x00, 0x09, 0x08, 0x2B, 0x00, 0x0B, 0x00, 0x0B,
-0x00, 0x0C, 0x00, 0x0B, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-0x01, 0xE5, 0x0B, 0xCD, 0x15, 0x73, 0x2E, 0xD8, 0x37, 0x5A, 0x47, 0xDC, 0x57, 0xFD, 0x5F, 0xFF,
-0x6F, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x6F, 0xFF, 0x67, 0xFF, 0x6F, 0xFF, 0xDC, 0xFE,
-0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x01, 0x0B, 0x22, 0xBC, 0x3B, 0x9F,
-0x44, 0x1F, 0x54, 0x9F, 0x65, 0x1F, 0x65, 0x1F, 0x6D, 0x5F, 0x65, 0x1F, 0x64, 0x5F, 0x4C, 0x1B,
-0x04, 0xC4, 0x04, 0xE1, 0x04, 0xE0, 0x04, 0xA0, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x18, 0x00, 0x89, 0x21, 0xB0, 0x80, 0xE1, 0x80, 0xFA, 0x60, 0xFA, 0xE0, 0xFB, 0x60, 0xFB, 0xE1,
-0xFC, 0x62, 0xFC, 0xA2, 0xFC, 0xE3, 0xFD, 0x03, 0xFD, 0x23, 0xFD, 0x23, 0xFD, 0x03, 0xFC, 0xA2,
-0xFC, 0x01, 0x71, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x08, 0x21, 0x20, 0x00, 0x30, 0x00, 0x28, 0x80, 0x10, 0xE0, 0x01, 0x61, 0x01, 0xC2,
-0x02, 0x43, 0x02, 0x84, 0x02, 0xE5, 0x03, 0x05, 0x03, 0x25, 0x03, 0x46, 0x03, 0x87, 0x0B, 0xE9,
-0x0B, 0xCA, 0x02, 0xE6, 0x02, 0x09, 0x00, 0x4A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0B,
-0x00, 0x09, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42,
-0x0B, 0x2A, 0x0C, 0xD1, 0x1E, 0x15, 0x26, 0x98, 0x37, 0x5B, 0x47, 0xDC, 0x57, 0xFD, 0x5F, 0xFE,
-0x5F, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x5F, 0xFF, 0x6F, 0xDE, 0xE4, 0xBE,
-0x08, 0x62, 0x00, 0x61, 0x00, 0x00, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xCF, 0x22, 0xBC, 0x3B, 0x9F,
-0x44, 0x3F, 0x5C, 0xDF, 0x7D, 0xDF, 0xA6, 0xBF, 0x8E, 0x1F, 0x65, 0x1F, 0x64, 0x9F, 0x64, 0x1F,
-0x24, 0x4F, 0x04, 0xE1, 0x04, 0xE0, 0x05, 0x01, 0x03, 0xA1, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x20, 0x00, 0x80, 0xC0, 0xB8, 0xA0, 0xE1, 0x80, 0xFA, 0x60, 0xFA, 0xE0, 0xFB, 0x60, 0xFB, 0xC1,
-0xFC, 0x62, 0xFC, 0x82, 0xFC, 0xE3, 0xFD, 0x03, 0xFD, 0x04, 0xFD, 0x04, 0xFD, 0x03, 0xFC, 0xC3,
-0xFC, 0x42, 0xBA, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x10, 0x21, 0x30, 0x00, 0x38, 0x40, 0x28, 0xA0, 0x10, 0xE0, 0x01, 0x61, 0x02, 0x02,
-0x02, 0x43, 0x02, 0x84, 0x02, 0xC5, 0x03, 0x26, 0x03, 0x26, 0x0B, 0x88, 0x1C, 0x8D, 0x14, 0x8C,
-0x0C, 0x2A, 0x02, 0xE5, 0x1A, 0xEB, 0x2A, 0x33, 0x10, 0xCD, 0x08, 0x0B, 0x00, 0x0A, 0x00, 0x09,
-0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x02, 0x05,
-0x0C, 0x2E, 0x15, 0x73, 0x2E, 0xB8, 0x2F, 0x3A, 0x3F, 0x7B, 0x4F, 0xFD, 0x57, 0xFE, 0x57, 0xFE,
-0x5F, 0xFE, 0x67, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x5F, 0xFF, 0x67, 0xFF, 0x7F, 0xDF, 0xEC, 0x9E,
-0x08, 0xA3, 0x00, 0xA1, 0x01, 0x00, 0x00, 0x40, 0x00, 0xE5, 0x09, 0x11, 0x1A, 0x9B, 0x33, 0x5F,
-0x43, 0xFF, 0x5C, 0xDF, 0x8E, 0x3F, 0xAE, 0xBF, 0x8D, 0xFF, 0x6D, 0x3F, 0x5C, 0xDF, 0x64, 0x5F,
-0x5B, 0xFB, 0x04, 0xC3, 0x05, 0x02, 0x05, 0x64, 0x04, 0x82, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00,
-0x28, 0x00, 0x78, 0x00, 0xB8, 0xC0, 0xE9, 0xA0, 0xFA, 0x60, 0xFA, 0xC0, 0xFB, 0x40, 0xFB, 0xC0,
-0xFC, 0x41, 0xFC, 0x82, 0xFD, 0x03, 0xFC, 0xE3, 0xFD, 0x03, 0xFD, 0x03, 0xFD, 0x03, 0xFC, 0xE3,
-0xFC, 0x82, 0xEB, 0x62, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x28, 0x21, 0x38, 0x00, 0x38, 0x40, 0x20, 0xC0, 0x09, 0x00, 0x01, 0xA1, 0x02, 0x02,
-0x13, 0x48, 0x02, 0xA5, 0x02, 0xC5, 0x0B, 0x87, 0x2D, 0x2E, 0x3D, 0xF1, 0x35, 0xB1, 0x24, 0xCE,
-0x03, 0x67, 0x02, 0xE5, 0x1B, 0x2A, 0x64, 0x1A, 0x42, 0xD5, 0x19, 0x2F, 0x08, 0x2B, 0x00, 0x08,
-0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0xA4, 0x03, 0x09,
-0x0C, 0xB1, 0x1D, 0xD5, 0x2E, 0xD9, 0x37, 0x7A, 0x47, 0xBB, 0x57, 0xFD, 0x57, 0xFE, 0x5F, 0xFE,
-0x5F, 0xFF, 0x5F, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x5F, 0xFF, 0x7F, 0xBE, 0xF4, 0x7E,
-0x00, 0x62, 0x00, 0x20, 0x02, 0x00, 0x01, 0xE0, 0x08, 0xA4, 0x09, 0x72, 0x1A, 0x9A, 0x33, 0x3F,
-0x3B, 0xDF, 0x4C, 0x3F, 0x6D, 0x3F, 0x7D, 0x9F, 0x75, 0x5F, 0x64, 0xFF, 0x5C, 0x9F, 0x54, 0x3F,
-0x6B, 0xDF, 0x24, 0xAF, 0x05, 0xC6, 0x05, 0x84, 0x04, 0x40, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
-0x38, 0x00, 0x88, 0x20, 0xC0, 0xC0, 0xE9, 0xA0, 0xFA, 0x60, 0xFA, 0xE0, 0xFB, 0x20, 0xFB, 0xA0,
-0xFC, 0x00, 0xFC, 0x61, 0xFC, 0xC2, 0xFC, 0xE3, 0xFD, 0x03, 0xFD, 0x03, 0xFD, 0x03, 0xFC, 0xE3,
-0xFC, 0xA2, 0xFC, 0x01, 0x50, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x10, 0x00, 0x38, 0x00, 0x40, 0x00, 0x38, 0x40, 0x18, 0xA0, 0x09, 0x20, 0x01, 0xA1, 0x02, 0x03,
-0x02, 0x64, 0x0B, 0x27, 0x13, 0x89, 0x1C, 0x0B, 0x1B, 0xEB, 0x24, 0x6B, 0x0C, 0x0A, 0x03, 0x66,
-0x03, 0x25, 0x03, 0x05, 0x0A, 0x87, 0x4A, 0xB4, 0x6B, 0xF9, 0x42, 0xB4, 0x29, 0xD0, 0x10, 0x8A,
-0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x02, 0x25, 0x04, 0x0D,
-0x15, 0x73, 0x26, 0x56, 0x37, 0x39, 0x3F, 0x9B, 0x4F, 0xDC, 0x57, 0xFD, 0x57, 0xFE, 0x57, 0xFE,
-0x5F, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x5F, 0xFF, 0x7F, 0x7E, 0xF4, 0x7F,
-0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x04, 0x00, 0x01, 0x01, 0x09, 0x10, 0x1A, 0x79, 0x2B, 0x3E,
-0x3B, 0x9F, 0x43, 0xFF, 0x54, 0x7F, 0x6D, 0x1F, 0x75, 0x5F, 0x64, 0xFF, 0x54, 0x7F, 0x4C, 0x3F,
-0x6B, 0xFF, 0x53, 0xFA, 0x0D, 0x87, 0x04, 0xA1, 0x03, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00,
-0x40, 0x00, 0x90, 0x20, 0xC8, 0xE0, 0xE9, 0xC0, 0xFA, 0x60, 0xFA, 0xE0, 0xFB, 0x20, 0xFB, 0x80,
-0xFC, 0x21, 0xFC, 0x82, 0xFC, 0xC3, 0xFC, 0xE3, 0xFD, 0x04, 0xFD, 0x05, 0xFD, 0x04, 0xFC, 0xE3,
-0xFC, 0xC3, 0xFC, 0x42, 0xDA, 0xE1, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x30, 0x00, 0x40, 0x00, 0x40, 0x00, 0x30, 0x60, 0x18, 0xC0, 0x09, 0x20, 0x01, 0xA2, 0x02, 0x23,
-0x02, 0x43, 0x02, 0x84, 0x34, 0x8D, 0x24, 0xAE, 0x0B, 0x46, 0x03, 0x46, 0x03, 0x65, 0x03, 0x45,
-0x03, 0x25, 0x02, 0xE5, 0x0A, 0x86, 0x10, 0x68, 0x30, 0xEE, 0x41, 0xD2, 0x31, 0x90, 0x18, 0xAB,
-0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x01, 0x84, 0x03, 0x09, 0x0C, 0xD0,
-0x1D, 0xD5, 0x2E, 0xB8, 0x3F, 0x5A, 0x3F, 0xBB, 0x57, 0xFD, 0x57, 0xFD, 0x5F, 0xFE, 0x5F, 0xFE,
-0x5F, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x5F, 0xFF, 0x57, 0xFE, 0x8F, 0x3E, 0xFC, 0x7F,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x40, 0x00, 0x80, 0x00, 0xCD, 0x12, 0x37, 0x22, 0xFD,
-0x33, 0x5F, 0x43, 0xDF, 0x4C, 0x1F, 0x4C, 0x3F, 0x5C, 0x9F, 0x64, 0xBF, 0x5C, 0x9F, 0x4C, 0x1F,
-0x63, 0xDF, 0x6B, 0x9F, 0x1B, 0xE9, 0x04, 0x20, 0x03, 0x40, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00,
-0x48, 0x00, 0x98, 0x40, 0xC9, 0x00, 0xE9, 0xC0, 0xFA, 0x60, 0xFA, 0xC0, 0xFB, 0x20, 0xFB, 0x60,
-0xFC, 0x21, 0xFC, 0x82, 0xFC, 0xC6, 0xFD, 0x31, 0xFD, 0x78, 0xFD, 0xBA, 0xFD, 0xD7, 0xFD, 0x4F,
-0xFC, 0xE5, 0xFC, 0x63, 0xFB, 0xC2, 0xB2, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-0x40, 0x00, 0x48, 0x00, 0x40, 0x00, 0x30, 0x80, 0x10, 0xE0, 0x09, 0xC3, 0x01, 0xA2, 0x02, 0x03,
-0x02, 0x43, 0x02, 0xA4, 0x0A, 0xE6, 0x1B, 0xCA, 0x03, 0x05, 0x03, 0x25, 0x03, 0x45, 0x03, 0x46,
-0x0B, 0x26, 0x52, 0xC4, 0x92, 0xE4, 0xA2, 0x43, 0x79, 0x23, 0x40, 0x46, 0x18, 0x27, 0x10, 0x26,
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x43, 0x02, 0x47, 0x04, 0x0D, 0x15, 0x53,
-0x26, 0x56, 0x2F, 0x19, 0x3F, 0x9B, 0x47, 0xDC, 0x57, 0xFD, 0x57, 0xDD, 0x5F, 0xFE, 0x5F, 0xFE,
-0x5F, 0xFE, 0x67, 0xFF, 0x67, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0x57, 0xFE, 0x9E, 0xFE, 0xFC, 0xBF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x89, 0x33, 0x19, 0x1A, 0x9A,
-0x2B, 0x3E, 0x4B, 0x5E, 0x43, 0xBF, 0x43, 0xFF, 0x44, 0x1F, 0x4C, 0x1F, 0x44, 0x1F, 0x44, 0x1F,
-0x53, 0xDF, 0x73, 0xBF, 0x4B, 0x37, 0x04, 0x00, 0x03, 0x40, 0x00, 0x40, 0x00, 0x00, 0x18, 0x00,
-0x58, 0x00, 0xA0, 0x40, 0xD1, 0x20, 0xE9, 0xC0, 0xFA, 0x60, 0xFA, 0xE0, 0xFB, 0x20, 0xFB, 0x60,
-0xFC, 0x01, 0xFC, 0x29, 0xFC, 0xFA, 0xFD, 0xBE, 0xFE, 0x1F, 0xFE, 0x7F, 0xFE, 0xBF, 0xFE, 0xBF,
-0xFD, 0xD8, 0xFC, 0xA8, 0xFB, 0xE3, 0xFB, 0xE2, 0x38, 0x80, 0x00, 0x20, 0x00, 0x00, 0x30, 0x20,
-0x50, 0x00, 0x48, 0x00, 0x40, 0x81, 0x28, 0xC0, 0x11, 0x00, 0x01, 0x61, 0x01, 0xC2, 0x02, 0x23,
-0x02, 0x63, 0x0A, 0xE5, 0x24, 0xCD, 0x1C, 0x0B, 0x03, 0x25, 0x03, 0x25, 0x03, 0x46, 0x4B, 0x06,
-0xD3, 0x65, 0xFC, 0x01, 0xFC, 0xA2, 0xFC, 0xE2, 0xFC, 0xE2, 0xFC, 0x62, 0x99, 0xC1, 0x10, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x01, 0xC5, 0x03, 0x2A, 0x0C, 0xD0, 0x1D, 0xD4,
-0x2E, 0xB8, 0x37, 0x5A, 0x47, 0xBC, 0x4F, 0xFC, 0x57, 0xFD, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE,
-0x5F, 0xFE, 0x67, 0xFF, 0x67, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0x57, 0xFE, 0xA6, 0xDE, 0xFC, 0xDF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x11, 0xB3, 0x12, 0x39,
-0x22, 0xDD, 0x33, 0x1E, 0x3B, 0x7F, 0x3B, 0xBF, 0x43, 0xDF, 0x43, 0xFF, 0x44, 0x1F, 0x4C, 0x1F,
-0x4B, 0xFF, 0x6B, 0xDF, 0x73, 0x5E, 0x13, 0xA7, 0x03, 0x00, 0x00, 0x20, 0x08, 0x42, 0x20, 0x00,
-0x60, 0x00, 0xA8, 0x60, 0xD1, 0x20, 0xF1, 0xE0, 0xFA, 0x60, 0xFA, 0xE0, 0xFB, 0x20, 0xFB, 0x60,
-0xEB, 0x64, 0xF4, 0x37, 0xFD, 0xBE, 0xFE, 0x3F, 0xFE, 0xBF, 0xFE, 0xFF, 0xFF, 0x3F, 0xFF, 0x1F,
-0xFF, 0x1F, 0xFD, 0xFB, 0xFC, 0x8A, 0xFC, 0x23, 0x9A, 0x21, 0x11, 0x63, 0x08, 0x00, 0x48, 0x00,
-0x50, 0x00, 0x48, 0x00, 0x48, 0xC2, 0x28, 0xC0, 0x09, 0x00, 0x01, 0x60, 0x01, 0xC2, 0x02, 0x23,
-0x02, 0x63, 0x02, 0x23, 0x02, 0x23, 0x0B, 0x26, 0x03, 0x05, 0x03, 0x25, 0x52, 0x85, 0xEA, 0xE3,
-0xFC, 0x22, 0xFC, 0xC2, 0xFD, 0x64, 0xFD, 0xA4, 0xFD, 0xC5, 0xFD, 0xA3, 0xFD, 0x64, 0xAA, 0x62,
-0x08, 0x00, 0x00, 0x00, 0x00, 0x61, 0x01, 0x63, 0x02, 0x67, 0x04, 0x0E, 0x15, 0x32, 0x26, 0x36,
-0x2E, 0xF9, 0x37, 0x1A, 0x3F, 0x1B, 0x4F, 0xDD, 0x57, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE,
-0x67, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x67, 0xFF, 0x5F, 0xFF, 0x4F, 0xFE, 0xBE, 0xBE, 0xFD, 0x1F,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x09, 0x93, 0x1A, 0x58,
-0x1A, 0x9B, 0x2B, 0x1E, 0x33, 0x5F, 0x3B, 0x9F, 0x43, 0xDF, 0x4B, 0xDF, 0x4C, 0x1F, 0x4C, 0x1F,
-0x4B, 0xFF, 0x63, 0xFF, 0x7B, 0x7F, 0x43, 0x35, 0x02, 0xC0, 0x08, 0xC4, 0x10, 0x62, 0x30, 0x00,
-0x68, 0x00, 0xA8, 0x60, 0xD9, 0x40, 0xF1, 0xE0, 0xFA, 0x60, 0xFA, 0xE0, 0xFB, 0x20, 0xF3, 0x81,
-0xBA, 0x4B, 0xFC, 0xDB, 0xFD, 0xFE, 0xFE, 0x7F, 0xFE, 0xDF, 0xFF, 0x3F, 0xFF, 0x7F, 0xFF, 0x7F,
-0xFF, 0x5F, 0xFE, 0xFF, 0xFD, 0x97, 0xFC, 0x24, 0xD3, 0x43, 0x22, 0x85, 0x08, 0x20, 0x48, 0x00,
-0x50, 0x00, 0x48, 0x20, 0x38, 0x80, 0x20, 0xC0, 0x09, 0x00, 0x01, 0x61, 0x01, 0xC2, 0x02, 0x23,
-0x02, 0x63, 0x02, 0x83, 0x02, 0xC3, 0x02, 0xC4, 0x02, 0xE4, 0x3A, 0x64, 0xD9, 0x82, 0xFB, 0x41,
-0xFC, 0x82, 0xFD, 0x66, 0xFD, 0xA5, 0xFD, 0xC4, 0xFE, 0x07, 0xFE, 0x27, 0xFE, 0x29, 0xFD, 0x66,
-0x59, 0x02, 0x00, 0x61, 0x01, 0x43, 0x01, 0xE5, 0x03, 0x6B, 0x0C, 0xB0, 0x1D, 0xB4, 0x26, 0x77,
-0x3F, 0x5A, 0x47, 0x9B, 0x4F, 0xDC, 0x57, 0xFD, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE,
-0x67, 0xFF, 0x67, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0x4F, 0xFE, 0xC6, 0x9E, 0xFD, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x09, 0x73, 0x12, 0x18,
-0x1A, 0x9B, 0x2B, 0x1E, 0x33, 0x5F, 0x3B, 0x9F, 0x43, 0xBF, 0x43, 0xDF, 0x4C, 0x1F, 0x43, 0xFF,
-0x4B, 0xFF, 0x53, 0xDF, 0x73, 0x9F, 0x73, 0x1D, 0x12, 0x26, 0x32, 0x0A, 0x28, 0xC4, 0x40, 0x20,
-0x68, 0x00, 0xA0, 0x60, 0xD9, 0x60, 0xF2, 0x00, 0xFA, 0x60, 0xFA, 0xC0, 0xFB, 0x20, 0xC2, 0x23,
-0xC2, 0x92, 0xFC, 0xDC, 0xFD, 0xFF, 0xFE, 0x9F, 0xFF, 0x1F, 0xFF, 0x7F, 0xFF, 0xDF, 0xFF, 0xDF,
-0xFF, 0x7F, 0xFF, 0x1F, 0xFE, 0x7E, 0xFC, 0x88, 0xE3, 0x62, 0x33, 0x27, 0x10, 0xA1, 0x40, 0x00,
-0x50, 0x00, 0x48, 0x40, 0x30, 0xA0, 0x18, 0xE0, 0x09, 0x20, 0x01, 0x81, 0x01, 0xE2, 0x02, 0x23,
-0x02, 0x43, 0x02, 0x83, 0x02, 0xA3, 0x02, 0xE4, 0x12, 0xC4, 0xA9, 0x21, 0xF9, 0xE0, 0xFB, 0x20,
-0xFC, 0xC2, 0xFD, 0xA9, 0xFE, 0x2B, 0xFE, 0x8E, 0xFE, 0xF2, 0xFE, 0x8D, 0xFE, 0x49, 0xFE, 0x07,
-0xD4, 0x48, 0x11, 0x64, 0x01, 0xC4, 0x02, 0xA8, 0x04, 0x0E, 0x1D, 0x53, 0x1D, 0xF5, 0x2E, 0xB8,
-0x3F, 0x5A, 0x4F, 0xBC, 0x4F, 0xFD, 0x57, 0xFD, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE,
-0x67, 0xFF, 0x67, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0x57, 0xFF, 0x4F, 0xFE, 0xAD, 0x9B, 0xEB, 0xFD,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x09, 0x72, 0x12, 0x18,
-0x1A, 0x7B, 0x2A, 0xFE, 0x33, 0x3F, 0x3B, 0x7F, 0x43, 0xBF, 0x43, 0xDF, 0x4B, 0xFF, 0x4B, 0xFF,
-0x4B, 0xFF, 0x4B, 0xDF, 0x63, 0xBF, 0x83, 0x5F, 0x49, 0xF2, 0x52, 0x09, 0x71, 0x45, 0x58, 0x00,
-0x78, 0x00, 0xB0, 0xA0, 0xD9, 0x60, 0xF2, 0x00, 0xFA, 0x60, 0xFA, 0xC0, 0xFB, 0x20, 0x91, 0x27,
-0xD2, 0xB4, 0xFC, 0xDB, 0xFD, 0xDF, 0xFE, 0x9F, 0xFF, 0x1F, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF,
-0xFF, 0x7F, 0xFF, 0x3F, 0xFE, 0xBF, 0xFD, 0x31, 0xEB, 0x41, 0x3B, 0x06, 0x11, 0x83, 0x30, 0x00,
-0x50, 0x81, 0x40, 0x60, 0x30, 0xE0, 0x19, 0x00, 0x09, 0x21, 0x09, 0xC2, 0x01, 0xE2, 0x02, 0x23,
-0x02, 0x42, 0x02, 0x82, 0x02, 0xA3, 0x02, 0xC4, 0x59, 0xE2, 0xE0, 0xC0, 0xFA, 0x00, 0xFB, 0x60,
-0xFC, 0xA2, 0xFD, 0xCA, 0xFE, 0x8E, 0xFE, 0x6E, 0xFF, 0x78, 0xFF, 0x14, 0xFE, 0xAD, 0xFE, 0x28,
-0xFD, 0x88, 0x42, 0x26, 0x02, 0x88, 0x03, 0xAC, 0x0C, 0xB0, 0x1D, 0xD4, 0x26, 0x56, 0x2E, 0xF9,
-0x3F, 0x5A, 0x4F, 0xBC, 0x4F, 0xFC, 0x5F, 0xFD, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE,
-0x5F, 0xFE, 0x67, 0xFF, 0x5F, 0xFF, 0x57, 0xFF, 0x57, 0xFE, 0x47, 0xFE, 0xB4, 0xFC, 0xDB, 0x7C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0x32, 0x11, 0xF7,
-0x12, 0x7A, 0x22, 0xDE, 0x2B, 0x3F, 0x3B, 0x7F, 0x43, 0xBF, 0x43, 0xBF, 0x43, 0xDF, 0x4B, 0xDF,
-0x4B, 0xDF, 0x4B, 0xBF, 0x5B, 0xBF, 0x7B, 0x7F, 0x7B, 0x1D, 0x8A, 0x6B, 0xCA, 0x02, 0x78, 0x20,
-0x88, 0x20, 0xB8, 0xC0, 0xD9, 0x60, 0xF2, 0x00, 0xFA, 0x60, 0xFA, 0xC0, 0xF2, 0xE1, 0x78, 0xAA,
-0xE3, 0x15, 0xFC, 0xBB, 0xFD, 0x9E, 0xFE, 0x5F, 0xFE, 0xDF, 0xFF, 0x7F, 0xFF, 0xBF, 0xFF, 0x9F,
-0xFF, 0x5F, 0xFF, 0x1F, 0xFE, 0xDF, 0xFD, 0xB9, 0xD3, 0x02, 0x4A, 0x24, 0x12, 0xA6, 0x18, 0x60,
-0x40, 0x80, 0x40, 0xA0, 0x28, 0xC0, 0x19, 0x00, 0x09, 0x41, 0x01, 0xA2, 0x09, 0xE2, 0x02, 0x23,
-0x02, 0x63, 0x02, 0x83, 0x02, 0xA3, 0x0A, 0xA3, 0xA8, 0xC1, 0xF1, 0x00, 0xFA, 0x60, 0xFB, 0x61,
-0xFC, 0x42, 0xFD, 0x66, 0xFE, 0x8B, 0xFF, 0x12, 0xFF, 0x9B, 0xFF, 0x78, 0xFE, 0x8D, 0xFD, 0xE5,
-0xFD, 0x87, 0x83, 0x49, 0x13, 0x2B, 0x0C, 0x4F, 0x1D, 0x53, 0x2E, 0x56, 0x2E, 0x97, 0x3F, 0x3A,
-0x47, 0x9B, 0x4F, 0xDC, 0x57, 0xFD, 0x5F, 0xFD, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE,
-0x67, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0x57, 0xFE, 0x4F, 0xFE, 0x47, 0xFE, 0xBC, 0x7B, 0xDB, 0x5C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x01, 0x31, 0x11, 0xF7,
-0x12, 0x5A, 0x22, 0xDD, 0x2B, 0x1F, 0x3B, 0x5F, 0x43, 0x9F, 0x43, 0xBF, 0x43, 0xBF, 0x4B, 0xDF,
-0x43, 0xDF, 0x4B, 0xBF, 0x53, 0xBF, 0x73, 0x9F, 0x83, 0x5F, 0x9A, 0xD5, 0xEB, 0x66, 0xA1, 0x43,
-0x98, 0x80, 0xB8, 0xE0, 0xD1, 0x60, 0xEA, 0x00, 0xFA, 0x60, 0xFA, 0xC0, 0xCA, 0x22, 0x68, 0x8C,
-0xE3, 0x35, 0xFC, 0x7A, 0xFD, 0x5D, 0xFE, 0x1F, 0xFE, 0x9F, 0xFE, 0xFF, 0xFF, 0x3F, 0xFF, 0x3F,
-0xFF, 0x3F, 0xFF, 0x1F, 0xFE, 0xDF, 0xFE, 0x1E, 0xB2, 0x06, 0x50, 0xC1, 0x2B, 0x89, 0x19, 0x83,
-0x28, 0x80, 0x30, 0xA0, 0x20, 0xE0, 0x11, 0x21, 0x09, 0xC3, 0x01, 0xC2, 0x09, 0xE3, 0x02, 0x23,
-0x02, 0x43, 0x02, 0x84, 0x02, 0x83, 0x41, 0xE3, 0xD0, 0x20, 0xF1, 0x00, 0xFA, 0x61, 0xFB, 0x41,
-0xFC, 0x21, 0xFC, 0xE4, 0xFD, 0xC8, 0xFE, 0x4D, 0xFE, 0x6E, 0xFE, 0xAF, 0xFE, 0x07, 0xFD, 0xC5,
-0xFD, 0x45, 0x9C, 0x0B, 0x24, 0x2E, 0x1C, 0xF1, 0x25, 0xB4, 0x2E, 0x57, 0x2E, 0xB8, 0x3F, 0x3A,
-0x47, 0x9B, 0x4F, 0xDC, 0x57, 0xFD, 0x5F, 0xFD, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE,
-0x5F, 0xFE, 0x5F, 0xFF, 0x57, 0xFF, 0x57, 0xFE, 0x4F, 0xFE, 0x4F, 0xDD, 0xC3, 0xFB, 0xD3, 0x1B,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0x31, 0x11, 0xD7,
-0x12, 0x5A, 0x22, 0xDD, 0x2A, 0xFF, 0x33, 0x5F, 0x3B, 0x9F, 0x43, 0xBF, 0x4B, 0xDF, 0x4B, 0xDF,
-0x4B, 0xDF, 0x4B, 0xDF, 0x53, 0xBF, 0x63, 0x9F, 0x83, 0x5F, 0x8B, 0x3D, 0xCC, 0xB4, 0xC4, 0x72,
-0xA9, 0x62, 0xB8, 0xE0, 0xC9, 0x40, 0xD9, 0x80, 0xE9, 0xC0, 0xF2, 0x21, 0xA1, 0x45, 0x60, 0x4B,
-0xD2, 0xB3, 0xFC, 0x3A, 0xFD, 0x5D, 0xFD, 0xDF, 0xFE, 0x5F, 0xFE, 0xBF, 0xFE, 0xFF, 0xFF, 0x1F,
-0xFF, 0x1F, 0xFE, 0xFF, 0xFE, 0xBF, 0xFE, 0x5F, 0x92, 0x4D, 0x48, 0x00, 0x3A, 0x85, 0x23, 0x08,
-0x29, 0x63, 0x21, 0x21, 0x19, 0x22, 0x11, 0x41, 0x09, 0xA2, 0x09, 0xE3, 0x0A, 0x03, 0x01, 0xA2,
-0x01, 0x81, 0x01, 0xC2, 0x0A, 0x22, 0xA0, 0xC1, 0xD8, 0x00, 0xF0, 0xE0, 0xFA, 0x40, 0xFB, 0x20,
-0xFB, 0xE0, 0xFC, 0x82, 0xFD, 0x23, 0xFD, 0x86, 0xFD, 0xC7, 0xFD, 0xE7, 0xFD, 0xE5, 0xFD, 0xA4,
-0xFD, 0x02, 0xB4, 0x6C, 0x24, 0x90, 0x25, 0x53, 0x2E, 0x36, 0x2E, 0xB8, 0x3F, 0x19, 0x3F, 0x5A,
-0x47, 0xBB, 0x57, 0xDC, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFE, 0x57, 0xFE, 0x57, 0xFE, 0x5F, 0xFE,
-0x57, 0xFE, 0x57, 0xFE, 0x5F, 0xFF, 0x57, 0xFE, 0x4F, 0xFE, 0x4F, 0xBD, 0xC3, 0x7A, 0xCA, 0xD9,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x01, 0x31, 0x09, 0xD7,
-0x12, 0x3A, 0x22, 0xBC, 0x22, 0xFE, 0x33, 0x5F, 0x3B, 0x7F, 0x43, 0x9F, 0x43, 0xBF, 0x43, 0xBF,
-0x43, 0xDF, 0x4B, 0xDF, 0x4B, 0xBF, 0x5B, 0x9F, 0x7B, 0x7F, 0x83, 0x3E, 0x94, 0xBC, 0x7C, 0xD8,
-0xB2, 0xA9, 0xA0, 0x60, 0x98, 0x40, 0xA0, 0x20, 0xA8, 0x20, 0xC0, 0x60, 0x70, 0xA9, 0x50, 0x0A,
-0xB9, 0xD0, 0xFB, 0xD8, 0xFC, 0xFC, 0xFD, 0x9E, 0xFE, 0x3F, 0xFE, 0x7F, 0xFE, 0xBF, 0xFE, 0xDF,
-0xFE, 0xDF, 0xFE, 0xBF, 0xFE, 0xBF, 0xFE, 0x7F, 0xBB, 0xF5, 0x40, 0x00, 0x50, 0x81, 0x33, 0x68,
-0x23, 0x08, 0x12, 0x24, 0x09, 0x21, 0x09, 0x41, 0x09, 0x82, 0x08, 0xE1, 0x08, 0x60, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0xD0, 0x00, 0xD8, 0x00, 0xF0, 0xE0, 0xFA, 0x00, 0xFA, 0xE0,
-0xFB, 0xC0, 0xFC, 0x82, 0xFC, 0xE3, 0xFD, 0x44, 0xFD, 0x84, 0xFD, 0xA5, 0xFD, 0xA4, 0xFD, 0x41,
-0xFC, 0xC1, 0xC4, 0xAC, 0x2C, 0xF1, 0x2D, 0xB4, 0x2E, 0x57, 0x36, 0xD8, 0x3F, 0x3A, 0x47, 0x9B,
-0x4F, 0xDC, 0x57, 0xFD, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFE, 0x57, 0xFE, 0x57, 0xFE, 0x5F, 0xFE,
-0x5F, 0xFF, 0x5F, 0xFE, 0x57, 0xFE, 0x4F, 0xFE, 0x4F, 0xFE, 0x4F, 0x9D, 0xBB, 0x19, 0xBA, 0x57,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x09, 0x11, 0x09, 0xD6,
-0x1A, 0x3A, 0x1A, 0xBC, 0x22, 0xFE, 0x33, 0x5F, 0x33, 0x7F, 0x3B, 0x9F, 0x3B, 0x9F, 0x4B, 0xBF,
-0x4B, 0xBF, 0x4B, 0xBF, 0x53, 0xBF, 0x5B, 0x9F, 0x73, 0x7F, 0x83, 0x7F, 0x83, 0xDC, 0x6B, 0xB4,
-0x79, 0x46, 0x80, 0x20, 0x60, 0x00, 0x60, 0x00, 0x70, 0x00, 0x80, 0x00, 0x50, 0x6B, 0x58, 0x0A,
-0xA9, 0x6E, 0xEB, 0x15, 0xFC, 0x5A, 0xFD, 0x1D, 0xFD, 0xBE, 0xFE, 0x1F, 0xFE, 0x7F, 0xFE, 0x9F,
-0xFE, 0x9F, 0xFE, 0xBF, 0xFE, 0x9F, 0xFE, 0x7F, 0xF5, 0x9D, 0x50, 0x42, 0x50, 0x00, 0x38, 0xE1,
-0x23, 0x47, 0x1B, 0x28, 0x0A, 0x04, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0xD8, 0x00, 0xE0, 0x81, 0xF1, 0x00, 0xF9, 0xA0, 0xFA, 0x80,
-0xFB, 0x60, 0xFC, 0x00, 0xFC, 0x82, 0xFC, 0xC2, 0xFD, 0x02, 0xFD, 0x22, 0xFD, 0x42, 0xFD, 0x01,
-0xFC, 0xC2, 0xD4, 0xED, 0x35, 0x53, 0x35, 0xF5, 0x36, 0x98, 0x3F, 0x19, 0x47, 0x5A, 0x4F, 0x9B,
-0x57, 0xDC, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFE, 0x5F, 0xFE, 0x57, 0xFE, 0x5F, 0xFE, 0x57, 0xFE,
-0x5F, 0xFE, 0x57, 0xFE, 0x5F, 0xFE, 0x57, 0xFE, 0x4F, 0xFE, 0x4F, 0xBD, 0xB4, 0x98, 0xCC, 0x30,
-0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0x11, 0x09, 0xB6,
-0x12, 0x39, 0x1A, 0x9B, 0x22, 0xDD, 0x2B, 0x3F, 0x33, 0x5F, 0x3B, 0x7F, 0x43, 0x9F, 0x43, 0xBF,
-0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x53, 0xBF, 0x63, 0x9F, 0x73, 0x5F, 0x6A, 0xDC, 0x5A, 0x0F,
-0x38, 0x03, 0x50, 0x00, 0x48, 0x00, 0x48, 0x00, 0x50, 0x00, 0x60, 0x03, 0x40, 0x2B, 0x60, 0x2A,
-0xA9, 0x8F, 0xEA, 0xF5, 0xFB, 0xF9, 0xFC, 0xBB, 0xFD, 0x3D, 0xFD, 0xBE, 0xFE, 0x1F, 0xFE, 0x5F,
-0xFE, 0x9F, 0xFE, 0x9F, 0xFE, 0x9F, 0xFE, 0x5F, 0xFD, 0xFF, 0x89, 0xCB, 0x50, 0x00, 0x40, 0x00,
-0x18, 0x80, 0x12, 0x45, 0x02, 0x04, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x30, 0x00, 0xD0, 0x00, 0xD8, 0x00, 0xE8, 0xA0, 0xF9, 0x20, 0xF9, 0xC0, 0xFA, 0x40,
-0xFB, 0x00, 0xFB, 0xA0, 0xFC, 0x21, 0xFC, 0x60, 0xFC, 0xC1, 0xFC, 0xE2, 0xFC, 0xE0, 0xFC, 0xE1,
-0xFC, 0xE4, 0xE5, 0x0C, 0x45, 0xB4, 0x3E, 0x57, 0x3E, 0xB8, 0x47, 0x3A, 0x4F, 0x5B, 0x4F, 0xBB,
-0x57, 0xDC, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x57, 0xFE, 0x57, 0xFE,
-0x5F, 0xFE, 0x57, 0xFE, 0x57, 0xFE, 0x57, 0xFE, 0x5F, 0xFD, 0xAF, 0x95, 0xF7, 0xCD, 0xFF, 0xEE,
-0x73, 0xB5, 0x21, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x67, 0x09, 0x31, 0x09, 0x96,
-0x11, 0xF8, 0x1A, 0x5B, 0x22, 0xDD, 0x33, 0x3F, 0x3B, 0x5F, 0x3B, 0x7F, 0x3B, 0x9F, 0x43, 0x9F,
-0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x53, 0x9F, 0x5B, 0x9F, 0x63, 0x7F, 0x62, 0x9C, 0x38, 0x8C,
-0x28, 0x02, 0x30, 0x00, 0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x48, 0x04, 0x40, 0x0B, 0x70, 0x4B,
-0xB9, 0xB0, 0xEA, 0xF5, 0xFB, 0xF9, 0xFC, 0x9C, 0xFD, 0x3D, 0xFD, 0xBE, 0xFE, 0x1F, 0xFE, 0x3F,
-0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x5F, 0xFE, 0x3F, 0xC3, 0x94, 0x50, 0x00, 0x40, 0x00,
-0x10, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x90, 0x00, 0xD8, 0x00, 0xE0, 0x20, 0xF0, 0xC0, 0xF9, 0x60, 0xFA, 0x00, 0xFA, 0x60,
-0xFA, 0xC0, 0xFB, 0x80, 0xFC, 0x01, 0xFC, 0x41, 0xFC, 0xA1, 0xFC, 0xC1, 0xFD, 0x02, 0xFD, 0x23,
-0xFD, 0x05, 0xF5, 0x0C, 0x4D, 0xD5, 0x3E, 0x77, 0x3E, 0xD8, 0x4F, 0x3A, 0x4F, 0x7B, 0x57, 0xBC,
-0x67, 0x9C, 0x6F, 0xFE, 0x67, 0xFD, 0x5F, 0xFD, 0x5F, 0xFE, 0x5F, 0xFE, 0x57, 0xFE, 0x57, 0xFE,
-0x5F, 0xFE, 0x57, 0xFE, 0x57, 0xFE, 0x6F, 0xBC, 0xDE, 0xED, 0xFF, 0xC8, 0xFF, 0xEC, 0xFF, 0xF0,
-0x84, 0x57, 0x7B, 0xB5, 0x18, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x08, 0xF1, 0x09, 0x95,
-0x1A, 0x18, 0x1A, 0x5A, 0x22, 0xDD, 0x2B, 0x1E, 0x3B, 0x5F, 0x3B, 0x7F, 0x43, 0x9F, 0x43, 0x9F,
-0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0x9F, 0x53, 0x9F, 0x63, 0x7F, 0x5A, 0x9C, 0x30, 0x6C,
-0x20, 0x02, 0x20, 0x00, 0x10, 0x00, 0x20, 0x00, 0x38, 0x00, 0x48, 0x07, 0x48, 0x0B, 0x78, 0x4B,
-0xB9, 0xD0, 0xEA, 0xF5, 0xFB, 0xF9, 0xFC, 0xBB, 0xFD, 0x3D, 0xFD, 0x9E, 0xFE, 0x1F, 0xFE, 0x1F,
-0xFE, 0x3F, 0xFE, 0x5F, 0xFE, 0x7F, 0xFE, 0x5F, 0xFE, 0x3F, 0xF5, 0x3C, 0x50, 0x21, 0x30, 0x00,
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x28, 0x00, 0xD8, 0x20, 0xE0, 0x00, 0xE8, 0x60, 0xF9, 0x00, 0xF9, 0x80, 0xFA, 0x00, 0xFA, 0x81,
-0xFB, 0x00, 0xFB, 0xC1, 0xFC, 0x21, 0xFC, 0x83, 0xFC, 0xA2, 0xFD, 0x03, 0xFD, 0x23, 0xFD, 0x03,
-0xFD, 0x04, 0xF5, 0x2C, 0x5E, 0x16, 0x46, 0x97, 0x47, 0x19, 0x4F, 0x5A, 0x57, 0x9B, 0x5F, 0xBC,
-0x5F, 0xDC, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x57, 0xFE,
-0x57, 0xFE, 0x57, 0xFE, 0x77, 0xBD, 0xDE, 0x29, 0xFF, 0x63, 0xFF, 0xE8, 0xFF, 0xEF, 0xFF, 0xF2,
-0x8C, 0x99, 0x8C, 0x37, 0x73, 0x53, 0x08, 0x22, 0x00, 0x00, 0x00, 0x08, 0x00, 0xB0, 0x09, 0x75,
-0x12, 0x18, 0x22, 0x5A, 0x22, 0xBC, 0x2A, 0xFE, 0x33, 0x3F, 0x3B, 0x7F, 0x43, 0x9F, 0x43, 0x9F,
-0x43, 0x9F, 0x43, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0x9F, 0x53, 0x7F, 0x52, 0xBD, 0x28, 0x6D,
-0x10, 0x01, 0x28, 0x02, 0x08, 0x00, 0x08, 0x00, 0x18, 0x00, 0x40, 0x2A, 0x50, 0x0C, 0x80, 0x6C,
-0xC1, 0xD0, 0xEA, 0xF5, 0xFB, 0xF9, 0xFC, 0x7B, 0xFC, 0xFC, 0xFD, 0x9E, 0xFD, 0xFE, 0xFE, 0x1F,
-0xFE, 0x3F, 0xFE, 0x5F, 0xFE, 0x7F, 0xFE, 0x5F, 0xFE, 0x3F, 0xFD, 0xDE, 0x79, 0x69, 0x28, 0x00,
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x88, 0x00, 0xE0, 0x20, 0xE0, 0x20, 0xF0, 0xC0, 0xF9, 0x40, 0xF9, 0xA0, 0xFA, 0x00, 0xFA, 0xA0,
-0xFB, 0x40, 0xFB, 0xC1, 0xFC, 0x21, 0xFC, 0x82, 0xFC, 0xA2, 0xFC, 0xE2, 0xFC, 0xE1, 0xFD, 0x02,
-0xFC, 0xE4, 0xFC, 0xEA, 0x66, 0x35, 0x46, 0xD8, 0x47, 0x19, 0x4F, 0x5A, 0x57, 0x9B, 0x57, 0xBC,
-0x5F, 0xFC, 0x5F, 0xFD, 0x5F, 0xFD, 0x6F, 0xFD, 0x5F, 0xFE, 0x57, 0xFE, 0x57, 0xFE, 0x57, 0xFE,
-0x57, 0xFE, 0x5F, 0xFE, 0xC5, 0xCE, 0xFE, 0xA0, 0xFF, 0xE4, 0xFF, 0xEA, 0xFF, 0xEF, 0xFF, 0xF4,
-0x8C, 0x99, 0x8C, 0x58, 0x8C, 0x17, 0x4A, 0x0D, 0x00, 0x00, 0x00, 0x07, 0x00, 0xB0, 0x01, 0x55,
-0x09, 0xD8, 0x1A, 0x5A, 0x2A, 0xBC, 0x2A, 0xFE, 0x33, 0x3F, 0x3B, 0x7F, 0x3B, 0x7F, 0x43, 0x9F,
-0x43, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0x9F, 0x4B, 0x9F, 0x53, 0x9F, 0x4A, 0xDE, 0x30, 0xEF,
-0x08, 0x01, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x01, 0x48, 0x2B, 0x58, 0x0B, 0x90, 0x8C,
-0xC9, 0xF1, 0xF2, 0xF5, 0xFB, 0xD9, 0xFC, 0x5B, 0xFC, 0xFC, 0xFD, 0x7E, 0xFD, 0xFE, 0xFD, 0xFE,
-0xFD, 0xFF, 0xFE, 0x5F, 0xFE, 0x7F, 0xFE, 0x5F, 0xFE, 0x7F, 0xFE, 0x1E, 0xB3, 0x12, 0x28, 0x00,
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-0xD8, 0x20, 0xE8, 0x40, 0xE8, 0x60, 0xF8, 0xE0, 0xF9, 0x80, 0xF9, 0xE0, 0xFA, 0x60, 0xFA, 0xC1,
-0xFB, 0x41, 0xFB, 0xC1, 0xFC, 0x21, 0xFC, 0x82, 0xFC, 0xC2, 0xFC, 0xC2, 0xFC, 0xC2, 0xFC, 0xE2,
-0xFC, 0xE3, 0xFC, 0xE9, 0x7E, 0x76, 0x4F, 0x19, 0x4F, 0x3A, 0x4F, 0x7B, 0x57, 0x9B, 0x5F, 0xBC,
-0x5F, 0xDC, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFE, 0x57, 0xFE, 0x4F, 0xDD, 0x5F, 0xFE,
-0x5F, 0xFE, 0xA5, 0xF4, 0xF4, 0xE1, 0xFF, 0x40, 0xFF, 0xE4, 0xFF, 0xEA, 0xFF, 0xF0, 0xFF, 0xF5,
-0x94, 0xD9, 0x8C, 0x78, 0x8C, 0x17, 0x7B, 0x96, 0x20, 0xE7, 0x00, 0x07, 0x00, 0x90, 0x01, 0x14,
-0x09, 0x97, 0x1A, 0x5A, 0x22, 0xBC, 0x2B, 0x1E, 0x33, 0x3F, 0x43, 0x7F, 0x3B, 0x9F, 0x43, 0x9F,
-0x43, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x53, 0x9F, 0x4A, 0xFE, 0x31, 0x32,
-0x00, 0x01, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x04, 0x48, 0x2C, 0x68, 0x0B, 0x98, 0xCD,
-0xD2, 0x52, 0xEB, 0x15, 0xFB, 0xD9, 0xFC, 0x5A, 0xFC, 0xDC, 0xFD, 0x7D, 0xFD, 0xDE, 0xFD, 0xFE,
-0xFE, 0x1F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x3F, 0xEC, 0xFA, 0x28, 0x21,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-0xE8, 0x60, 0xE8, 0x81, 0xF0, 0xC1, 0xF9, 0x20, 0xF9, 0xC0, 0xFA, 0x20, 0xFA, 0x80, 0xFB, 0x00,
-0xFB, 0x60, 0xFB, 0xE0, 0xFC, 0x21, 0xFC, 0x82, 0xFC, 0xA2, 0xFC, 0xC2, 0xFD, 0x02, 0xFD, 0x03,
-0xFC, 0xE4, 0xFC, 0xC8, 0x9E, 0xF8, 0x47, 0x7A, 0x47, 0x39, 0x57, 0x7B, 0x5F, 0xBB, 0x5F, 0xDC,
-0x5F, 0xFC, 0x5F, 0xFC, 0x5F, 0xFD, 0x67, 0xDD, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE,
-0x96, 0xB8, 0xE3, 0x62, 0xFD, 0x80, 0xFF, 0x81, 0xFF, 0xE6, 0xFF, 0xEB, 0xFF, 0xF0, 0xFF, 0xF4,
-0x94, 0xD9, 0x8C, 0x78, 0x8B, 0xF7, 0x83, 0xB6, 0x6B, 0x13, 0x00, 0x29, 0x00, 0x8F, 0x01, 0x14,
-0x09, 0x97, 0x12, 0x3A, 0x1A, 0xBC, 0x2A, 0xFD, 0x33, 0x3F, 0x3B, 0x5F, 0x3B, 0x9F, 0x43, 0x9F,
-0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x53, 0xFF, 0x4B, 0xBF, 0x4B, 0x9F, 0x4B, 0x1F, 0x29, 0x34,
-0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x07, 0x48, 0x2D, 0x68, 0x2B, 0xA1, 0x0E,
-0xD2, 0x52, 0xF3, 0x36, 0xFC, 0x19, 0xFC, 0x5A, 0xFC, 0xDC, 0xFD, 0x5D, 0xFD, 0xBE, 0xFD, 0xFF,
-0xFE, 0x1E, 0xFE, 0x5F, 0xFE, 0x7F, 0xFE, 0x9F, 0xFE, 0x7F, 0xFE, 0x5F, 0xFD, 0xBE, 0x59, 0x07,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD8, 0x40,
-0xF0, 0x81, 0xE8, 0x60, 0xF0, 0xE0, 0xF9, 0x40, 0xF9, 0xC0, 0xFA, 0x40, 0xFA, 0x80, 0xFB, 0x00,
-0xFB, 0x60, 0xFB, 0xE1, 0xFC, 0x21, 0xFC, 0x82, 0xFC, 0xA2, 0xFC, 0xE3, 0xFC, 0xE3, 0xFC, 0xE3,
-0xFC, 0xE3, 0xFC, 0xA6, 0xC6, 0xF9, 0x7F, 0xFF, 0x5F, 0x7C, 0x4F, 0x9B, 0x57, 0xBC, 0x5F, 0xDC,
-0x5F, 0xFC, 0x57, 0xFD, 0x57, 0xFD, 0x57, 0xFD, 0x5F, 0xFE, 0x6F, 0xFE, 0x8F, 0xFF, 0x9F, 0x5C,
-0xDB, 0x86, 0xFB, 0xA0, 0xFE, 0x00, 0xFF, 0xA1, 0xFF, 0xE5, 0xFF, 0xEA, 0xFF, 0xEF, 0xFF, 0xF3,
-0x8C, 0x99, 0x8C, 0x78, 0x8B, 0xF7, 0x83, 0xB6, 0x7B, 0xB6, 0x42, 0x11, 0x00, 0x70, 0x01, 0x14,
-0x09, 0x97, 0x12, 0x1A, 0x1A, 0x7B, 0x22, 0xFD, 0x33, 0x3F, 0x33, 0x3F, 0x3B, 0x5F, 0x43, 0x9F,
-0x43, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0xBF, 0x4B, 0x9F, 0x4B, 0x3F, 0x29, 0x76,
-0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0A, 0x50, 0x0C, 0x78, 0x4C, 0xA9, 0x2E,
-0xDA, 0x53, 0xF3, 0x36, 0xFB, 0xD9, 0xFC, 0x9B, 0xFD, 0x1C, 0xFD, 0x5D, 0xFD, 0x9E, 0xFD, 0xDE,
-0xFD, 0xFE, 0xFE, 0x5F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x1E, 0xDC, 0x78,
-0x28, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xB8, 0x00, 0xF0, 0xA1,
-0xF0, 0xA2, 0xF0, 0xC1, 0xF9, 0x20, 0xF9, 0x80, 0xF9, 0xC0, 0xFA, 0x40, 0xFA, 0xA0, 0xFB, 0x40,
-0xFB, 0xA0, 0xFC, 0x01, 0xFC, 0x42, 0xFC, 0x63, 0xFC, 0x82, 0xFC, 0xE3, 0xFD, 0x02, 0xFD, 0x03,
-0xFC, 0xC3, 0xFC, 0x85, 0xC6, 0x97, 0x8F, 0xFF, 0x8F, 0xFF, 0x6F, 0xFE, 0x5F, 0xFD, 0x5F, 0xFD,
-0x57, 0xFD, 0x57, 0xFD, 0x4F, 0xFC, 0x4F, 0xDC, 0x57, 0xDC, 0x4F, 0xFC, 0x67, 0x9B, 0xCC, 0x6B,
-0xF3, 0x20, 0xFC, 0x60, 0xFE, 0x20, 0xFF, 0xA1, 0xFF, 0xE5, 0xFF, 0xE9, 0xFF, 0xEE, 0xFF, 0xF1,
-0x84, 0x58, 0x84, 0x37, 0x8B, 0xF6, 0x83, 0xB6, 0x83, 0xD6, 0x7B, 0x96, 0x21, 0x52, 0x00, 0xF4,
-0x09, 0x97, 0x12, 0x1A, 0x12, 0x7B, 0x22, 0xDD, 0x2B, 0x1F, 0x33, 0x3F, 0x3B, 0x5F, 0x3B, 0x9F,
-0x43, 0x9F, 0x4B, 0xBF, 0x4B, 0xDF, 0x4B, 0xBF, 0x4B, 0xBF, 0x43, 0xBF, 0x43, 0x7F, 0x32, 0x19,
-0x08, 0x07, 0x00, 0x01, 0x00, 0x00, 0x20, 0x01, 0x48, 0x2C, 0x50, 0x0C, 0x78, 0x4C, 0xB1, 0x6F,
-0xDA, 0x73, 0xFB, 0x57, 0xFB, 0xF9, 0xFC, 0x5B, 0xFC, 0xFC, 0xFD, 0x3D, 0xFD, 0x5D, 0xFD, 0xBE,
-0xFE, 0x1E, 0xFE, 0x3F, 0xFE, 0x5F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x9F, 0xFE, 0x5F, 0xFD, 0x7D,
-0xC4, 0x76, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xA0, 0x00, 0xE8, 0x40, 0xF0, 0xC2,
-0xF0, 0xC3, 0xF9, 0x01, 0xF9, 0x61, 0xF9, 0xA0, 0xF9, 0xE0, 0xFA, 0x60, 0xFA, 0xC0, 0xFB, 0x40,
-0xFB, 0xA0, 0xFC, 0x01, 0xFC, 0x21, 0xFC, 0x63, 0xFC, 0x82, 0xFC, 0xE3, 0xFC, 0xE2, 0xFC, 0xE2,
-0xFC, 0xE2, 0xFC, 0x84, 0xCD, 0x30, 0x6D, 0xF5, 0x77, 0x9C, 0x97, 0xFF, 0x97, 0xFF, 0x7F, 0xFF,
-0x67, 0xFE, 0x4F, 0x9B, 0x2E, 0x56, 0x1C, 0xEF, 0x14, 0xAD, 0x36, 0x55, 0xB4, 0xEE, 0xEB, 0x21,
-0xFB, 0xC0, 0xFD, 0x20, 0xFE, 0x60, 0xFF, 0xA0, 0xFF, 0xE5, 0xFF, 0xE9, 0xFF, 0xED, 0xFF, 0xF0,
-0x84, 0x17, 0x7B, 0xF6, 0x83, 0xD6, 0x83, 0xD7, 0x83, 0xD6, 0x7B, 0x96, 0x63, 0x36, 0x09, 0x14,
-0x09, 0x97, 0x12, 0x1A, 0x1A, 0x7C, 0x2A, 0xDD, 0x33, 0x1E, 0x54, 0x1E, 0x54, 0x1F, 0x43, 0x9F,
-0x43, 0xBF, 0x4B, 0xDF, 0x4B, 0xDF, 0x53, 0xBF, 0x4B, 0xDF, 0x4B, 0xFF, 0x4B, 0xDF, 0x43, 0x1D,
-0x18, 0xB0, 0x00, 0x01, 0x10, 0x00, 0x48, 0x03, 0x48, 0x6E, 0x50, 0x2C, 0x80, 0x6C, 0xB1, 0x4F,
-0xE2, 0x93, 0xF3, 0x56, 0xFB, 0xF9, 0xFC, 0x5A, 0xFC, 0xFC, 0xFD, 0x5D, 0xFD, 0x9E, 0xFD, 0xDE,
-0xFE, 0x1E, 0xFE, 0x3F, 0xFE, 0x5F, 0xFE, 0x7F, 0xFE, 0x9F, 0xFE, 0x9F, 0xFE, 0x5F, 0xFD, 0x9D,
-0xFE, 0x5E, 0x6A, 0x0B, 0x00, 0x00, 0x08, 0x00, 0x98, 0x00, 0xC0, 0x00, 0xF8, 0xC1, 0xF8, 0xC2,
-0xF8, 0xC2, 0xF9, 0x01, 0xF9, 0x61, 0xF9, 0xC0, 0xFA, 0x20, 0xFA, 0x80, 0xFA, 0xE0, 0xFB, 0x40,
-0xFB, 0xC1, 0xFB, 0xE0, 0xFC, 0x21, 0xFC, 0xA2, 0xFC, 0xC2, 0xFC, 0xE2, 0xFC, 0xE2, 0xFC, 0xE2,
-0xFC, 0xC2, 0xFC, 0x62, 0xD4, 0x4B, 0x5C, 0xD1, 0x55, 0x12, 0x5E, 0x77, 0x6F, 0x7C, 0x67, 0xBD,
-0x57, 0x9C, 0x36, 0x77, 0x14, 0x2E, 0x02, 0xE7, 0x0B, 0x48, 0x94, 0x2A, 0xEB, 0x21, 0xFB, 0x60,
-0xFC, 0x80, 0xFD, 0xC0, 0xFE, 0xC0, 0xFF, 0x80, 0xFF, 0xE4, 0xFF, 0xE7, 0xFF, 0xEB, 0xFF, 0xEE,
-0x7B, 0xD6, 0x7B, 0xD6, 0x7B, 0xB6, 0x8B, 0xD7, 0x83, 0xD6, 0x7B, 0xB5, 0x7B, 0x96, 0x42, 0x75,
-0x09, 0xB7, 0x11, 0xF9, 0x1A, 0x5B, 0x22, 0xBD, 0x2A, 0xFE, 0x33, 0x3F, 0x3B, 0x5F, 0x3B, 0x7F,
-0x43, 0x9F, 0x43, 0x9F, 0x4B, 0xBF, 0x53, 0xDF, 0x4B, 0xFF, 0x54, 0x3F, 0x5C, 0x9F, 0x53, 0xDE,
-0x31, 0xD6, 0x00, 0x00, 0x30, 0x00, 0x48, 0x06, 0x50, 0x8F, 0x58, 0x2C, 0x80, 0x4C, 0xB9, 0x8F,
-0xE2, 0x93, 0xFB, 0x56, 0xFC, 0x19, 0xFC, 0x5B, 0xFC, 0xDC, 0xFD, 0x3D, 0xFD, 0x9E, 0xFD, 0xFE,
-0xFE, 0x1E, 0xFE, 0x3F, 0xFE, 0x3F, 0xFE, 0x9F, 0xFE, 0xDF, 0xFE, 0x9F, 0xFE, 0x3F, 0xFD, 0xDE,
-0xFE, 0x5E, 0xDD, 0x59, 0x08, 0x00, 0x58, 0x00, 0xC0, 0x00, 0xE8, 0x40, 0xF9, 0x03, 0xF8, 0xC2,
-0xF8, 0xE2, 0xF9, 0x41, 0xF9, 0xA0, 0xF9, 0xE0, 0xFA, 0x40, 0xFA, 0xA0, 0xFB, 0x00, 0xFB, 0x60,
-0xFB, 0xE1, 0xFC, 0x01, 0xFC, 0x21, 0xFC, 0x82, 0xFC, 0xC2, 0xFC, 0xE2, 0xFD, 0x03, 0xFC, 0xE3,
-0xFC, 0xC2, 0xFC, 0x62, 0xEB, 0xC5, 0x54, 0xB0, 0x3C, 0xF1, 0x34, 0xF1, 0x34, 0x8F, 0x34, 0xB0,
-0x2B, 0xAB, 0x22, 0xC6, 0x12, 0xA5, 0x0A, 0x85, 0x63, 0x24, 0xEB, 0x41, 0xFB, 0x20, 0xFC, 0x20,
-0xFD, 0x60, 0xFE, 0x40, 0xFF, 0x40, 0xFF, 0xA0, 0xFF, 0xE3, 0xFF, 0xE5, 0xFF, 0xE9, 0xFF, 0xEB,
-0x73, 0xB5, 0x73, 0xB6, 0x7B, 0xD6, 0x83, 0xD6, 0x83, 0xD6, 0x83, 0xB6, 0x7B, 0x95, 0x73, 0x77,
-0x2A, 0x37, 0x12, 0x19, 0x1A, 0x7B, 0x22, 0xBD, 0x2A, 0xFE, 0x33, 0x3F, 0x33, 0x5F, 0x3B, 0x7F,
-0x3B, 0x9F, 0x43, 0xBF, 0x4B, 0xDF, 0x53, 0xFF, 0x54, 0x3F, 0x6C, 0xFF, 0x64, 0x9F, 0x5C, 0x7F,
-0x29, 0x73, 0x08, 0x00, 0x48, 0x00, 0x48, 0x09, 0x50, 0x6E, 0x60, 0x0C, 0x88, 0x6C, 0xB9, 0x90,
-0xE2, 0x94, 0xFB, 0x56, 0xFB, 0xD8, 0xFC, 0x7B, 0xFC, 0xDC, 0xFD, 0x3D, 0xFD, 0x9D, 0xFD, 0xDE,
-0xFD, 0xFE, 0xFE, 0x1E, 0xFE, 0x3F, 0xFE, 0xBF, 0xFE, 0xBF, 0xFE, 0x9F, 0xFE, 0x3F, 0xFD, 0xFE,
-0xFE, 0x1E, 0xFE, 0xDF, 0x51, 0x47, 0xB0, 0x20, 0xD0, 0x00, 0xF8, 0xC2, 0xF9, 0x04, 0xF8, 0xC2,
-0xF9, 0x01, 0xF9, 0x81, 0xF9, 0xA1, 0xFA, 0x00, 0xFA, 0x40, 0xFA, 0xC0, 0xFB, 0x00, 0xFB, 0x60,
-0xFB, 0xE1, 0xFC, 0x01, 0xFC, 0x21, 0xFC, 0x83, 0xFC, 0xA2, 0xFC, 0xE2, 0xFD, 0x03, 0xFC, 0xE2,
-0xFC, 0xC2, 0xFC, 0x83, 0xFB, 0xE4, 0xB4, 0x8A, 0x2C, 0x4E, 0x2C, 0x2E, 0x23, 0x4A, 0x1A, 0x45,
-0x21, 0x40, 0x19, 0x00, 0x19, 0x00, 0x49, 0x60, 0xEB, 0x21, 0xFB, 0x20, 0xFB, 0xC0, 0xFC, 0xE0,
-0xFD, 0xE0, 0xFE, 0xC0, 0xFF, 0x60, 0xFF, 0xE1, 0xFF, 0xE2, 0xFF, 0xE5, 0xFF, 0xE8, 0xFF, 0xEA,
-0x6B, 0x95, 0x73, 0xB5, 0x73, 0xB6, 0x7B, 0xB6, 0x83, 0xB6, 0x83, 0xB6, 0x7B, 0x75, 0x73, 0x75,
-0x63, 0x37, 0x1A, 0x19, 0x1A, 0x7B, 0x22, 0xDD, 0x2B, 0x1E, 0x33, 0x3F, 0x33, 0x5F, 0x43, 0x9F,
-0x43, 0xBF, 0x43, 0xDF, 0x4C, 0x1F, 0x5C, 0x5F, 0x75, 0x3F, 0x6C, 0xFF, 0x64, 0xBF, 0x43, 0x3E,
-0x18, 0xAF, 0x28, 0x01, 0x50, 0x02, 0x50, 0x0B, 0x48, 0x0C, 0x60, 0x0B, 0x98, 0xAD, 0xC1, 0xD0,
-0xE2, 0x93, 0xFB, 0x56, 0xFB, 0xD9, 0xFC, 0x5A, 0xFC, 0xDC, 0xFD, 0x1C, 0xFD, 0x7D, 0xFD, 0xBE,
-0xFD, 0xFE, 0xFE, 0x1E, 0xFE, 0x3F, 0xFE, 0x9F, 0xFE, 0x7F, 0xFE, 0x5F, 0xFE, 0x3F, 0xFD, 0xFE,
-0xFD, 0xFE, 0xFE, 0xFF, 0xB3, 0x70, 0xE8, 0xE1, 0xE8, 0x20, 0xF9, 0x23, 0xF9, 0x04, 0xF9, 0x02,
-0xF9, 0x82, 0xF9, 0xA0, 0xF9, 0xC0, 0xFA, 0x20, 0xFA, 0x80, 0xFA, 0xC0, 0xFB, 0x00, 0xFB, 0x60,
-0xFB, 0xE1, 0xFC, 0x21, 0xFC, 0x42, 0xFC, 0x82, 0xFC, 0xC2, 0xFC, 0xC2, 0xFC, 0xE2, 0xFC, 0xE2,
-0xFC, 0xE3, 0xFC, 0x83, 0xFB, 0xA1, 0xF4, 0xA6, 0x3B, 0x8B, 0x1B, 0x08, 0x19, 0xC3, 0x10, 0xE0,
-0x10, 0x80, 0x18, 0x80, 0x28, 0xA0, 0xD2, 0xE0, 0xFB, 0x00, 0xFB, 0x80, 0xFC, 0x60, 0xFD, 0x80,
-0xFE, 0x60, 0xFF, 0x00, 0xFF, 0xA0, 0xFF, 0xE1, 0xFF, 0xE3, 0xFF, 0xE5, 0xFF, 0xE7, 0xFF, 0xE9,
-0x6B, 0x95, 0x73, 0x95, 0x73, 0xB6, 0x7B, 0xB6, 0x83, 0xB6, 0x83, 0x96, 0x83, 0x95, 0x7B, 0x75,
-0x73, 0x76, 0x4A, 0xF9, 0x2A, 0xDC, 0x2B, 0x1D, 0x33, 0x3E, 0x3B, 0x5F, 0x3B, 0x7F, 0x43, 0xBF,
-0x4B, 0xFF, 0x54, 0x5F, 0x75, 0x3F, 0x75, 0x5F, 0x65, 0x1F, 0x64, 0xBF, 0x4B, 0x5E, 0x32, 0x9C,
-0x10, 0x8D, 0x50, 0x25, 0x60, 0x05, 0x60, 0x2C, 0x50, 0x0B, 0x68, 0x0A, 0x98, 0xCD, 0xC9, 0xF1,
-0xE2, 0x94, 0xFB, 0x57, 0xFB, 0xD9, 0xFC, 0x7B, 0xFC, 0xDC, 0xFD, 0x1D, 0xFD, 0x7D, 0xFD, 0xBE,
-0xFD, 0xDE, 0xFD, 0xFE, 0xFE, 0x5F, 0xFE, 0x9F, 0xFE, 0x7F, 0xFE, 0x5F, 0xFE, 0x3F, 0xFD, 0xFE,
-0xFE, 0x1E, 0xFE, 0xFF, 0xEC, 0xD6, 0xF1, 0xE2, 0xF0, 0x80, 0xF9, 0x44, 0xF9, 0x03, 0xF9, 0x01,
-0xF9, 0xA3, 0xF9, 0xA0, 0xFA, 0x01, 0xFA, 0x41, 0xFA, 0x80, 0xFA, 0xC1, 0xFB, 0x21, 0xFB, 0x80,
-0xFB, 0xE1, 0xFC, 0x22, 0xFC, 0x62, 0xFC, 0x62, 0xFC, 0xA2, 0xFC, 0xC1, 0xFC, 0xE2, 0xFC, 0xC2,
-0xFC, 0xE3, 0xFC, 0xA3, 0xFB, 0x82, 0xFC, 0x45, 0x42, 0x87, 0x11, 0xE5, 0x10, 0xA0, 0x10, 0x60,
-0x08, 0x20, 0x18, 0x00, 0xB2, 0x20, 0xFA, 0xE0, 0xFB, 0x40, 0xFC, 0x20, 0xFD, 0x20, 0xFE, 0x20,
-0xFE, 0xC0, 0xFF, 0x40, 0xFF, 0xC0, 0xFF, 0xE2, 0xFF, 0xE3, 0xFF, 0xE6, 0xFF, 0xE7, 0xFF, 0xE8,
-0x63, 0x54, 0x6B, 0x95, 0x73, 0x95, 0x73, 0xB6, 0x7B, 0x96, 0x83, 0xB6, 0x83, 0x96, 0x83, 0x96,
-0x7B, 0x75, 0x73, 0x77, 0x4B, 0x9D, 0x3B, 0x9E, 0x3B, 0x9F, 0x4B, 0xDF, 0x54, 0x3F, 0x64, 0xBF,
-0x64, 0xFF, 0x64, 0xFF, 0x64, 0xDF, 0x64, 0xDF, 0x54, 0x3F, 0x43, 0x3F, 0x32, 0xBD, 0x42, 0x5A,
-0x71, 0x2E, 0xC1, 0xAB, 0xD9, 0xCB, 0xDA, 0x0C, 0xD2, 0x2D, 0xA9, 0x4B, 0xA0, 0xED, 0xC9, 0xF1,
-0xEA, 0xB4, 0xFB, 0x57, 0xFB, 0xD9, 0xFC, 0x5A, 0xFC, 0xBC, 0xFD, 0x1C, 0xFD, 0x5D, 0xFD, 0xBE,
-0xFD, 0xFE, 0xFE, 0x1E, 0xFE, 0x5F, 0xFE, 0x7F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x3E, 0xFE, 0x1E,
-0xFE, 0x3E, 0xFE, 0xFF, 0xFD, 0x78, 0xFA, 0xE4, 0xF9, 0x00, 0xF9, 0x42, 0xF9, 0x23, 0xF9, 0x42,
-0xF9, 0xA1, 0xF9, 0xE1, 0xFB, 0x46, 0xFD, 0x0C, 0xFE, 0x50, 0xFE, 0x92, 0xFD, 0xCE, 0xFC, 0xA7,
-0xFC, 0x02, 0xFC, 0x21, 0xFC, 0x62, 0xFC, 0x82, 0xFC, 0x81, 0xFC, 0xE2, 0xFC, 0xE2, 0xFC, 0xE2,
-0xFC, 0xE2, 0xFC, 0xA3, 0xFB, 0xA0, 0xFC, 0x44, 0x49, 0xA4, 0x08, 0x60, 0x08, 0x00, 0x10, 0x20,
-0x38, 0x80, 0x99, 0xA0, 0xFB, 0x00, 0xFB, 0x20, 0xFB, 0xC0, 0xFC, 0xC0, 0xFD, 0xC0, 0xFE, 0x80,
-0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xE2, 0xFF, 0xE3, 0xFF, 0xE4, 0xFF, 0xE6, 0xFF, 0xE7, 0xFF, 0xE9,
-0x63, 0x53, 0x6B, 0x74, 0x6B, 0x95, 0x73, 0x95, 0x73, 0xB6, 0x7B, 0xB6, 0x83, 0xB6, 0x83, 0x96,
-0x7B, 0x95, 0x73, 0x76, 0x6B, 0xBA, 0x54, 0x7F, 0x5C, 0xDF, 0x5C, 0xDF, 0x54, 0x9F, 0x54, 0x9F,
-0x5C, 0xBF, 0x54, 0x5F, 0x43, 0xBF, 0x33, 0x1E, 0x2A, 0xBC, 0x3A, 0xBC, 0x5A, 0x59, 0xA9, 0xCF,
-0xD9, 0xAB, 0xE1, 0x69, 0xF1, 0x88, 0xF1, 0xC9, 0xF9, 0xEA, 0xFA, 0x2B, 0xEA, 0x4D, 0xD2, 0x30,
-0xEA, 0xB4, 0xFB, 0x56, 0xFB, 0xD8, 0xFC, 0x3A, 0xFC, 0xBB, 0xFD, 0x1C, 0xFD, 0x5D, 0xFD, 0x9E,
-0xFD, 0xDE, 0xFD, 0xFE, 0xFE, 0x3E, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x3E, 0xFE, 0x3E,
-0xFE, 0x5E, 0xFF, 0x1F, 0xFD, 0x78, 0xFC, 0x47, 0xF9, 0x60, 0xF9, 0x41, 0xF9, 0x42, 0xF9, 0x62,
-0xFA, 0x24, 0xFC, 0xAC, 0xFE, 0xF3, 0xFF, 0x96, 0xFF, 0xB7, 0xFF, 0xF9, 0xFF, 0xFA, 0xFF, 0xD9,
-0xFE, 0x71, 0xFC, 0x85, 0xFC, 0x83, 0xFC, 0xA3, 0xFC, 0xA1, 0xFC, 0xE2, 0xFC, 0xE2, 0xFC, 0xE2,
-0xFC, 0xE3, 0xFC, 0x61, 0xFB, 0xE1, 0xFC, 0xC4, 0x92, 0x43, 0x08, 0x00, 0x18, 0x20, 0x89, 0xC0,
-0xBA, 0x80, 0xFB, 0x00, 0xFB, 0x00, 0xFB, 0xA0, 0xFC, 0x80, 0xFD, 0x60, 0xFE, 0x40, 0xFE, 0xE0,
-0xFF, 0x60, 0xFF, 0xC2, 0xFF, 0xE3, 0xFF, 0xE4, 0xFF, 0xE5, 0xFF, 0xE6, 0xFF, 0xE8, 0xF7, 0xE9,
-0x63, 0x33, 0x63, 0x54, 0x6B, 0x95, 0x6B, 0x95, 0x73, 0x96, 0x7B, 0x96, 0x7B, 0x95, 0x83, 0xB6,
-0x83, 0x95, 0x7B, 0x75, 0x73, 0x77, 0x6B, 0xD9, 0x5B, 0xFC, 0x3B, 0x7E, 0x2B, 0x1E, 0x2A, 0xFD,
-0x22, 0xBC, 0x22, 0x7B, 0x22, 0x5A, 0x2A, 0x7B, 0x2A, 0x5B, 0x4A, 0x17, 0x99, 0x2B, 0xD1, 0x8A,
-0xE1, 0x07, 0xE9, 0x68, 0xF2, 0x0A, 0xFA, 0xAD, 0xFA, 0x6C, 0xFA, 0x8C, 0xFA, 0x8C, 0xF2, 0x8F,
-0xF2, 0xF3, 0xFB, 0x56, 0xFB, 0xD8, 0xFC, 0x3A, 0xFC, 0x9B, 0xFC, 0xFC, 0xFD, 0x3D, 0xFD, 0x9E,
-0xFD, 0xDE, 0xFD, 0xFE, 0xFE, 0x3E, 0xFE, 0x3E, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x1E, 0xFE, 0x3E,
-0xFE, 0x9F, 0xFF, 0x3F, 0xEC, 0x34, 0xFC, 0xC6, 0xFA, 0x81, 0xF9, 0x20, 0xF9, 0x61, 0xF9, 0xE5,
-0xFC, 0x0D, 0xFE, 0xB3, 0xFF, 0x75, 0xFF, 0xB7, 0xFF, 0xF8, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFB,
-0xFF, 0xFB, 0xFE, 0xD4, 0xFC, 0xA5, 0xFC, 0xC3, 0xFC, 0xA1, 0xFC, 0xC1, 0xFC, 0xE2, 0xFC, 0xE2,
-0xFC, 0xC1, 0xFC, 0x61, 0xFC, 0x82, 0xFD, 0x26, 0xAA, 0xA4, 0x20, 0x20, 0xA2, 0x40, 0xCB, 0x00,
-0xF3, 0x00, 0xFB, 0x20, 0xFB, 0x80, 0xFC, 0x20, 0xFD, 0x20, 0xFE, 0x00, 0xFE, 0xA0, 0xFF, 0x20,
-0xFF, 0x80, 0xFF, 0xC2, 0xFF, 0xE5, 0xFF, 0xE4, 0xFF, 0xE5, 0xFF, 0xE7, 0xFF, 0xE8, 0xF7, 0xE9,
-0x5B, 0x13, 0x63, 0x74, 0x6B, 0x74, 0x6B, 0x95, 0x73, 0x95, 0x73, 0x95, 0x7B, 0x95, 0x83, 0x96,
-0x83, 0x95, 0x7B, 0x75, 0x73, 0x55, 0x73, 0x97, 0x73, 0xB6, 0x3A, 0xB6, 0x11, 0xB8, 0x19, 0xF9,
-0x19, 0xF9, 0x19, 0xF9, 0x22, 0x3A, 0x22, 0x3B, 0x32, 0x3A, 0x58, 0x8B, 0xB9, 0x08, 0xD9, 0x07,
-0xE9, 0x48, 0xF1, 0xCA, 0xFA, 0x0B, 0xFA, 0xEE, 0xFB, 0x0F, 0xFB, 0x4F, 0xFA, 0xCD, 0xFA, 0x8D,
-0xFA, 0xD0, 0xFB, 0x56, 0xFB, 0xF9, 0xFC, 0x19, 0xFC, 0x7A, 0xFC, 0xFC, 0xFD, 0x3D, 0xFD, 0x9D,
-0xFD, 0xBE, 0xFD, 0xFE, 0xFE, 0x1E, 0xFE, 0x1E, 0xFE, 0x5E, 0xFE, 0x3E, 0xFE, 0x5E, 0xFE, 0x7E,
-0xFE, 0xDF, 0xFF, 0x1F, 0xD2, 0x4D, 0xFC, 0x47, 0xFC, 0x45, 0xF9, 0x40, 0xF9, 0xA3, 0xFB, 0x4C,
-0xFD, 0x70, 0xFF, 0x34, 0xFF, 0x96, 0xFF, 0xD8, 0xFF, 0xFA, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF, 0xFC,
-0xFF, 0xFC, 0xFF, 0xFB, 0xFE, 0x50, 0xFC, 0xC4, 0xFC, 0x81, 0xFC, 0xE1, 0xFD, 0x02, 0xFD, 0x03,
-0xFC, 0xC1, 0xFC, 0xE3, 0xFC, 0xE5, 0xFD, 0x66, 0xAA, 0xC3, 0xB2, 0xE0, 0xD3, 0x40, 0xF3, 0x40,
-0xFB, 0x40, 0xFB, 0x80, 0xFC, 0x20, 0xFC, 0xE0, 0xFD, 0xA0, 0xFE, 0x60, 0xFE, 0xE0, 0xFF, 0x60,
-0xFF, 0xA2, 0xFF, 0xE2, 0xFF, 0xE3, 0xFF, 0xE4, 0xFF, 0xE5, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xE8,
-0x5B, 0x13, 0x63, 0x53, 0x63, 0x54, 0x6B, 0x74, 0x6B, 0x95, 0x6B, 0x95, 0x73, 0x95, 0x7B, 0x96,
-0x83, 0x95, 0x83, 0x95, 0x7B, 0x54, 0x73, 0x75, 0x73, 0x96, 0x74, 0x17, 0x2A, 0x56, 0x11, 0xF8,
-0x11, 0xF9, 0x1A, 0x19, 0x1A, 0x3A, 0x22, 0x5A, 0x31, 0x73, 0x70, 0x25, 0xC0, 0xE7, 0xE1, 0x27,
-0xE9, 0xA9, 0xF2, 0x0B, 0xFA, 0xCD, 0xFC, 0x33, 0xFC, 0x74, 0xFC, 0x13, 0xFB, 0x0F, 0xFA, 0x8D,
-0xFA, 0x4C, 0xFB, 0x54, 0xFB, 0xF9, 0xFC, 0x3A, 0xFC, 0x9B, 0xFC, 0xDB, 0xFD, 0x3C, 0xFD, 0x9D,
-0xFD, 0xDE, 0xFD, 0xDE, 0xFD, 0xFE, 0xFE, 0x3E, 0xFE, 0x1E, 0xFE, 0x3E, 0xFE, 0x5F, 0xFE, 0x9F,
-0xFF, 0x1F, 0xFE, 0x7E, 0xA9, 0x07, 0xF2, 0x44, 0xFD, 0x26, 0xFA, 0xA3, 0xEA, 0x09, 0xF3, 0x8C,
-0xFD, 0xD0, 0xFF, 0x55, 0xFF, 0xB6, 0xFF, 0xF8, 0xFF, 0xFA, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0xFD,
-0xFF, 0xFC, 0xFF, 0xFB, 0xFF, 0xB8, 0xFD, 0x08, 0xFC, 0x81, 0xFC, 0xC0, 0xFC, 0xE1, 0xFC, 0xE2,
-0xFC, 0xE2, 0xFD, 0x03, 0xFD, 0x27, 0xFD, 0xA5, 0xDC, 0x42, 0xEC, 0xE0, 0xF3, 0x60, 0xFB, 0xA0,
-0xFB, 0xA0, 0xFC, 0x00, 0xFC, 0xA0, 0xFD, 0x60, 0xFE, 0x20, 0xFE, 0xA0, 0xFF, 0x20, 0xFF, 0x80,
-0xFF, 0xC1, 0xFF, 0xE2, 0xFF, 0xE3, 0xFF, 0xE4, 0xFF, 0xE5, 0xFF, 0xE6, 0xFF, 0xE7, 0xFF, 0xE8,
-0x5B, 0x12, 0x5B, 0x33, 0x63, 0x54, 0x63, 0x74, 0x6B, 0x95, 0x6B, 0x75, 0x73, 0x95, 0x73, 0x95,
-0x83, 0x96, 0x83, 0x95, 0x83, 0x95, 0x73, 0x34, 0x6B, 0x34, 0x7B, 0xF6, 0x6B, 0xF7, 0x19, 0xF7,
-0x11, 0xF9, 0x12, 0x1A, 0x1A, 0x3B, 0x22, 0x3A, 0x38, 0x6A, 0x80, 0x24, 0xC0, 0xE7, 0xE1, 0xA9,
-0xE9, 0xEB, 0xF2, 0xCE, 0xFB, 0xF2, 0xFD, 0x57, 0xFE, 0x5B, 0xFC, 0xF6, 0xFA, 0xEE, 0xFA, 0x4B,
-0xFA, 0x4B, 0xFA, 0x8E, 0xFB, 0xF8, 0xFC, 0x3A, 0xFC, 0x9B, 0xFC, 0xDC, 0xFD, 0x3D, 0xFD, 0x9D,
-0xFD, 0xDE, 0xFD, 0xFE, 0xFE, 0x1E, 0xFD, 0xFE, 0xFE, 0x1E, 0xFE, 0x5F, 0xFE, 0x9F, 0xFF, 0x1F,
-0xFF, 0x3F, 0xFC, 0xBA, 0x88, 0x84, 0xE8, 0xC2, 0xFC, 0x87, 0xF3, 0xA8, 0xD2, 0x09, 0xFC, 0x0C,
-0xFD, 0xD0, 0xFF, 0x13, 0xFF, 0xB6, 0xFF, 0xF9, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFD, 0xFF, 0xFB, 0xFF, 0xFA, 0xFE, 0x2F, 0xFC, 0xA1, 0xFC, 0xE2, 0xFD, 0x02, 0xFD, 0x02,
-0xFD, 0x23, 0xFD, 0x04, 0xFD, 0xA7, 0xFD, 0x84, 0xFE, 0xC3, 0xFD, 0x00, 0xFC, 0x20, 0xFB, 0xE0,
-0xFC, 0x00, 0xFC, 0x80, 0xFD, 0x40, 0xFD, 0xC0, 0xFE, 0x60, 0xFE, 0xE0, 0xFF, 0x40, 0xFF, 0xA0,
-0xFF, 0xC1, 0xFF, 0xE2, 0xFF, 0xE3, 0xFF, 0xE4, 0xFF, 0xE5, 0xFF, 0xE6, 0xFF, 0xE7, 0xFF, 0xE8,
@@ -9,12 +9,17 @@
 #include "lib/VectorTable.h"
 #include "lib/NVIC.h"
 #include "lib/GPIO.h"
-#include "lib/GPT.h"
 #include "lib/UART.h"
 #include "lib/Print.h"
 #include "lib/SPIMaster.h"
 
 #include "SSD1331.h"
+#include "SSD1331Frame.h"
+#include "SSD1331Render.h"
+#include "EventQueue.h"
+#include "Input.h"
+#include "Profile.h"
+#include "Placement.h"
 
 
 const uint8_t wheel[] = {
@@ -27,106 +32,105 @@ const uint8_t crayons[] = {
 
 
 static const uint32_t buttonAGpio = 12;
-static const int buttonPressCheckPeriodMs = 10;
-static void HandleButtonTimerIrq(GPT *);
-
-typedef struct CallbackNode {
-    bool enqueued;
-    struct CallbackNode *next;
-    void (*cb)(void);
-} CallbackNode;
-
-static void EnqueueCallback(CallbackNode *node);
 
 static UART      *debug   = NULL;
 static SSD1331   *display = NULL;
+static SSD1331_Frame *frame = NULL;
+static void FramePresented(SSD1331_Frame *handle, bool success);
 static unsigned   image = 0;
-static GPT *buttonTimeout = NULL;
 
-static void HandleButtonTimerIrqDeferred(void)
+// Double buffered in SYSRAM, so a frame is drawn while the last is sent by DMA.
+static SYSRAM_DATA uint16_t framePixels[2][SSD1331_WIDTH * SSD1331_HEIGHT];
+
+static bool framePending = false;
+
+// Each upload's result and each button press is passed to the main loop. Only
+// one upload is in flight at a time.
+EVENT_QUEUE_DEFINE(frameEvents, bool, 2);
+EVENT_QUEUE_DEFINE(buttonEvents, Input_Event, 4);
+
+static void PresentFrame(void)
 {
-    // Assume initial state is high, i.e. button not pressed.
-    static bool prevState = true;
-    bool newState;
-    GPIO_Read(buttonAGpio, &newState);
-
-    if (newState != prevState) {
-        bool pressed = !newState;
-        if (pressed) {
-            image = (image + 1) % 2;
-            if (image == 0) {
-                SSD1331_Upload(display, wheel, sizeof(wheel));
-            } else {
-                SSD1331_Upload(display, crayons, sizeof(crayons));
-            }
-        }
+    if (SSD1331_FrameBusy(frame)) {
+        framePending = true;
+    } else if (!SSD1331_FramePresent(frame, FramePresented)) {
+        UART_Print(debug, "ERROR: Failed to start display upload\r\n");
+    }
+}
 
-        prevState = newState;
+static void FramePresentedDeferred(void *payload)
+{
+    bool *success = payload;
+    if (!*success) {
+        UART_Print(debug, "ERROR: Display upload failed\r\n");
+    }
+    if (framePending) {
+        framePending = false;
+        PresentFrame();
     }
 }
 
-static void HandleButtonTimerIrq(GPT *handle)
+static void FramePresented(SSD1331_Frame *handle, bool success)
 {
     (void)handle;
-    static CallbackNode cbn = {.enqueued = false, .cb = HandleButtonTimerIrqDeferred};
-    EnqueueCallback(&cbn);
+    EventQueue_Post(&frameEvents, &success);
 }
 
-static CallbackNode *volatile callbacks = NULL;
-
-static void EnqueueCallback(CallbackNode *node)
+// Draws an image with its name over the bottom, rendered at runtime.
+static void ShowImage(const uint8_t *data, const char *name)
 {
-    uint32_t prevBasePri = NVIC_BlockIRQs();
-    if (!node->enqueued) {
-        CallbackNode *prevHead = callbacks;
-        node->enqueued = true;
-        callbacks = node;
-        node->next = prevHead;
-    }
-    NVIC_RestoreIRQs(prevBasePri);
+    SSD1331_FrameLoad(frame, 0, 0, SSD1331_WIDTH, SSD1331_HEIGHT, data);
+
+    const int captionY = (SSD1331_HEIGHT - SSD1331_FONT_HEIGHT - 2);
+    SSD1331_RenderGradient(frame, 0, captionY, SSD1331_WIDTH, (SSD1331_FONT_HEIGHT + 2),
+        SSD1331_RGB(0, 0, 96), SSD1331_RGB(0, 0, 0), false);
+    SSD1331_RenderText(frame, 2, (captionY + 1), name, SSD1331_RGB(255, 255, 255), NULL);
+
+    PresentFrame();
 }
 
-static void InvokeCallbacks(void)
+static void HandleButtonDeferred(void *payload)
 {
-    CallbackNode *node;
-    do {
-        uint32_t prevBasePri = NVIC_BlockIRQs();
-        node = callbacks;
-        if (node) {
-            node->enqueued = false;
-            callbacks = node->next;
-        }
-        NVIC_RestoreIRQs(prevBasePri);
-
-        if (node) {
-            (*node->cb)();
+    const Input_Event *event = payload;
+    if (event->pressed) {
+        image = (image + 1) % 2;
+        // Only the pixels which differ between the images are sent.
+        if (image == 0) {
+            ShowImage(wheel, "Colour wheel");
+        } else {
+            ShowImage(crayons, "Crayons");
         }
-    } while (node);
+        PROFILE_PRINT(debug, false);
+    }
 }
 
 _Noreturn void RTCoreMain(void)
 {
     VectorTableInit();
     CPUFreq_Set(26000000);
+    PROFILE_INIT(NULL);
 
     debug = UART_Open(MT3620_UNIT_UART_DEBUG, 115200, UART_PARITY_NONE, 1, NULL);
     UART_Print(debug, "--------------------------------\r\n");
     UART_Print(debug, "SPI_SSD1331_RTApp_MT3620_BareMetal\r\n");
     UART_Print(debug, "App built on: " __DATE__ " " __TIME__ "\r\n");
 
+    EventQueue_Init(&frameEvents, 0, FramePresentedDeferred);
+    EventQueue_Init(&buttonEvents, 1, HandleButtonDeferred);
+
     // Set the pins as outputs.
     GPIO_ConfigurePinForOutput(0);
     GPIO_ConfigurePinForOutput(1);
     GPIO_ConfigurePinForOutput(2);
     GPIO_ConfigurePinForOutput(3);
 
-    GPIO_ConfigurePinForInput(buttonAGpio);
-
     SPIMaster *driver = SPIMaster_Open(MT3620_UNIT_ISU1);
     if (!driver) {
         UART_Print(debug,
             "ERROR: SPI initialisation failed\r\n");
     }
+    // Send frames as large transfers rather than a FIFO at a time.
+    SPIMaster_DMAEnable(driver, true);
 
     display = SSD1331_Open(driver, 0, 1, 2, 3);
     if (!display) {
@@ -135,22 +139,22 @@ _Noreturn void RTCoreMain(void)
         while (true);
     }
 
-    SSD1331_Upload(display, wheel, sizeof(wheel));
-
-    // Setup GPT1 to poll for button press
-    if (!(buttonTimeout = GPT_Open(MT3620_UNIT_GPT1, 1000, GPT_MODE_REPEAT))) {
-        UART_Print(debug, "ERROR: Opening timer\r\n");
+    frame = SSD1331_FrameOpenDouble(display, framePixels[0], framePixels[1]);
+    if (!frame) {
+        UART_Print(debug,
+            "ERROR: Failed to setup framebuffer\r\n");
+        while (true);
     }
-    int32_t error;
 
-    if ((error = GPT_StartTimeout(buttonTimeout, buttonPressCheckPeriodMs,
-                                  GPT_UNITS_MILLISEC, &HandleButtonTimerIrq)) != ERROR_NONE) {
-        UART_Printf(debug, "ERROR: Starting timer (%ld)\r\n", error);
+    ShowImage(wheel, "Colour wheel");
+
+    if (!Input_Open(buttonAGpio, INPUT_EDGE_PRESS, &buttonEvents)) {
+        UART_Print(debug, "ERROR: Configuring button interrupt\r\n");
     }
 
     for (;;) {
         __asm__("wfi");
-        InvokeCallbacks();
+        EventQueue_Dispatch();
     }
 
     SSD1331_Close(display);
@@ -1,65 +0,0 @@
-// https://ccsearch.creativecommons.org/photos/12340fcc-d383-499f-92d2-d20739033d1f
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x04,0x69,0x06,0xdd,0x06,0xee,0x0b,0xf7,0x0a,0xff,0x0b,0xff,0x0b,0xff,0x0b,0xff,0x0b,0xff,0x0f,0xf7,0x0b,0xee,0x0f,0xd5,0x07,0xa2,0x03,0x28,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x58,0x05,0x98,0x07,0xc0,0x07,0xd0,0x03,0xd8,0x07,0xd8,0x06,0xd8,0x03,0xd8,0x02,0xd8,0x01,0xb8,0x05,0x60,0x01,0x10,0x04,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x8a,0x03,0xcc,0x05,0xe6,0x07,0xf6,0x0e,0xff,0x0b,0xff,0x0b,0xff,0x0f,0xff,0x0b,0xff,0x0b,0xf7,0x0f,0xf6,0x0f,0xdd,0x06,0xb3,0x06,0x38,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x03,0x60,0x05,0xa0,0x07,0xc8,0x07,0xd8,0x06,0xd8,0x07,0xd8,0x06,0xd8,0x02,0xd8,0x02,0xd0,0x01,0xc0,0x07,0xa8,0x05,0x70,0x05,0x20,0x06,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x03,0x51,0x07,0x00,0x03,0x00,0x02,0x49,0x02,0xb3,0x05,0xdd,0x07,0xee,0x0f,0xff,0x0f,0xff,0x0c,0xff,0x0c,0xff,0x0b,0xff,0x0b,0xff,0x0a,0xf6,0x0d,0xe6,0x07,0xc3,0x06,0x59,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x04,0x70,0x05,0xb0,0x07,0xc8,0x03,0xd8,0x07,0xd8,0x06,0xd8,0x03,0xd8,0x03,0xd8,0x03,0xd0,0x01,0xb8,0x05,0x98,0x07,0x60,0x05,0x20,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x18,0x02,0xac,0x05,0xde,0x07,0xa4,0x03,0x39,0x05,0x00,0x00,0x18,0x04,0x8a,0x07,0xd4,0x05,0xee,0x0e,0xf7,0x0a,0xff,0x0c,0xff,0x0d,0xff,0x0c,0xff,0x0b,0xff,0x0b,0xf7,0x0a,0xee,0x07,0xcc,0x07,0x71,0x06,0x00,0x00,0x00,0x00,0x00,0x01,0x20,0x05,0x78,0x05,0xb0,0x01,0xd0,0x03,0xd8,0x07,0xd8,0x07,0xd8,0x03,0xd8,0x02,0xd8,0x02,0xc8,0x07,0xb0,0x05,0x80,0x05,0x48,0x01,0x08,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x41,0x05,0xd6,0x06,0xf7,0x07,0xe7,0x07,0xce,0x04,0x93,0x07,0x28,0x03,0x00,0x00,0x51,0x07,0xbb,0x07,0xe5,0x07,0xf6,0x0f,0xff,0x0b,0xff,0x0d,0xff,0x0c,0xff,0x0c,0xff,0x0b,0xf7,0x0f,0xee,0x0d,0xd5,0x05,0x8a,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x28,0x07,0x88,0x07,0xb8,0x01,0xd0,0x06,0xe0,0x07,0xd8,0x07,0xd8,0x06,0xd8,0x02,0xd0,0x03,0xc0,0x05,0xa0,0x05,0x68,0x05,0x28,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x07,0xef,0x09,0xff,0x0f,0xf7,0x09,0xef,0x07,0xe6,0x06,0xc5,0x06,0x72,0x06,0x10,0x05,0x10,0x00,0x92,0x03,0xd5,0x07,0xee,0x0d,0xff,0x0b,0xff,0x0e,0xff,0x0d,0xff,0x0c,0xff,0x0b,0xff,0x0b,0xf6,0x0b,0xdd,0x07,0xa2,0x03,0x10,0x07,0x00,0x00,0x00,0x00,0x38,0x01,0x90,0x07,0xc0,0x01,0xd8,0x07,0xe0,0x07,0xd8,0x06,0xd8,0x03,0xd8,0x02,0xd0,0x07,0xb8,0x07,0x90,0x05,0x50,0x03,0x08,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x06,0x48,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x41,0x02,0xef,0x09,0xff,0x0f,0xff,0x0f,0xff,0x0d,0xf7,0x09,0xef,0x07,0xde,0x05,0xb5,0x03,0x52,0x03,0x00,0x01,0x49,0x03,0xc3,0x04,0xe6,0x07,0xf7,0x0b,0xff,0x0d,0xff,0x0e,0xff,0x0e,0xff,0x0c,0xff,0x0b,0xf7,0x0a,0xe5,0x07,0xb3,0x06,0x20,0x05,0x00,0x00,0x00,0x00,0x40,0x03,0xa0,0x07,0xc8,0x01,0xe0,0x02,0xe0,0x07,0xe0,0x06,0xd8,0x03,0xd8,0x03,0xc8,0x05,0xb0,0x05,0x78,0x05,0x30,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x04,0x50,0x03,0x90,0x07,0x88,0x05,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x07,0xde,0x0f,0xf7,0x0a,0xff,0x0f,0xff,0x0e,0xff,0x0e,0xff,0x0d,0xf7,0x0f,0xef,0x07,0xd6,0x05,0xac,0x07,0x31,0x01,0x08,0x05,0x92,0x07,0xdd,0x06,0xf6,0x0b,0xff,0x0f,0xff,0x0f,0xff,0x0e,0xff,0x0d,0xff,0x0b,0xf7,0x0b,0xee,0x0a,0xc3,0x07,0x30,0x05,0x00,0x00,0x00,0x00,0x50,0x03,0xa8,0x07,0xd0,0x02,0xe0,0x02,0xe0,0x07,0xe0,0x06,0xd8,0x03,0xd8,0x03,0xc0,0x05,0x98,0x05,0x58,0x03,0x08,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x38,0x00,0x80,0x05,0xa8,0x07,0xc8,0x01,0xb0,0x01,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x05,0xd6,0x07,0xef,0x0f,0xf7,0x0e,0xf7,0x0b,0xff,0x0e,0xff,0x0e,0xff,0x0e,0xff,0x0d,0xf7,0x0f,0xef,0x07,0xd6,0x07,0x93,0x07,0x18,0x00,0x40,0x07,0xc4,0x06,0xee,0x0d,0xff,0x0f,0xff,0x0f,0xff,0x0d,0xff,0x0d,0xff,0x0f,0xff,0x0f,0xee,0x0b,0xcc,0x05,0x48,0x07,0x00,0x00,0x00,0x01,0x60,0x05,0xb0,0x07,0xd8,0x06,0xe0,0x02,0xe0,0x07,0xd8,0x06,0xd8,0x02,0xd0,0x07,0xb8,0x05,0x80,0x05,0x30,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x18,0x05,0x68,0x05,0xa0,0x07,0xc0,0x01,0xd0,0x06,0xd8,0x02,0xa8,0x01,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x04,0xb5,0x07,0xd6,0x06,0xe7,0x08,0xef,0x0a,0xf7,0x0a,0xff,0x0f,0xff,0x0e,0xff,0x0f,0xff,0x0e,0xff,0x0d,0xf7,0x0f,0xe7,0x06,0xce,0x05,0x6a,0x05,0x10,0x02,0x92,0x07,0xe5,0x06,0xf7,0x0b,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0c,0xff,0x0b,0xf6,0x09,0xd4,0x07,0x61,0x01,0x00,0x00,0x00,0x02,0x70,0x05,0xc0,0x07,0xd8,0x07,0xe0,0x03,0xe0,0x07,0xe0,0x02,0xd8,0x01,0xc8,0x05,0xa8,0x05,0x60,0x03,0x18,0x05,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x50,0x03,0x98,0x07,0xb8,0x01,0xd0,0x03,0xd8,0x07,0xd8,0x07,0xe0,0x07,0x88,0x05,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x73,0x02,0xad,0x05,0xc6,0x06,0xde,0x07,0xef,0x0e,0xf7,0x0f,0xff,0x0e,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0d,0xf7,0x07,0xe7,0x06,0xbd,0x06,0x39,0x01,0x40,0x05,0xcc,0x05,0xee,0x0d,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0d,0xff,0x0b,0xf6,0x0f,0xdd,0x06,0x71,0x03,0x00,0x00,0x08,0x03,0x80,0x05,0xc8,0x07,0xe0,0x07,0xe0,0x02,0xe0,0x07,0xd8,0x02,0xd8,0x02,0xc0,0x05,0x90,0x05,0x40,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x07,0x80,0x07,0xb8,0x01,0xc8,0x02,0xd8,0x07,0xd8,0x03,0xd8,0x07,0xd8,0x06,0xe0,0x02,0x78,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x07,0x6a,0x07,0x94,0x07,0xb5,0x06,0xce,0x06,0xde,0x07,0xef,0x09,0xf7,0x0b,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0d,0xef,0x07,0xde,0x07,0x9c,0x07,0x10,0x00,0x92,0x07,0xe5,0x07,0xff,0x0f,0xff,0x0e,0xff,0x0d,0xff,0x0e,0xff,0x0c,0xf7,0x0b,0xe5,0x06,0x8a,0x02,0x00,0x00,0x10,0x04,0x90,0x05,0xd0,0x02,0xe0,0x03,0xe0,0x02,0xe0,0x07,0xd8,0x03,0xd0,0x07,0xb0,0x05,0x70,0x03,0x18,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x03,0x68,0x05,0xa8,0x07,0xc8,0x01,0xd8,0x07,0xe0,0x03,0xd8,0x02,0xd8,0x07,0xd8,0x03,0xd0,0x02,0xd0,0x07,0x68,0x07,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x28,0x07,0x62,0x07,0x94,0x07,0xbd,0x04,0xd6,0x07,0xe7,0x07,0xf7,0x0d,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xf7,0x0b,0xef,0x07,0xd6,0x07,0x72,0x06,0x28,0x05,0xcc,0x07,0xf6,0x0b,0xff,0x0d,0xff,0x0d,0xff,0x0e,0xff,0x0d,0xff,0x0f,0xee,0x07,0x9a,0x07,0x00,0x01,0x18,0x04,0xa0,0x07,0xd8,0x02,0xe0,0x02,0xe0,0x06,0xe0,0x03,0xd8,0x03,0xc8,0x05,0x98,0x05,0x40,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x02,0x98,0x07,0xc8,0x02,0xd8,0x06,0xe0,0x02,0xd8,0x02,0xd8,0x07,0xd8,0x03,0xd8,0x03,0xd0,0x01,0xd0,0x07,0xc0,0x05,0x28,0x03,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x04,0x5a,0x01,0x94,0x03,0xbd,0x04,0xd6,0x07,0xef,0x07,0xf7,0x08,0xff,0x0e,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xf7,0x0a,0xef,0x06,0xc5,0x06,0x41,0x05,0x82,0x07,0xee,0x0f,0xff,0x0b,0xff,0x0f,0xff,0x0f,0xff,0x0e,0xff,0x0b,0xf6,0x08,0xaa,0x07,0x08,0x03,0x20,0x05,0xb0,0x05,0xd8,0x06,0xe0,0x03,0xe0,0x03,0xe0,0x02,0xd8,0x01,0xb8,0x05,0x78,0x05,0x10,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x05,0x80,0x07,0xc0,0x01,0xd0,0x06,0xe0,0x02,0xe0,0x03,0xd8,0x06,0xd8,0x02,0xd8,0x01,0xd0,0x01,0xd0,0x01,0xc0,0x05,0xb0,0x05,0x80,0x03,0x08,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x41,0x07,0x8b,0x07,0xbd,0x05,0xde,0x06,0xef,0x07,0xf7,0x0b,0xff,0x0e,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0e,0xf7,0x0f,0xe7,0x07,0xa4,0x07,0x41,0x03,0xcc,0x07,0xf7,0x0a,0xff,0x0e,0xff,0x0d,0xff,0x0f,0xff,0x0b,0xf6,0x09,0xbb,0x06,0x10,0x05,0x28,0x07,0xc0,0x05,0xe0,0x06,0xe8,0x03,0xe0,0x03,0xd8,0x03,0xd0,0x05,0xa0,0x05,0x40,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x58,0x03,0xb0,0x01,0xd0,0x06,0xe0,0x02,0xe0,0x03,0xd8,0x06,0xd8,0x03,0xd8,0x01,0xd0,0x02,0xd0,0x01,0xc0,0x05,0xb0,0x05,0x90,0x05,0x68,0x05,0x30,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x2b,0x06,0x22,0x07,0x11,0x03,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x31,0x03,0x7b,0x06,0xbd,0x03,0xde,0x05,0xef,0x07,0xf7,0x0b,0xff,0x0f,0xff,0x0f,0xff,0x0f,0xff,0x0b,0xff,0x0f,0xff,0x0f,0xf7,0x07,0xde,0x07,0x5a,0x06,0x69,0x06,0xe5,0x07,0xff,0x0a,0xff,0x0d,0xff,0x0f,0xff,0x0e,0xfe,0x0f,0xc4,0x06,0x18,0x02,0x28,0x05,0xc0,0x03,0xe0,0x06,0xe8,0x07,0xe0,0x02,0xd8,0x07,0xc0,0x03,0x78,0x03,0x10,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x05,0x98,0x01,0xc8,0x06,0xd8,0x03,0xe0,0x07,0xe0,0x07,0xd8,0x03,0xd8,0x01,0xd8,0x01,0xd0,0x01,0xc0,0x05,0xb0,0x07,0x90,0x05,0x68,0x03,0x38,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x06,0x4c,0x0e,0x3c,0x0f,0x33,0x0c,0x22,0x05,0x11,0x03,0x08,0x03,0x00,0x01,0x00,0x00,0x18,0x02,0x62,0x03,0xad,0x07,0xde,0x05,0xef,0x07,0xf7,0x0a,0xff,0x0e,0xff,0x0f,0xff,0x0b,0xff,0x0f,0xff,0x0b,0xff,0x0d,0xf7,0x07,0xc5,0x05,0x20,0x00,0x8a,0x07,0xf6,0x07,0xff,0x0b,0xff,0x0d,0xff,0x0f,0xff,0x0e,0xd4,0x07,0x28,0x07,0x18,0x04,0xc0,0x03,0xe8,0x06,0xe8,0x06,0xe0,0x02,0xd8,0x07,0xa8,0x05,0x40,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x78,0x05,0xc0,0x03,0xd8,0x03,0xe1,0x03,0xe0,0x03,0xd8,0x03,0xd8,0x01,0xd8,0x02,0xd0,0x07,0xc8,0x05,0xb0,0x05,0x88,0x05,0x60,0x03,0x30,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x7d,0x17,0x75,0x17,0x65,0x0f,0x54,0x0d,0x44,0x0f,0x3c,0x0f,0x2b,0x06,0x1a,0x07,0x08,0x01,0x00,0x00,0x00,0x03,0x39,0x01,0x9c,0x03,0xd6,0x07,0xef,0x07,0xf7,0x07,0xff,0x0f,0xff,0x0f,0xff,0x0b,0xff,0x0b,0xff,0x0b,0xff,0x0b,0xef,0x07,0x93,0x07,0x10,0x06,0xb3,0x07,0xf6,0x0e,0xff,0x0f,0xff,0x0f,0xff,0x0b,0xdd,0x07,0x30,0x07,0x08,0x02,0xb0,0x03,0xe8,0x03,0xe8,0x06,0xe0,0x02,0xd0,0x05,0x80,0x05,0x08,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0xb8,0x01,0xd8,0x03,0xe1,0x03,0xe0,0x03,0xd8,0x06,0xd8,0x03,0xd8,0x01,0xd0,0x07,0xc0,0x05,0xa8,0x05,0x88,0x05,0x58,0x03,0x28,0x07,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x07,0x9e,0x16,0x8d,0x15,0x85,0x17,0x75,0x13,0x6d,0x17,0x65,0x0f,0x55,0x0e,0x45,0x0b,0x3c,0x09,0x22,0x07,0x08,0x01,0x00,0x01,0x18,0x04,0x7b,0x06,0xc6,0x04,0xe7,0x07,0xf7,0x07,0xff,0x0f,0xff,0x0a,0xff,0x0b,0xff,0x0a,0xff,0x0f,0xff,0x0a,0xe6,0x05,0x51,0x07,0x48,0x03,0xdd,0x07,0xff,0x09,0xff,0x0f,0xff,0x0b,0xe5,0x07,0x49,0x01,0x00,0x00,0xa0,0x03,0xe8,0x02,0xe8,0x03,0xd8,0x01,0xb8,0x05,0x38,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x03,0x90,0x07,0xd0,0x02,0xe1,0x03,0xe0,0x06,0xd8,0x05,0xd8,0x01,0xd8,0x01,0xd0,0x01,0xc8,0x03,0xb0,0x03,0x88,0x07,0x50,0x02,0x20,0x05,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x04,0x30,0x01,0x81,0x07,0x30,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x11,0xae,0x1d,0xa6,0x17,0x9e,0x17,0x96,0x15,0x95,0x17,0x8e,0x16,0x86,0x13,0x76,0x17,0x6e,0x17,0x5d,0x0e,0x44,0x0a,0x2a,0x07,0x09,0x03,0x08,0x00,0x52,0x01,0xad,0x03,0xde,0x05,0xf7,0x07,0xff,0x0d,0xff,0x0a,0xff,0x0b,0xff,0x0a,0xff,0x0f,0xf7,0x07,0xc5,0x07,0x28,0x04,0x92,0x05,0xf6,0x06,0xff,0x0f,0xff,0x0e,0xee,0x07,0x51,0x05,0x00,0x00,0xa0,0x05,0xe8,0x03,0xe0,0x02,0xd8,0x06,0x88,0x05,0x08,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x50,0x03,0xc8,0x07,0xe0,0x06,0xe0,0x07,0xe0,0x03,0xd8,0x07,0xd8,0x01,0xd8,0x01,0xc8,0x05,0xb0,0x07,0xaa,0x06,0x71,0x03,0x20,0x03,0x00,0x00,0x10,0x06,0x20,0x05,0x48,0x07,0x82,0x03,0xab,0x03,0xc4,0x06,0xb3,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x05,0xa6,0x16,0xb6,0x1f,0xae,0x1e,0xae,0x19,0xae,0x17,0xae,0x17,0xa6,0x17,0xa6,0x17,0xa6,0x17,0x9e,0x17,0x8e,0x17,0x7e,0x13,0x66,0x12,0x4d,0x0b,0x2b,0x06,0x08,0x03,0x20,0x06,0x8b,0x06,0xd6,0x07,0xef,0x07,0xff,0x0f,0xff,0x09,0xff,0x0e,0xff,0x0f,0xff,0x0f,0xef,0x07,0x73,0x07,0x38,0x03,0xcb,0x07,0xff,0x0d,0xff,0x0e,0xf6,0x0b,0x61,0x03,0x00,0x02,0xa0,0x03,0xe0,0x02,0xe0,0x02,0xc0,0x03,0x38,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x03,0xa8,0x03,0xe0,0x07,0xe9,0x03,0xe0,0x07,0xd8,0x07,0xd8,0x07,0xd8,0x07,0xc0,0x05,0xa0,0x05,0x70,0x03,0x48,0x03,0x18,0x07,0x00,0x02,0x62,0x07,0xad,0x0f,0xc5,0x0d,0xc4,0x0a,0xcc,0x07,0xdd,0x07,0xe5,0x07,0xe6,0x09,0x41,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x06,0xb6,0x1f,0xbf,0x1f,0xb6,0x1f,0xb6,0x1d,0xb6,0x19,0xb6,0x1a,0xb6,0x1b,0xb6,0x1d,0xbf,0x1b,0xbf,0x1a,0xb7,0x19,0xaf,0x19,0xa7,0x17,0x8f,0x15,0x6e,0x14,0x4d,0x0f,0x2a,0x07,0x08,0x03,0x5a,0x03,0xc5,0x06,0xef,0x06,0xf7,0x07,0xff,0x07,0xff,0x07,0xff,0x0e,0xff,0x0d,0xde,0x05,0x20,0x05,0x79,0x01,0xed,0x07,0xff,0x0f,0xf6,0x0b,0x72,0x02,0x08,0x03,0xa8,0x01,0xe8,0x07,0xe0,0x07,0x90,0x03,0x08,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x60,0x03,0xd8,0x07,0xe9,0x03,0xe0,0x07,0xe0,0x01,0xd8,0x05,0xd8,0x07,0xc0,0x05,0xa0,0x05,0x68,0x03,0x30,0x01,0x10,0x06,0x20,0x07,0x61,0x06,0xa2,0x03,0xcc,0x06,0xe6,0x0d,0xee,0x0f,0xee,0x0d,0xee,0x0b,0xf6,0x0a,0xf7,0x0a,0x8b,0x05,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x0b,0xbf,0x1f,0xbf,0x1a,0xbf,0x1f,0xbf,0x1e,0xbf,0x1b,0xbf,0x1b,0xbf,0x1b,0xbf,0x1f,0xc7,0x1b,0xc7,0x1f,0xc7,0x1f,0xc7,0x1b,0xc7,0x1b,0xbf,0x1a,0xaf,0x1d,0x97,0x17,0x76,0x17,0x55,0x0b,0x22,0x06,0x31,0x03,0x8c,0x03,0xde,0x07,0xf7,0x07,0xff,0x07,0xff,0x07,0xff,0x0e,0xff,0x07,0xa4,0x07,0x18,0x06,0xc3,0x07,0xff,0x0c,0xff,0x0f,0x82,0x07,0x10,0x04,0xb0,0x03,0xe8,0x07,0xc8,0x05,0x38,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x04,0xc8,0x06,0xe8,0x07,0xe0,0x02,0xe0,0x01,0xd8,0x07,0xd8,0x07,0xc0,0x03,0x98,0x05,0x58,0x01,0x20,0x07,0x28,0x03,0x61,0x01,0xaa,0x03,0xcc,0x04,0xdd,0x06,0xe6,0x07,0xee,0x0f,0xf6,0x0f,0xf7,0x0c,0xf7,0x0f,0xf7,0x0d,0xff,0x0d,0xcd,0x0d,0x10,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x7c,0x16,0xbf,0x1b,0xbf,0x1f,0xbf,0x1f,0xbf,0x1a,0xbf,0x1a,0xbf,0x1b,0xbf,0x1b,0xc7,0x1a,0xc7,0x1f,0xc7,0x1f,0xc7,0x1b,0xcf,0x1b,0xcf,0x1b,0xcf,0x1f,0xcf,0x1f,0xc7,0x1a,0xb7,0x19,0x9f,0x17,0x86,0x13,0x55,0x0b,0x32,0x07,0x52,0x05,0xad,0x07,0xe7,0x07,0xf7,0x05,0xff,0x06,0xff,0x0f,0xf7,0x07,0x5a,0x03,0x59,0x02,0xf6,0x07,0xff,0x0b,0x93,0x03,0x18,0x05,0xc0,0x03,0xe8,0x07,0x88,0x05,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x88,0x03,0xe0,0x07,0xe8,0x03,0xe0,0x03,0xe0,0x05,0xd8,0x05,0xb8,0x03,0x88,0x05,0x40,0x00,0x30,0x07,0x71,0x07,0xab,0x03,0xd4,0x07,0xe5,0x06,0xee,0x0b,0xf6,0x09,0xf7,0x0a,0xf7,0x0f,0xff,0x0f,0xff,0x0b,0xff,0x0d,0xff,0x0c,0xff,0x0c,0xff,0x0d,0x20,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x01,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x07,0x85,0x17,0xaf,0x1d,0xb7,0x1d,0xb7,0x1e,0xbf,0x1f,0xbf,0x1f,0xc7,0x1b,0xc7,0x1f,0xc7,0x1f,0xc7,0x1b,0xc7,0x1b,0xc7,0x1b,0xcf,0x1b,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xbf,0x1b,0xaf,0x17,0x8f,0x12,0x55,0x0b,0x22,0x03,0x52,0x01,0xb5,0x07,0xe7,0x05,0xff,0x07,0xff,0x0f,0xd6,0x07,0x28,0x03,0xbb,0x03,0xff,0x0d,0xa3,0x04,0x28,0x00,0xd8,0x03,0xd0,0x07,0x20,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x30,0x06,0xd0,0x06,0xe8,0x02,0xe0,0x03,0xe0,0x07,0xd0,0x05,0xb8,0x03,0x78,0x03,0x48,0x06,0x69,0x01,0xb3,0x05,0xdc,0x07,0xe5,0x07,0xee,0x0b,0xf6,0x0d,0xf7,0x0a,0xf7,0x0f,0xff,0x0f,0xf7,0x0b,0xf6,0x0f,0xe6,0x0b,0xc4,0x07,0xa3,0x05,0x7a,0x07,0x61,0x07,0x18,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x07,0x7e,0x16,0x8f,0x17,0x97,0x17,0x9f,0x17,0xa7,0x19,0xaf,0x1b,0xb7,0x1e,0xbf,0x1f,0xbf,0x1a,0xc7,0x1b,0xc7,0x1b,0xc7,0x1b,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1b,0xb7,0x17,0x8e,0x15,0x4c,0x09,0x2a,0x02,0x63,0x01,0xbe,0x03,0xf7,0x07,0xff,0x06,0x7b,0x07,0x40,0x00,0xfe,0x07,0xb4,0x07,0x40,0x03,0xe0,0x05,0x80,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x88,0x07,0xe8,0x02,0xe0,0x06,0xe0,0x07,0xd0,0x05,0xb0,0x03,0x70,0x05,0x58,0x01,0x89,0x02,0xb3,0x03,0xb3,0x04,0xab,0x06,0xb3,0x05,0xd5,0x07,0xcd,0x0b,0xbc,0x06,0xab,0x07,0x92,0x07,0x79,0x02,0x61,0x01,0x50,0x07,0x50,0x00,0x50,0x03,0x50,0x05,0x61,0x03,0x51,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x07,0x5e,0x0f,0x66,0x0f,0x6e,0x13,0x6e,0x17,0x7e,0x13,0x87,0x14,0x8f,0x17,0x97,0x17,0x9f,0x19,0xa7,0x1b,0xb7,0x1d,0xb7,0x1a,0xbf,0x1b,0xc7,0x1b,0xc7,0x1f,0xc7,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x1f,0xd7,0x1f,0xcf,0x1f,0xb7,0x17,0x86,0x12,0x4c,0x07,0x3a,0x05,0x8c,0x07,0xe7,0x04,0xee,0x07,0x20,0x05,0xbb,0x04,0xc5,0x06,0x60,0x07,0xd8,0x03,0x28,0x05,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x01,0xe0,0x03,0xe8,0x03,0xe0,0x07,0xd8,0x05,0xa0,0x05,0x58,0x04,0x40,0x00,0x58,0x07,0x68,0x05,0x70,0x05,0x70,0x05,0x70,0x07,0x71,0x03,0x79,0x03,0x71,0x03,0x68,0x07,0x60,0x05,0x58,0x03,0x58,0x01,0x69,0x05,0x82,0x06,0x9b,0x04,0xb4,0x07,0xd5,0x0c,0xde,0x09,0xee,0x0d,0x20,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x07,0x33,0x07,0x34,0x0c,0x44,0x09,0x45,0x0f,0x4d,0x0d,0x55,0x0f,0x5e,0x0f,0x66,0x16,0x6e,0x13,0x76,0x13,0x7e,0x16,0x87,0x17,0x97,0x17,0x9f,0x18,0xa7,0x1c,0xb7,0x1f,0xbf,0x1a,0xbf,0x1b,0xc7,0x1e,0xc7,0x1f,0xc7,0x1e,0xc7,0x1e,0xcf,0x1f,0xcf,0x1f,0xcf,0x1e,0xcf,0x1e,0xbf,0x17,0x8e,0x10,0x3b,0x05,0x5b,0x01,0xce,0x06,0x8c,0x03,0x59,0x01,0xd4,0x07,0xa0,0x07,0x88,0x03,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x40,0x06,0xd8,0x07,0xb0,0x07,0x90,0x03,0x50,0x01,0x40,0x04,0x50,0x03,0x68,0x01,0x78,0x05,0x81,0x01,0x81,0x03,0x81,0x07,0x81,0x07,0x81,0x03,0x79,0x05,0x81,0x05,0x92,0x06,0xb3,0x07,0xcc,0x07,0xe6,0x0e,0xff,0x0a,0xf7,0x0b,0xf6,0x0d,0xee,0x0d,0xee,0x0a,0xee,0x09,0xf6,0x0b,0x62,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x08,0x01,0x08,0x01,0x11,0x02,0x19,0x07,0x1a,0x07,0x22,0x07,0x2b,0x07,0x2b,0x07,0x34,0x08,0x3c,0x09,0x45,0x0a,0x4d,0x0f,0x55,0x0f,0x5e,0x0f,0x66,0x16,0x76,0x17,0x7e,0x17,0x87,0x17,0x97,0x17,0x9f,0x17,0xa7,0x18,0xaf,0x1b,0xb7,0x1b,0xbf,0x1f,0xc7,0x1f,0xc7,0x1f,0xcf,0x1e,0xcf,0x1f,0xbf,0x17,0x7d,0x0f,0x5b,0x07,0x94,0x06,0x72,0x03,0xba,0x02,0x50,0x07,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x48,0x05,0x58,0x05,0x40,0x00,0x38,0x01,0x50,0x01,0x68,0x06,0x80,0x03,0x88,0x07,0x89,0x01,0x89,0x03,0x91,0x07,0x89,0x07,0xaa,0x03,0xcc,0x07,0xee,0x0f,0xff,0x0b,0xff,0x0f,0xff,0x0f,0xff,0x0b,0xf7,0x0e,0xf6,0x0b,0xee,0x07,0xe6,0x07,0xdd,0x05,0xdd,0x05,0xe5,0x07,0xe5,0x07,0x93,0x05,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x07,0x00,0x01,0x00,0x06,0x08,0x03,0x08,0x07,0x09,0x03,0x11,0x06,0x19,0x03,0x1a,0x06,0x22,0x07,0x2b,0x06,0x33,0x07,0x3c,0x0d,0x44,0x0f,0x4d,0x0e,0x5e,0x0f,0x66,0x16,0x76,0x13,0x7f,0x13,0x8f,0x14,0x97,0x17,0xa7,0x17,0xaf,0x17,0xa7,0x17,0x8f,0x10,0x5d,0x07,0x8c,0x07,0x59,0x07,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x03,0x58,0x05,0x50,0x01,0x50,0x04,0x68,0x06,0x80,0x03,0x91,0x01,0xa9,0x03,0xba,0x06,0xc3,0x07,0xd4,0x04,0xdc,0x07,0xe5,0x07,0xf6,0x0b,0xff,0x0b,0xff,0x0b,0xff,0x0f,0xf7,0x0f,0xf7,0x0b,0xf6,0x0b,0xee,0x0a,0xe5,0x07,0xdd,0x05,0xcc,0x05,0xb2,0x07,0xaa,0x07,0xbb,0x04,0xc4,0x05,0xbd,0x0e,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x01,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x08,0x07,0x08,0x07,0x09,0x01,0x11,0x07,0x11,0x02,0x1a,0x05,0x1a,0x07,0x23,0x07,0x13,0x0c,0x1c,0x0f,0x1b,0x0e,0x01,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x05,0x58,0x06,0x68,0x05,0xaa,0x01,0xdc,0x03,0xed,0x04,0xed,0x07,0xf6,0x07,0xf6,0x09,0xf6,0x0f,0xf7,0x0b,0xff,0x0f,0xf7,0x0e,0xf7,0x0b,0xf7,0x0a,0xf6,0x0e,0xf6,0x0a,0xee,0x09,0xee,0x09,0xe5,0x07,0xd5,0x05,0xc3,0x05,0x9a,0x03,0x79,0x03,0x48,0x07,0x38,0x07,0x59,0x03,0x8b,0x09,0xbe,0x13,0x10,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x07,0x00,0x01,0x00,0x06,0x00,0x03,0x00,0x07,0x00,0x06,0x01,0x07,0x09,0x07,0x09,0x0b,0x0a,0x0e,0x02,0x0b,0x0a,0x0e,0x02,0x0d,0x03,0x0f,0x0b,0x15,0x0c,0x17,0x0c,0x17,0x0d,0x17,0x0d,0x1b,0x0c,0x15,0x12,0x13,0x09,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x03,0x91,0x03,0xcb,0x02,0xed,0x05,0xf6,0x07,0xf6,0x06,0xf6,0x07,0xf6,0x09,0xf6,0x09,0xee,0x0f,0xee,0x0b,0xee,0x0e,0xe6,0x0e,0xe5,0x07,0xdd,0x07,0xdd,0x07,0xd4,0x07,0xc4,0x07,0xbb,0x05,0xab,0x04,0x8a,0x06,0x59,0x07,0x30,0x02,0x10,0x03,0x08,0x06,0x08,0x05,0x08,0x06,0x39,0x07,0xc6,0x16,0x29,0x04,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x07,0x00,0x03,0x00,0x03,0x00,0x05,0x01,0x06,0x01,0x07,0x09,0x0f,0x0a,0x0f,0x0a,0x0f,0x0b,0x13,0x1b,0x16,0x1c,0x13,0x1c,0x17,0x25,0x16,0x25,0x1c,0x25,0x1f,0x1d,0x1e,0x1e,0x1f,0x16,0x1f,0x16,0x1b,0x16,0x1e,0x0e,0x1b,0x0d,0x19,0x0d,0x18,0x0d,0x1d,0x0c,0x16,0x13,0x10,0x09,0x0b,0x18,0x0d,0x08,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x01,0xa2,0x01,0xb2,0x05,0xc3,0x06,0xee,0x07,0xf7,0x06,0xf7,0x07,0xee,0x07,0xee,0x06,0xe6,0x06,0xe6,0x06,0xdd,0x07,0xd5,0x05,0xc4,0x05,0xb4,0x03,0xa3,0x07,0x8a,0x06,0x71,0x07,0x59,0x07,0x41,0x01,0x28,0x05,0x10,0x04,0x08,0x07,0x00,0x04,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x06,0xcf,0x1a,0x39,0x06,0x00,0x00,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x01,0x05,0x01,0x07,0x01,0x0a,0x09,0x0f,0x0a,0x0c,0x0a,0x0f,0x13,0x12,0x1b,0x14,0x1c,0x16,0x25,0x1a,0x25,0x1d,0x2d,0x1b,0x3e,0x1f,0x46,0x1f,0x3e,0x1d,0x3e,0x1c,0x3e,0x1c,0x3e,0x1f,0x36,0x1f,0x2e,0x1d,0x1e,0x1f,0x0e,0x1b,0x0e,0x1b,0x0d,0x19,0x0d,0x19,0x0d,0x1f,0x0d,0x19,0x0b,0x11,0x11,0x0f,0x10,0x0f,0x08,0x06,0x10,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x42,0x01,0xa4,0x03,0xa3,0x01,0x8a,0x03,0x92,0x03,0xc4,0x07,0xe6,0x07,0xef,0x05,0xf7,0x07,0xef,0x05,0xef,0x05,0xe6,0x05,0xe6,0x07,0xde,0x06,0xd6,0x07,0xce,0x06,0xc5,0x03,0xbd,0x03,0xac,0x03,0x9c,0x03,0x93,0x03,0x83,0x06,0x72,0x03,0x5a,0x03,0x49,0x05,0x39,0x05,0x29,0x00,0x21,0x07,0xcf,0x17,0x42,0x07,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x12,0x0f,0x13,0x12,0x13,0x16,0x13,0x16,0x1c,0x16,0x24,0x17,0x2d,0x1f,0x35,0x1f,0x3e,0x1f,0x46,0x1f,0x56,0x1e,0x56,0x1e,0x56,0x1d,0x56,0x1f,0x57,0x1d,0x4f,0x1d,0x46,0x1f,0x3e,0x1f,0x2e,0x1f,0x1e,0x1f,0x16,0x1b,0x0e,0x1b,0x0d,0x1e,0x0d,0x19,0x0d,0x1e,0x0d,0x1a,0x0b,0x17,0x09,0x0d,0x18,0x0e,0x18,0x0a,0x08,0x06,0x10,0x06,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x06,0x10,0x05,0x19,0x07,0x75,0x0f,0x6c,0x05,0xb5,0x07,0xd5,0x03,0xc5,0x02,0xb4,0x05,0xbc,0x05,0xd5,0x07,0xe6,0x07,0xef,0x07,0xf7,0x05,0xf7,0x05,0xf7,0x05,0xf7,0x07,0xf7,0x05,0xf7,0x06,0xef,0x06,0xef,0x07,0xe7,0x07,0xe6,0x05,0xde,0x04,0xd6,0x06,0xce,0x06,0xc5,0x07,0xbd,0x03,0xac,0x07,0x9c,0x07,0x8b,0x07,0xd7,0x16,0x5a,0x07,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x24,0x17,0x25,0x1d,0x2d,0x1d,0x35,0x1f,0x46,0x1b,0x46,0x1f,0x56,0x1e,0x5e,0x1d,0x66,0x1f,0x6f,0x1f,0x67,0x1f,0x5f,0x1f,0x57,0x1d,0x4e,0x1f,0x46,0x1d,0x3e,0x1d,0x2e,0x1f,0x26,0x1e,0x1e,0x1f,0x16,0x1f,0x0e,0x1b,0x0e,0x1b,0x0d,0x1e,0x0d,0x1b,0x0c,0x14,0x02,0x0c,0x08,0x07,0x20,0x0d,0x18,0x0e,0x08,0x07,0x10,0x07,0x10,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x5a,0x17,0x18,0x07,0x54,0x12,0x6d,0x0f,0xaf,0x17,0x75,0x07,0xb6,0x07,0xef,0x07,0xef,0x07,0xe6,0x07,0xde,0x03,0xde,0x03,0xde,0x07,0xe6,0x06,0xef,0x04,0xef,0x07,0xef,0x05,0xf7,0x05,0xf7,0x07,0xf7,0x06,0xf7,0x06,0xf7,0x06,0xf7,0x07,0xef,0x06,0xef,0x07,0xef,0x07,0xe7,0x06,0xe7,0x05,0xde,0x05,0xd6,0x05,0xce,0x05,0xd6,0x0f,0x5a,0x06,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x35,0x1c,0x4e,0x1e,0x56,0x1e,0x5e,0x1f,0x6e,0x1f,0x6f,0x1d,0x6f,0x1f,0x77,0x1e,0x6f,0x1d,0x67,0x1f,0x5f,0x1d,0x4e,0x1f,0x46,0x1d,0x3e,0x1d,0x36,0x1d,0x2e,0x1d,0x26,0x1d,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x16,0x1f,0x0d,0x19,0x0c,0x15,0x02,0x0f,0x09,0x07,0x18,0x07,0x28,0x0d,0x28,0x0f,0x10,0x09,0x10,0x07,0x20,0x0d,0x08,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x03,0x08,0x03,0x29,0x0f,0x11,0x06,0x86,0x1b,0x22,0x0f,0x55,0x07,0x65,0x0a,0x43,0x03,0xa5,0x05,0xe7,0x07,0xf7,0x07,0xf7,0x05,0xef,0x07,0xef,0x07,0xe7,0x05,0xe7,0x04,0xe7,0x06,0xef,0x07,0xef,0x05,0xef,0x05,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x05,0xf7,0x06,0xf7,0x07,0xf7,0x06,0xf7,0x07,0xef,0x07,0xef,0x07,0xef,0x07,0xe7,0x06,0xe6,0x06,0x52,0x02,0x00,0x00,0x00,0x02,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x01,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x45,0x17,0x77,0x1f,0x6f,0x1f,0x77,0x1d,0x7f,0x1f,0x77,0x1e,0x6f,0x1f,0x67,0x1f,0x5f,0x1d,0x56,0x1f,0x4e,0x1d,0x46,0x1d,0x3e,0x1d,0x3e,0x1d,0x36,0x1c,0x2e,0x1f,0x26,0x1d,0x26,0x1f,0x26,0x1d,0x1d,0x1b,0x0c,0x17,0x0b,0x10,0x01,0x0b,0x08,0x07,0x18,0x0b,0x31,0x0f,0x31,0x10,0x18,0x0e,0x10,0x07,0x20,0x0e,0x20,0x07,0x00,0x01,0x00,0x00,0x00,0x00,0x08,0x02,0x10,0x07,0x08,0x07,0x08,0x04,0x10,0x06,0x76,0x1a,0x22,0x0b,0x1b,0x06,0x33,0x05,0x2b,0x02,0x3b,0x02,0x9e,0x07,0xe7,0x0f,0xef,0x07,0xf7,0x06,0xf7,0x07,0xf7,0x07,0xef,0x07,0xef,0x07,0xef,0x05,0xef,0x05,0xef,0x05,0xef,0x07,0xef,0x07,0xf7,0x05,0xf7,0x07,0xf7,0x07,0xf7,0x06,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xef,0x07,0x4a,0x02,0x00,0x00,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3c,0x17,0x7f,0x1f,0x77,0x1f,0x77,0x1e,0x77,0x1e,0x67,0x1f,0x5f,0x1d,0x5f,0x1d,0x5f,0x1d,0x56,0x1f,0x4e,0x1f,0x46,0x1f,0x3e,0x1d,0x3e,0x1f,0x3e,0x1f,0x36,0x1f,0x2e,0x1c,0x1d,0x1b,0x14,0x1c,0x0b,0x13,0x09,0x0f,0x00,0x03,0x08,0x03,0x20,0x0d,0x39,0x13,0x31,0x13,0x20,0x0c,0x10,0x09,0x28,0x0f,0x38,0x0f,0x10,0x03,0x00,0x00,0x00,0x00,0x00,0x02,0x18,0x07,0x10,0x07,0x00,0x03,0x00,0x03,0x10,0x07,0x2b,0x0f,0x09,0x07,0x1b,0x06,0x45,0x07,0x2b,0x07,0x2a,0x07,0x44,0x07,0x9e,0x0e,0xcf,0x0b,0xdf,0x07,0xef,0x06,0xf7,0x06,0xf7,0x07,0xf7,0x07,0xf7,0x06,0xf7,0x06,0xf7,0x06,0xf7,0x06,0xf7,0x06,0xf7,0x05,0xf7,0x07,0xf7,0x06,0xf7,0x07,0xf7,0x06,0xf7,0x06,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xef,0x07,0x39,0x07,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x0e,0x76,0x1f,0x77,0x1e,0x6f,0x1f,0x6f,0x1f,0x67,0x1d,0x67,0x1f,0x5f,0x1d,0x5f,0x1d,0x56,0x1f,0x4e,0x1f,0x4e,0x1f,0x46,0x1d,0x46,0x1e,0x36,0x1e,0x25,0x1f,0x1d,0x1c,0x13,0x16,0x0a,0x0f,0x00,0x05,0x00,0x02,0x10,0x03,0x28,0x0b,0x39,0x17,0x41,0x17,0x28,0x0f,0x18,0x0b,0x28,0x0f,0x49,0x10,0x28,0x09,0x00,0x01,0x00,0x00,0x00,0x00,0x10,0x03,0x20,0x0b,0x10,0x07,0x00,0x03,0x10,0x05,0x18,0x0d,0x01,0x05,0x01,0x05,0x12,0x06,0x5e,0x0c,0x4d,0x0d,0x2b,0x07,0x23,0x02,0x55,0x07,0x7e,0x0d,0x9e,0x0f,0xb6,0x07,0xd6,0x07,0xe7,0x07,0xef,0x06,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x06,0xf7,0x06,0xf7,0x07,0xf7,0x06,0xf7,0x06,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xe6,0x06,0x20,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x6e,0x1f,0x77,0x1d,0x6f,0x1f,0x6f,0x1f,0x6f,0x1f,0x67,0x1f,0x67,0x1d,0x5f,0x1d,0x5e,0x1d,0x4e,0x1f,0x4e,0x1e,0x36,0x1b,0x2d,0x1f,0x25,0x1f,0x14,0x15,0x12,0x0e,0x09,0x07,0x00,0x01,0x00,0x01,0x10,0x06,0x30,0x0d,0x41,0x13,0x41,0x17,0x30,0x17,0x20,0x0f,0x28,0x0b,0x49,0x11,0x39,0x0f,0x10,0x03,0x00,0x00,0x00,0x00,0x00,0x02,0x20,0x0b,0x20,0x0e,0x08,0x06,0x08,0x05,0x20,0x0f,0x19,0x0d,0x01,0x07,0x01,0x05,0x09,0x07,0x56,0x11,0x7f,0x11,0x56,0x0a,0x2c,0x05,0x2b,0x04,0x5e,0x0b,0x7f,0x0f,0x76,0x0c,0x7e,0x07,0x9d,0x04,0xc6,0x05,0xde,0x05,0xe7,0x06,0xef,0x07,0xf7,0x06,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x06,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xde,0x07,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x4c,0x13,0x77,0x1e,0x77,0x1f,0x6f,0x1f,0x6f,0x1f,0x67,0x1d,0x67,0x1d,0x56,0x1f,0x4e,0x1c,0x3e,0x1f,0x35,0x1e,0x25,0x1e,0x1c,0x14,0x12,0x0f,0x09,0x0d,0x00,0x07,0x00,0x00,0x00,0x03,0x18,0x06,0x30,0x0f,0x49,0x13,0x49,0x17,0x39,0x13,0x28,0x0f,0x28,0x0f,0x41,0x15,0x49,0x17,0x20,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x05,0x28,0x0e,0x20,0x0b,0x08,0x05,0x10,0x06,0x28,0x0f,0x1a,0x12,0x01,0x0f,0x01,0x05,0x0a,0x0b,0x3d,0x14,0x8f,0x17,0x87,0x12,0x5e,0x0b,0x34,0x06,0x3c,0x07,0x6e,0x0d,0x8f,0x16,0x76,0x0e,0x55,0x0f,0x53,0x05,0x83,0x02,0xb5,0x03,0xd6,0x04,0xe6,0x07,0xef,0x07,0xef,0x07,0xef,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x06,0xf7,0x06,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xbd,0x05,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x01,0x00,0x00,0x19,0x06,0x6f,0x1e,0x6f,0x1d,0x6f,0x1d,0x67,0x1d,0x56,0x1d,0x4e,0x1d,0x3e,0x1b,0x35,0x1e,0x25,0x1c,0x1c,0x15,0x12,0x0f,0x09,0x0b,0x00,0x03,0x00,0x01,0x00,0x00,0x08,0x05,0x20,0x07,0x30,0x0f,0x49,0x13,0x51,0x15,0x41,0x17,0x30,0x0f,0x30,0x0f,0x41,0x0f,0x49,0x11,0x30,0x0d,0x08,0x07,0x00,0x00,0x00,0x00,0x00,0x03,0x28,0x0e,0x30,0x0f,0x18,0x07,0x08,0x06,0x20,0x0e,0x31,0x13,0x1b,0x14,0x0a,0x0f,0x01,0x05,0x02,0x0b,0x2d,0x16,0x87,0x17,0x9f,0x17,0x87,0x13,0x5e,0x0f,0x3d,0x07,0x4d,0x0b,0x7e,0x16,0x97,0x14,0x76,0x13,0x4d,0x0b,0x2b,0x04,0x29,0x01,0x6a,0x05,0xa4,0x07,0xc6,0x04,0xd6,0x06,0xe6,0x07,0xef,0x07,0xef,0x07,0xef,0x06,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0xf7,0x07,0x94,0x07,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x55,0x1f,0x46,0x1d,0x4e,0x1e,0x46,0x1d,0x3e,0x1f,0x2d,0x1e,0x25,0x19,0x1c,0x17,0x12,0x15,0x09,0x0a,0x00,0x06,0x00,0x03,0x00,0x00,0x00,0x00,0x08,0x07,0x20,0x0d,0x38,0x0f,0x49,0x13,0x59,0x17,0x49,0x17,0x39,0x13,0x38,0x0f,0x39,0x0f,0x49,0x17,0x41,0x0f,0x20,0x07,0x00,0x02,0x00,0x00,0x00,0x00,0x18,0x07,0x30,0x0f,0x30,0x0d,0x10,0x06,0x10,0x06,0x28,0x0f,0x31,0x17,0x1c,0x17,0x0b,0x17,0x01,0x07,0x02,0x0d,0x1d,0x16,0x56,0x17,0x8f,0x17,0xa7,0x17,0x87,0x15,0x5e,0x0f,0x45,0x0d,0x5e,0x0d,0x7f,0x13,0x97,0x17,0x7f,0x11,0x55,0x0f,0x2b,0x05,0x00,0x01,0x18,0x05,0x52,0x03,0x8b,0x07,0xb5,0x07,0xce,0x07,0xde,0x07,0xe7,0x05,0xe7,0x07,0xef,0x07,0xef,0x07,0xef,0x07,0xf7,0x07,0x5a,0x07,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0x00,0x1a,0x0f,0x35,0x1f,0x2d,0x1b,0x2d,0x1d,0x24,0x17,0x1b,0x14,0x12,0x0f,0x09,0x0b,0x00,0x07,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x08,0x03,0x20,0x0d,0x39,0x0e,0x51,0x17,0x59,0x17,0x51,0x16,0x41,0x16,0x41,0x13,0x41,0x13,0x49,0x12,0x49,0x17,0x30,0x0f,0x08,0x03,0x00,0x00,0x00,0x00,0x08,0x06,0x28,0x0b,0x41,0x11,0x28,0x0f,0x10,0x07,0x18,0x0b,0x31,0x11,0x32,0x17,0x24,0x1f,0x14,0x15,0x01,0x0f,0x02,0x0f,0x0c,0x17,0x2d,0x17,0x66,0x17,0x97,0x16,0xa7,0x17,0x8f,0x14,0x5e,0x0f,0x4e,0x0b,0x5e,0x0f,0x7f,0x13,0x97,0x15,0x7f,0x13,0x5e,0x0d,0x34,0x07,0x11,0x02,0x00,0x00,0x10,0x07,0x39,0x03,0x73,0x06,0xa4,0x03,0xbd,0x07,0xce,0x07,0xde,0x05,0xe6,0x07,0xe7,0x07,0xef,0x07,0x10,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x06,0x23,0x13,0x1b,0x15,0x1b,0x14,0x1a,0x16,0x11,0x0e,0x01,0x05,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x03,0x28,0x0d,0x38,0x0f,0x49,0x12,0x61,0x17,0x59,0x15,0x49,0x13,0x41,0x15,0x41,0x14,0x49,0x17,0x51,0x13,0x39,0x0f,0x20,0x07,0x00,0x03,0x00,0x00,0x00,0x01,0x18,0x06,0x39,0x0f,0x41,0x11,0x20,0x0e,0x18,0x07,0x28,0x0c,0x39,0x13,0x33,0x17,0x25,0x1b,0x1d,0x19,0x0a,0x0f,0x02,0x0e,0x0d,0x18,0x14,0x16,0x3d,0x17,0x6e,0x12,0xa7,0x17,0xa7,0x1d,0x8f,0x17,0x66,0x11,0x5e,0x0e,0x6e,0x13,0x8f,0x15,0x9f,0x17,0x87,0x17,0x66,0x0f,0x3c,0x09,0x19,0x03,0x00,0x01,0x00,0x00,0x00,0x04,0x29,0x00,0x62,0x01,0x8b,0x06,0xac,0x07,0xc5,0x06,0xd6,0x07,0xac,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x00,0x01,0x00,0x02,0x11,0x07,0x11,0x0f,0x11,0x09,0x09,0x07,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x10,0x03,0x20,0x0e,0x38,0x0f,0x49,0x13,0x61,0x16,0x59,0x17,0x51,0x16,0x49,0x13,0x49,0x15,0x49,0x17,0x51,0x13,0x49,0x11,0x28,0x0a,0x08,0x02,0x00,0x00,0x00,0x00,0x08,0x07,0x28,0x0b,0x41,0x16,0x38,0x0f,0x20,0x0b,0x20,0x09,0x30,0x0f,0x41,0x14,0x34,0x18,0x2d,0x1f,0x25,0x1e,0x0b,0x13,0x0a,0x16,0x15,0x18,0x1d,0x1d,0x1c,0x16,0x45,0x0d,0x7e,0x17,0xa7,0x1d,0xa7,0x1c,0x8f,0x15,0x6e,0x16,0x6e,0x15,0x7f,0x13,0x97,0x17,0x9f,0x17,0x87,0x17,0x66,0x12,0x45,0x0e,0x22,0x05,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x05,0x41,0x07,0x6a,0x03,0x9c,0x07,0x41,0x07,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x07,0x00,0x07,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x10,0x03,0x28,0x0d,0x38,0x0f,0x49,0x12,0x61,0x17,0x61,0x16,0x59,0x15,0x51,0x13,0x49,0x13,0x49,0x12,0x51,0x17,0x51,0x12,0x38,0x0f,0x18,0x07,0x00,0x00,0x00,0x00,0x00,0x02,0x20,0x07,0x41,0x0f,0x49,0x16,0x30,0x0e,0x20,0x0b,0x20,0x0f,0x39,0x13,0x41,0x17,0x34,0x1f,0x2e,0x1f,0x36,0x1b,0x1c,0x17,0x0b,0x12,0x15,0x1b,0x26,0x1a,0x1c,0x15,0x23,0x0b,0x4d,0x0f,0x87,0x17,0xaf,0x1d,0xa7,0x1c,0x97,0x17,0x7f,0x15,0x7f,0x13,0x87,0x14,0x97,0x17,0x9f,0x17,0x8f,0x15,0x66,0x15,0x45,0x0b,0x23,0x07,0x08,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x20,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x07,0x28,0x0d,0x38,0x0f,0x49,0x11,0x59,0x17,0x61,0x17,0x61,0x17,0x59,0x16,0x51,0x13,0x51,0x13,0x51,0x13,0x51,0x17,0x41,0x0f,0x28,0x0e,0x08,0x07,0x00,0x00,0x00,0x00,0x10,0x03,0x30,0x0b,0x49,0x17,0x41,0x17,0x30,0x0f,0x20,0x0e,0x30,0x0f,0x41,0x17,0x39,0x16,0x34,0x1a,0x36,0x1f,0x3e,0x1f,0x2d,0x1b,0x0b,0x14,0x1d,0x1a,0x2e,0x1f,0x25,0x1d,0x1a,0x0e,0x2b,0x07,0x5e,0x0f,0x97,0x16,0xaf,0x1f,0xaf,0x1d,0x97,0x17,0x87,0x14,0x87,0x14,0x8f,0x17,0x9f,0x17,0x9f,0x1b,0x8f,0x17,0x6e,0x11,0x4d,0x0c,0x2b,0x06,0x08,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x01,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x10,0x03,0x28,0x0d,0x38,0x0e,0x49,0x17,0x59,0x15,0x69,0x17,0x61,0x17,0x59,0x17,0x59,0x16,0x51,0x17,0x59,0x14,0x59,0x16,0x49,0x11,0x30,0x0b,0x18,0x05,0x00,0x01,0x00,0x00,0x00,0x04,0x20,0x07,0x39,0x0f,0x51,0x13,0x41,0x13,0x28,0x0d,0x28,0x0f,0x39,0x0f,0x49,0x13,0x39,0x17,0x2c,0x1d,0x2e,0x1f,0x3e,0x1c,0x35,0x1f,0x1c,0x17,0x1d,0x1a,0x2e,0x1f,0x36,0x1a,0x1b,0x13,0x11,0x07,0x34,0x0a,0x6e,0x13,0x9f,0x17,0xaf,0x1d,0xa7,0x1d,0x97,0x17,0x8f,0x16,0x97,0x17,0x97,0x17,0xa7,0x1b,0xa7,0x1a,0x8f,0x17,0x6e,0x12,0x4d,0x0d,0x33,0x07,0x11,0x06,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x10,0x07,0x20,0x07,0x30,0x0d,0x49,0x15,0x59,0x14,0x69,0x16,0x61,0x17,0x61,0x15,0x61,0x17,0x59,0x15,0x59,0x15,0x59,0x17,0x51,0x17,0x39,0x0e,0x20,0x07,0x08,0x05,0x00,0x00,0x00,0x00,0x08,0x03,0x30,0x0b,0x49,0x17,0x51,0x17,0x39,0x10,0x28,0x0d,0x30,0x0f,0x41,0x15,0x49,0x13,0x31,0x11,0x23,0x17,0x2e,0x1b,0x46,0x1d,0x4e,0x1f,0x2d,0x1d,0x1d,0x19,0x36,0x1f,0x36,0x1b,0x24,0x17,0x11,0x0f,0x09,0x03,0x45,0x0b,0x76,0x13,0x9f,0x17,0xaf,0x1f,0xaf,0x1d,0x9f,0x1a,0x9f,0x17,0x9f,0x17,0x9f,0x1b,0xa7,0x1c,0xa7,0x1b,0x8f,0x17,0x6e,0x12,0x56,0x0d,0x34,0x08,0x11,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x18,0x06,0x28,0x07,0x30,0x0f,0x41,0x15,0x51,0x17,0x69,0x17,0x69,0x17,0x69,0x16,0x61,0x17,0x61,0x15,0x61,0x17,0x59,0x17,0x59,0x16,0x41,0x15,0x30,0x0a,0x18,0x05,0x00,0x01,0x00,0x00,0x00,0x02,0x18,0x06,0x38,0x0f,0x51,0x15,0x51,0x13,0x38,0x0f,0x30,0x0f,0x38,0x0f,0x49,0x13,0x41,0x12,0x31,0x0f,0x23,0x15,0x2d,0x1f,0x4e,0x1c,0x46,0x1b,0x35,0x1e,0x25,0x19,0x36,0x1f,0x3e,0x1f,0x2d,0x1d,0x1b,0x0f,0x00,0x07,0x1a,0x05,0x4d,0x0e,0x7e,0x16,0xa7,0x1a,0xaf,0x1e,0xaf,0x1f,0xa7,0x1c,0x9f,0x1a,0x9f,0x1b,0xa7,0x1c,0xa7,0x1f,0xa7,0x1c,0x8f,0x17,0x76,0x13,0x56,0x0f,0x55,0x0e,0x53,0x0d,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x20,0x07,0x30,0x0f,0x41,0x0f,0x51,0x17,0x61,0x16,0x69,0x17,0x69,0x17,0x69,0x17,0x61,0x15,0x61,0x15,0x61,0x15,0x59,0x17,0x49,0x13,0x38,0x0e,0x20,0x06,0x08,0x05,0x00,0x00,0x00,0x00,0x10,0x03,0x28,0x0a,0x41,0x15,0x51,0x16,0x49,0x16,0x38,0x0f,0x38,0x0f,0x41,0x11,0x51,0x13,0x41,0x15,0x29,0x0d,0x23,0x13,0x2d,0x1a,0x56,0x1d,0x4e,0x1d,0x46,0x1f,0x2d,0x1a,0x2e,0x1b,0x46,0x1e,0x3e,0x1f,0x24,0x17,0x09,0x07,0x00,0x06,0x2b,0x07,0x5e,0x0f,0x87,0x15,0xa7,0x1b,0xb7,0x1e,0xaf,0x1d,0xa7,0x1c,0xa7,0x1c,0xa7,0x1c,0xa7,0x1f,0xaf,0x1f,0xa7,0x1d,0x8f,0x17,0x6e,0x13,0x96,0x14,0x29,0x07,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x06,0x39,0x0d,0x51,0x13,0x61,0x15,0x69,0x17,0x69,0x16,0x69,0x17,0x69,0x17,0x61,0x17,0x61,0x17,0x61,0x17,0x51,0x17,0x41,0x0f,0x28,0x0f,0x10,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x18,0x06,0x30,0x0d,0x49,0x13,0x51,0x16,0x49,0x17,0x39,0x10,0x39,0x0f,0x41,0x17,0x51,0x17,0x39,0x0f,0x29,0x0f,0x1b,0x12,0x2d,0x1f,0x56,0x1d,0x56,0x1c,0x56,0x1d,0x36,0x1f,0x36,0x1f,0x46,0x1f,0x46,0x1f,0x2d,0x17,0x12,0x0f,0x00,0x03,0x08,0x07,0x3c,0x0e,0x5e,0x14,0x87,0x17,0xa7,0x1d,0xaf,0x1e,0xaf,0x1f,0xa7,0x1d,0xa7,0x1d,0xa7,0x1d,0xaf,0x1f,0xaf,0x1e,0xa7,0x1d,0x97,0x17,0x5c,0x0c,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x05,0x59,0x14,0x69,0x17,0x69,0x17,0x69,0x16,0x69,0x16,0x69,0x16,0x69,0x17,0x61,0x15,0x59,0x14,0x49,0x16,0x30,0x0b,0x20,0x07,0x00,0x03,0x00,0x00,0x00,0x00,0x08,0x02,0x28,0x0d,0x41,0x0f,0x59,0x17,0x51,0x17,0x41,0x15,0x41,0x11,0x41,0x11,0x49,0x13,0x49,0x13,0x39,0x0d,0x21,0x0a,0x1a,0x13,0x2d,0x1b,0x56,0x1f,0x5e,0x1f,0x56,0x1e,0x46,0x1b,0x3e,0x1b,0x46,0x1e,0x4e,0x1e,0x35,0x1f,0x1b,0x11,0x00,0x07,0x00,0x00,0x11,0x03,0x44,0x0f,0x66,0x13,0x8f,0x16,0xa7,0x1d,0xb7,0x1e,0xaf,0x1d,0xaf,0x1d,0xaf,0x1f,0xaf,0x1f,0xaf,0x1f,0xaf,0x1e,0x96,0x15,0x10,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x07,0x61,0x17,0x69,0x17,0x69,0x17,0x69,0x17,0x69,0x17,0x69,0x16,0x61,0x17,0x49,0x11,0x38,0x0f,0x28,0x0c,0x10,0x03,0x00,0x01,0x00,0x00,0x00,0x02,0x18,0x07,0x30,0x0b,0x49,0x17,0x59,0x15,0x51,0x13,0x49,0x16,0x41,0x13,0x49,0x15,0x51,0x17,0x49,0x13,0x30,0x0e,0x18,0x0c,0x12,0x0f,0x25,0x1b,0x56,0x1e,0x66,0x1d,0x66,0x1e,0x4e,0x1e,0x46,0x1f,0x46,0x1f,0x56,0x1c,0x3e,0x1e,0x1c,0x17,0x09,0x07,0x00,0x02,0x00,0x02,0x22,0x06,0x45,0x0b,0x66,0x17,0x8f,0x16,0xa7,0x1d,0xb7,0x1f,0xaf,0x1f,0xaf,0x1f,0xaf,0x1e,0xb7,0x1b,0x96,0x15,0x11,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x05,0x51,0x13,0x69,0x16,0x69,0x17,0x69,0x17,0x61,0x15,0x51,0x17,0x41,0x0f,0x30,0x0a,0x18,0x07,0x00,0x03,0x00,0x00,0x00,0x00,0x08,0x06,0x20,0x07,0x38,0x0f,0x51,0x13,0x59,0x17,0x49,0x13,0x49,0x17,0x49,0x17,0x49,0x13,0x51,0x15,0x49,0x17,0x30,0x0b,0x18,0x06,0x12,0x0d,0x25,0x1b,0x4e,0x1c,0x66,0x1f,0x6e,0x1d,0x5e,0x1f,0x46,0x1e,0x4e,0x1c,0x66,0x1d,0x4e,0x1b,0x2d,0x17,0x12,0x0e,0x00,0x07,0x00,0x00,0x00,0x02,0x2b,0x07,0x4d,0x0d,0x6e,0x13,0x97,0x17,0xaf,0x1d,0xb7,0x1f,0xaf,0x1e,0xb7,0x1b,0x8e,0x15,0x19,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x49,0x0f,0x69,0x17,0x69,0x17,0x59,0x14,0x49,0x15,0x30,0x0c,0x20,0x07,0x08,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x10,0x04,0x30,0x0e,0x41,0x14,0x59,0x17,0x59,0x16,0x51,0x13,0x49,0x12,0x49,0x17,0x51,0x13,0x51,0x17,0x41,0x14,0x28,0x09,0x10,0x07,0x12,0x0b,0x24,0x17,0x46,0x1c,0x66,0x1f,0x6e,0x1f,0x6e,0x1f,0x5e,0x1f,0x5e,0x1f,0x77,0x1d,0x5e,0x1c,0x35,0x1b,0x1b,0x17,0x00,0x07,0x00,0x00,0x00,0x00,0x08,0x07,0x33,0x07,0x55,0x0f,0x76,0x13,0x97,0x17,0xa7,0x1f,0xb7,0x1f,0xa6,0x17,0x19,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x0f,0x59,0x14,0x49,0x11,0x38,0x0f,0x28,0x0d,0x18,0x05,0x00,0x01,0x00,0x00,0x00,0x00,0x08,0x05,0x20,0x06,0x30,0x0d,0x49,0x17,0x59,0x15,0x51,0x15,0x51,0x17,0x49,0x13,0x49,0x13,0x51,0x15,0x51,0x13,0x39,0x0f,0x28,0x0e,0x10,0x07,0x11,0x0a,0x24,0x16,0x46,0x1f,0x6f,0x1f,0x7f,0x1f,0x7f,0x1d,0x66,0x1d,0x66,0x1d,0x6e,0x1f,0x66,0x1d,0x3e,0x1a,0x24,0x14,0x09,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x07,0x3c,0x09,0x56,0x0e,0x76,0x13,0x97,0x17,0x96,0x15,0x19,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x07,0x38,0x0d,0x30,0x0b,0x20,0x06,0x08,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x03,0x28,0x0f,0x41,0x0e,0x51,0x17,0x59,0x15,0x51,0x16,0x51,0x17,0x51,0x13,0x51,0x13,0x51,0x16,0x49,0x13,0x38,0x0f,0x20,0x07,0x08,0x01,0x09,0x0d,0x24,0x17,0x46,0x1b,0x6e,0x1f,0x77,0x1f,0x7f,0x1f,0x6f,0x1d,0x6e,0x1f,0x77,0x1d,0x6f,0x1d,0x46,0x1f,0x24,0x17,0x12,0x0f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x19,0x03,0x3c,0x0b,0x56,0x0e,0x5d,0x0f,0x11,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x18,0x07,0x10,0x03,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x18,0x05,0x30,0x0b,0x41,0x14,0x59,0x17,0x59,0x15,0x59,0x16,0x51,0x15,0x51,0x13,0x51,0x15,0x59,0x17,0x49,0x17,0x30,0x0c,0x18,0x07,0x00,0x04,0x09,0x07,0x1c,0x14,0x3e,0x1b,0x66,0x1f,0x7f,0x1d,0x87,0x1d,0x77,0x1d,0x77,0x1d,0x7f,0x1f,0x77,0x1f,0x56,0x1f,0x2d,0x1b,0x1a,0x0f,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x22,0x05,0x2b,0x06,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x20,0x07,0x38,0x0d,0x49,0x17,0x59,0x17,0x59,0x17,0x59,0x17,0x59,0x15,0x51,0x15,0x59,0x16,0x59,0x17,0x41,0x15,0x30,0x0f,0x18,0x05,0x00,0x01,0x09,0x07,0x1b,0x13,0x3e,0x1a,0x66,0x1c,0x87,0x1f,0x8f,0x1f,0x87,0x1d,0x7f,0x1f,0x87,0x1d,0x87,0x1f,0x5e,0x1c,0x35,0x1a,0x1b,0x17,0x09,0x07,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x03,0x28,0x0f,0x39,0x0f,0x51,0x13,0x61,0x17,0x61,0x17,0x59,0x17,0x59,0x15,0x59,0x15,0x59,0x17,0x51,0x13,0x41,0x0f,0x28,0x0a,0x18,0x06,0x00,0x00,0x09,0x07,0x1b,0x12,0x3d,0x1e,0x66,0x1f,0x87,0x1f,0x97,0x1e,0x87,0x1f,0x7f,0x1d,0x87,0x1f,0x87,0x1f,0x66,0x1d,0x3e,0x1b,0x1c,0x17,0x11,0x0f,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x03,0x30,0x0f,0x59,0x16,0x61,0x16,0x61,0x15,0x59,0x17,0x59,0x15,0x59,0x14,0x59,0x17,0x49,0x17,0x38,0x0f,0x28,0x09,0x10,0x06,0x00,0x00,0x08,0x07,0x1b,0x13,0x35,0x1d,0x5e,0x1c,0x87,0x1d,0x97,0x1e,0x8f,0x1f,0x87,0x1e,0x87,0x1f,0x87,0x1d,0x6f,0x1d,0x4e,0x1f,0x24,0x1e,0x12,0x0e,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
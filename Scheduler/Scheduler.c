@@ -0,0 +1,471 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include <stddef.h>
+
+#include "Scheduler.h"
+#include "lib/CPUFreq.h"
+#include "lib/GPT.h"
+#include "lib/NVIC.h"
+#include "lib/Print.h"
+
+#define SCHEDULER_TICK_US   (1U << SCHEDULER_TICK_SHIFT)
+#define SCHEDULER_SLOT_BITS 6
+#define SCHEDULER_SLOTS     (1U << SCHEDULER_SLOT_BITS)
+#define SCHEDULER_SLOT_MASK (SCHEDULER_SLOTS - 1)
+
+// Timers on the list of those out of reach of the wheel are on this level.
+#define SCHEDULER_FAR       SCHEDULER_LEVELS
+
+#define SCHEDULER_NEVER     UINT64_MAX
+
+static GPT *timer = NULL;
+
+// Each level's slots hold timers due in a step of that level, and have a bit
+// set in their level's map while they hold any.
+static Scheduler_Timer *wheel[SCHEDULER_LEVELS][SCHEDULER_SLOTS] = { 0 };
+static uint64_t         occupied[SCHEDULER_LEVELS] = { 0 };
+static Scheduler_Timer *far = NULL;
+
+// The tick the wheel has been turned up to, and the next tick it needs turning
+// at as of when the GPT was last started.
+static uint64_t tick   = 0;
+static uint64_t target = SCHEDULER_NEVER;
+
+// Set while timers are expiring, when the wheel mustn't be moved under them.
+static bool expiring = false;
+
+// Time in microseconds when the GPT was last started, and how long it was
+// started for, or 0 if it isn't running. Time only advances while a timer is
+// waiting, as nothing else depends on it.
+static uint64_t base  = 0;
+static uint32_t armed = 0;
+
+// The shortest timeout the GPT can count at its speed.
+static uint32_t resolution = 1;
+
+// Every deadline set in microseconds, to be converted to cycles again when the
+// clock changes.
+static struct {
+    EventQueue *queue;
+    uint32_t    deadline;
+} deadlines[SCHEDULER_DEADLINES_MAX] = { 0 };
+
+static void (*idle)(void) = NULL;
+
+static uint64_t Scheduler__Now(void)
+{
+    if (armed == 0) {
+        return base;
+    }
+
+    uint32_t elapsed = GPT_GetRunningTime(timer, GPT_UNITS_MICROSEC);
+    return base + (elapsed < armed ? elapsed : armed);
+}
+
+static uint64_t Scheduler__Due(const Scheduler_Timer *t)
+{
+    return ((t->expiry + SCHEDULER_TICK_US - 1) >> SCHEDULER_TICK_SHIFT);
+}
+
+static Scheduler_Timer **Scheduler__Slot(unsigned level, unsigned slot)
+{
+    return ((level < SCHEDULER_LEVELS) ? &wheel[level][slot] : &far);
+}
+
+// Links the timer into the slot it's due in, which due mustn't be before. The
+// highest digit in which due differs from the wheel picks the level, so the
+// slot is always ahead of where the wheel is on that level. A timer due now
+// goes in the current slot of the bottom level, so must be expired straight
+// away.
+static void Scheduler__Insert(Scheduler_Timer *t, uint64_t due)
+{
+    uint64_t differ = (due ^ tick);
+    unsigned level  = 0;
+    if (differ != 0) {
+        level = ((63 - __builtin_clzll(differ)) / SCHEDULER_SLOT_BITS);
+    }
+
+    unsigned slot = 0;
+    if (level < SCHEDULER_LEVELS) {
+        slot = ((due >> (level * SCHEDULER_SLOT_BITS)) & SCHEDULER_SLOT_MASK);
+        occupied[level] |= (1ULL << slot);
+    } else {
+        level = SCHEDULER_FAR;
+    }
+
+    Scheduler_Timer **head = Scheduler__Slot(level, slot);
+    t->level = level;
+    t->slot  = slot;
+    t->prev  = NULL;
+    t->next  = *head;
+    if (*head) {
+        (*head)->prev = t;
+    }
+    *head = t;
+}
+
+static void Scheduler__Remove(Scheduler_Timer *t)
+{
+    Scheduler_Timer **head = Scheduler__Slot(t->level, t->slot);
+    if (t->prev) {
+        t->prev->next = t->next;
+    } else {
+        *head = t->next;
+    }
+    if (t->next) {
+        t->next->prev = t->prev;
+    }
+
+    if ((t->level < SCHEDULER_LEVELS) && (*head == NULL)) {
+        occupied[t->level] &= ~(1ULL << t->slot);
+    }
+    t->next = NULL;
+    t->prev = NULL;
+}
+
+// Finds the next tick the wheel needs turning at, when the timers in the
+// nearest slot either expire or move down a level. Every timer on a level is
+// due before any above it, so only the lowest level holding any matters.
+static uint64_t Scheduler__Next(unsigned *level)
+{
+    unsigned l;
+    for (l = 0; l < SCHEDULER_LEVELS; l++) {
+        unsigned shift = (l * SCHEDULER_SLOT_BITS);
+        unsigned pos   = ((tick >> shift) & SCHEDULER_SLOT_MASK);
+        uint64_t ahead = ((pos < SCHEDULER_SLOT_MASK) ? (occupied[l] & (~0ULL << (pos + 1))) : 0);
+        if (ahead != 0) {
+            uint64_t span = (1ULL << (shift + SCHEDULER_SLOT_BITS));
+            *level = l;
+            return ((tick & ~(span - 1)) | ((uint64_t)__builtin_ctzll(ahead) << shift));
+        }
+    }
+
+    if (far) {
+        uint64_t span = (1ULL << (SCHEDULER_LEVELS * SCHEDULER_SLOT_BITS));
+        *level = SCHEDULER_FAR;
+        return ((tick & ~(span - 1)) + span);
+    }
+    return SCHEDULER_NEVER;
+}
+
+static void Scheduler__Expire(Scheduler_Timer *t)
+{
+    if (t->period == 0) {
+        t->active = false;
+    } else {
+        // Periods missed while the core was busy aren't made up for, which
+        // the queue's overflow count would show.
+        uint64_t now = (tick << SCHEDULER_TICK_SHIFT);
+        t->expiry += t->period;
+        if (t->expiry <= now) {
+            t->expiry = now + t->period;
+        }
+        Scheduler__Insert(t, Scheduler__Due(t));
+    }
+
+    if (t->queue) {
+        EventQueue_Post(t->queue, t->payload);
+    }
+    if (t->callback) {
+        t->callback(t);
+    }
+}
+
+// Turns the wheel to at, moving the timers of the slot there down a level if
+// it isn't the bottom, then expires whatever is due.
+static void Scheduler__Turn(uint64_t at, unsigned level)
+{
+    tick = at;
+
+    if (level > 0) {
+        unsigned slot = 0;
+        if (level < SCHEDULER_LEVELS) {
+            slot = ((at >> (level * SCHEDULER_SLOT_BITS)) & SCHEDULER_SLOT_MASK);
+            occupied[level] &= ~(1ULL << slot);
+        }
+
+        Scheduler_Timer **head = Scheduler__Slot(level, slot);
+        Scheduler_Timer  *list = *head;
+        *head = NULL;
+
+        while (list) {
+            Scheduler_Timer *t = list;
+            list = t->next;
+            Scheduler__Insert(t, Scheduler__Due(t));
+        }
+    }
+
+    // Callbacks may stop other timers due now, so each is taken off in turn.
+    Scheduler_Timer **head = &wheel[0][at & SCHEDULER_SLOT_MASK];
+    while (*head) {
+        Scheduler_Timer *t = *head;
+        Scheduler__Remove(t);
+        Scheduler__Expire(t);
+    }
+}
+
+// Brings the wheel up to now, as far as it can go without passing anything it
+// still has to do, so new timers are placed as low on it as can be.
+static void Scheduler__CatchUp(uint64_t now)
+{
+    if (expiring) {
+        return;
+    }
+
+    uint64_t at = (now >> SCHEDULER_TICK_SHIFT);
+    if ((target != SCHEDULER_NEVER) && (at >= target)) {
+        at = (target - 1);
+    }
+    if (at > tick) {
+        tick = at;
+    }
+}
+
+static void Scheduler__Expired(GPT *handle);
+
+// Starts the GPT for the next turn of the wheel, called with interrupts
+// blocked.
+static void Scheduler__Arm(uint64_t now)
+{
+    if (armed != 0) {
+        GPT_Stop(timer);
+        armed = 0;
+    }
+    base = now;
+
+    unsigned level;
+    target = Scheduler__Next(&level);
+    if (target == SCHEDULER_NEVER) {
+        return;
+    }
+
+    uint64_t at    = (target << SCHEDULER_TICK_SHIFT);
+    uint64_t delay = ((at > now) ? (at - now) : 0);
+    if (delay > UINT32_MAX) {
+        delay = UINT32_MAX;
+    }
+    if (delay < resolution) {
+        delay = resolution;
+    }
+
+    if (GPT_StartTimeout(timer, (uint32_t)delay, GPT_UNITS_MICROSEC,
+                         Scheduler__Expired) == ERROR_NONE) {
+        armed = (uint32_t)delay;
+    }
+}
+
+static void Scheduler__Expired(GPT *handle)
+{
+    (void)handle;
+
+    uint64_t now = base + armed;
+    base   = now;
+    armed  = 0;
+    target = SCHEDULER_NEVER;
+
+    expiring = true;
+    uint64_t at;
+    unsigned level;
+    while ((at = Scheduler__Next(&level)) <= (now >> SCHEDULER_TICK_SHIFT)) {
+        Scheduler__Turn(at, level);
+    }
+    expiring = false;
+
+    Scheduler__CatchUp(now);
+    Scheduler__Arm(now);
+}
+
+bool Scheduler_Init(int32_t gpt, float speedHz)
+{
+    if (timer) {
+        return false;
+    }
+
+    timer = GPT_Open(gpt, speedHz, GPT_MODE_ONE_SHOT);
+    if (!timer) {
+        return false;
+    }
+
+    float speed;
+    if ((GPT_GetSpeed(timer, &speed) == ERROR_NONE) && (speed > 0.0f) && (speed < 1000000.0f)) {
+        resolution = (uint32_t)((1000000.0f + speed - 1.0f) / speed);
+    }
+
+    __builtin_memset(wheel, 0, sizeof(wheel));
+    __builtin_memset(occupied, 0, sizeof(occupied));
+    far      = NULL;
+    tick     = 0;
+    target   = SCHEDULER_NEVER;
+    expiring = false;
+    base     = 0;
+    armed    = 0;
+    return true;
+}
+
+static bool Scheduler__Start(Scheduler_Timer *t, EventQueue *queue, const void *payload,
+                             Scheduler_Callback callback, uint32_t delay, uint32_t period)
+{
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    uint64_t now = Scheduler__Now();
+    Scheduler__CatchUp(now);
+
+    if (t->active) {
+        Scheduler__Remove(t);
+    }
+
+    t->queue    = queue;
+    t->payload  = payload;
+    t->callback = callback;
+    t->expiry   = now + delay;
+    t->period   = period;
+    t->active   = true;
+
+    uint64_t due = Scheduler__Due(t);
+    Scheduler__Insert(t, ((due > tick) ? due : (tick + 1)));
+
+    // The GPT only needs restarting if the wheel must now turn sooner, and is
+    // restarted anyway once the timers expiring now are done with.
+    unsigned level;
+    if (!expiring && (Scheduler__Next(&level) < target)) {
+        Scheduler__Arm(now);
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+
+    return true;
+}
+
+bool Scheduler_TimerStart(Scheduler_Timer *t, EventQueue *queue, const void *payload,
+                          uint32_t delay, uint32_t period)
+{
+    if (!timer || !t || !queue) {
+        return false;
+    }
+    return Scheduler__Start(t, queue, payload, NULL, delay, period);
+}
+
+bool Scheduler_TimerCall(Scheduler_Timer *t, Scheduler_Callback callback,
+                         uint32_t delay, uint32_t period)
+{
+    if (!timer || !t) {
+        return false;
+    }
+    return Scheduler__Start(t, NULL, NULL, callback, delay, period);
+}
+
+void Scheduler_TimerStop(Scheduler_Timer *t)
+{
+    if (!t) {
+        return;
+    }
+
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    if (t->active) {
+        Scheduler__Remove(t);
+        t->active = false;
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+bool Scheduler_TimerActive(const Scheduler_Timer *t)
+{
+    return (t && t->active);
+}
+
+static uint32_t Scheduler__Cycles(uint32_t deadline, unsigned freq)
+{
+    return deadline * (freq / 1000000);
+}
+
+bool Scheduler_SetDeadline(EventQueue *queue, uint32_t deadline)
+{
+    if (!queue) {
+        return false;
+    }
+
+    unsigned d, free = SCHEDULER_DEADLINES_MAX;
+    for (d = 0; d < SCHEDULER_DEADLINES_MAX; d++) {
+        if (deadlines[d].queue == queue) {
+            break;
+        }
+        if (!deadlines[d].queue && (free == SCHEDULER_DEADLINES_MAX)) {
+            free = d;
+        }
+    }
+    if (d == SCHEDULER_DEADLINES_MAX) {
+        if (deadline == 0) {
+            EventQueue_SetDeadline(queue, 0);
+            return true;
+        }
+        if (free == SCHEDULER_DEADLINES_MAX) {
+            return false;
+        }
+        d = free;
+    }
+
+    // The clock may change from an interrupt, so the table and the queue are
+    // updated together.
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    deadlines[d].queue    = (deadline > 0 ? queue : NULL);
+    deadlines[d].deadline = deadline;
+    EventQueue_SetDeadline(queue, Scheduler__Cycles(deadline, CPUFreq_Get()));
+    NVIC_RestoreIRQs(prevBasePri);
+    return true;
+}
+
+void Scheduler_ClockChanged(unsigned freq)
+{
+    uint32_t prevBasePri = NVIC_BlockIRQs();
+    unsigned d;
+    for (d = 0; d < SCHEDULER_DEADLINES_MAX; d++) {
+        if (deadlines[d].queue) {
+            EventQueue_SetDeadline(
+                deadlines[d].queue, Scheduler__Cycles(deadlines[d].deadline, freq));
+        }
+    }
+    NVIC_RestoreIRQs(prevBasePri);
+}
+
+void Scheduler_SetIdle(void (*newIdle)(void))
+{
+    idle = newIdle;
+}
+
+_Noreturn void Scheduler_Run(void)
+{
+    for (;;) {
+        EventQueue_Dispatch();
+
+        // An event posted after the queues were checked still wakes the core,
+        // as wfi returns for an interrupt pending while they're masked. The
+        // idle function runs masked too, so a burst started by an interrupt
+        // meanwhile wakes the core to drop the clock again.
+        __asm__ volatile ("cpsid i" ::: "memory");
+        if (idle) {
+            idle();
+        }
+        if (!EventQueue_Pending()) {
+            __asm__ volatile ("wfi");
+        }
+        __asm__ volatile ("cpsie i" ::: "memory");
+    }
+}
+
+void Scheduler_Report(UART *debug, bool reset)
+{
+    unsigned mhz = (CPUFreq_Get() / 1000000);
+    if (mhz == 0) {
+        mhz = 1;
+    }
+
+    EventQueue *queue;
+    for (queue = EventQueue_Next(NULL); queue != NULL; queue = EventQueue_Next(queue)) {
+        EventQueue_Stats stats;
+        EventQueue_StatsGet(queue, &stats, reset);
+
+        UART_Printf(debug, "INFO: %-16s %8lu handled, %4lu missed, %4lu dropped, "
+                    "latency %6lu us, run %6lu us\r\n",
+                    (queue->label ? queue->label : "?"), stats.handled, stats.missed,
+                    stats.overflows, (stats.latency_max / mhz), (stats.run_max / mhz));
+    }
+}
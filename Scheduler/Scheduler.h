@@ -0,0 +1,123 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "EventQueue.h"
+#include "lib/UART.h"
+
+// A cooperative, run to completion scheduler for the bare-metal samples.
+//
+// Tasks are the handlers of event queues, so they run in the main loop one at
+// a time, most urgent first, each until it returns. Work which is due later or
+// periodically is started with a software timer, which posts to the task's
+// queue when it expires. Scheduler_Run() then sleeps whenever no queue has an
+// event waiting. The timer interrupt is the producer of every queue a timer
+// posts to, so those queues mustn't also be posted to by another interrupt.
+//
+// All the timers share one GPT. They're kept on a hierarchical wheel of
+// SCHEDULER_LEVELS levels, each of 64 slots, where every level counts in steps
+// 64 times those of the one below. Starting or stopping a timer only links or
+// unlinks it from a slot, however many are running. The GPT is only ever armed
+// for the next slot with something in it, so the core isn't woken up for ticks
+// nothing is waiting on, and only started again when a timer is added ahead of
+// that. Timers due further out than the top level reaches wait on a list which
+// is looked at once each turn of it, about every 18 minutes at the default
+// tick.
+//
+// Drivers which must act at interrupt level, such as to abandon a transfer,
+// can have a timer call them from the timer interrupt instead of posting.
+//
+// Deadlines are set per queue, and Scheduler_Report() prints how often each
+// was missed along with the longest latency and run time of every task.
+// Deadlines are kept in microseconds, so calling Scheduler_ClockChanged()
+// whenever the CPU frequency changes keeps them right.
+//
+//     static Scheduler_Timer pollTimer;
+//     EVENT_QUEUE_DEFINE_SIGNAL(pollEvents, 1);
+//
+//     Scheduler_Init(MT3620_UNIT_GPT1, 32768);
+//     EventQueue_Init(&pollEvents, 1, HandlePoll);
+//     Scheduler_SetDeadline(&pollEvents, 2000);
+//     Scheduler_TimerStart(&pollTimer, &pollEvents, NULL, 10000, 10000);
+//     Scheduler_Run();
+
+// Timers expire on ticks of 2^SCHEDULER_TICK_SHIFT microseconds, rounded up,
+// or the resolution of the GPT where that's coarser.
+#ifndef SCHEDULER_TICK_SHIFT
+#define SCHEDULER_TICK_SHIFT 6
+#endif
+
+#define SCHEDULER_LEVELS 4
+
+// The most queues which can be given a deadline.
+#define SCHEDULER_DEADLINES_MAX 8
+
+typedef struct Scheduler_Timer Scheduler_Timer;
+
+typedef void (*Scheduler_Callback)(Scheduler_Timer *timer);
+
+struct Scheduler_Timer {
+    EventQueue         *queue;
+    const void         *payload;
+    Scheduler_Callback  callback;
+    uint64_t            expiry;
+    uint32_t            period;
+    bool                active;
+    uint8_t             level;
+    uint8_t             slot;
+    Scheduler_Timer    *next;
+    Scheduler_Timer    *prev;
+};
+
+// Opens the GPT used for every timer, in one shot mode at speedHz, which sets
+// the resolution of all the timers. GPT0, GPT1 and GPT3 can be used, and only
+// GPT3 is faster than 32768 Hz, so is the one to use for timers shorter than a
+// millisecond.
+bool Scheduler_Init(int32_t gpt, float speedHz);
+
+// Posts payload to queue after delay microseconds, and then every period
+// microseconds if period isn't 0. The payload is copied as it's posted, so
+// must stay valid until the timer is stopped. Restarts the timer if it's
+// already running. Returns false if the scheduler isn't initialised.
+bool Scheduler_TimerStart(Scheduler_Timer *timer, EventQueue *queue, const void *payload,
+                          uint32_t delay, uint32_t period);
+
+// As Scheduler_TimerStart(), but calls callback from the timer interrupt
+// rather than posting. The callback may start or stop any timer, itself too.
+// It may be NULL where the timer is only checked with Scheduler_TimerActive().
+bool Scheduler_TimerCall(Scheduler_Timer *timer, Scheduler_Callback callback,
+                         uint32_t delay, uint32_t period);
+
+// Events already posted by the timer are still handled. This doesn't restart
+// the GPT, which wakes the core at most once more for nothing.
+void Scheduler_TimerStop(Scheduler_Timer *timer);
+
+// Returns true until a one shot timer has expired or any timer is stopped.
+bool Scheduler_TimerActive(const Scheduler_Timer *timer);
+
+// Sets the deadline of each of the queue's events in microseconds, or 0 for
+// none, at the current CPU frequency. Returns false if too many queues have a
+// deadline already.
+bool Scheduler_SetDeadline(EventQueue *queue, uint32_t deadline);
+
+// Converts every deadline again for the CPU running at freq, as a
+// Governor_Handler or after calling CPUFreq_Set().
+void Scheduler_ClockChanged(unsigned freq);
+
+// Sets a function for Scheduler_Run() to call each time before it sleeps, such
+// as Governor_Idle() to drop the clock, or NULL for none. It's called with
+// interrupts masked, so mustn't wait for one.
+void Scheduler_SetIdle(void (*idle)(void));
+
+// Handles events as they arrive and sleeps between them.
+_Noreturn void Scheduler_Run(void);
+
+// Prints the statistics of every registered queue, and resets them if reset.
+void Scheduler_Report(UART *debug, bool reset);
+
+#endif // #ifndef SCHEDULER_H_
@@ -0,0 +1,108 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "pool_threadx.h"
+#include "lib/Print.h"
+
+static pool_threadx *pools = TX_NULL;
+
+UINT pool_threadx_create(pool_threadx *pool, CHAR *name, ULONG size, ULONG *area, ULONG area_size)
+{
+    TX_INTERRUPT_SAVE_AREA
+
+    if (pool == TX_NULL) {
+        return TX_PTR_ERROR;
+    }
+
+    UINT status = tx_block_pool_create(&pool->pool, name, size, area, area_size);
+    if (status != TX_SUCCESS) {
+        return status;
+    }
+
+    ULONG available;
+    (void)tx_block_pool_info_get(&pool->pool, TX_NULL, &available, &pool->blocks,
+                                 TX_NULL, TX_NULL, TX_NULL);
+    pool->used     = 0;
+    pool->used_max = 0;
+
+    TX_DISABLE
+    pool_threadx **link = &pools;
+    while (*link != TX_NULL) {
+        link = &(*link)->next;
+    }
+    pool->next = TX_NULL;
+    *link = pool;
+    TX_RESTORE
+
+    return TX_SUCCESS;
+}
+
+UINT pool_threadx_delete(pool_threadx *pool)
+{
+    TX_INTERRUPT_SAVE_AREA
+
+    if (pool == TX_NULL) {
+        return TX_PTR_ERROR;
+    }
+
+    TX_DISABLE
+    pool_threadx **link;
+    for (link = &pools; *link != TX_NULL; link = &(*link)->next) {
+        if (*link == pool) {
+            *link = pool->next;
+            break;
+        }
+    }
+    TX_RESTORE
+
+    return tx_block_pool_delete(&pool->pool);
+}
+
+VOID *pool_threadx_allocate(pool_threadx *pool)
+{
+    TX_INTERRUPT_SAVE_AREA
+    VOID *block;
+
+    if ((pool == TX_NULL)
+        || (tx_block_allocate(&pool->pool, &block, TX_NO_WAIT) != TX_SUCCESS)) {
+        return TX_NULL;
+    }
+
+    TX_DISABLE
+    pool->used++;
+    if (pool->used > pool->used_max) {
+        pool->used_max = pool->used;
+    }
+    TX_RESTORE
+
+    return block;
+}
+
+UINT pool_threadx_release(pool_threadx *pool, VOID *block)
+{
+    TX_INTERRUPT_SAVE_AREA
+
+    if ((pool == TX_NULL) || (block == TX_NULL)) {
+        return TX_PTR_ERROR;
+    }
+
+    UINT status = tx_block_release(block);
+    if (status == TX_SUCCESS) {
+        TX_DISABLE
+        pool->used--;
+        TX_RESTORE
+    }
+    return status;
+}
+
+void pool_threadx_report(UART *debug)
+{
+    pool_threadx *pool;
+    for (pool = pools; pool != TX_NULL; pool = pool->next) {
+        CHAR *name;
+        (void)tx_block_pool_info_get(&pool->pool, &name, TX_NULL, TX_NULL,
+                                     TX_NULL, TX_NULL, TX_NULL);
+        UART_Printf(debug, "           %-16s %4lu of %4lu blocks used, at most %4lu\r\n",
+                    name, pool->used, pool->blocks, pool->used_max);
+    }
+}
@@ -0,0 +1,42 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef POOL_THREADX_H_
+#define POOL_THREADX_H_
+
+#include "tx_api.h"
+#include "lib/UART.h"
+
+// Fixed size allocations for thread stacks and driver handles, so that they
+// take the same short time every time and can't fragment, unlike a byte pool.
+//
+// Each pool is a ThreadX block pool over a static array sized at compile time
+// with POOL_THREADX_AREA, which the caller places in TCM or, with SYSRAM_DATA
+// from Placement.h, in SYSRAM. Pools keep count of the most
+// blocks ever in use, and pool_threadx_report() prints this for every pool
+// created so each can be sized to what it needs.
+
+typedef struct _pool_threadx {
+    TX_BLOCK_POOL         pool;
+    ULONG                 blocks;
+    ULONG                 used;
+    ULONG                 used_max;
+    struct _pool_threadx *next;
+} pool_threadx;
+
+// This is the number of ULONGs of memory needed by a pool of count blocks of
+// size bytes, as ThreadX keeps a pointer in front of each block.
+#define POOL_THREADX_AREA(size, count) \
+    ((count) * ((((size) + sizeof(ULONG) - 1) / sizeof(ULONG)) + ((sizeof(VOID *) + sizeof(ULONG) - 1) / sizeof(ULONG))))
+
+// area must be sizeof(ULONG) aligned, such as an array of ULONG.
+UINT pool_threadx_create(pool_threadx *pool, CHAR *name, ULONG size, ULONG *area, ULONG area_size);
+UINT pool_threadx_delete(pool_threadx *pool);
+
+// Doesn't wait, returning TX_NULL if the pool is empty.
+VOID *pool_threadx_allocate(pool_threadx *pool);
+UINT  pool_threadx_release(pool_threadx *pool, VOID *block);
+
+void pool_threadx_report(UART *debug);
+
+#endif // #ifndef POOL_THREADX_H_
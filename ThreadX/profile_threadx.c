@@ -0,0 +1,286 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "profile_threadx.h"
+#include "lib/CPUFreq.h"
+#include "lib/Print.h"
+
+#define DEMCR        (*(volatile uint32_t *)0xE000EDFC)
+#define DWT_CTRL     (*(volatile uint32_t *)0xE0001000)
+#define DWT_CYCCNT   (*(volatile uint32_t *)0xE0001004)
+#define SCB_VTOR     (*(volatile uint32_t *)0xE000ED08)
+#define SYSTICK_RVR  (*(volatile uint32_t *)0xE000E014)
+#define SYSTICK_CVR  (*(volatile uint32_t *)0xE000E018)
+
+#define DEMCR_TRCENA        (1U << 24)
+#define DWT_CTRL_CYCCNTENA  (1U << 0)
+
+#define EXCEPTION_SYSTICK   15
+#define EXCEPTION_IRQ0      16
+
+// Interrupts can only nest as deep as there are priority levels.
+#define PROFILE_THREADX_NESTING 16
+
+// Marks that no thread is running, so cycles are idle.
+#define PROFILE_THREADX_IDLE (PROFILE_THREADX_THREADS + 1)
+
+VOID _tx_execution_initialize(VOID);
+VOID _tx_execution_thread_enter(VOID);
+VOID _tx_execution_thread_exit(VOID);
+VOID _tx_execution_isr_enter(VOID);
+VOID _tx_execution_isr_exit(VOID);
+
+typedef void (*profile_threadx_vector)(void);
+
+// The vector table must be aligned to a power of two at least its size.
+static profile_threadx_vector profile_vectors[PROFILE_THREADX_VECTORS] __attribute__((aligned(512)));
+static profile_threadx_vector profile_handlers[PROFILE_THREADX_VECTORS];
+
+static profile_threadx_stats profile = { 0 };
+
+static uint32_t profile_last   = 0;
+static uint32_t profile_start  = 0;
+static uint32_t profile_run    = 0;
+static unsigned profile_thread = PROFILE_THREADX_IDLE;
+
+static unsigned profile_nesting = 0;
+static uint8_t  profile_isr[PROFILE_THREADX_NESTING];
+static uint32_t profile_isr_entry[PROFILE_THREADX_NESTING];
+
+static inline uint32_t profile_threadx_ipsr(void)
+{
+    uint32_t ipsr;
+    __asm__ volatile ("mrs %0, ipsr" : "=r" (ipsr));
+    return (ipsr & 0x1FF);
+}
+
+// Charges the cycles since the last change to whatever was running.
+static uint32_t profile_threadx_charge(void)
+{
+    uint32_t now   = DWT_CYCCNT;
+    uint32_t delta = (now - profile_last);
+    profile_last = now;
+
+    if (profile_nesting > 0) {
+        profile.isrs[profile_isr[profile_nesting - 1]].cycles += delta;
+    } else if (profile_thread != PROFILE_THREADX_IDLE) {
+        profile.threads[profile_thread].cycles += delta;
+    } else {
+        profile.idle += delta;
+    }
+    return now;
+}
+
+static unsigned profile_threadx_slot(TX_THREAD *thread)
+{
+    unsigned i;
+    for (i = 0; i < PROFILE_THREADX_THREADS; i++) {
+        if (profile.threads[i].thread == thread) {
+            return i;
+        }
+        if (profile.threads[i].thread == TX_NULL) {
+            profile.threads[i].thread = thread;
+            return i;
+        }
+    }
+    return PROFILE_THREADX_THREADS;
+}
+
+static void profile_threadx_irq(void)
+{
+    _tx_execution_isr_enter();
+    profile_handlers[profile_threadx_ipsr()]();
+    _tx_execution_isr_exit();
+}
+
+VOID _tx_execution_initialize(VOID)
+{
+    DEMCR    |= DEMCR_TRCENA;
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+
+    profile_last  = DWT_CYCCNT;
+    profile_start = profile_last;
+
+    // Exceptions are left alone, as SysTick already calls the hooks and the
+    // rest either belong to ThreadX or never return.
+    const profile_threadx_vector *table = (const profile_threadx_vector *)SCB_VTOR;
+    unsigned i;
+    for (i = 0; i < PROFILE_THREADX_VECTORS; i++) {
+        profile_handlers[i] = table[i];
+        profile_vectors[i]  = (((i >= EXCEPTION_IRQ0) && (table[i] != NULL))
+                               ? profile_threadx_irq : table[i]);
+    }
+
+    __asm__ volatile ("dsb");
+    SCB_VTOR = (uint32_t)profile_vectors;
+    __asm__ volatile ("dsb\n\tisb");
+}
+
+VOID _tx_execution_thread_enter(VOID)
+{
+    TX_INTERRUPT_SAVE_AREA
+
+    TX_DISABLE
+    profile_run = profile_threadx_charge();
+
+    profile_thread = profile_threadx_slot(_tx_thread_current_ptr);
+    profile.threads[profile_thread].switches++;
+    profile.switches++;
+    TX_RESTORE
+}
+
+VOID _tx_execution_thread_exit(VOID)
+{
+    TX_INTERRUPT_SAVE_AREA
+
+    TX_DISABLE
+    uint32_t now = profile_threadx_charge();
+
+    if (profile_thread != PROFILE_THREADX_IDLE) {
+        uint32_t run = (now - profile_run);
+        if (run > profile.threads[profile_thread].max_run) {
+            profile.threads[profile_thread].max_run = run;
+        }
+        profile_thread = PROFILE_THREADX_IDLE;
+    }
+    TX_RESTORE
+}
+
+VOID _tx_execution_isr_enter(VOID)
+{
+    TX_INTERRUPT_SAVE_AREA
+
+    TX_DISABLE
+    uint32_t now       = profile_threadx_charge();
+    uint32_t exception = profile_threadx_ipsr();
+
+    if (exception == EXCEPTION_SYSTICK) {
+        // SysTick counts down from its reload value, which it reached as the
+        // tick happened.
+        uint32_t latency = (SYSTICK_RVR - SYSTICK_CVR);
+        if (latency > profile.tick_latency_max) {
+            profile.tick_latency_max = latency;
+        }
+    }
+
+    if ((exception < PROFILE_THREADX_VECTORS) && (profile_nesting < PROFILE_THREADX_NESTING)) {
+        profile.isrs[exception].count++;
+        profile_isr[profile_nesting]       = exception;
+        profile_isr_entry[profile_nesting] = now;
+        profile_nesting++;
+    }
+    TX_RESTORE
+}
+
+VOID _tx_execution_isr_exit(VOID)
+{
+    TX_INTERRUPT_SAVE_AREA
+
+    TX_DISABLE
+    uint32_t now = profile_threadx_charge();
+
+    if (profile_nesting > 0) {
+        profile_nesting--;
+        profile_threadx_isr *isr = &profile.isrs[profile_isr[profile_nesting]];
+        uint32_t duration = (now - profile_isr_entry[profile_nesting]);
+        if (duration > isr->max) {
+            isr->max = duration;
+        }
+    }
+    TX_RESTORE
+}
+
+void profile_threadx_stats_get(profile_threadx_stats *stats, bool reset)
+{
+    TX_INTERRUPT_SAVE_AREA
+
+    TX_DISABLE
+    uint32_t now = profile_threadx_charge();
+    profile.cycles += (now - profile_start);
+    profile_start = now;
+
+    unsigned i;
+    for (i = 0; i < PROFILE_THREADX_THREADS; i++) {
+        TX_THREAD *thread = profile.threads[i].thread;
+        if (thread != TX_NULL) {
+            profile.threads[i].name     = thread->tx_thread_name;
+            profile.threads[i].priority = thread->tx_thread_priority;
+        }
+    }
+
+    if (stats != NULL) {
+        __builtin_memcpy(stats, &profile, sizeof(profile));
+    }
+
+    if (reset) {
+        // Only the running thread is known to still exist.
+        TX_THREAD *current = TX_NULL;
+        if (profile_thread < PROFILE_THREADX_THREADS) {
+            current = profile.threads[profile_thread].thread;
+        }
+
+        __builtin_memset(&profile, 0, sizeof(profile));
+        if (current != TX_NULL) {
+            profile.threads[0].thread = current;
+            profile_thread = 0;
+        }
+        profile_run = now;
+        for (i = 0; i < profile_nesting; i++) {
+            profile_isr_entry[i] = now;
+        }
+    }
+    TX_RESTORE
+}
+
+static void profile_threadx_percent(UART *debug, uint64_t cycles, uint64_t total)
+{
+    uint32_t permille = (total > 0 ? (uint32_t)((cycles * 1000) / total) : 0);
+    UART_Printf(debug, "%3lu.%lu%%", (unsigned long)(permille / 10), (unsigned long)(permille % 10));
+}
+
+void profile_threadx_stats_print(const profile_threadx_stats *stats, UART *debug)
+{
+    unsigned long ms = 0;
+    unsigned freq = CPUFreq_Get();
+    if (freq >= 1000) {
+        ms = (unsigned long)(stats->cycles / (freq / 1000));
+    }
+
+    UART_Printf(debug, "           profile over %lu ms, %lu context switches, max tick latency %lu cycles\r\n",
+                ms, (unsigned long)stats->switches, (unsigned long)stats->tick_latency_max);
+
+    UART_Print(debug, "           idle:                          ");
+    profile_threadx_percent(debug, stats->idle, stats->cycles);
+    UART_Print(debug, "\r\n");
+
+    unsigned i;
+    for (i = 0; i <= PROFILE_THREADX_THREADS; i++) {
+        const profile_threadx_thread *thread = &stats->threads[i];
+        if ((thread->thread == TX_NULL) && (thread->switches == 0)) {
+            continue;
+        }
+
+        UART_Printf(debug, "           %-16s (priority %2lu):  ",
+                    (thread->thread != TX_NULL ? thread->name : "other threads"),
+                    (unsigned long)thread->priority);
+        profile_threadx_percent(debug, thread->cycles, stats->cycles);
+        UART_Printf(debug, ", %lu switches, longest run %lu cycles\r\n",
+                    (unsigned long)thread->switches, (unsigned long)thread->max_run);
+    }
+
+    for (i = 0; i < PROFILE_THREADX_VECTORS; i++) {
+        const profile_threadx_isr *isr = &stats->isrs[i];
+        if (isr->count == 0) {
+            continue;
+        }
+
+        if (i < EXCEPTION_IRQ0) {
+            UART_Printf(debug, "           exception %-3u %10lu calls:    ", i, (unsigned long)isr->count);
+        } else {
+            UART_Printf(debug, "           IRQ %-3u       %10lu calls:    ", (i - EXCEPTION_IRQ0), (unsigned long)isr->count);
+        }
+        profile_threadx_percent(debug, isr->cycles, stats->cycles);
+        UART_Printf(debug, ", longest %lu cycles\r\n", (unsigned long)isr->max);
+    }
+}
@@ -0,0 +1,66 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef PROFILE_THREADX_H_
+#define PROFILE_THREADX_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "tx_api.h"
+#include "lib/UART.h"
+
+// Accounts for where the CPU's cycles go, counting them with the DWT cycle
+// counter as ThreadX switches between threads, interrupts and idle.
+//
+// With TX_ENABLE_EXECUTION_CHANGE_NOTIFY defined, ThreadX calls the execution
+// profile hooks which are provided here: _tx_execution_initialize() as the
+// kernel is entered, _tx_execution_thread_enter() and
+// _tx_execution_thread_exit() from PendSV as threads are switched in and out,
+// and _tx_execution_isr_enter() and _tx_execution_isr_exit() around the
+// SysTick handler in tx_initialize_low_level.S. So that every other interrupt
+// is seen too, the vector table is copied at initialisation and each of its
+// interrupts is routed through a handler which calls the ISR hooks around the
+// original.
+//
+// Cycles are charged to exactly one of the running thread, the innermost
+// interrupt or idle, so an interrupt's cycles don't include the interrupts
+// which preempted it, while its longest run does. The SysTick latency is the
+// time from the tick to its handler starting, which shows how long interrupts
+// are being held off for.
+
+// This is the number of threads tracked separately, any more being lumped
+// together in a last entry with a NULL thread.
+#define PROFILE_THREADX_THREADS 16
+
+// This is the number of exceptions and interrupts, indexed by exception number.
+#define PROFILE_THREADX_VECTORS (16 + 100)
+
+typedef struct {
+    TX_THREAD *thread;
+    CHAR      *name;
+    UINT       priority;
+    ULONG      switches; // Times switched in.
+    uint32_t   max_run;  // Longest time between being switched in and out.
+    uint64_t   cycles;
+} profile_threadx_thread;
+
+typedef struct {
+    ULONG    count;
+    uint32_t max;        // Longest time from entry to exit.
+    uint64_t cycles;
+} profile_threadx_isr;
+
+typedef struct {
+    uint64_t               cycles;      // Since the last reset.
+    uint64_t               idle;
+    ULONG                  switches;
+    uint32_t               tick_latency_max;
+    profile_threadx_thread threads[PROFILE_THREADX_THREADS + 1];
+    profile_threadx_isr    isrs[PROFILE_THREADX_VECTORS];
+} profile_threadx_stats;
+
+void profile_threadx_stats_get(profile_threadx_stats *stats, bool reset);
+void profile_threadx_stats_print(const profile_threadx_stats *stats, UART *debug);
+
+#endif // #ifndef PROFILE_THREADX_H_
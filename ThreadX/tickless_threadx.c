@@ -0,0 +1,139 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "tickless_threadx.h"
+#include "tx_timer.h"
+
+#define SYSTICK_CSR  (*(volatile uint32_t *)0xE000E010)
+#define SYSTICK_RVR  (*(volatile uint32_t *)0xE000E014)
+#define SYSTICK_CVR  (*(volatile uint32_t *)0xE000E018)
+#define SCB_ICSR     (*(volatile uint32_t *)0xE000ED04)
+
+#define SYSTICK_CSR_STOP      0x4
+#define SYSTICK_CSR_RUN       0x7
+#define SYSTICK_CSR_COUNTFLAG (1U << 16)
+#define SYSTICK_MAX           0x01000000
+#define SCB_ICSR_PENDSTCLR    (1U << 25)
+
+// Don't stretch a tick which is about to end, as it could end before SysTick
+// has been stopped.
+#define TICKLESS_MARGIN 256
+
+VOID tx_low_power_enter(VOID);
+VOID tx_low_power_exit(VOID);
+
+// Cycles in one tick, taken from the reload value set up by
+// _tx_initialize_low_level.
+static uint32_t tick_cycles = 0;
+
+// Length of the current sleep in cycles, or zero when not sleeping, and how
+// far into its tick the sleep began.
+static uint32_t sleep_cycles = 0;
+static uint32_t sleep_phase  = 0;
+
+static ULONG stats_sleeps        = 0;
+static ULONG stats_ticks_skipped = 0;
+
+// Returns which of the next max ticks is the first with work for ThreadX.
+static ULONG tickless_threadx_next(ULONG max)
+{
+    if ((_tx_timer_time_slice != 0) && (_tx_timer_time_slice < max)) {
+        max = _tx_timer_time_slice;
+    }
+
+    // Each tick looks at the timer list entry under the current pointer, and
+    // only moves on from entries which are empty.
+    TX_TIMER_INTERNAL **entry = _tx_timer_current_ptr;
+    ULONG ticks;
+    for (ticks = 1; ticks < max; ticks++) {
+        if (*entry != TX_NULL) {
+            break;
+        }
+        if (++entry == _tx_timer_list_end) {
+            entry = _tx_timer_list_start;
+        }
+    }
+    return ticks;
+}
+
+// Restarts SysTick so it next fires after cycles, then on every tick as before.
+static void tickless_threadx_restart(uint32_t cycles)
+{
+    SYSTICK_CSR = SYSTICK_CSR_STOP;
+    SYSTICK_RVR = (cycles - 1);
+    SYSTICK_CVR = 0;
+    SYSTICK_CSR = SYSTICK_CSR_RUN;
+
+    // The counter has already loaded, so this only applies from the next tick.
+    SYSTICK_RVR = (tick_cycles - 1);
+}
+
+VOID tx_low_power_enter(VOID)
+{
+    if (tick_cycles == 0) {
+        tick_cycles = (SYSTICK_RVR + 1);
+    }
+
+    // Interrupts are disabled here, so the remainder of this tick is safe to use.
+    uint32_t remaining = SYSTICK_CVR;
+    if ((remaining < TICKLESS_MARGIN) || (SYSTICK_CSR & SYSTICK_CSR_COUNTFLAG)) {
+        return;
+    }
+
+    ULONG ticks = tickless_threadx_next(((SYSTICK_MAX - remaining) / tick_cycles) + 1);
+    if (ticks <= 1) {
+        return;
+    }
+
+    sleep_phase  = (tick_cycles - remaining);
+    sleep_cycles = (remaining + ((ticks - 1) * tick_cycles));
+    tickless_threadx_restart(sleep_cycles);
+}
+
+VOID tx_low_power_exit(VOID)
+{
+    if (sleep_cycles == 0) {
+        return;
+    }
+
+    uint32_t csr = SYSTICK_CSR;
+    uint32_t cvr = SYSTICK_CVR;
+
+    // Once the sleep ran out the counter reloaded with tick_cycles.
+    uint32_t elapsed;
+    if (csr & SYSTICK_CSR_COUNTFLAG) {
+        elapsed = (sleep_cycles + (tick_cycles - 1 - cvr));
+    } else {
+        elapsed = (sleep_cycles - 1 - cvr);
+    }
+    elapsed += sleep_phase;
+    sleep_cycles = 0;
+
+    // Account for every tick, including the one which woke us, here.
+    ULONG ticks = (elapsed / tick_cycles);
+    tickless_threadx_restart(tick_cycles - (elapsed % tick_cycles));
+    SCB_ICSR = SCB_ICSR_PENDSTCLR;
+
+    stats_sleeps++;
+    if (ticks > 1) {
+        stats_ticks_skipped += (ticks - 1);
+    }
+
+    while (ticks-- > 0) {
+        _tx_timer_interrupt();
+    }
+}
+
+void tickless_threadx_stats(ULONG *sleeps, ULONG *ticks_skipped)
+{
+    TX_INTERRUPT_SAVE_AREA
+
+    TX_DISABLE
+    if (sleeps != TX_NULL) {
+        *sleeps = stats_sleeps;
+    }
+    if (ticks_skipped != TX_NULL) {
+        *ticks_skipped = stats_ticks_skipped;
+    }
+    TX_RESTORE
+}
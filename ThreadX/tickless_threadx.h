@@ -0,0 +1,25 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef TICKLESS_THREADX_H_
+#define TICKLESS_THREADX_H_
+
+#include "tx_api.h"
+
+// Stops SysTick from waking the core on ticks where ThreadX has nothing to do.
+//
+// With TX_LOW_POWER and TX_ENABLE_WFI defined, the Cortex-M4 port calls
+// tx_low_power_enter() and tx_low_power_exit() around the wfi in its idle
+// loop. On entry the timer list is checked for the next tick which has work,
+// either a timer expiring or a time slice ending, and SysTick is stretched to
+// fire then, as far as its 24-bit counter allows. On exit, whether woken by
+// SysTick or another interrupt, the ticks which passed are handed to ThreadX
+// and SysTick is put back in phase with the original tick. The few cycles
+// spent restarting SysTick aren't made up, so time drifts very slightly with
+// each long sleep.
+
+// Counts how often the core slept for more than one tick, and the SysTick
+// interrupts which didn't happen as a result.
+void tickless_threadx_stats(ULONG *sleeps, ULONG *ticks_skipped);
+
+#endif // #ifndef TICKLESS_THREADX_H_
@@ -1,15 +1,22 @@
 /* This is a small demo of the high-performance ThreadX kernel.  It includes examples of eight
    threads of different priorities, using a message queue, semaphore, mutex, event flags group, 
-   byte pool, and block pool.  */
+   and block pools.  */
 
 #include "tx_api.h"
 #include "lib/Print.h"
+#include "pool_threadx.h"
+#ifdef THREADX_TICKLESS
+#include "tickless_threadx.h"
+#endif
+#ifdef THREADX_PROFILE
+#include "profile_threadx.h"
+#endif
 
 extern UART* debug;
 
 #define DEMO_STACK_SIZE         1024
-#define DEMO_BYTE_POOL_SIZE     9120
-#define DEMO_BLOCK_POOL_SIZE    100
+#define DEMO_STACK_COUNT        8
+#define DEMO_BLOCK_POOL_COUNT   12
 #define DEMO_QUEUE_SIZE         100
 
 
@@ -27,9 +34,15 @@ TX_QUEUE                queue_0;
 TX_SEMAPHORE            semaphore_0;
 TX_MUTEX                mutex_0;
 TX_EVENT_FLAGS_GROUP    event_flags_0;
-TX_BYTE_POOL            byte_pool_0;
-TX_BLOCK_POOL           block_pool_0;
-UCHAR                   memory_area[DEMO_BYTE_POOL_SIZE];
+pool_threadx            stack_pool;
+pool_threadx            block_pool_0;
+
+
+/* Define the memory for the pools and the queue, sized at compile time.  */
+
+ULONG                   stack_area[POOL_THREADX_AREA(DEMO_STACK_SIZE, DEMO_STACK_COUNT)];
+ULONG                   block_pool_area[POOL_THREADX_AREA(sizeof(ULONG), DEMO_BLOCK_POOL_COUNT)];
+ULONG                   queue_area[DEMO_QUEUE_SIZE];
 
 
 /* Define the counters used in the demo application...  */
@@ -74,14 +87,14 @@ void    tx_application_define(void *first_unused_memory)
 CHAR    *pointer;
 
 
-    /* Create a byte memory pool from which to allocate the thread stacks.  */
-    tx_byte_pool_create(&byte_pool_0, "byte pool 0", memory_area, DEMO_BYTE_POOL_SIZE);
+    /* Create a block memory pool from which to allocate the thread stacks.  */
+    pool_threadx_create(&stack_pool, "stack pool", DEMO_STACK_SIZE, stack_area, sizeof(stack_area));
 
     /* Put system definition stuff in here, e.g. thread creates and other assorted
        create information.  */
 
     /* Allocate the stack for thread 0.  */
-    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    pointer = pool_threadx_allocate(&stack_pool);
 
     /* Create the main thread.  */
     tx_thread_create(&thread_0, "thread 0", thread_0_entry, 0,  
@@ -90,7 +103,7 @@ CHAR    *pointer;
 
 
     /* Allocate the stack for thread 1.  */
-    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    pointer = pool_threadx_allocate(&stack_pool);
 
     /* Create threads 1 and 2. These threads pass information through a ThreadX 
        message queue.  It is also interesting to note that these threads have a time
@@ -100,14 +113,14 @@ CHAR    *pointer;
             16, 16, 4, TX_AUTO_START);
 
     /* Allocate the stack for thread 2.  */
-    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    pointer = pool_threadx_allocate(&stack_pool);
 
     tx_thread_create(&thread_2, "thread 2", thread_2_entry, 2,  
             pointer, DEMO_STACK_SIZE, 
             16, 16, 4, TX_AUTO_START);
 
     /* Allocate the stack for thread 3.  */
-    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    pointer = pool_threadx_allocate(&stack_pool);
 
     /* Create threads 3 and 4.  These threads compete for a ThreadX counting semaphore.  
        An interesting thing here is that both threads share the same instruction area.  */
@@ -116,14 +129,14 @@ CHAR    *pointer;
             8, 8, TX_NO_TIME_SLICE, TX_AUTO_START);
 
     /* Allocate the stack for thread 4.  */
-    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    pointer = pool_threadx_allocate(&stack_pool);
 
     tx_thread_create(&thread_4, "thread 4", thread_3_and_4_entry, 4,  
             pointer, DEMO_STACK_SIZE, 
             8, 8, TX_NO_TIME_SLICE, TX_AUTO_START);
 
     /* Allocate the stack for thread 5.  */
-    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    pointer = pool_threadx_allocate(&stack_pool);
 
     /* Create thread 5.  This thread simply pends on an event flag which will be set
        by thread_0.  */
@@ -132,7 +145,7 @@ CHAR    *pointer;
             4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
 
     /* Allocate the stack for thread 6.  */
-    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    pointer = pool_threadx_allocate(&stack_pool);
 
     /* Create threads 6 and 7.  These threads compete for a ThreadX mutex.  */
     tx_thread_create(&thread_6, "thread 6", thread_6_and_7_entry, 6,  
@@ -140,17 +153,14 @@ CHAR    *pointer;
             8, 8, TX_NO_TIME_SLICE, TX_AUTO_START);
 
     /* Allocate the stack for thread 7.  */
-    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    pointer = pool_threadx_allocate(&stack_pool);
 
     tx_thread_create(&thread_7, "thread 7", thread_6_and_7_entry, 7,  
             pointer, DEMO_STACK_SIZE, 
             8, 8, TX_NO_TIME_SLICE, TX_AUTO_START);
 
-    /* Allocate the message queue.  */
-    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_QUEUE_SIZE*sizeof(ULONG), TX_NO_WAIT);
-
     /* Create the message queue shared by threads 1 and 2.  */
-    tx_queue_create(&queue_0, "queue 0", TX_1_ULONG, pointer, DEMO_QUEUE_SIZE*sizeof(ULONG));
+    tx_queue_create(&queue_0, "queue 0", TX_1_ULONG, queue_area, sizeof(queue_area));
 
     /* Create the semaphore used by threads 3 and 4.  */
     tx_semaphore_create(&semaphore_0, "semaphore 0", 1);
@@ -161,17 +171,14 @@ CHAR    *pointer;
     /* Create the mutex used by thread 6 and 7 without priority inheritance.  */
     tx_mutex_create(&mutex_0, "mutex 0", TX_NO_INHERIT);
 
-    /* Allocate the memory for a small block pool.  */
-    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_BLOCK_POOL_SIZE, TX_NO_WAIT);
-
     /* Create a block memory pool to allocate a message buffer from.  */
-    tx_block_pool_create(&block_pool_0, "block pool 0", sizeof(ULONG), pointer, DEMO_BLOCK_POOL_SIZE);
+    pool_threadx_create(&block_pool_0, "block pool 0", sizeof(ULONG), block_pool_area, sizeof(block_pool_area));
 
     /* Allocate a block and release the block memory.  */
-    tx_block_allocate(&block_pool_0, (VOID **) &pointer, TX_NO_WAIT);
+    pointer = pool_threadx_allocate(&block_pool_0);
 
     /* Release the block back to the pool.  */
-    tx_block_release(pointer);
+    pool_threadx_release(&block_pool_0, pointer);
 }
 
 
@@ -202,6 +209,19 @@ UINT    status;
             UART_Printf(debug, "           thread 5 events received:      %lu\r\n", thread_5_counter);
             UART_Printf(debug, "           thread 6 mutex obtained:       %lu\r\n", thread_6_counter);
             UART_Printf(debug, "           thread 7 mutex obtained:       %lu\r\n", thread_7_counter);
+#ifdef THREADX_TICKLESS
+            ULONG sleeps, ticks_skipped;
+            tickless_threadx_stats(&sleeps, &ticks_skipped);
+            UART_Printf(debug, "           idle sleeps:                   %lu\r\n", sleeps);
+            UART_Printf(debug, "           ticks skipped:                 %lu\r\n", ticks_skipped);
+#endif
+            pool_threadx_report(debug);
+#ifdef THREADX_PROFILE
+            /* Each report covers the time since the last.  */
+            static profile_threadx_stats profile_stats;
+            profile_threadx_stats_get(&profile_stats, true);
+            profile_threadx_stats_print(&profile_stats, debug);
+#endif
         }
 
         /* Sleep for 10 ticks.  */
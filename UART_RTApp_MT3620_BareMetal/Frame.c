@@ -0,0 +1,257 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#include "Frame.h"
+#include <stddef.h>
+
+// This is the maximum number of receivers which can be opened at once.
+#define FRAME_MAX 1
+
+#define FRAME_DELIMITER 0x00
+
+struct Frame_Receiver {
+    uint8_t       *buffer;
+    uintptr_t      size;
+    Frame_Handler  handler;
+    void          *context;
+
+    // Bytes held, of which those before scanned have been searched for a
+    // delimiter. While discarding, everything up to the next delimiter is
+    // dropped.
+    uintptr_t      length;
+    uintptr_t      scanned;
+    bool           discard;
+
+    Frame_Stats    stats;
+};
+
+// CRC16-CCITT (polynomial 0x1021) of each value of the top nibble.
+static const uint16_t Frame__Crc16Table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+static uint16_t Frame__Crc16(const uint8_t *data, uintptr_t size)
+{
+    uint16_t crc = 0xFFFF;
+    uintptr_t i;
+    for (i = 0; i < size; i++) {
+        crc = (crc << 4) ^ Frame__Crc16Table[(crc >> 12) ^ (data[i] >> 4)];
+        crc = (crc << 4) ^ Frame__Crc16Table[(crc >> 12) ^ (data[i] & 0xF)];
+    }
+    return crc;
+}
+
+Frame_Receiver *Frame_Open(uint8_t *buffer, uintptr_t size, Frame_Handler handler, void *context)
+{
+    if (!buffer || (size < FRAME_ENCODED_SIZE(0)) || !handler) {
+        return NULL;
+    }
+
+    static Frame_Receiver Handles[FRAME_MAX] = {0};
+    Frame_Receiver *receiver = NULL;
+    unsigned h;
+    for (h = 0; h < FRAME_MAX; h++) {
+        if (!Handles[h].buffer) {
+            receiver = &Handles[h];
+            break;
+        }
+    }
+    if (!receiver) {
+        return NULL;
+    }
+
+    *receiver = (Frame_Receiver){0};
+    receiver->buffer  = buffer;
+    receiver->size    = size;
+    receiver->handler = handler;
+    receiver->context = context;
+    return receiver;
+}
+
+void Frame_Close(Frame_Receiver *receiver)
+{
+    if (receiver) {
+        receiver->buffer = NULL;
+    }
+}
+
+// Decodes size bytes of COBS in place, without the delimiter, returning false
+// if they aren't valid.
+static bool Frame__Decode(uint8_t *data, uintptr_t size, uintptr_t *decoded)
+{
+    uintptr_t in = 0, out = 0;
+    while (in < size) {
+        uint8_t   code  = data[in++];
+        uintptr_t count = (code - 1U);
+        if (count > (size - in)) {
+            return false;
+        }
+
+        // The output never catches up with the input, so this only ever
+        // moves bytes towards the start.
+        __builtin_memmove(&data[out], &data[in], count);
+        out += count;
+        in  += count;
+
+        // Each group but the last, and those of 254 bytes, ended in a zero.
+        if ((code != 0xFF) && (in < size)) {
+            data[out++] = 0x00;
+        }
+    }
+
+    *decoded = out;
+    return true;
+}
+
+static void Frame__Handle(Frame_Receiver *receiver, uint8_t *data, uintptr_t size)
+{
+    // Back to back delimiters may be sent to flush out a partial frame.
+    if (size == 0) {
+        return;
+    }
+
+    uintptr_t decoded;
+    if (!Frame__Decode(data, size, &decoded) || (decoded < FRAME_CRC_SIZE)) {
+        receiver->stats.invalid++;
+        return;
+    }
+
+    uintptr_t payload = (decoded - FRAME_CRC_SIZE);
+    uint16_t  crc     = (data[payload] | (data[payload + 1] << 8));
+    if (Frame__Crc16(data, payload) != crc) {
+        receiver->stats.crcErrors++;
+        return;
+    }
+
+    receiver->stats.frames++;
+    receiver->handler(data, payload, receiver->context);
+}
+
+static void Frame__Scan(Frame_Receiver *receiver)
+{
+    uint8_t  *buffer = receiver->buffer;
+    uintptr_t start  = 0;
+    uintptr_t i;
+    for (i = receiver->scanned; i < receiver->length; i++) {
+        if (buffer[i] != FRAME_DELIMITER) {
+            continue;
+        }
+
+        if (receiver->discard) {
+            receiver->discard = false;
+        } else {
+            Frame__Handle(receiver, &buffer[start], (i - start));
+        }
+        start = (i + 1);
+    }
+
+    if (receiver->discard) {
+        start = receiver->length;
+    }
+
+    // Only the partial frame left at the end is moved.
+    uintptr_t remaining = (receiver->length - start);
+    if ((start > 0) && (remaining > 0)) {
+        __builtin_memmove(buffer, &buffer[start], remaining);
+    }
+    receiver->length  = remaining;
+    receiver->scanned = remaining;
+}
+
+bool Frame_Receive(Frame_Receiver *receiver, UART *uart)
+{
+    if (!receiver || !receiver->buffer) {
+        return false;
+    }
+
+    uintptr_t avail;
+    while ((avail = UART_ReadAvailable(uart)) > 0) {
+        // A frame filling the whole buffer can't be handled, so is dropped up
+        // to its delimiter.
+        if (receiver->length == receiver->size) {
+            receiver->stats.overflows++;
+            receiver->discard = true;
+            receiver->length  = 0;
+            receiver->scanned = 0;
+        }
+
+        uintptr_t space = (receiver->size - receiver->length);
+        if (avail > space) {
+            avail = space;
+        }
+        if (UART_Read(uart, &receiver->buffer[receiver->length], avail) != ERROR_NONE) {
+            return false;
+        }
+        receiver->length += avail;
+
+        Frame__Scan(receiver);
+    }
+
+    return true;
+}
+
+void Frame_Idle(Frame_Receiver *receiver)
+{
+    if (!receiver || !receiver->buffer) {
+        return;
+    }
+
+    if (receiver->length > 0) {
+        receiver->stats.idle++;
+    }
+    receiver->length  = 0;
+    receiver->scanned = 0;
+    receiver->discard = false;
+}
+
+void Frame_GetStats(Frame_Receiver *receiver, Frame_Stats *stats, bool reset)
+{
+    if (!receiver) {
+        return;
+    }
+
+    if (stats) {
+        *stats = receiver->stats;
+    }
+    if (reset) {
+        receiver->stats = (Frame_Stats){0};
+    }
+}
+
+uintptr_t Frame_Encode(const void *payload, uintptr_t size, uint8_t *out, uintptr_t outSize)
+{
+    if ((!payload && (size > 0)) || !out || (outSize < FRAME_ENCODED_SIZE(size))) {
+        return 0;
+    }
+
+    const uint8_t *data = payload;
+    uint16_t crc = Frame__Crc16(data, size);
+    uint8_t  tail[FRAME_CRC_SIZE] = { (uint8_t)crc, (uint8_t)(crc >> 8) };
+
+    // Each group's code is written once its length is known.
+    uintptr_t codeIndex = 0;
+    uintptr_t o         = 1;
+    uint8_t   code      = 1;
+    uintptr_t i;
+    for (i = 0; i < (size + FRAME_CRC_SIZE); i++) {
+        uint8_t byte = ((i < size) ? data[i] : tail[i - size]);
+        if (byte == 0x00) {
+            out[codeIndex] = code;
+            codeIndex = o++;
+            code      = 1;
+            continue;
+        }
+
+        out[o++] = byte;
+        if (++code == 0xFF) {
+            out[codeIndex] = code;
+            codeIndex = o++;
+            code      = 1;
+        }
+    }
+    out[codeIndex] = code;
+    out[o++] = FRAME_DELIMITER;
+
+    return o;
+}
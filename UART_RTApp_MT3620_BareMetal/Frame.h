@@ -0,0 +1,74 @@
+/* Copyright (c) Codethink Ltd. All rights reserved.
+   Licensed under the MIT License. */
+
+#ifndef FRAME_H_
+#define FRAME_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lib/UART.h"
+
+// Frames binary messages on a UART with COBS, so each frame is delimited by
+// the only zero byte in it, and checks each with a CRC16-CCITT appended to the
+// payload before it's encoded.
+//
+// Bytes are read from the UART driver straight into the receiver's buffer,
+// which persists between reads, and each frame is decoded in place as its
+// delimiter arrives, COBS never decoding to more than it was encoded from.
+// The handler is given the payload where it lies in the buffer, valid until
+// the handler returns, so nothing is copied after the read. Only the start of
+// a frame which hasn't ended yet is moved, to the front of the buffer, once
+// the frames before it have been handled.
+//
+// Frames which don't fit in the buffer, don't decode or fail their CRC are
+// dropped and counted, the receiver picking up again at the next delimiter.
+// Frame_Idle() drops a partial frame once the line has gone quiet, so that a
+// frame whose end was lost isn't run into the next.
+//
+//     static uint8_t rxBuffer[1024];
+//     receiver = Frame_Open(rxBuffer, sizeof(rxBuffer), HandleFrame, NULL);
+//
+//     // On each receive interrupt, deferred to the main loop.
+//     Frame_Receive(receiver, uart);
+
+#define FRAME_CRC_SIZE 2
+
+// Largest encoded size of a payload of size bytes, with its CRC and delimiter.
+#define FRAME_ENCODED_SIZE(size) \
+    ((size) + FRAME_CRC_SIZE + ((((size) + FRAME_CRC_SIZE) / 254) + 1) + 1)
+
+typedef struct Frame_Receiver Frame_Receiver;
+
+typedef struct {
+    uint32_t frames;     // Frames handled.
+    uint32_t overflows;  // Frames too long for the buffer.
+    uint32_t invalid;    // Frames which didn't decode, or were too short.
+    uint32_t crcErrors;  // Frames which failed their CRC.
+    uint32_t idle;       // Partial frames dropped by Frame_Idle().
+} Frame_Stats;
+
+// Called with the payload of each frame received, which stays valid until it
+// returns.
+typedef void (*Frame_Handler)(const uint8_t *data, uintptr_t size, void *context);
+
+// buffer must hold the longest encoded frame expected, and stays in use until
+// the receiver is closed.
+Frame_Receiver *Frame_Open(uint8_t *buffer, uintptr_t size, Frame_Handler handler, void *context);
+void            Frame_Close(Frame_Receiver *receiver);
+
+// Reads everything available from uart, calling the handler for each frame
+// completed. Returns false if a read fails.
+bool Frame_Receive(Frame_Receiver *receiver, UART *uart);
+
+// Drops any partial frame, to be called once the line has been idle for longer
+// than a frame would pause for.
+void Frame_Idle(Frame_Receiver *receiver);
+
+void Frame_GetStats(Frame_Receiver *receiver, Frame_Stats *stats, bool reset);
+
+// Encodes size bytes of payload into a frame in out, which holds outSize
+// bytes. Returns the size of the frame, or 0 if it may not fit.
+uintptr_t Frame_Encode(const void *payload, uintptr_t size, uint8_t *out, uintptr_t outSize);
+
+#endif // #ifndef FRAME_H_
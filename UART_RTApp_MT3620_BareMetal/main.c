@@ -13,113 +13,101 @@
 #include "lib/UART.h"
 #include "lib/Print.h"
 
+#include "EventQueue.h"
+#include "Scheduler.h"
+#include "Input.h"
+
+#include "Frame.h"
 
 static const int buttonAGpio = 12;
-static const int buttonPressCheckPeriodMs = 10;
-static void HandleButtonTimerIrq(GPT *);
-static void HandleButtonTimerIrqDeferred(void);
+static void HandleButtonDeferred(void *payload);
+
+// The scheduler report is printed this long after each message is sent, once
+// its echo has been received.
+static const uint32_t reportDelayUs = 1000000;
+
+// A frame still incomplete after the line has been quiet this long has lost
+// its end, allowing for the gaps between the driver's receive interrupts.
+static const uint32_t idleUs = 5000;
 
 static UART *driver = NULL;
 static UART *debug  = NULL;
-static GPT *buttonTimeout = NULL;
 
-typedef struct CallbackNode {
-    bool enqueued;
-    struct CallbackNode *next;
-    void (*cb)(void);
-} CallbackNode;
+static Scheduler_Timer reportTimer;
+static Scheduler_Timer idleTimer;
 
-static void EnqueueCallback(CallbackNode *node);
+// Frames are received into this buffer and handled where they lie, so it must
+// hold the longest encoded frame.
+static uint8_t         rxBuffer[1024];
+static Frame_Receiver *receiver = NULL;
 
-static void HandleButtonTimerIrq(GPT *handle)
-{
-    (void)handle;
-    static CallbackNode cbn = {.enqueued = false, .cb = HandleButtonTimerIrqDeferred};
-    EnqueueCallback(&cbn);
-}
+static const char message[] = "RTCore: Hello world!";
+static uint8_t    txBuffer[FRAME_ENCODED_SIZE(sizeof(message) - 1)];
+
+// Each interrupt's work is deferred to the main loop. One pending event covers
+// everything a repeat of the UART interrupt would have, while button presses
+// are handled in the order they happened.
+EVENT_QUEUE_DEFINE_SIGNAL(uartRxEvents, 1);
+EVENT_QUEUE_DEFINE(buttonEvents, Input_Event, 4);
+EVENT_QUEUE_DEFINE_SIGNAL(reportEvents, 1);
+EVENT_QUEUE_DEFINE_SIGNAL(idleEvents, 1);
 
-static void HandleButtonTimerIrqDeferred(void)
+static void HandleButtonDeferred(void *payload)
 {
-    // Assume initial state is high, i.e. button not pressed.
-    static bool prevState = true;
-    bool newState;
-    GPIO_Read(buttonAGpio, &newState);
-
-    if (newState != prevState) {
-        bool pressed = !newState;
-        if (pressed) {
-            UART_Print(driver, "RTCore: Hello world!");
+    const Input_Event *event = payload;
+    if (event->pressed) {
+        uintptr_t size = Frame_Encode(message, (sizeof(message) - 1), txBuffer, sizeof(txBuffer));
+        if (UART_Write(driver, txBuffer, size) != ERROR_NONE) {
+            UART_Print(debug, "ERROR: Failed to send message\r\n");
         }
-
-        prevState = newState;
+        Scheduler_TimerStart(&reportTimer, &reportEvents, NULL, reportDelayUs, 0);
     }
 }
 
-static void HandleUartIsu0RxIrqDeferred(void)
+static void HandleReportDeferred(void *payload)
 {
-    uintptr_t avail = UART_ReadAvailable(driver);
-    if (avail == 0) {
-        UART_Print(debug, "ERROR: UART received interrupt for zero bytes.\r\n");
-        return;
-    }
+    (void)payload;
+    Scheduler_Report(debug, false);
 
-    if (avail >= 65536) {
-        // Avoid handling large amounts of data as this could cause stack issues.
-        UART_Print(debug, "ERROR: UART received too many bytes.\r\n");
-        return;
-    }
+    Frame_Stats stats;
+    Frame_GetStats(receiver, &stats, false);
+    UART_Printf(debug, "Frames: %lu, overflows: %lu, invalid: %lu, CRC errors: %lu, cut off: %lu\r\n",
+        stats.frames, stats.overflows, stats.invalid, stats.crcErrors, stats.idle);
+}
 
-    uint8_t buffer[avail];
-    if (UART_Read(driver, buffer, avail) != ERROR_NONE) {
-        UART_Print(debug, "ERROR: Failed to read ");
-        UART_PrintUInt(debug, avail);
-        UART_Print(debug, " bytes from UART.\r\n");
-        return;
-    }
+static void HandleFrame(const uint8_t *data, uintptr_t size, void *context)
+{
+    (void)context;
 
-    UART_Print(debug, "UART received ");
-    UART_PrintUInt(debug, avail);
-    UART_Print(debug, " bytes: \'");
-    UART_Write(debug, buffer, avail);
+    UART_Printf(debug, "UART received frame of %lu bytes: \'", (uint32_t)size);
+    UART_Write(debug, data, size);
     UART_Print(debug, "\'.\r\n");
 }
 
+static void HandleUartIsu0RxIrqDeferred(void *payload)
+{
+    (void)payload;
 
-static void HandleUartIsu0RxIrq(void) {
-    static CallbackNode cbn = { .enqueued = false, .cb = HandleUartIsu0RxIrqDeferred };
-    EnqueueCallback(&cbn);
-}
+    if (!Frame_Receive(receiver, driver)) {
+        UART_Print(debug, "ERROR: Failed to read from UART.\r\n");
+    }
 
-static CallbackNode *volatile callbacks = NULL;
+    // Restarted by every burst, so only expires once the line goes quiet.
+    Scheduler_TimerStart(&idleTimer, &idleEvents, NULL, idleUs, 0);
+}
 
-static void EnqueueCallback(CallbackNode *node)
+static void HandleIdleDeferred(void *payload)
 {
-    uint32_t prevBasePri = NVIC_BlockIRQs();
-    if (!node->enqueued) {
-        CallbackNode *prevHead = callbacks;
-        node->enqueued = true;
-        callbacks = node;
-        node->next = prevHead;
+    (void)payload;
+
+    // Data may have arrived after the timer expired, restarting it.
+    if (!Scheduler_TimerActive(&idleTimer)) {
+        Frame_Idle(receiver);
     }
-    NVIC_RestoreIRQs(prevBasePri);
 }
 
-static void InvokeCallbacks(void)
-{
-    CallbackNode *node;
-    do {
-        uint32_t prevBasePri = NVIC_BlockIRQs();
-        node = callbacks;
-        if (node) {
-            node->enqueued = false;
-            callbacks = node->next;
-        }
-        NVIC_RestoreIRQs(prevBasePri);
-
-        if (node) {
-            (*node->cb)();
-        }
-    } while (node);
+static void HandleUartIsu0RxIrq(void) {
+    EventQueue_Post(&uartRxEvents, NULL);
 }
 
 _Noreturn void RTCoreMain(void)
@@ -132,6 +120,16 @@ _Noreturn void RTCoreMain(void)
     UART_Print(debug, "UART_RTApp_MT3620_BareMetal\r\n");
     UART_Print(debug, "App built on: " __DATE__ " " __TIME__ "\r\n");
 
+    // Received data is handled before button presses.
+    EventQueue_Init(&uartRxEvents, 0, HandleUartIsu0RxIrqDeferred);
+    EventQueue_Init(&buttonEvents, 1, HandleButtonDeferred);
+    EventQueue_Init(&reportEvents, 2, HandleReportDeferred);
+    EventQueue_Init(&idleEvents, 3, HandleIdleDeferred);
+    Scheduler_SetDeadline(&uartRxEvents, 10000);
+    Scheduler_SetDeadline(&buttonEvents, 10000);
+
+    receiver = Frame_Open(rxBuffer, sizeof(rxBuffer), HandleFrame, NULL);
+
     driver = UART_Open(MT3620_UNIT_ISU0, 115200, UART_PARITY_NONE, 1, HandleUartIsu0RxIrq);
     if (!driver) {
         UART_Print(debug, "ERROR: UART initialisation failed\r\n");
@@ -140,21 +138,14 @@ _Noreturn void RTCoreMain(void)
     UART_Print(debug,
         "Install a loopback header on ISU0, and press button A to send a message.\r\n");
 
-    GPIO_ConfigurePinForInput(buttonAGpio);
-
-    // Setup GPT1 to poll for button press
-    if (!(buttonTimeout = GPT_Open(MT3620_UNIT_GPT1, 1000, GPT_MODE_REPEAT))) {
+    // Software timers run on GPT1, such as the one which prints the report.
+    if (!Scheduler_Init(MT3620_UNIT_GPT1, 32768)) {
         UART_Print(debug, "ERROR: Opening timer\r\n");
     }
-    int32_t error;
 
-    if ((error = GPT_StartTimeout(buttonTimeout, buttonPressCheckPeriodMs,
-                                  GPT_UNITS_MILLISEC, &HandleButtonTimerIrq)) != ERROR_NONE) {
-        UART_Printf(debug, "ERROR: Starting timer (%ld)\r\n", error);
+    if (!Input_Open(buttonAGpio, INPUT_EDGE_PRESS, &buttonEvents)) {
+        UART_Print(debug, "ERROR: Configuring button interrupt\r\n");
     }
 
-    for (;;) {
-        __asm__("wfi");
-        InvokeCallbacks();
-    }
+    Scheduler_Run();
 }
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+#  Copyright (c) Codethink Ltd. All rights reserved.
+#  Licensed under the MIT License.
+
+"""Decodes the output of the Log module's LOG_BINARY() records, as captured from
+the debug UART, using the application's ELF file to find the format strings:
+
+    log_decode.py app.out capture.bin
+    log_decode.py app.out /dev/ttyUSB0
+
+Each record is a 0xFF byte, the address of the format string, a count of
+arguments and the arguments, all 32 bit little endian but for the count's
+single byte. Text logged between records is passed through as it is.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+MARK = 0xFF
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+CONVERSION = re.compile(r'%([-+0]*)(\*|\d*)[lhz]*([diuxXocsp%])')
+
+
+def read_sections(path):
+    with open(path, 'rb') as f:
+        elf = f.read()
+
+    if elf[:4] != b'\x7fELF' or elf[4] != 1 or elf[5] != 1:
+        sys.exit('%s: expected a 32 bit little endian ELF file' % path)
+
+    shoff, = struct.unpack_from('<I', elf, 0x20)
+    shentsize, shnum = struct.unpack_from('<HH', elf, 0x2E)
+
+    sections = []
+    for i in range(shnum):
+        (_, kind, flags, addr, offset, size) = struct.unpack_from(
+            '<IIIIII', elf, shoff + (i * shentsize))
+        if (flags & SHF_ALLOC) and kind != SHT_NOBITS and size > 0:
+            sections.append((addr, elf[offset:offset + size]))
+    return sections
+
+
+def read_string(sections, addr):
+    for base, data in sections:
+        if base <= addr < base + len(data):
+            end = data.find(b'\0', addr - base)
+            if end < 0:
+                end = len(data)
+            return data[addr - base:end].decode(errors='replace')
+    return None
+
+
+def format_record(fmt, args):
+    args = list(args)
+
+    def convert(match):
+        flags, width, kind = match.groups()
+        if kind == '%':
+            return '%'
+        if width == '*':
+            width = str(args.pop(0)) if args else ''
+        if not args:
+            return match.group(0)
+
+        value = args.pop(0)
+        if kind in 'di':
+            value -= (1 << 32) if value & (1 << 31) else 0
+            kind = 'd'
+        elif kind == 'u':
+            kind = 'd'
+        elif kind == 'p':
+            return '0x%x' % value
+        elif kind == 's':
+            # Strings aren't logged, only where they were.
+            return '<0x%08x>' % value
+        elif kind == 'c':
+            value = chr(value & 0xFF)
+        return ('%' + flags + width + kind) % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def decode(sections, stream, out):
+    data = b''
+    while True:
+        chunk = stream.read(1)
+        if not chunk:
+            break
+        data += chunk
+
+        while data:
+            mark = data.find(bytes([MARK]))
+            if mark < 0:
+                out.write(data.decode(errors='replace'))
+                data = b''
+                break
+            if mark > 0:
+                out.write(data[:mark].decode(errors='replace'))
+                data = data[mark:]
+
+            if len(data) < 6:
+                break
+            addr, count = struct.unpack_from('<IB', data, 1)
+            size = 6 + (count * 4)
+            if len(data) < size:
+                break
+            args = struct.unpack_from('<%dI' % count, data, 6)
+            data = data[size:]
+
+            fmt = read_string(sections, addr)
+            if fmt is None:
+                out.write('<unknown format 0x%08x%s>\n'
+                          % (addr, ''.join(' %d' % a for a in args)))
+            else:
+                out.write(format_record(fmt, args))
+        out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Decode binary log records from an RTApp.')
+    parser.add_argument('elf', help='the application ELF file')
+    parser.add_argument('input', nargs='?',
+                        help='captured output or serial device, or stdin')
+    args = parser.parse_args()
+
+    sections = read_sections(args.elf)
+    if args.input:
+        with open(args.input, 'rb', buffering=0) as stream:
+            decode(sections, stream, sys.stdout)
+    else:
+        decode(sections, sys.stdin.buffer, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+#  Copyright (c) Codethink Ltd. All rights reserved.
+#  Licensed under the MIT License.
+
+"""Converts an image to the native pixel format of one of the OLED controllers,
+as the bytes of a C array initialiser, so samples can include it into const
+data and send it to the display as it is:
+
+    static const uint8_t image[] = {
+        #include "image.h"
+    };
+
+ssd1306 takes a binary PBM (P4) and emits the vertical addressing order used by
+the SSD1306 sample: for each column, one byte per page of 8 rows with the top
+row in the least significant bit, and white pixels lit.
+
+ssd1331 takes a binary PPM (P6) and emits RGB565 rows, two bytes per pixel
+sent high byte first.
+
+Comments in the image header, such as where it came from, are kept.
+"""
+
+import argparse
+import sys
+
+
+def read_pnm(path, magic):
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    fields = []
+    comments = []
+    pos = 0
+    count = (3 if magic == b'P4' else 4)
+    while len(fields) < count:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            end = data.index(b'\n', pos)
+            comments.append(data[pos + 1:end].decode().strip())
+            pos = end + 1
+            continue
+        start = pos
+        while pos < len(data) and not data[pos:pos + 1].isspace():
+            pos += 1
+        fields.append(data[start:pos])
+    # A single whitespace byte separates the header from the raster.
+    pos += 1
+
+    if fields[0] != magic:
+        sys.exit('%s: expected a %s image' % (path, magic.decode()))
+    width, height = int(fields[1]), int(fields[2])
+    if magic == b'P6' and int(fields[3]) != 255:
+        sys.exit('%s: expected 8 bits per channel' % path)
+
+    stride = (((width + 7) // 8) if magic == b'P4' else (width * 3))
+    raster = data[pos:pos + (stride * height)]
+    if len(raster) != (stride * height):
+        sys.exit('%s: image data is truncated' % path)
+    return width, height, stride, raster, comments
+
+
+def convert_ssd1306(path):
+    width, height, stride, raster, comments = read_pnm(path, b'P4')
+    if (height % 8) != 0:
+        sys.exit('%s: height must be a multiple of 8' % path)
+
+    out = bytearray()
+    for x in range(width):
+        for page in range(height // 8):
+            byte = 0
+            for i in range(8):
+                y = (page * 8) + i
+                # PBM stores black as 1, and the display lights pixels set to 1.
+                if not ((raster[(y * stride) + (x // 8)] >> (7 - (x % 8))) & 1):
+                    byte |= (1 << i)
+            out.append(byte)
+    return out, comments
+
+
+def convert_ssd1331(path):
+    width, height, stride, raster, comments = read_pnm(path, b'P6')
+
+    out = bytearray()
+    for i in range(0, (width * height * 3), 3):
+        r, g, b = raster[i], raster[i + 1], raster[i + 2]
+        pixel = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+        out += bytes(((pixel >> 8), (pixel & 0xFF)))
+    return out, comments
+
+
+CONVERTERS = {
+    'ssd1306': convert_ssd1306,
+    'ssd1331': convert_ssd1331,
+}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert an image to an OLED controller\'s pixel format.')
+    parser.add_argument('format', choices=sorted(CONVERTERS))
+    parser.add_argument('input')
+    parser.add_argument('output')
+    args = parser.parse_args()
+
+    data, comments = CONVERTERS[args.format](args.input)
+
+    with open(args.output, 'w') as f:
+        for comment in comments:
+            f.write('// %s\n' % comment)
+        for i in range(0, len(data), 16):
+            f.write(', '.join('0x%02X' % b for b in data[i:i + 16]) + ',\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+#  Copyright (c) Codethink Ltd. All rights reserved.
+#  Licensed under the MIT License.
+
+"""Generates a gamma corrected table of PWM on times, as the values of a C
+array initialiser, for the PWM sample's sequencer to step through:
+
+    static const uint16_t breathe[] = {
+        #include "breathe.h"
+    };
+
+Each ramp between off and fully on takes the given number of steps, and each
+brightness is raised to the power of gamma before being scaled to the period,
+so that equal steps look equally bright.
+
+breathe ramps up and then back down.
+
+hue is one channel of a colour wheel in six equal phases: fully on, ramping
+down, off for two, ramping up and fully on again. Starting the green and blue
+channels four and two phases into the table respectively, the three channels
+step through every mix of two primaries in turn.
+"""
+
+import argparse
+
+
+def ramp(steps):
+    return [i / steps for i in range(steps)]
+
+
+def breathe(steps):
+    up = ramp(steps)
+    return up + [1.0 - level for level in up]
+
+
+def hue(steps):
+    up = ramp(steps)
+    down = [1.0 - level for level in up]
+    return ([1.0] * steps) + down + ([0.0] * (steps * 2)) + up + ([1.0] * steps)
+
+
+SHAPES = {
+    'breathe': breathe,
+    'hue': hue,
+}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate a table of PWM on times.')
+    parser.add_argument('shape', choices=sorted(SHAPES))
+    parser.add_argument('output')
+    parser.add_argument('--steps', type=int, default=256,
+                        help='steps in each ramp (default: 256)')
+    parser.add_argument('--period', type=int, default=1024,
+                        help='PWM period in counts, the on time of full brightness (default: 1024)')
+    parser.add_argument('--gamma', type=float, default=2.2,
+                        help='gamma of the output (default: 2.2)')
+    args = parser.parse_args()
+
+    if args.steps < 1 or not (0 < args.period <= 0xFFFF):
+        parser.error('steps must be positive, and period fit in 16 bits')
+
+    levels = SHAPES[args.shape](args.steps)
+    table = [round((level ** args.gamma) * args.period) for level in levels]
+
+    with open(args.output, 'w') as f:
+        f.write('// %s, %d steps per ramp, period %d, gamma %g\n'
+                % (args.shape, args.steps, args.period, args.gamma))
+        for i in range(0, len(table), 16):
+            f.write(', '.join('%d' % t for t in table[i:i + 16]) + ',\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+#  Copyright (c) Codethink Ltd. All rights reserved.
+#  Licensed under the MIT License.
+
+"""Reports how much of each of the M4's memories a real-time app uses, from the
+sections of its ELF file, to check that hot code pinned with the macros of
+Placement/Placement.h went to TCM and that what's left of TCM is enough for
+the stack:
+
+    section_report.py I2S_RTApp_MT3620_BareMetal.out
+
+Each allocated section is listed with its address, size and the memory it's
+in, followed by the total of each memory. With --symbols, the functions and
+objects in the .tcm section are listed as well, largest first.
+
+The stack starts at the top of TCM and grows down towards the sections below
+it, so the TCM left over is the most the stack can use.
+"""
+
+import argparse
+import struct
+import sys
+
+# ORIGIN and LENGTH of each memory, as in the drivers' linker script.
+MEMORIES = [
+    ('TCM', 0x00100000, 192 * 1024),
+    ('SYSRAM', 0x22000000, 64 * 1024),
+    ('FLASH', 0x10000000, 1024 * 1024),
+]
+
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+STT_OBJECT = 1
+STT_FUNC = 2
+
+
+class Section:
+    def __init__(self, name, kind, flags, addr, offset, size, link, entsize):
+        self.name = name
+        self.kind = kind
+        self.flags = flags
+        self.addr = addr
+        self.offset = offset
+        self.size = size
+        self.link = link
+        self.entsize = entsize
+
+
+def read_sections(data):
+    if data[:4] != b'\x7fELF' or data[4] != 1 or data[5] != 1:
+        raise ValueError('not a 32-bit little endian ELF file')
+
+    shoff, = struct.unpack_from('<I', data, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from('<HHH', data, 0x2E)
+
+    sections = []
+    for i in range(shnum):
+        (name, kind, flags, addr, offset, size, link, _info, _align,
+         entsize) = struct.unpack_from('<10I', data, shoff + (i * shentsize))
+        sections.append(Section(name, kind, flags, addr, offset, size, link, entsize))
+
+    strings = sections[shstrndx]
+    for section in sections:
+        section.name = c_string(data, strings.offset + section.name)
+    return sections
+
+
+def c_string(data, offset):
+    return data[offset:data.index(b'\0', offset)].decode('ascii', 'replace')
+
+
+def read_symbols(data, sections, within):
+    symbols = []
+    for table in sections:
+        if table.kind != SHT_SYMTAB:
+            continue
+        strings = sections[table.link]
+        for offset in range(table.offset, table.offset + table.size, table.entsize):
+            name, value, size, info, _other, shndx = struct.unpack_from('<IIIBBH', data, offset)
+            if (info & 0xF) not in (STT_FUNC, STT_OBJECT) or size == 0:
+                continue
+            if shndx >= len(sections) or sections[shndx] is not within:
+                continue
+            symbols.append((c_string(data, strings.offset + name), value & ~1, size))
+    return sorted(symbols, key=lambda symbol: (-symbol[2], symbol[0]))
+
+
+def memory_of(addr):
+    for name, origin, length in MEMORIES:
+        if origin <= addr < origin + length:
+            return name
+    return '?'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Report the memory used by each section of an RTApp.')
+    parser.add_argument('elf')
+    parser.add_argument('--symbols', action='store_true',
+                        help='list what was placed in the .tcm section')
+    args = parser.parse_args()
+
+    with open(args.elf, 'rb') as f:
+        data = f.read()
+    try:
+        sections = read_sections(data)
+    except (ValueError, struct.error) as error:
+        sys.exit('{}: {}'.format(args.elf, error))
+
+    allocated = [s for s in sections if (s.flags & SHF_ALLOC) and s.size > 0]
+    allocated.sort(key=lambda s: s.addr)
+
+    print('{:<24} {:>10} {:>8}  {}'.format('Section', 'Address', 'Size', 'Memory'))
+    used = {name: 0 for name, _, _ in MEMORIES}
+    for section in allocated:
+        memory = memory_of(section.addr)
+        used[memory] = used.get(memory, 0) + section.size
+        print('{:<24} 0x{:08x} {:>8}  {}{}'.format(
+            section.name, section.addr, section.size, memory,
+            ' (no load)' if section.kind == SHT_NOBITS else ''))
+
+    print()
+    print('{:<8} {:>8} {:>8} {:>6}'.format('Memory', 'Used', 'Size', ''))
+    for name, _, length in MEMORIES:
+        print('{:<8} {:>8} {:>8} {:>5.1f}%'.format(name, used[name], length,
+                                                    (100.0 * used[name]) / length))
+    tcm_length = MEMORIES[0][2]
+    print('Stack may use up to {} bytes of TCM'.format(max(tcm_length - used['TCM'], 0)))
+
+    if args.symbols:
+        pinned = next((s for s in allocated if s.name == '.tcm'), None)
+        print()
+        if pinned is None:
+            print('Nothing was placed in .tcm')
+            return
+        print('{:<40} {:>10} {:>8}'.format('Pinned in .tcm', 'Address', 'Size'))
+        for name, value, size in read_symbols(data, sections, pinned):
+            print('{:<40} 0x{:08x} {:>8}'.format(name, value, size))
+
+
+if __name__ == '__main__':
+    main()